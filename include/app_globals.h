@@ -185,6 +185,22 @@ void app_request_restart_service();
  */
 bool app_quit_requested();
 
+/**
+ * @brief Register the function that wakes the sleeping main loop
+ *
+ * @param wake Thread-safe, async-signal-safe wake function (nullptr to unregister)
+ */
+void app_set_main_loop_wake(void (*wake)());
+
+/**
+ * @brief Wake the main loop if it is sleeping
+ *
+ * Thread-safe and async-signal-safe. Call after handing the main thread work
+ * it polls for outside the UpdateQueue (e.g. the Moonraker notification queue),
+ * so it is picked up now rather than at the next timer deadline.
+ */
+void app_wake_main_loop();
+
 /**
  * @brief Check if setup wizard is currently active
  * @return true if wizard is running, false otherwise
@@ -8,6 +8,7 @@
 #include "cli_args.h"
 #include "lvgl/lvgl.h"
 #include "main_loop_handler.h"
+#include "main_loop_waiter.h"
 #include "splash_screen_manager.h"
 
 #include <memory>
@@ -95,6 +96,12 @@ class Application {
     void handle_keyboard_shortcuts();
     void process_notifications();
     void check_timeouts();
+    void init_loop_wakeups();
+    void update_input_polling(bool input_ready, uint32_t now);
+    static void on_display_refr_ready(lv_event_t* e);
+    void init_frame_profiler(bool benchmark_mode);
+    void export_frame_trace();
+    static void on_display_profile_event(lv_event_t* e);
 
     // Shutdown
     void shutdown();
@@ -154,6 +161,16 @@ class Application {
     // Main loop timing handler (screenshot, auto-quit, benchmark)
     helix::application::MainLoopHandler m_loop_handler;
 
+    // Idle-aware main loop: sleep until LVGL deadline, input or queued work
+    helix::application::LoopWaiter m_loop_waiter;
+    helix::application::LoopStats m_loop_stats;
+    lv_timer_t* m_input_read_timer = nullptr; ///< Pointer read timer (nullptr = never paused)
+    bool m_input_read_paused = false;
+    uint32_t m_last_input_tick = 0;
+
+    // Frame profiler trace destination (empty = profiler off)
+    std::string m_trace_path;
+
     // State
     bool m_running = false;
     bool m_wizard_active = false;
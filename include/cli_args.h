@@ -114,6 +114,9 @@ struct CliArgs {
     bool memory_report = false; // --memory-report: log memory every 30s
     bool show_memory = false;   // --show-memory: display memory overlay (M key toggle)
 
+    // Frame profiler (see frame_profiler.h)
+    std::string profile_trace_path; // --profile-trace: Chrome trace output (enables profiler)
+
     // Display rotation (passed by watchdog, or CLI override)
     int rotation = 0; // 0, 90, 180, 270 degrees
 
@@ -6,7 +6,8 @@
  * @brief JSON configuration singleton with RFC 6901 pointer syntax accessors
  *
  * @pattern Singleton with template accessors and default fallbacks
- * @threading Main thread only (not thread-safe)
+ * @threading Main thread only (not thread-safe); save() hands a snapshot to a
+ *            background writer (see ConfigSaveCoordinator)
  *
  * @see Friend test access pattern for unit testing
  */
@@ -15,10 +16,14 @@
 
 #include "json_fwd.h"
 
+#include <cstdint>
+#include <memory>
 #include <string>
 
 namespace helix {
 
+class ConfigSaveCoordinator;
+
 /**
  * @brief Configuration for a user-customizable macro button
  *
@@ -60,6 +65,10 @@ class Config {
   private:
     static Config* instance;
     std::string path;
+    std::unique_ptr<ConfigSaveCoordinator> saver_;
+
+    /// Report a failed background write of the current file (main thread)
+    bool report_save_error();
 
   protected:
     json data;
@@ -79,6 +88,7 @@ class Config {
      * Use get_instance() to obtain singleton instance.
      */
     Config();
+    ~Config();
 
     Config(Config& o) = delete;
     void operator=(const Config&) = delete;
@@ -168,13 +178,33 @@ class Config {
     /**
      * @brief Save current configuration to file
      *
-     * Writes in-memory config to disk with pretty formatting.
-     * Includes error handling and validation.
+     * Marks the config dirty and hands a snapshot to the background writer,
+     * which coalesces saves made within a short window and replaces the file
+     * atomically (temp file + fsync + rename). Never blocks on disk I/O.
      *
-     * @return true if save succeeded, false on error
+     * @return false if the previous background write of this file failed
+     *         (the failure is also reported to the user), true otherwise
      */
     bool save();
 
+    /**
+     * @brief Write any pending save now and wait for it
+     *
+     * Call before exiting or exec'ing a new process; the singleton is never
+     * destroyed, so nothing else flushes the last debounced save.
+     *
+     * @return true if nothing was pending or the write succeeded
+     */
+    bool flush();
+
+    /**
+     * @brief Saves requested vs. file writes performed
+     *
+     * @param[out] requested save() calls that reached the writer
+     * @param[out] written Successful file writes
+     */
+    void get_save_stats(uint64_t& requested, uint64_t& written) const;
+
     /**
      * @brief Get printer config path prefix
      *
@@ -0,0 +1,143 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file config_save_coordinator.h
+ * @brief Debounced, crash-safe background writer for the JSON config file
+ *
+ * @pattern request() stores the latest snapshot (dirty flag) -> a writer
+ *          thread waits out the debounce window -> serializes and writes via
+ *          temp file + fsync + rename
+ * @threading request()/flush()/stats() from any thread; writes happen on the
+ *            writer thread or inside flush()
+ * @gotchas Config is a leaked singleton, so its coordinator is never
+ *          destroyed - call Config::flush() before exiting or exec'ing
+ */
+
+#pragma once
+
+#include "json_fwd.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace helix {
+
+/**
+ * @brief Coalesces config saves and writes them off the UI thread
+ *
+ * Settings call Config::save() on every individual change (slider drags,
+ * toggles, wizard steps). Writing the whole file synchronously each time
+ * blocked the UI on SD-card I/O and wore flash; writing in place could also
+ * leave a truncated file on power loss.
+ *
+ * Each request() replaces the pending snapshot. The writer waits until no
+ * new request arrived for DEBOUNCE, but never delays a dirty snapshot
+ * longer than MAX_DELAY, so continuous changes still reach disk.
+ */
+class ConfigSaveCoordinator {
+  public:
+    /// Quiet period after the last request before writing
+    static constexpr std::chrono::milliseconds DEFAULT_DEBOUNCE{1000};
+
+    /// Longest a dirty snapshot may wait while requests keep arriving
+    static constexpr std::chrono::milliseconds DEFAULT_MAX_DELAY{5000};
+
+    struct Stats {
+        uint64_t requested = 0; ///< request() calls
+        uint64_t written = 0;   ///< Successful file writes
+        uint64_t failed = 0;    ///< Failed file writes
+    };
+
+    explicit ConfigSaveCoordinator(std::chrono::milliseconds debounce = DEFAULT_DEBOUNCE,
+                                   std::chrono::milliseconds max_delay = DEFAULT_MAX_DELAY);
+
+    /// Flushes pending data and stops the writer thread
+    ~ConfigSaveCoordinator();
+
+    ConfigSaveCoordinator(const ConfigSaveCoordinator&) = delete;
+    ConfigSaveCoordinator& operator=(const ConfigSaveCoordinator&) = delete;
+
+    /**
+     * @brief Mark the config dirty with a new snapshot
+     *
+     * Replaces any snapshot still waiting to be written. Starts the writer
+     * thread on first use.
+     *
+     * @param path Destination file
+     * @param snapshot Config contents to persist
+     */
+    void request(const std::string& path, json snapshot);
+
+    /**
+     * @brief Write any pending snapshot now and wait for it
+     *
+     * When this returns, every earlier request() is on disk (or failed).
+     *
+     * @return false if the pending write failed
+     */
+    bool flush();
+
+    /// Requested vs. performed write counts
+    [[nodiscard]] Stats stats() const;
+
+    /**
+     * @brief Take the most recent write failure, if any
+     *
+     * Failures happen on the writer thread; the owner reports them to the
+     * user from its own thread.
+     *
+     * @param[out] path File the failed write targeted
+     * @param[out] message Failure description
+     * @return true if a failure was pending (it is cleared)
+     */
+    bool take_error(std::string& path, std::string& message);
+
+    /**
+     * @brief Replace a file's contents crash-safely
+     *
+     * Writes path + ".tmp", fsyncs it, renames it over path and fsyncs the
+     * directory. Readers see either the old or the new file, never a partial one.
+     *
+     * @param[out] error Failure description
+     * @return true on success
+     */
+    static bool write_file_atomic(const std::string& path, const std::string& contents,
+                                  std::string& error);
+
+  private:
+    void writer_loop();
+
+    /// Write the pending snapshot, if any (caller must not hold mutex_)
+    bool write_pending();
+
+    const std::chrono::milliseconds debounce_;
+    const std::chrono::milliseconds max_delay_;
+
+    mutable std::mutex mutex_; ///< Guards the pending snapshot and error
+    std::condition_variable cv_;
+    std::optional<json> pending_;
+    std::string pending_path_;
+    std::chrono::steady_clock::time_point first_request_;
+    std::chrono::steady_clock::time_point last_request_;
+    std::string error_path_;
+    std::string error_message_;
+    bool stop_ = false;
+
+    /// Held across take + write so snapshots reach disk in request order
+    std::mutex write_mutex_;
+
+    std::thread writer_;
+
+    std::atomic<uint64_t> requested_{0};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> failed_{0};
+};
+
+} // namespace helix
@@ -0,0 +1,155 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file console_line_buffer.h
+ * @brief Fixed-capacity ring of pre-parsed G-code console lines
+ *
+ * @pattern push() parses into the oldest slot (reusing its string/span
+ *          capacity) -> measure callback caches the line height -> views
+ *          map scroll offsets to lines with index_at()
+ * @threading Not thread-safe; owned and used by the UI thread
+ * @gotchas Line contents never change once pushed, so seq() uniquely
+ *          identifies what a row shows until relayout() changes heights
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace helix {
+
+/// Color role of a console text run (resolved to theme colors by the view)
+enum class ConsoleColor : uint8_t {
+    TEXT,    ///< Commands
+    SUCCESS, ///< Responses, AFC/Happy Hare success--text
+    INFO,    ///< info--text
+    WARNING, ///< warning--text
+    DANGER   ///< Errors, error--text
+};
+
+/// Colored run [start, start + length) of ConsoleLine::text
+struct ConsoleSpan {
+    uint32_t start = 0;
+    uint32_t length = 0;
+    ConsoleColor color = ConsoleColor::TEXT;
+};
+
+/// Kind of console entry (selects the default color)
+enum class ConsoleLineKind : uint8_t {
+    COMMAND, ///< User-entered G-code command
+    RESPONSE ///< Klipper response
+};
+
+struct ConsoleLine {
+    std::string text;               ///< Display text with HTML span tags stripped
+    std::vector<ConsoleSpan> spans; ///< Colored runs covering text, in order
+    double timestamp = 0.0;         ///< Unix timestamp from Moonraker (0 for live lines)
+    int32_t height = 0;             ///< Measured height including the row gap
+};
+
+/**
+ * @brief Ring buffer of console lines with cached layout
+ *
+ * The console used to create an LVGL label (or spangroup) per entry and
+ * delete the oldest widget one at a time once full. Lines are now parsed
+ * once into a fixed ring: push() overwrites the oldest slot in O(1),
+ * reusing its allocations, and a view renders only the visible lines from
+ * a small widget pool.
+ *
+ * Each line's height comes from the measure callback when it is pushed;
+ * the buffer keeps running offsets so index_at() maps a scroll position
+ * to a line in O(log n).
+ */
+class ConsoleLineBuffer {
+  public:
+    /// Returns the rendered height of a line (including the gap below it)
+    using Measure = std::function<int32_t(const ConsoleLine&)>;
+
+    explicit ConsoleLineBuffer(size_t capacity);
+
+    ConsoleLineBuffer(const ConsoleLineBuffer&) = delete;
+    ConsoleLineBuffer& operator=(const ConsoleLineBuffer&) = delete;
+
+    /**
+     * @brief Append a message, dropping the oldest line when full
+     *
+     * Mainsail-style `<span class=xxx--text>` markup (AFC, Happy Hare) is
+     * parsed into colored spans; everything else is one span in the kind's
+     * default color (DANGER for errors).
+     *
+     * @return The stored line
+     */
+    const ConsoleLine& push(std::string_view message, ConsoleLineKind kind, bool is_error,
+                            double timestamp = 0.0);
+
+    /// Drop all lines (sequence numbers keep counting)
+    void clear();
+
+    /// Set the height callback and re-measure every line
+    void set_measure(Measure measure);
+
+    /// Re-measure every line (e.g. after the view width changed)
+    void relayout();
+
+    [[nodiscard]] size_t size() const {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] size_t capacity() const {
+        return slots_.size();
+    }
+
+    /// Line by position, 0 = oldest
+    [[nodiscard]] const ConsoleLine& at(size_t index) const {
+        return slots_[slot(index)];
+    }
+
+    /// Sequence number of the line at index (unique for the buffer's lifetime)
+    [[nodiscard]] uint64_t seq(size_t index) const {
+        return total_pushed_ - size_ + index;
+    }
+
+    /// Lines pushed since construction
+    [[nodiscard]] uint64_t total_pushed() const {
+        return total_pushed_;
+    }
+
+    /// Sum of the heights of all lines
+    [[nodiscard]] int64_t content_height() const;
+
+    /// Offset of the top of line index from the top of the oldest line
+    [[nodiscard]] int64_t y_of(size_t index) const;
+
+    /// Index of the line covering offset y (clamped to [0, size - 1])
+    [[nodiscard]] size_t index_at(int64_t y) const;
+
+    /// True if the message contains span markup that push() parses
+    static bool contains_html_spans(std::string_view message);
+
+  private:
+    size_t slot(size_t index) const {
+        return (head_ + index) % slots_.size();
+    }
+
+    static void parse_into(ConsoleLine& line, std::string_view message, ConsoleColor base);
+
+    std::vector<ConsoleLine> slots_;
+    std::vector<int64_t> tops_; ///< Running top offset of each slot's line
+    size_t head_ = 0;           ///< Slot of the oldest line
+    size_t size_ = 0;
+    uint64_t total_pushed_ = 0;
+    int64_t next_top_ = 0; ///< Running offset just past the newest line
+    Measure measure_;
+};
+
+} // namespace helix
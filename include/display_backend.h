@@ -183,6 +183,16 @@ class DisplayBackend {
         return nullptr;
     }
 
+    /**
+     * @brief Device node behind the pointer input, if it is a Linux input device
+     *
+     * Lets the main loop sleep until the device is readable instead of polling.
+     * Empty when input is not backed by a pollable node (e.g. SDL).
+     */
+    virtual std::string input_device_path() const {
+        return {};
+    }
+
     // ========================================================================
     // Backend Information
     // ========================================================================
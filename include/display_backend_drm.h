@@ -71,6 +71,9 @@ class DisplayBackendDRM : public DisplayBackend {
     }
     bool is_available() const override;
     DetectedResolution detect_resolution() const override;
+    std::string input_device_path() const override {
+        return input_path_;
+    }
 
     // Framebuffer operations
     bool clear_framebuffer(uint32_t color) override;
@@ -84,6 +87,7 @@ class DisplayBackendDRM : public DisplayBackend {
     std::string drm_device_ = "/dev/dri/card0";
     lv_display_t* display_ = nullptr;
     lv_indev_t* pointer_ = nullptr;
+    std::string input_path_; ///< Node pointer_ was created on
 };
 
 #endif // HELIX_DISPLAY_DRM
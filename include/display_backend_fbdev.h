@@ -80,6 +80,9 @@ class DisplayBackendFbdev : public DisplayBackend {
     }
     bool is_available() const override;
     DetectedResolution detect_resolution() const override;
+    std::string input_device_path() const override {
+        return touch_path_;
+    }
 
     // Framebuffer operations
     bool clear_framebuffer(uint32_t color) override;
@@ -134,6 +137,7 @@ class DisplayBackendFbdev : public DisplayBackend {
   private:
     std::string fb_device_ = "/dev/fb0";
     std::string touch_device_; // Empty = auto-detect
+    std::string touch_path_;   // Node touch_ was created on
     lv_display_t* display_ = nullptr;
     lv_indev_t* touch_ = nullptr;
 
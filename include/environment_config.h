@@ -119,6 +119,17 @@ class EnvironmentConfig {
      */
     static bool get_benchmark_mode();
 
+    /**
+     * @brief Get console stress-test rate from HELIX_CONSOLE_STRESS
+     *
+     * When set, the G-code console feeds itself synthetic responses at this
+     * rate while open and logs sustained throughput and late UI ticks.
+     * Valid range: 1-100000 lines/sec
+     *
+     * @return Lines per second, or nullopt if not set/invalid
+     */
+    static std::optional<int> get_console_stress_rate();
+
     /**
      * @brief Get data directory override from HELIX_DATA_DIR
      *
@@ -264,6 +264,9 @@ class FilamentSensorManager : public helix::sensors::ISensorManager {
      */
     void update_from_status(const nlohmann::json& status) override;
 
+    /// @brief Whether a status key is a filament_switch_sensor / filament_motion_sensor object
+    [[nodiscard]] bool handles_status_object(const std::string& klipper_name) const override;
+
     /// @brief Inject mock sensor objects for testing UI
     void inject_mock_sensors(std::vector<std::string>& objects, nlohmann::json& config_keys,
                              nlohmann::json& moonraker_info) override;
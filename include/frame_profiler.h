@@ -0,0 +1,253 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file frame_profiler.h
+ * @brief Per-phase frame profiler with Chrome trace export
+ *
+ * Benchmark mode only reports aggregate FPS. When a panel stutters, this
+ * shows where the frame went: UpdateQueue drain, layout, a specific draw
+ * (TinyGL, bed mesh, filament path) or the flush to fbdev/DRM.
+ *
+ * Usage:
+ * @code
+ * void MyCanvas::draw(lv_event_t* e) {
+ *     HELIX_PROFILE_SCOPE("draw.my_canvas");
+ *     ...
+ * }
+ * @endcode
+ *
+ * Enabled at runtime by HELIX_BENCHMARK or --profile-trace <file>. The trace
+ * is written on exit and on SIGUSR2; open it in chrome://tracing or Perfetto.
+ * p50/p95/p99 per phase are logged on exit.
+ *
+ * @pattern Scoped timers -> lock-free overwrite ring (last N events, for the
+ *          trace) + per-phase log-linear histograms (whole run, for percentiles)
+ * @threading record()/HELIX_PROFILE_SCOPE from any thread; enable(), export
+ *            and summaries from the main thread
+ * @gotchas Scopes compile to nothing in release builds (HELIX_RELEASE_BUILD)
+ *          unless built with ENABLE_FRAME_PROFILER=yes. Phase names must be
+ *          string literals (stored by pointer).
+ */
+
+#pragma once
+
+#include "helix_timing.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(HELIX_FRAME_PROFILER) || !defined(HELIX_RELEASE_BUILD)
+#define HELIX_FRAME_PROFILER_ENABLED 1
+#endif
+
+namespace helix::profiling {
+
+using PhaseId = uint16_t;
+inline constexpr PhaseId INVALID_PHASE = 0xFFFF;
+
+/**
+ * @brief One completed phase, as stored in the ring and written to the trace
+ */
+struct TraceEvent {
+    uint64_t start_us = 0;
+    uint32_t duration_us = 0;
+    PhaseId phase = INVALID_PHASE;
+    uint16_t thread = 0; ///< Small per-thread index (first recorder = 1)
+};
+
+/**
+ * @brief Duration percentiles for one phase over the whole run
+ */
+struct PhaseSummary {
+    const char* name = "";
+    uint64_t count = 0;
+    uint64_t total_us = 0;
+    uint64_t p50_us = 0;
+    uint64_t p95_us = 0;
+    uint64_t p99_us = 0;
+    uint64_t max_us = 0;
+};
+
+class FrameProfiler {
+  public:
+    static constexpr size_t MAX_PHASES = 32;
+    static constexpr size_t DEFAULT_RING_CAPACITY = 16384; ///< ~30s of a busy 60 fps loop
+
+    /// Log-linear histogram: exact below 16us, then 4 buckets per power of two
+    static constexpr size_t LINEAR_BUCKETS = 16;
+    static constexpr size_t HISTOGRAM_BUCKETS = 128;
+
+    static FrameProfiler& instance();
+
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    /// True if scopes were compiled in (see HELIX_FRAME_PROFILER_ENABLED)
+    static constexpr bool compiled_in() {
+#ifdef HELIX_FRAME_PROFILER_ENABLED
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Start recording
+     *
+     * The ring is allocated on first enable and kept for the process lifetime,
+     * so threads racing a disable() never see it freed.
+     *
+     * @param ring_capacity Events kept for the trace (rounded up to a power of two)
+     */
+    void enable(size_t ring_capacity = DEFAULT_RING_CAPACITY);
+
+    /// Stop recording (collected data is kept)
+    void disable();
+
+    [[nodiscard]] bool enabled() const {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Look up or add a phase by name (thread-safe)
+     *
+     * @param name String literal; the same text always maps to the same id
+     * @return Phase id, or INVALID_PHASE once MAX_PHASES are in use
+     */
+    PhaseId register_phase(const char* name);
+
+    [[nodiscard]] const char* phase_name(PhaseId phase) const;
+
+    /**
+     * @brief Record a completed phase (lock-free, any thread)
+     *
+     * No-op while disabled. Use for phases that don't fit a scope, e.g. ones
+     * bracketed by LVGL start/finish events.
+     */
+    void record(PhaseId phase, uint64_t start_us, uint64_t duration_us);
+
+    /// Per-phase percentiles for phases with at least one sample, by total time
+    [[nodiscard]] std::vector<PhaseSummary> summarize() const;
+
+    /// Log summarize() at info level, one line per phase
+    void log_summary() const;
+
+    /// Events still in the ring, oldest first
+    [[nodiscard]] std::vector<TraceEvent> snapshot() const;
+
+    /// Events overwritten before they could be exported
+    [[nodiscard]] uint64_t overwritten() const;
+
+    /**
+     * @brief Write the ring as Chrome trace-event JSON
+     *
+     * @param[out] error Failure description
+     * @return true on success
+     */
+    bool write_chrome_trace(const std::string& path, std::string& error) const;
+
+    /// Serialize events as Chrome trace-event JSON ("X" complete events)
+    void write_chrome_trace(std::ostream& out, const std::vector<TraceEvent>& events) const;
+
+    /// Ask the main thread to export the trace (async-signal-safe)
+    static void request_export();
+
+    /// Take a pending export request
+    static bool take_export_request();
+
+    /**
+     * @brief Clear samples, events and the export request
+     *
+     * For tests; not concurrent with record().
+     *
+     * @param ring_capacity If non-zero, replace the ring with one of this many
+     *        events (rounded up to a power of two); 0 keeps the current ring
+     */
+    void reset(size_t ring_capacity = 0);
+
+  private:
+    FrameProfiler() = default;
+
+    struct Slot {
+        std::atomic<uint64_t> seq{0}; ///< 2*pos+1 while writing, 2*pos+2 when done
+        std::atomic<uint64_t> start_us{0};
+        std::atomic<uint32_t> duration_us{0};
+        std::atomic<uint32_t> phase_thread{0}; ///< phase << 16 | thread
+    };
+
+    struct PhaseStats {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> total_us{0};
+        std::atomic<uint64_t> max_us{0};
+        std::array<std::atomic<uint32_t>, HISTOGRAM_BUCKETS> buckets{};
+    };
+
+    void allocate_ring(size_t ring_capacity);
+
+    static size_t bucket_for(uint64_t us);
+    static uint64_t bucket_upper_bound(size_t bucket);
+    static uint64_t percentile(const PhaseStats& stats, uint64_t count, double fraction);
+
+    std::atomic<bool> enabled_{false};
+
+    mutable std::mutex phases_mutex_; ///< Guards registration (names are read lock-free)
+    std::array<std::atomic<const char*>, MAX_PHASES> names_{};
+    std::atomic<size_t> phase_count_{0};
+    std::array<PhaseStats, MAX_PHASES> stats_{};
+
+    std::unique_ptr<Slot[]> ring_;
+    size_t ring_mask_ = 0;
+    std::atomic<uint64_t> head_{0};
+};
+
+/**
+ * @brief Records the enclosing scope as one phase (see HELIX_PROFILE_SCOPE)
+ */
+class ScopedPhase {
+  public:
+    explicit ScopedPhase(PhaseId phase) {
+        if (FrameProfiler::instance().enabled() && phase != INVALID_PHASE) {
+            phase_ = phase;
+            start_us_ = timing::get_micros();
+        }
+    }
+
+    ~ScopedPhase() {
+        if (phase_ != INVALID_PHASE) {
+            FrameProfiler::instance().record(phase_, start_us_, timing::get_micros() - start_us_);
+        }
+    }
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+  private:
+    PhaseId phase_ = INVALID_PHASE;
+    uint64_t start_us_ = 0;
+};
+
+} // namespace helix::profiling
+
+#define HELIX_PROFILE_CONCAT_INNER(a, b) a##b
+#define HELIX_PROFILE_CONCAT(a, b) HELIX_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef HELIX_FRAME_PROFILER_ENABLED
+/**
+ * @brief Time the rest of the enclosing scope as phase @p name (string literal)
+ */
+#define HELIX_PROFILE_SCOPE(name)                                                                  \
+    static const ::helix::profiling::PhaseId HELIX_PROFILE_CONCAT(helix_profile_id_, __LINE__) =   \
+        ::helix::profiling::FrameProfiler::instance().register_phase(name);                        \
+    ::helix::profiling::ScopedPhase HELIX_PROFILE_CONCAT(helix_profile_scope_, __LINE__)(          \
+        HELIX_PROFILE_CONCAT(helix_profile_id_, __LINE__))
+#else
+#define HELIX_PROFILE_SCOPE(name) ((void)0)
+#endif
@@ -0,0 +1,216 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_band_line_rasterizer.h
+ * @brief Software line rasterization for the 2D layer cache, in parallel screen bands
+ *
+ * @pattern One job at a time: start() -> (poll ready()) -> composite_into() on the UI thread
+ * @threading start()/cancel()/composite_into() from one thread (the LVGL thread);
+ *            the LineSource runs on worker threads
+ * @gotchas Writes are overwrites, never blends, which is what makes the banded
+ *          output identical to serial drawing; a pixel value of 0 means "untouched"
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/// A projected, styled line ready to rasterize (screen pixels, ARGB8888 color)
+struct RasterLine {
+    int x0, y0, x1, y1;
+    uint32_t color;
+    int width; ///< Line width in pixels
+};
+
+/**
+ * @brief Draw a thick Bresenham line into an ARGB8888 buffer
+ *
+ * The line is drawn as `line_width` parallel 1px Bresenham lines offset
+ * along its perpendicular. Only rows in [row_begin, row_end) are written,
+ * so several threads can draw into disjoint row bands of one buffer.
+ *
+ * Pixels are written as native uint32_t ARGB8888, i.e. B, G, R, A bytes on
+ * the little-endian targets LVGL's ARGB8888 layout assumes.
+ *
+ * @param pixels First pixel of row 0
+ * @param stride Row pitch in pixels
+ * @param width Buffer width (columns outside are clipped)
+ * @param row_begin First row that may be written
+ * @param row_end One past the last row that may be written
+ * @param line Line to draw
+ */
+void draw_raster_line(uint32_t* pixels, int stride, int width, int row_begin, int row_end,
+                      const RasterLine& line);
+
+/**
+ * @brief Renders a range of layers into an offscreen buffer on a worker pool
+ *
+ * GCodeLayerRenderer used to catch up its solid cache by drawing every
+ * segment of every missing layer on the LVGL thread. For a deep range (a jump
+ * to layer 300) this now runs as a background job:
+ *
+ * 1. Bin: the range is processed in chunks of layers. Each worker turns a
+ *    contiguous slice of the chunk's layers into RasterLines (projection and
+ *    styling happen in the LineSource) and sorts them into horizontal bands.
+ * 2. Rasterize: workers claim bands and draw every line binned to the band,
+ *    slice by slice, so each pixel sees the same writes in the same order as
+ *    serial drawing.
+ *
+ * The result sits in a staging buffer until composite_into() copies the
+ * touched pixels into the cache on the UI thread in one pass, so the cache
+ * never shows a half-drawn range.
+ *
+ * @code
+ *   rasterizer.start(w, h, from, to, [=] { return make_line_source(snapshot); });
+ *   // each frame:
+ *   if (rasterizer.ready()) { rasterizer.composite_into(cache_data, cache_stride); }
+ * @endcode
+ */
+class BandLineRasterizer {
+  public:
+    /// Appends the lines of one layer, in draw order. Called on worker threads.
+    using LineSource = std::function<void(int layer, std::vector<RasterLine>& out)>;
+
+    /// Creates one LineSource per worker (on the calling thread), so sources
+    /// may keep unsynchronized per-worker state
+    using LineSourceFactory = std::function<LineSource()>;
+
+    /// Counters for the last finished job
+    struct Stats {
+        int layers{0};        ///< Layers rendered
+        size_t lines{0};      ///< Lines binned
+        size_t band_lines{0}; ///< Lines drawn summed over bands (>= lines)
+        double elapsed_ms{0.0};
+    };
+
+    /**
+     * @brief Start the worker threads
+     * @param thread_count Workers (0 = configured_thread_count())
+     */
+    explicit BandLineRasterizer(unsigned thread_count = 0);
+
+    /// Cancels any job and joins the workers
+    ~BandLineRasterizer();
+
+    BandLineRasterizer(const BandLineRasterizer&) = delete;
+    BandLineRasterizer& operator=(const BandLineRasterizer&) = delete;
+
+    /**
+     * @brief Start rendering layers [from_layer, to_layer] into a fresh staging buffer
+     * @return false if a job is already running or the arguments are empty
+     */
+    bool start(int width, int height, int from_layer, int to_layer,
+               const LineSourceFactory& make_source);
+
+    /// Stop the current job (if any) and discard its result; waits for workers
+    void cancel();
+
+    /// @return true while a job is rendering
+    bool busy() const {
+        return state_.load() == State::RUNNING;
+    }
+
+    /// @return true when a finished job is waiting for composite_into()
+    bool ready() const {
+        return state_.load() == State::READY;
+    }
+
+    /// @return Layers of the running job completed so far
+    int layers_done() const {
+        return layers_done_.load();
+    }
+
+    int from_layer() const {
+        return from_layer_;
+    }
+
+    int to_layer() const {
+        return to_layer_;
+    }
+
+    /**
+     * @brief Copy the finished job's touched pixels into an ARGB8888 buffer
+     * @param dst First byte of the destination (same width/height as start())
+     * @param dst_stride Destination row pitch in bytes
+     * @return false if no finished job was waiting
+     */
+    bool composite_into(uint8_t* dst, size_t dst_stride);
+
+    Stats stats() const;
+
+    unsigned thread_count() const {
+        return static_cast<unsigned>(workers_.size()) + 1;
+    }
+
+    /**
+     * @brief Worker count from HELIX_GCODE_LAYER_CACHE_THREADS or
+     *        /gcode_viewer/layer_cache_threads (0 = auto, up to 4)
+     */
+    static unsigned configured_thread_count();
+
+  private:
+    enum class State { IDLE, RUNNING, READY };
+
+    /// Layers binned by one worker per chunk (keeps chunk memory bounded)
+    static constexpr int LAYERS_PER_SLICE = 4;
+
+    /// Bands per worker (more bands than workers balances dense middle rows)
+    static constexpr int BANDS_PER_THREAD = 2;
+
+    void run_job(std::vector<LineSource> sources);
+    void bin_slice(unsigned worker, int first_layer, int last_layer);
+    void rasterize_bands();
+
+    /// Run fn(worker) on every helper and fn(0) on the calling (job) thread
+    void run_parallel(const std::function<void(unsigned)>& fn);
+    void helper_loop(unsigned worker);
+    void stop_helpers();
+
+    std::vector<std::thread> workers_; ///< Helpers 1..N-1; the job thread is worker 0
+    std::thread job_thread_;
+
+    std::atomic<State> state_{State::IDLE};
+    std::atomic<bool> cancel_{false};
+    std::atomic<int> layers_done_{0};
+
+    // Job parameters (written by start() before the job thread exists)
+    int width_{0};
+    int height_{0};
+    int from_layer_{0};
+    int to_layer_{-1};
+    int band_count_{1};
+    int band_height_{1};
+    std::vector<uint32_t> staging_;
+
+    // Per-chunk working set: sources_[worker], bins_[worker][band]
+    std::vector<LineSource> sources_;
+    std::vector<std::vector<RasterLine>> scratch_;
+    std::vector<std::vector<std::vector<RasterLine>>> bins_;
+    std::atomic<int> next_band_{0};
+
+    // Helper dispatch
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    const std::function<void(unsigned)>* task_{nullptr};
+    uint64_t generation_{0};
+    unsigned remaining_{0};
+    bool stopping_{false};
+
+    mutable std::mutex stats_mutex_;
+    Stats stats_;
+};
+
+} // namespace gcode
+} // namespace helix
@@ -3,16 +3,25 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace helix {
+
+class HttpSession;
+struct HttpConnectionCounters;
+
 namespace gcode {
 
+class RangeBlockCache;
+
 /**
  * @brief Abstract interface for reading G-code data
  *
@@ -39,6 +48,36 @@ class GCodeDataSource {
      */
     virtual std::vector<char> read_range(uint64_t offset, uint32_t length) = 0;
 
+    /**
+     * @brief Zero-copy view of a byte range, if the source can provide one
+     *
+     * Memory-mapped sources return a view into the mapping, valid until the
+     * source is destroyed. Other sources return an empty view; fall back to
+     * read_range().
+     *
+     * @param offset Starting byte position
+     * @param length Number of bytes (clamped to end of source)
+     * @return View of the bytes, or empty if not supported
+     */
+    virtual std::string_view view_range(uint64_t /*offset*/, uint32_t /*length*/) {
+        return {};
+    }
+
+    /**
+     * @brief Readahead hint: this byte range will be read soon
+     *
+     * No-op unless the source is memory-mapped (MADV_WILLNEED).
+     */
+    virtual void advise_willneed(uint64_t /*offset*/, uint64_t /*length*/) {}
+
+    /**
+     * @brief Readahead hint: this byte range won't be read again soon
+     *
+     * No-op unless the source is memory-mapped (MADV_DONTNEED on whole pages
+     * inside the range, so neighbouring data stays resident).
+     */
+    virtual void advise_dontneed(uint64_t /*offset*/, uint64_t /*length*/) {}
+
     /**
      * @brief Get total size of the data source
      * @return Size in bytes, or 0 if unknown
@@ -125,16 +164,28 @@ class GCodeDataSource {
 /**
  * @brief Data source for local files
  *
- * Uses standard file I/O with fseek/fread for efficient random access.
- * This is the most efficient source for local G-code files.
+ * Two I/O modes:
+ * - STDIO: fseek/fread into a fresh buffer per read_range()
+ * - MMAP: maps the whole file read-only. view_range() returns views into the
+ *   mapping (no allocation or copy per layer) and the advise_* hints drive
+ *   kernel readahead. Falls back to STDIO if mapping fails.
+ *
+ * MMAP needs address space for the whole file, so 32-bit targets default to
+ * STDIO (see use_gcode_mmap()).
  */
 class FileDataSource : public GCodeDataSource {
   public:
+    enum class IoMode {
+        STDIO, ///< fseek/fread per read
+        MMAP,  ///< Read-only memory mapping of the whole file
+    };
+
     /**
      * @brief Create data source from file path
      * @param filepath Path to local file
+     * @param mode Preferred I/O mode (MMAP falls back to STDIO on failure)
      */
-    explicit FileDataSource(const std::string& filepath);
+    explicit FileDataSource(const std::string& filepath, IoMode mode = IoMode::STDIO);
 
     ~FileDataSource() override;
 
@@ -147,6 +198,9 @@ class FileDataSource : public GCodeDataSource {
     FileDataSource& operator=(FileDataSource&& other) noexcept;
 
     std::vector<char> read_range(uint64_t offset, uint32_t length) override;
+    std::string_view view_range(uint64_t offset, uint32_t length) override;
+    void advise_willneed(uint64_t offset, uint64_t length) override;
+    void advise_dontneed(uint64_t offset, uint64_t length) override;
     uint64_t file_size() const override;
     bool supports_range_requests() const override;
     std::string source_name() const override;
@@ -161,10 +215,23 @@ class FileDataSource : public GCodeDataSource {
         return filepath_;
     }
 
+    /**
+     * @brief Check if the file is memory-mapped
+     * @return true in MMAP mode (false if mapping failed and STDIO is in use)
+     */
+    bool is_memory_mapped() const {
+        return map_ != nullptr;
+    }
+
   private:
+    bool map_file();
+    void unmap_file();
+    void advise(uint64_t offset, uint64_t length, int advice, bool whole_pages_only);
+
     std::string filepath_;
     FILE* file_{nullptr};
     uint64_t size_{0};
+    const char* map_{nullptr}; ///< Whole-file read-only mapping (MMAP mode)
 };
 
 /**
@@ -174,6 +241,11 @@ class FileDataSource : public GCodeDataSource {
  * If Range requests aren't supported by the server, falls back to
  * downloading the entire file to a temporary location.
  *
+ * Range reads go through a RangeBlockCache (aligned blocks, LRU under the
+ * gcode_viewer.remote_cache_mb budget) on one keep-alive connection, so
+ * consecutive layers share requests and a large remote file is streamed
+ * without ever being written to flash.
+ *
  * The fallback behavior is transparent - callers don't need to
  * handle it differently.
  */
@@ -199,6 +271,9 @@ class MoonrakerDataSource : public GCodeDataSource {
     std::string source_name() const override;
     bool is_valid() const override;
     std::string indexable_file_path() const override;
+
+    /// Downloads to a temp file only when the server can't serve ranges;
+    /// otherwise the index is built from read_range() (see GCodeLayerIndex)
     bool ensure_indexable() override;
 
     /**
@@ -257,11 +332,17 @@ class MoonrakerDataSource : public GCodeDataSource {
     std::string moonraker_url_;
     std::string gcode_path_;
     uint64_t size_{0};
-    bool range_support_probed_{false};
-    bool range_support_{false};
+    std::atomic<bool> range_support_probed_{false};
+    std::atomic<bool> range_support_{false};
     bool metadata_fetched_{false};
     bool valid_{false};
 
+    // Range reads: block cache in front of one keep-alive connection
+    std::mutex range_mutex_; ///< Serializes probe and range_session_ use
+    std::unique_ptr<HttpConnectionCounters> http_counters_;
+    std::unique_ptr<HttpSession> range_session_;
+    std::unique_ptr<RangeBlockCache> block_cache_;
+
     // Fallback to local temp file if range requests don't work
     std::unique_ptr<FileDataSource> fallback_source_;
     std::string temp_file_path_;
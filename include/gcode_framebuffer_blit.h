@@ -0,0 +1,96 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_framebuffer_blit.h
+ * @brief Converts (and nearest-neighbor scales) TinyGL's framebuffer into LVGL image formats
+ *
+ * @pattern configure() on size change (precomputes row/column tables), blit() per frame
+ * @threading Not thread-safe; one blitter per renderer
+ * @gotchas TinyGL's 32-bit pixel is 0x00RRGGBB, which is LVGL's XRGB8888 in memory -
+ *          RGB888 output drops the pad byte, RGB565 truncates like lv_color_to_u16()
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/// Destination pixel formats (match LV_COLOR_FORMAT_RGB888/XRGB8888/RGB565 byte layout)
+enum class BlitFormat {
+    RGB888,   ///< 3 bytes: B, G, R
+    XRGB8888, ///< 4 bytes: B, G, R, X (TinyGL's own layout, no conversion)
+    RGB565,   ///< 16-bit little-endian RRRRRGGG GGGBBBBB
+};
+
+/// @return Bytes per pixel of a BlitFormat
+size_t blit_format_size(BlitFormat format);
+
+/// @return "rgb888", "xrgb8888" or "rgb565"
+const char* blit_format_name(BlitFormat format);
+
+/**
+ * @brief Copies the TinyGL framebuffer into an LVGL draw buffer
+ *
+ * The per-pixel path this replaces did an integer divide per destination
+ * pixel to find the source column and converted every pixel with scalar byte
+ * stores, even for destination rows that repeat the previous one.
+ *
+ * configure() precomputes the source row and column of every destination
+ * pixel (same integer arithmetic as before, so output is identical). blit()
+ * then converts each source row once with a SIMD kernel (NEON on ARM, SSE2 /
+ * SSSE3 on x86, scalar otherwise), widens 2x rows by pixel duplication and
+ * other scales through the column table, and copies repeated rows with memcpy.
+ *
+ * @code
+ *   blitter.configure(fb_w, fb_h, widget_w, widget_h, BlitFormat::RGB565);
+ *   blitter.blit(framebuffer, dest, dest_stride);
+ * @endcode
+ */
+class FramebufferBlitter {
+  public:
+    /**
+     * @brief Set source/destination sizes and format (no-op if unchanged)
+     */
+    void configure(int src_width, int src_height, int dst_width, int dst_height,
+                   BlitFormat format);
+
+    /**
+     * @brief Convert/scale a frame
+     * @param src TinyGL framebuffer (src_width * src_height pixels)
+     * @param dst Destination pixels
+     * @param dst_stride Destination row pitch in bytes
+     */
+    void blit(const uint32_t* src, uint8_t* dst, size_t dst_stride);
+
+    BlitFormat format() const {
+        return format_;
+    }
+
+  private:
+    int src_width_{0};
+    int src_height_{0};
+    int dst_width_{0};
+    int dst_height_{0};
+    BlitFormat format_{BlitFormat::RGB888};
+
+    std::vector<int> row_map_;      ///< Source row for each destination row
+    std::vector<int> column_map_;   ///< Source column for each destination column
+    std::vector<uint32_t> scratch_; ///< One scaled source row
+};
+
+/**
+ * @brief Convert a row of TinyGL pixels
+ * @param src Pixels (0x00RRGGBB)
+ * @param dst Destination (width * blit_format_size(format) bytes)
+ * @param width Pixels
+ * @param format Destination format
+ */
+void convert_framebuffer_row(const uint32_t* src, uint8_t* dst, int width, BlitFormat format);
+
+} // namespace gcode
+} // namespace helix
@@ -10,6 +10,7 @@
 #include "gcode_parser.h"
 
 #include <cstdint>
+#include <functional>
 #include <glm/glm.hpp>
 #include <memory>
 #include <optional>
@@ -243,11 +244,17 @@ struct SimplificationOptions {
  *
  * Pipeline:
  * 1. Analyze bounding box and compute quantization parameters
- * 2. Simplify segments (merge collinear lines within tolerance)
- * 3. Generate ribbon geometry (quads from line segments)
- * 4. Assign colors (Z-height gradient or custom)
- * 5. Compute surface normals (horizontal for flat ribbons)
- * 6. Index vertices (share vertices between adjacent segments)
+ * 2. Per layer, on a worker pool:
+ *    a. Simplify segments (merge collinear lines within tolerance)
+ *    b. Generate ribbon geometry (quads from line segments)
+ *    c. Assign colors (Z-height gradient or custom)
+ *    d. Compute surface normals (horizontal for flat ribbons)
+ *    e. Index vertices (share vertices between adjacent segments)
+ * 3. Append each layer's chunk in layer order, remapping palette and vertex indices
+ *
+ * Layers never copy the whole toolpath: only the layers in flight (a few per
+ * worker) hold simplified segments and unmerged geometry at any time, so peak
+ * memory above the result is bounded by the largest layers, not the file.
  */
 class GeometryBuilder {
   public:
@@ -371,9 +378,60 @@ class GeometryBuilder {
         tool_color_palette_ = palette;
     }
 
+    /**
+     * @brief Set worker threads for per-layer tessellation
+     * @param threads Worker count; 0 (default) picks one from core count and file size,
+     *                1 builds every layer on the calling thread
+     */
+    void set_worker_threads(unsigned threads) {
+        worker_threads_ = threads;
+    }
+
+    /**
+     * @brief Hash of everything besides the G-code itself that shapes build() output
+     *
+     * Covers @p options and every setter above except set_worker_threads()
+     * (output is identical for any thread count), plus the configured tube
+     * sides. Used to key GeometryCache entries.
+     */
+    uint64_t cache_key(const SimplificationOptions& options) const;
+
   private:
+    /**
+     * @brief One layer, simplified and tessellated on its own
+     *
+     * Vertex and palette indices are local to the chunk; append_chunk() rebases
+     * them onto the shared geometry.
+     */
+    struct LayerChunk {
+        RibbonGeometry geometry;
+        AABB bbox;                      ///< Extrusion bounds for frustum culling
+        size_t input_segments = 0;      ///< Raw segments in the layer
+        size_t degenerate_segments = 0; ///< Zero-length segments dropped
+        size_t output_segments = 0;     ///< Segments after simplification
+        size_t travel_segments = 0;     ///< Travels skipped (no geometry)
+        size_t sharing_candidates = 0;  ///< Extrusions following another extrusion
+        size_t segments_shared = 0;     ///< Of those, reusing the previous end cap
+    };
+
+    // Per-layer pipeline
+    void build_layer(const Layer& layer, const SimplificationOptions& options, bool top_layer,
+                     LayerChunk& chunk);
+    void append_chunk(RibbonGeometry& geometry, const LayerChunk& chunk, size_t layer_idx);
+
+    /**
+     * @brief Run build_layer() for every layer and hand the chunks to @p merge in layer order
+     *
+     * Workers claim layers in order but stay at most a few layers ahead of the
+     * merge, which runs on the calling thread.
+     */
+    void for_each_layer_chunk(const ParsedGCodeFile& gcode, const SimplificationOptions& options,
+                              unsigned threads,
+                              const std::function<void(size_t, LayerChunk&)>& merge);
+
     // Palette management
     uint16_t add_to_normal_palette(RibbonGeometry& geometry, const glm::vec3& normal);
+    uint16_t add_quantized_normal(RibbonGeometry& geometry, const glm::vec3& quantized);
     uint8_t add_to_color_palette(RibbonGeometry& geometry, uint32_t color_rgb);
 
     // Simplification pipeline
@@ -433,6 +491,7 @@ class GeometryBuilder {
         highlighted_objects_;                     ///< Object names to highlight (empty = none)
     bool debug_face_colors_ = false;              ///< Enable per-face debug coloring
     std::vector<std::string> tool_color_palette_; ///< Hex colors per tool (multi-color prints)
+    unsigned worker_threads_ = 0;                 ///< Tessellation workers (0 = auto)
 
     // Build statistics
     BuildStats stats_;
@@ -0,0 +1,127 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+// G-Code Geometry Cache
+// Saves built ribbon geometry to disk so reopening an unchanged file in the
+// 3D viewer skips the tessellation pass.
+
+#pragma once
+
+#include "gcode_geometry_builder.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief Size and modification time identifying the contents of a G-code file
+ */
+struct SourceStamp {
+    uint64_t size = 0;
+    int64_t mtime = 0; ///< Filesystem clock ticks
+
+    bool operator==(const SourceStamp& other) const {
+        return size == other.size && mtime == other.mtime;
+    }
+    bool operator!=(const SourceStamp& other) const {
+        return !(*this == other);
+    }
+};
+
+/**
+ * @brief Disk cache of RibbonGeometry, one file per (G-code file, build settings)
+ *
+ * Entries are named after the G-code path and GeometryBuilder::cache_key(), and
+ * record the file's size and mtime, so an edited or re-uploaded file is rebuilt
+ * and overwrites its old entry. The directory is capped at a byte budget;
+ * the least recently used entries are removed first.
+ *
+ * Usage:
+ * @code
+ * GeometryCache cache(get_helix_cache_dir("gcode_geometry"), max_bytes);
+ * auto stamp = GeometryCache::stamp(path);   // Before parsing
+ * ... parse ...
+ * uint64_t key = builder.cache_key(opts);
+ * auto geometry = stamp ? cache.load(path, *stamp, key) : nullptr;
+ * if (!geometry) {
+ *     geometry = std::make_unique<RibbonGeometry>(builder.build(gcode, opts));
+ *     if (stamp) cache.save(path, *stamp, key, *geometry);
+ * }
+ * @endcode
+ *
+ * @threading load()/save() may run concurrently from worker threads; each save
+ *            writes its own temp file and renames it into place
+ * @gotchas Native byte order and struct layout: entries are never shared between
+ *          machines. Bump FORMAT_VERSION when the builder's output changes for the
+ *          same input and settings, or stale geometry will be served.
+ */
+class GeometryCache {
+  public:
+    /// Bump when the entry layout or the builder's tessellation changes
+    static constexpr uint32_t FORMAT_VERSION = 1;
+    static constexpr size_t DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+
+    /**
+     * @param cache_dir Entry directory (must exist; empty disables the cache)
+     * @param max_bytes Total size of all entries (0 disables the cache)
+     */
+    explicit GeometryCache(std::string cache_dir, size_t max_bytes = DEFAULT_MAX_BYTES);
+
+    [[nodiscard]] bool enabled() const {
+        return !cache_dir_.empty() && max_bytes_ > 0;
+    }
+
+    /**
+     * @brief Current size and mtime of a file
+     *
+     * Take the stamp before parsing: save() only writes if the file still
+     * matches it, so geometry built from an older copy is never stored under
+     * the newer file's identity.
+     */
+    static std::optional<SourceStamp> stamp(const std::string& source_path);
+
+    /**
+     * @brief Load geometry for a file and build settings
+     *
+     * The entry is memory-mapped, validated (magic, version, layout, size,
+     * checksum, source path and stamp) and copied into a RibbonGeometry. A hit
+     * refreshes the entry's mtime for LRU eviction.
+     *
+     * @return Geometry, or nullptr on a miss or an invalid entry
+     */
+    std::unique_ptr<RibbonGeometry> load(const std::string& source_path, const SourceStamp& stamp,
+                                         uint64_t build_key) const;
+
+    /**
+     * @brief Store geometry, then evict least recently used entries over the budget
+     *
+     * Skipped when the entry alone exceeds the budget, the disk is nearly
+     * full, or the file no longer matches @p stamp. Failures are logged and
+     * never fatal.
+     *
+     * @return true if the entry was written
+     */
+    bool save(const std::string& source_path, const SourceStamp& stamp, uint64_t build_key,
+              const RibbonGeometry& geometry) const;
+
+    /// Entry file for a G-code path and build key
+    [[nodiscard]] std::string entry_path(const std::string& source_path, uint64_t build_key) const;
+
+    /// Total size of all entries in the directory, including unfinished temp files
+    [[nodiscard]] size_t total_bytes() const;
+
+  private:
+    /// Remove stale temp files, then least recently used entries over the budget
+    void evict_to_budget() const;
+
+    std::string cache_dir_;
+    size_t max_bytes_;
+};
+
+} // namespace gcode
+} // namespace helix
@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include "gcode_packed_layer.h"
 #include "gcode_parser.h"
 #include "memory_utils.h"
 
 #include <chrono>
 #include <cstddef>
 #include <functional>
+#include <future>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -28,18 +30,23 @@ class GCodeDataSource;
  * budget is exceeded, least-recently-used layers are evicted. This enables
  * viewing large G-code files (10MB+) on memory-constrained devices.
  *
+ * Loaded segments are stored as PackedLayer (quantized positions, interned
+ * object names), about a quarter of the size of a ToolpathSegment vector.
+ *
  * Thread-safe for concurrent access from UI and background loading threads.
+ * Layers are loaded outside the cache lock; concurrent requests for a layer
+ * that is already loading wait for that load instead of parsing it again.
  *
  * Usage:
  * @code
  *   GCodeLayerCache cache(8 * 1024 * 1024); // 8MB budget
- *   auto layer_data = cache.get_or_load(50, data_source, index);
- *   if (layer_data) {
- *       // Render segments...
+ *   auto result = cache.get_or_load(50, loader);
+ *   if (result.layer) {
+ *       // Render result.layer->start(i), result.layer->end(i)...
  *   }
  * @endcode
  *
- * Memory usage: ~80 bytes per segment + cache bookkeeping
+ * Memory usage: ~21 bytes per segment + cache bookkeeping
  */
 class GCodeLayerCache {
   public:
@@ -52,8 +59,8 @@ class GCodeLayerCache {
     /// Memory budget for well-equipped devices (32MB) - >512MB total RAM
     static constexpr size_t DEFAULT_BUDGET_GOOD = 32 * 1024 * 1024;
 
-    /// Approximate bytes per segment (for estimation)
-    static constexpr size_t BYTES_PER_SEGMENT = 80;
+    /// Approximate bytes per cached segment (for estimation)
+    static constexpr size_t BYTES_PER_SEGMENT = PackedLayer::BYTES_PER_SEGMENT;
 
     /**
      * @brief Construct cache with memory budget
@@ -78,29 +85,41 @@ class GCodeLayerCache {
      * segments while other threads may trigger cache eviction.
      */
     struct CacheResult {
-        std::shared_ptr<const std::vector<ToolpathSegment>>
-            segments;            ///< Shared pointer to segments (thread-safe lifetime)
-        bool was_hit{false};     ///< True if found in cache
-        bool load_failed{false}; ///< True if load attempted but failed
+        std::shared_ptr<const PackedLayer> layer; ///< Packed segments (thread-safe lifetime)
+        bool was_hit{false};                      ///< True if found in cache
+        bool load_failed{false};                  ///< True if load attempted but failed
+        bool was_shared{false};                   ///< True if another caller's load was awaited
     };
 
     /**
      * @brief Get layer data, loading from source if not cached
      *
      * If the layer is cached, returns immediately and updates LRU order.
-     * If not cached, loads from data source, caches result, and returns.
-     * May evict other layers to stay within budget.
+     * If another thread is loading it, waits for that load and shares its
+     * result. Otherwise calls the loader (without holding the cache lock),
+     * caches the result, and returns. May evict other layers to stay within
+     * budget.
      *
      * @param layer_index Zero-based layer index
      * @param loader Function to load layer data: (layer_index) -> vector<ToolpathSegment>
-     * @return CacheResult with pointer to segments (valid until next cache operation)
-     *
-     * @note The returned pointer is only valid until the next cache-modifying operation.
-     *       Copy the data if you need to keep it longer.
+     * @return CacheResult with the packed layer (kept alive by the shared_ptr)
      */
     CacheResult get_or_load(size_t layer_index,
                             std::function<std::vector<ToolpathSegment>(size_t)> loader);
 
+    /**
+     * @brief Load a layer ahead of use (background prefetch)
+     *
+     * Same as get_or_load(), but not counted in hit_stats() or
+     * shared_load_count(), so those reflect the layers the viewer asked for.
+     *
+     * @param layer_index Zero-based layer index
+     * @param loader Function to load layer data
+     * @return CacheResult with the packed layer
+     */
+    CacheResult preload(size_t layer_index,
+                        std::function<std::vector<ToolpathSegment>(size_t)> loader);
+
     /**
      * @brief Check if a layer is currently cached
      * @param layer_index Zero-based layer index
@@ -128,7 +147,7 @@ class GCodeLayerCache {
      * Used when layer data was loaded externally (e.g., during index building).
      *
      * @param layer_index Layer index
-     * @param segments Segment data to cache (moved into cache)
+     * @param segments Segment data to cache (packed, then released)
      * @return true if inserted, false if would exceed budget even after eviction
      */
     bool insert(size_t layer_index, std::vector<ToolpathSegment>&& segments);
@@ -173,6 +192,12 @@ class GCodeLayerCache {
      */
     std::pair<size_t, size_t> hit_stats() const;
 
+    /**
+     * @brief Get number of requests that waited for an in-flight load
+     * @return Loads shared instead of duplicated (since last reset_stats())
+     */
+    size_t shared_load_count() const;
+
     /**
      * @brief Get cache hit rate
      * @return Hit rate as fraction [0.0, 1.0]
@@ -193,6 +218,17 @@ class GCodeLayerCache {
      */
     void set_memory_budget(size_t budget_bytes);
 
+    /**
+     * @brief Set callback invoked when a layer is evicted
+     *
+     * Called for LRU, budget and pressure evictions, not for clear(). Runs
+     * under the cache mutex: keep it cheap and don't call back into the cache.
+     * Used to release the evicted layer's source pages (madvise DONTNEED).
+     *
+     * @param callback Receives the evicted layer index (nullptr to remove)
+     */
+    void set_eviction_callback(std::function<void(size_t)> callback);
+
     // =========================================================================
     // Adaptive Memory Management
     // =========================================================================
@@ -264,16 +300,39 @@ class GCodeLayerCache {
      * data alive even if this entry is evicted from the cache.
      */
     struct CacheEntry {
-        std::shared_ptr<std::vector<ToolpathSegment>> segments;
+        std::shared_ptr<const PackedLayer> layer;
         size_t memory_bytes{0}; ///< Estimated memory usage
     };
 
     /**
-     * @brief Estimate memory usage for segment vector
-     * @param segments Vector of segments
+     * @brief Estimate memory usage for a packed layer
+     * @param layer Packed layer
      * @return Estimated bytes
      */
-    static size_t estimate_memory(const std::vector<ToolpathSegment>& segments);
+    static size_t estimate_memory(const PackedLayer& layer);
+
+    /**
+     * @brief Shared implementation of get_or_load() and preload()
+     * @param count_lookup Update hit/miss/shared counters
+     */
+    CacheResult lookup_or_load(size_t layer_index,
+                               const std::function<std::vector<ToolpathSegment>(size_t)>& loader,
+                               bool count_lookup);
+
+    /**
+     * @brief Load, pack and insert a layer registered in in_flight_
+     *
+     * Called without the lock held; takes it to insert the result. The caller
+     * removes the in_flight_ entry and publishes the result to waiters.
+     *
+     * @param layer_index Layer to load
+     * @param loader Layer loader
+     * @param generation generation_ when the load started
+     * @return Result handed to the caller and to waiters
+     */
+    CacheResult load_and_insert(size_t layer_index,
+                                const std::function<std::vector<ToolpathSegment>(size_t)>& loader,
+                                uint64_t generation);
 
     /**
      * @brief Evict oldest entries until under budget
@@ -287,6 +346,12 @@ class GCodeLayerCache {
      */
     void touch(size_t layer_index);
 
+    /**
+     * @brief Invoke the eviction callback, if set
+     * @param layer_index Layer that was evicted
+     */
+    void notify_evicted(size_t layer_index);
+
     /**
      * @brief Safely subtract from memory tracking (prevents underflow)
      * @param bytes Bytes to subtract
@@ -299,6 +364,14 @@ class GCodeLayerCache {
     std::unordered_map<size_t, std::list<size_t>::iterator>
         lru_map_; ///< Layer -> iterator into lru_order_
 
+    /// A load in progress; concurrent requests for the same layer wait on it
+    struct InFlight {
+        uint64_t generation; ///< generation_ when the load started
+        std::shared_future<CacheResult> result;
+    };
+    std::unordered_map<size_t, InFlight> in_flight_;
+    uint64_t generation_{0}; ///< Bumped by clear() to discard in-flight results
+
     // Configuration
     size_t memory_budget_;
     size_t current_memory_{0};
@@ -306,10 +379,13 @@ class GCodeLayerCache {
     // Statistics
     mutable size_t hit_count_{0};
     mutable size_t miss_count_{0};
+    size_t shared_count_{0};
 
     // Thread safety
     mutable std::mutex mutex_;
 
+    std::function<void(size_t)> eviction_callback_;
+
     // Adaptive memory management
     bool adaptive_enabled_{false};
     int adaptive_target_percent_{15};         ///< Target % of available RAM
@@ -11,6 +11,8 @@
 namespace helix {
 namespace gcode {
 
+class GCodeDataSource;
+
 /**
  * @brief Compact layer entry for streaming G-code access
  *
@@ -53,7 +55,7 @@ struct LayerIndexStats {
  * @brief Layer index for streaming G-code access
  *
  * Provides random access to layers without loading the entire file.
- * Built with a single-pass scan of the file, recording byte offsets
+ * Built with a (chunk-parallel) scan of the file, recording byte offsets
  * for each layer boundary.
  *
  * Usage:
@@ -83,14 +85,86 @@ class GCodeLayerIndex {
     /**
      * @brief Build index from a G-code file
      *
-     * Single-pass scan that identifies layer boundaries by detecting
-     * Z-axis changes or ;LAYER_CHANGE markers. Records byte offset,
-     * length, and line count for each layer.
+     * Identifies layer boundaries by detecting Z-axis changes or
+     * ;LAYER_CHANGE markers. Records byte offset, length, and line count
+     * for each layer.
+     *
+     * Large files are split at newline boundaries and the chunks scanned
+     * on worker threads; a sequential stitch pass then carries layer state
+     * across chunk boundaries. The result is identical to a serial scan.
      *
      * @param filepath Path to G-code file
+     * @param thread_count Chunks/threads to use (0 = auto: one per core,
+     *        at most 8, at least 2MB per chunk)
+     * @return true if successful, false on error
+     */
+    bool build_from_file(const std::string& filepath, unsigned thread_count = 0);
+
+    /**
+     * @brief Build index by reading a data source front to back
+     *
+     * For sources without a local file (a remote file read with HTTP range
+     * requests), so the file never has to be copied to flash first. Scans
+     * serially; the result matches build_from_file() on the same bytes.
+     *
+     * @param source Source to scan (read_range() must work)
      * @return true if successful, false on error
      */
-    bool build_from_file(const std::string& filepath);
+    bool build_from_source(GCodeDataSource& source);
+
+    /**
+     * @brief Load the index from a sidecar if it is current, otherwise build and save it
+     *
+     * Reopening an unchanged file skips the scan entirely. The sidecar is
+     * keyed by the file's path, size and modification time; any mismatch
+     * rebuilds it. Sidecar failures are never fatal: the index is still built.
+     *
+     * @param filepath Path to G-code file
+     * @param cache_dir Sidecar directory (empty = always build, never save)
+     * @param thread_count Passed to build_from_file()
+     * @return true if the index is valid
+     */
+    bool load_or_build(const std::string& filepath, const std::string& cache_dir,
+                       unsigned thread_count = 0);
+
+    /**
+     * @brief Write the index to a binary sidecar file
+     *
+     * Written to a temp file and renamed into place, so readers never see a
+     * partial sidecar.
+     *
+     * @param sidecar_path Destination path
+     * @return true if written
+     */
+    bool save_sidecar(const std::string& sidecar_path) const;
+
+    /**
+     * @brief Load the index from a sidecar written by save_sidecar()
+     *
+     * Rejects sidecars with a different format version or entry layout, a bad
+     * checksum, or a source path/size/mtime that no longer matches the file.
+     * The index is left empty on failure.
+     *
+     * @param sidecar_path Sidecar file
+     * @param source_path G-code file the sidecar must describe
+     * @return true if loaded
+     */
+    bool load_sidecar(const std::string& sidecar_path, const std::string& source_path);
+
+    /**
+     * @brief Sidecar file name for a G-code file
+     * @param source_path G-code file path
+     * @param cache_dir Sidecar directory
+     * @return cache_dir + "/" + hash of the path + ".lidx"
+     */
+    static std::string sidecar_path_for(const std::string& source_path,
+                                        const std::string& cache_dir);
+
+    /// Bump when the sidecar layout or the layer detection rules change
+    static constexpr uint32_t SIDECAR_VERSION = 1;
+
+    /// Sidecars kept per cache directory (least recently used are removed)
+    static constexpr size_t MAX_SIDECARS = 32;
 
     /**
      * @brief Get entry for a specific layer
@@ -168,7 +242,7 @@ class GCodeLayerIndex {
 
     /**
      * @brief Get source file path
-     * @return Path used in build_from_file()
+     * @return Path used in build_from_file() (source name for build_from_source())
      */
     const std::string& get_source_path() const {
         return source_path_;
@@ -0,0 +1,150 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_layer_prefetcher.h
+ * @brief Background worker pool that preloads streamed G-code layers
+ *
+ * @pattern Replaceable work queue; each schedule() supersedes pending work
+ * @threading schedule()/request()/cancel() from any thread; loads run on workers
+ * @gotchas cancel() waits for in-flight loads - call it before tearing down the data source
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief Sliding window of latency samples with percentile queries
+ *
+ * Thread-safe. Keeps the most recent WINDOW samples.
+ */
+class LatencyWindow {
+  public:
+    static constexpr size_t WINDOW = 256;
+
+    void record(double ms);
+
+    /// @return Percentile (0-100) of the recorded samples in ms, 0 if none
+    double percentile(double pct) const;
+
+    size_t sample_count() const;
+
+    void reset();
+
+  private:
+    mutable std::mutex mutex_;
+    std::vector<double> samples_;
+    size_t next_{0};
+};
+
+/**
+ * @brief Small dedicated thread pool that loads layers ahead of the viewer
+ *
+ * schedule() replaces the pending queue with the window around the requested
+ * layer, so scrubbing quickly never leaves a backlog of stale loads: pending
+ * layers outside the new window are dropped (counted as cancelled). Layers on
+ * the side the user is scrubbing towards are queued first.
+ *
+ * The load function does the actual work (GCodeStreamingController passes
+ * GCodeLayerCache::get_or_load, which also deduplicates loads of a layer that
+ * is already in flight on another thread).
+ *
+ * @code
+ *   LayerPrefetcher prefetcher([&](size_t layer) { cache.get_or_load(layer, loader); });
+ *   prefetcher.schedule(current_layer, 3, layer_count - 1);
+ * @endcode
+ */
+class LayerPrefetcher {
+  public:
+    using LoadFunction = std::function<void(size_t layer_index)>;
+
+    /// Counters since construction
+    struct Stats {
+        size_t scheduled{0}; ///< Layers queued by schedule()/request()
+        size_t loaded{0};    ///< Layers handed to the load function
+        size_t cancelled{0}; ///< Queued layers dropped before loading
+    };
+
+    /**
+     * @brief Start the worker threads
+     * @param load Called on a worker thread for each layer to load
+     * @param thread_count Workers (0 = 2 on multi-core devices, otherwise 1)
+     */
+    explicit LayerPrefetcher(LoadFunction load, unsigned thread_count = 0);
+
+    /// Cancels pending work and joins the workers
+    ~LayerPrefetcher();
+
+    LayerPrefetcher(const LayerPrefetcher&) = delete;
+    LayerPrefetcher& operator=(const LayerPrefetcher&) = delete;
+
+    /**
+     * @brief Queue the layers around a center layer, replacing pending work
+     *
+     * Queue order: the center, then the layers in the scrub direction (the
+     * direction from the previous center), then the other side, nearest first.
+     *
+     * @param center_layer Layer being viewed
+     * @param radius Layers on each side
+     * @param max_layer Highest valid layer index
+     */
+    void schedule(size_t center_layer, size_t radius, size_t max_layer);
+
+    /**
+     * @brief Queue one layer ahead of the window without cancelling anything
+     * @param layer_index Layer to load
+     */
+    void request(size_t layer_index);
+
+    /**
+     * @brief Drop pending work and wait for in-flight loads to finish
+     */
+    void cancel();
+
+    /**
+     * @brief Wait until the queue is empty and no load is running
+     * @param timeout Maximum time to wait
+     * @return true if idle
+     */
+    bool wait_idle(std::chrono::milliseconds timeout) const;
+
+    /// @return Layers queued but not started
+    size_t pending() const;
+
+    Stats stats() const;
+
+    unsigned thread_count() const {
+        return static_cast<unsigned>(workers_.size());
+    }
+
+  private:
+    void worker_loop();
+    void stop();
+
+    LoadFunction load_;
+    std::vector<std::thread> workers_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_cv_;         ///< Signals new work or stop
+    mutable std::condition_variable idle_cv_; ///< Signals queue drained and no loads running
+    std::deque<size_t> queue_;
+    size_t active_{0}; ///< Loads currently running
+    bool stopping_{false};
+    bool have_center_{false};
+    size_t last_center_{0};
+    Stats stats_;
+};
+
+} // namespace gcode
+} // namespace helix
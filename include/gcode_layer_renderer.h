@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include "gcode_band_line_rasterizer.h"
+#include "gcode_object_styles.h"
+#include "gcode_packed_layer.h"
 #include "gcode_parser.h"
 #include "gcode_projection.h"
 #include "gcode_streaming_controller.h"
@@ -381,6 +384,93 @@ class GCodeLayerRenderer {
     bool has_support_detection() const;
 
   private:
+    // =========================================================================
+    // Layer Access
+    // =========================================================================
+
+    /// One segment as the drawing loops see it (positions already decoded)
+    struct SegmentRef {
+        glm::vec3 start;
+        glm::vec3 end;
+        bool is_extrusion;
+        uint16_t style_id; ///< ObjectStyleTable ID of the segment's object
+        size_t index;      ///< Position in the layer, for LayerView::object_name()
+    };
+
+    /**
+     * @brief One layer's segments from whichever source is active
+     *
+     * Streaming mode reads the controller's cached PackedLayer in place
+     * (no unpacking into ToolpathSegments); full-file mode reads the parsed
+     * Layer. Either way the loops see the same SegmentRef.
+     *
+     * Object names are resolved to style IDs once, when the view is loaded:
+     * per interned name for a PackedLayer, per segment for a parsed Layer.
+     * The loops then index the style array directly.
+     */
+    struct LayerView {
+        std::shared_ptr<const PackedLayer> packed; ///< Streaming mode; keeps the cache entry alive
+        const Layer* layer = nullptr;              ///< Full-file mode
+        /// Style IDs: by PackedLayer name index (streaming) or by segment (full file)
+        std::vector<uint16_t> style_ids;
+
+        explicit operator bool() const {
+            return packed || layer;
+        }
+
+        size_t size() const {
+            return packed ? packed->size() : (layer ? layer->segments.size() : 0);
+        }
+
+        const std::string& object_name(size_t i) const {
+            return packed ? packed->object_name(i) : layer->segments[i].object_name;
+        }
+
+        /// Call @p fn with a SegmentRef for every segment, in draw order
+        template <typename Fn> void for_each(Fn&& fn) const {
+            if (packed) {
+                for (size_t i = 0; i < packed->size(); ++i) {
+                    fn(SegmentRef{packed->start(i), packed->end(i), packed->is_extrusion(i),
+                                  style_ids[packed->object_index(i)], i});
+                }
+            } else if (layer) {
+                for (size_t i = 0; i < layer->segments.size(); ++i) {
+                    const ToolpathSegment& seg = layer->segments[i];
+                    fn(SegmentRef{seg.start, seg.end, seg.is_extrusion, style_ids[i], i});
+                }
+            }
+        }
+
+        /// Resolve this layer's object names against @p styles (fills style_ids)
+        void bind_styles(ObjectStyleTable& styles);
+    };
+
+    /**
+     * @brief Fetch a layer from either data source (thread-safe)
+     *
+     * Static so background workers can use it with their own captured sources
+     * and style table copy. Blocks while a streamed layer loads.
+     * @param styles Table the view's style IDs are resolved against
+     */
+    static LayerView load_layer_view(const ParsedGCodeFile* gcode,
+                                     GCodeStreamingController* controller, int layer,
+                                     ObjectStyleTable& styles);
+
+    /**
+     * @brief View of current_layer_, memoized across redraws (main thread)
+     *
+     * Redrawing, picking or querying an unchanged layer reuses the held
+     * PackedLayer and its resolved style IDs instead of going back to the
+     * controller.
+     */
+    const LayerView& current_layer_view() const;
+
+    /// Drop the memoized current layer view (data source changed)
+    void reset_current_layer_view() const;
+
+    mutable LayerView current_view_;
+    mutable int current_view_layer_ = -1;
+
     // =========================================================================
     // Internal Rendering
     // =========================================================================
@@ -388,10 +478,12 @@ class GCodeLayerRenderer {
     /**
      * @brief Render a single segment
      * @param layer LVGL draw layer
-     * @param seg Toolpath segment to render
+     * @param seg Segment to render
+     * @param style Style of the segment's object (from object_styles_)
      * @param ghost If true, render in ghost style (grey, for preview)
      */
-    void render_segment(lv_layer_t* layer, const ToolpathSegment& seg, bool ghost = false);
+    void render_segment(lv_layer_t* layer, const SegmentRef& seg, const ObjectStyle& style,
+                        bool ghost = false);
 
     /**
      * @brief Render L-shaped corner brackets around highlighted objects' bounding boxes
@@ -441,26 +533,21 @@ class GCodeLayerRenderer {
         return helix::gcode::project(params, x, y, z);
     }
 
-    /**
-     * @brief Check if a segment is a support structure
-     * @param seg Segment to check
-     * @return true if segment is part of support
-     */
-    bool is_support_segment(const ToolpathSegment& seg) const;
-
     /**
      * @brief Check if a segment should be rendered based on visibility settings
      * @param seg Segment to check
+     * @param style Style of the segment's object
      * @return true if segment should be rendered
      */
-    bool should_render_segment(const ToolpathSegment& seg) const;
+    bool should_render_segment(const SegmentRef& seg, const ObjectStyle& style) const;
 
     /**
      * @brief Get line color for a segment
      * @param seg Segment to get color for
+     * @param style Style of the segment's object
      * @return LVGL color
      */
-    lv_color_t get_segment_color(const ToolpathSegment& seg) const;
+    lv_color_t get_segment_color(const SegmentRef& seg, const ObjectStyle& style) const;
 
     // Data source (exactly one should be non-null)
     const ParsedGCodeFile* gcode_ = nullptr;
@@ -493,9 +580,9 @@ class GCodeLayerRenderer {
     bool use_custom_travel_color_ = false;
     bool use_custom_support_color_ = false;
 
-    // Object exclusion/highlight state
-    std::unordered_set<std::string> excluded_objects_;
-    std::unordered_set<std::string> highlighted_objects_;
+    // Object exclusion/highlight state, resolved to per-object styles
+    // (mutable: names are interned as const paths like pick_object_at() walk layers)
+    mutable ObjectStyleTable object_styles_;
 
     // Cached bounds
     float bounds_min_x_ = 0.0f;
@@ -600,29 +687,58 @@ class GCodeLayerRenderer {
     void cancel_background_ghost_render();
 
     /// Background thread entry point (renders all layers to raw buffer)
-    void background_ghost_render_thread();
+    /// @param local_styles Snapshot of object_styles_ owned by the thread
+    void background_ghost_render_thread(ObjectStyleTable local_styles);
 
     /// Copy completed raw buffer to LVGL ghost_buf_ (called on main thread)
     void copy_raw_to_ghost_buf();
 
-    /// Software Bresenham line drawing to raw ARGB8888 buffer (ghost)
-    void draw_line_bresenham(int x0, int y0, int x1, int y1, uint32_t color);
+    // =========================================================================
+    // Background Solid Cache Rendering
+    // =========================================================================
+    // Solid layers are drawn with software Bresenham (draw_raster_line), which
+    // bypasses the LVGL draw API for AD5M compatibility. Small catch-ups are
+    // drawn straight into cache_buf_; a deep range (more than layers_per_frame_
+    // layers, e.g. jumping to layer 300) is rendered by cache_rasterizer_ on
+    // worker threads and composited into cache_buf_ when complete.
+
+    /// Everything needed to turn a segment into a solid cache line (UI-thread snapshot)
+    struct SolidPassParams {
+        TransformParams transform;
+        uint32_t base_color{0}; ///< ARGB8888 extrusion color
+        bool depth_shading{false};
+        float z_min{0.0f}, z_max{0.0f}, y_min{0.0f}, y_max{0.0f};
+        bool show_extrusions{true};
+        bool show_supports{true};
+        int line_width{1};
+    };
 
-    /// Thick line drawing using parallel Bresenham lines (ghost buffer)
-    void draw_thick_line_bresenham(int x0, int y0, int x1, int y1, uint32_t color, int width);
+    /// Capture SolidPassParams for the current cache size, view and colors
+    SolidPassParams capture_solid_pass_params() const;
+
+    /**
+     * @brief Project and style a segment for the solid cache
+     * @param params Snapshot from capture_solid_pass_params()
+     * @param styles Table the segment's layer view was bound to
+     * @param seg Segment
+     * @param[out] line Line to draw
+     * @return false if the segment is not drawn (travel, hidden, zero length)
+     */
+    static bool make_solid_line(const SolidPassParams& params, const ObjectStyleTable& styles,
+                                const SegmentRef& seg, RasterLine& line);
 
-    /// Blend a pixel with alpha into the ghost raw buffer
-    void blend_pixel(int x, int y, uint32_t color);
+    /// Band rasterizer for deep catch-ups (created on first use)
+    std::unique_ptr<BandLineRasterizer> cache_rasterizer_;
 
-    /// Software Bresenham line drawing to solid cache buffer
-    /// Used for solid layer rendering, bypassing LVGL draw API for AD5M compatibility
-    void draw_line_bresenham_solid(int x0, int y0, int x1, int y1, uint32_t color);
+    /// Start rendering solid layers [from_layer, to_layer] in the background
+    /// @return false if the range is small enough to draw synchronously
+    bool start_async_cache_render(int from_layer, int to_layer);
 
-    /// Thick line drawing using parallel Bresenham lines (solid cache)
-    void draw_thick_line_bresenham_solid(int x0, int y0, int x1, int y1, uint32_t color, int width);
+    /// Composite a finished background range into cache_buf_ (main thread)
+    void finish_async_cache_render();
 
-    /// Blend a pixel directly into the solid LVGL cache buffer
-    void blend_pixel_solid(int x, int y, uint32_t color);
+    /// Drop any background range (waits for its workers)
+    void cancel_async_cache_render();
 
     /// Compute line width in pixels from extrusion width metadata and current scale
     int get_extrusion_pixel_width() const;
@@ -0,0 +1,142 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_object_styles.h
+ * @brief Object name -> small integer ID interning with a per-object style array
+ *
+ * @pattern resolve() a layer's names once when it is loaded, style() per segment;
+ *          set_excluded()/set_highlighted() rebuild the array only on change
+ * @threading Not thread-safe; background renderers take a copy
+ * @gotchas IDs are only stable until clear(); consecutive segments of the same
+ *          object hit a one-entry cache and skip hashing entirely
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief How segments of one object are drawn by the 2D layer renderer
+ *
+ * Colors are ARGB8888 (0xAARRGGBB), matching the renderer's cache buffer.
+ */
+struct ObjectStyle {
+    uint32_t color{0};       ///< Replaces the (depth-shaded) base color when has_color
+    bool has_color{false};   ///< false = use the renderer's extrusion/support/travel color
+    bool excluded{false};    ///< Object is excluded from the print
+    bool highlighted{false}; ///< Object is selected
+    bool support{false};     ///< Name looks like a support structure
+};
+
+/**
+ * @brief Interns object names and keeps one ObjectStyle per object
+ *
+ * The layer renderer used to hash each segment's object name into the
+ * excluded and highlighted sets (and lowercase it for support detection) on
+ * every redraw. Names are resolved to IDs here instead, and the style of
+ * each ID is precomputed, so the per-segment cost is an array index.
+ *
+ * @code
+ *   ObjectStyleTable styles;
+ *   styles.set_excluded({"part_2"});
+ *   std::vector<uint16_t> ids;  // once per layer
+ *   for (const auto& name : packed.names()) ids.push_back(styles.resolve(name));
+ *   for (size_t i = 0; i < packed.size(); ++i) {
+ *       const ObjectStyle& style = styles.style(ids[packed.object_index(i)]);
+ *       if (style.excluded) { ... }
+ *   }
+ * @endcode
+ */
+class ObjectStyleTable {
+  public:
+    /// ID of segments without an object name (always styled as a plain extrusion)
+    static constexpr uint16_t NO_OBJECT = 0;
+
+    /// Exclusion color (orange-red) with 60% alpha
+    static constexpr uint32_t EXCLUDED_COLOR = 0x99FF6B35;
+
+    /// Selection color (blue), opaque
+    static constexpr uint32_t HIGHLIGHTED_COLOR = 0xFF42A5F5;
+
+    ObjectStyleTable();
+
+    /**
+     * @brief Get (or assign) the ID of an object name
+     * @param name Segment object name ("" = no object)
+     * @return ID for style(); NO_OBJECT for "" or once 65535 names are interned
+     */
+    uint16_t resolve(const std::string& name);
+
+    /// @return Style of an ID returned by resolve()
+    const ObjectStyle& style(uint16_t id) const {
+        return styles_[id];
+    }
+
+    /// @return Style of a name (resolves it first; for one-off lookups, not segment loops)
+    const ObjectStyle& style_for(const std::string& name) {
+        return styles_[resolve(name)];
+    }
+
+    /**
+     * @brief Replace the excluded object set
+     * @return true if the set changed (styles were rebuilt)
+     */
+    bool set_excluded(const std::unordered_set<std::string>& names);
+
+    /**
+     * @brief Replace the highlighted object set
+     * @return true if the set changed (styles were rebuilt)
+     */
+    bool set_highlighted(const std::unordered_set<std::string>& names);
+
+    const std::unordered_set<std::string>& excluded() const {
+        return excluded_;
+    }
+
+    const std::unordered_set<std::string>& highlighted() const {
+        return highlighted_;
+    }
+
+    /// Forget interned names (new G-code); the excluded/highlighted sets are kept
+    void clear();
+
+    /// @return Number of interned names, including the NO_OBJECT entry
+    size_t size() const {
+        return styles_.size();
+    }
+
+    /**
+     * @brief Check if an object name looks like a support structure
+     *
+     * Slicers name support objects "support_*", "*_support", "SUPPORT_*" or
+     * "Support"; matched case-insensitively.
+     */
+    static bool is_support_name(const std::string& name);
+
+  private:
+    ObjectStyle make_style(const std::string& name) const;
+    void rebuild();
+
+    std::unordered_map<std::string, uint16_t> ids_;
+    std::vector<std::string> names_;  ///< Indexed by ID ([0] = "")
+    std::vector<ObjectStyle> styles_; ///< Indexed by ID
+
+    std::unordered_set<std::string> excluded_;
+    std::unordered_set<std::string> highlighted_;
+
+    // One-entry cache: slicers emit each object's moves contiguously
+    std::string last_name_;
+    uint16_t last_id_{NO_OBJECT};
+};
+
+} // namespace gcode
+} // namespace helix
@@ -0,0 +1,158 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_packed_layer.h
+ * @brief Compact struct-of-arrays storage for one layer of toolpath segments
+ *
+ * @pattern Immutable after construction; quantized positions + interned names
+ * @threading Read-only after construction, safe to share between threads
+ * @gotchas Positions are quantized to 16 bits over the layer bounds (lossy, <5um on a 300mm bed)
+ */
+
+#pragma once
+
+#include "gcode_parser.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief One layer of toolpath segments packed into parallel arrays
+ *
+ * ToolpathSegment is ~80 bytes with a heap-allocated object name repeated on
+ * every segment. PackedLayer stores the same data in ~21 bytes per segment:
+ * - start/end positions: 3 x uint16_t each, quantized over the layer bounds
+ * - extrusion amount: float
+ * - width: uint16_t in micrometres (0 = use default)
+ * - object name: uint16_t index into a per-layer interned name table
+ * - is_extrusion + tool index: one byte (top bit + 7 bits)
+ *
+ * Used by GCodeLayerCache so the same memory budget holds ~4x more layers.
+ * Segments that share an endpoint still share it after quantization, so
+ * connected paths stay connected.
+ *
+ * @code
+ *   PackedLayer packed(segments);
+ *   for (size_t i = 0; i < packed.size(); ++i) {
+ *       draw(packed.start(i), packed.end(i), packed.object_index(i));
+ *   }
+ *   std::vector<ToolpathSegment> copy = packed.unpack();
+ * @endcode
+ */
+class PackedLayer {
+  public:
+    /// Bytes per segment in the parallel arrays
+    static constexpr size_t BYTES_PER_SEGMENT = 6 * sizeof(uint16_t) + sizeof(float) +
+                                                sizeof(uint16_t) + sizeof(uint16_t) +
+                                                sizeof(uint8_t);
+
+    /// Object index of segments without an object name (names()[0] is "")
+    static constexpr uint16_t NO_OBJECT = 0;
+
+    /// Highest tool index that can be stored (larger indices are clamped)
+    static constexpr int MAX_TOOL_INDEX = 0x7F;
+
+    PackedLayer() = default;
+
+    /**
+     * @brief Pack a layer's segments
+     * @param segments Segments in draw order
+     */
+    explicit PackedLayer(const std::vector<ToolpathSegment>& segments);
+
+    size_t size() const {
+        return flags_.size();
+    }
+
+    bool empty() const {
+        return flags_.empty();
+    }
+
+    /// @return Start point of segment i (dequantized)
+    glm::vec3 start(size_t i) const {
+        return {dequantize(start_[0][i], 0), dequantize(start_[1][i], 1),
+                dequantize(start_[2][i], 2)};
+    }
+
+    /// @return End point of segment i (dequantized)
+    glm::vec3 end(size_t i) const {
+        return {dequantize(end_[0][i], 0), dequantize(end_[1][i], 1), dequantize(end_[2][i], 2)};
+    }
+
+    bool is_extrusion(size_t i) const {
+        return (flags_[i] & FLAG_EXTRUSION) != 0;
+    }
+
+    int tool_index(size_t i) const {
+        return flags_[i] & TOOL_MASK;
+    }
+
+    float extrusion_amount(size_t i) const {
+        return extrusion_[i];
+    }
+
+    /// @return Extrusion width in mm (0 = use default)
+    float width(size_t i) const {
+        return static_cast<float>(width_um_[i]) * 0.001f;
+    }
+
+    /// @return Index into names() of segment i's object
+    uint16_t object_index(size_t i) const {
+        return object_[i];
+    }
+
+    const std::string& object_name(size_t i) const {
+        return names_[object_[i]];
+    }
+
+    /// @return Interned object names; index 0 is the empty name
+    const std::vector<std::string>& names() const {
+        return names_;
+    }
+
+    /// @return Bounds of all segment endpoints (the quantization range)
+    const AABB& bounds() const {
+        return bounds_;
+    }
+
+    /// @return Largest per-axis difference between a packed and original coordinate
+    float max_position_error() const;
+
+    /// @return Segment i as a full ToolpathSegment
+    ToolpathSegment segment(size_t i) const;
+
+    /// @return All segments as ToolpathSegments
+    std::vector<ToolpathSegment> unpack() const;
+
+    /// @return Heap + object bytes used by this layer
+    size_t memory_bytes() const;
+
+  private:
+    static constexpr uint8_t FLAG_EXTRUSION = 0x80;
+    static constexpr uint8_t TOOL_MASK = 0x7F;
+
+    float dequantize(uint16_t q, int axis) const {
+        return origin_[axis] + static_cast<float>(q) * step_[axis];
+    }
+
+    AABB bounds_;
+    float origin_[3] = {0.0f, 0.0f, 0.0f}; ///< Coordinate of quantized 0 per axis
+    float step_[3] = {0.0f, 0.0f, 0.0f};   ///< mm per quantization step per axis
+
+    std::vector<uint16_t> start_[3]; ///< Quantized start X/Y/Z
+    std::vector<uint16_t> end_[3];   ///< Quantized end X/Y/Z
+    std::vector<float> extrusion_;   ///< E-axis delta (mm of filament)
+    std::vector<uint16_t> width_um_; ///< Extrusion width in micrometres
+    std::vector<uint16_t> object_;   ///< Index into names_
+    std::vector<uint8_t> flags_;     ///< FLAG_EXTRUSION | tool index
+    std::vector<std::string> names_; ///< Interned object names ([0] = "")
+};
+
+} // namespace gcode
+} // namespace helix
@@ -12,11 +12,14 @@
 
 #pragma once
 
+#include "gcode_tokenizer.h"
+
 #include <glm/glm.hpp>
 #include <limits>
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace helix {
@@ -222,7 +225,7 @@ class GCodeParser {
      * Extracts movement commands, coordinate changes, and object metadata.
      * Automatically detects layer changes (Z-axis movement).
      */
-    void parse_line(const std::string& line);
+    void parse_line(std::string_view line);
 
     /**
      * @brief Finalize parsing and return complete data structure
@@ -281,10 +284,10 @@ class GCodeParser {
 
     /**
      * @brief Parse movement command (G0, G1)
-     * @param line Trimmed G-code line
+     * @param tokens Tokenized G-code line
      * @return true if parsed successfully
      */
-    bool parse_movement_command(const std::string& line);
+    bool parse_movement_command(const GCodeTokens& tokens);
 
     /**
      * @brief Parse EXCLUDE_OBJECT_* command
@@ -330,15 +333,6 @@ class GCodeParser {
      */
     void parse_wipe_tower_marker(const std::string& comment);
 
-    /**
-     * @brief Extract parameter value from G-code line
-     * @param line G-code line
-     * @param param Parameter letter (e.g., 'X', 'Y', 'Z')
-     * @param out_value Output value
-     * @return true if parameter found
-     */
-    bool extract_param(const std::string& line, char param, float& out_value);
-
     /**
      * @brief Extract string parameter value
      * @param line G-code line
@@ -365,13 +359,6 @@ class GCodeParser {
      */
     void start_new_layer(float z);
 
-    /**
-     * @brief Trim whitespace and comments from line
-     * @param line Raw line
-     * @return Trimmed line
-     */
-    std::string trim_line(const std::string& line);
-
     // Parser state
     glm::vec3 current_position_{0.0f, 0.0f, 0.0f}; ///< Current XYZ position
     float current_e_{0.0f};                        ///< Current E (extruder) position
@@ -0,0 +1,153 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_range_block_cache.h
+ * @brief Aligned block cache in front of a slow range-read backend (HTTP)
+ *
+ * @pattern read() -> cached blocks + one coalesced fetch per run of missing
+ *          blocks (plus readahead in the scrub direction) -> LRU eviction
+ * @threading read()/stats()/clear() are thread-safe; a block being fetched by
+ *            one thread is waited for, not fetched again, by the others
+ * @gotchas The fetcher runs without the cache lock held and must be safe to
+ *          call from several threads (or serialize itself)
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief LRU cache of fixed-size, aligned blocks of a remote file
+ *
+ * MoonrakerDataSource used to issue one HTTP range request per read_range():
+ * every layer paid a full round trip, and scrubbing issued many small
+ * requests. Reads are now served from aligned block_size() blocks:
+ *
+ * - Adjacent missing blocks are fetched with a single range request
+ *   (at most MAX_FETCH_BLOCKS per request).
+ * - On a miss, the next readahead blocks in the direction the reads are
+ *   moving (forward while playing, backward while scrubbing down) are
+ *   added to the same request.
+ * - Blocks are evicted least recently used first once the cache exceeds
+ *   its byte budget, so a 300 MB file streams in a few MB of RAM.
+ *
+ * @code
+ *   RangeBlockCache cache(size, 8 << 20, [&](uint64_t off, uint32_t len,
+ *                                            std::vector<char>& out) {
+ *       return http_range_get(off, len, out);
+ *   });
+ *   auto bytes = cache.read(layer_offset, layer_length);
+ * @endcode
+ */
+class RangeBlockCache {
+  public:
+    /**
+     * @brief Reads [offset, offset + length) from the backend into out
+     * @return false on failure; fewer bytes than asked is only valid at end of file
+     */
+    using Fetcher = std::function<bool(uint64_t offset, uint32_t length, std::vector<char>& out)>;
+
+    static constexpr uint32_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+    /// Blocks fetched per range request (4 MB at the default block size)
+    static constexpr uint32_t MAX_FETCH_BLOCKS = 16;
+
+    /// Blocks fetched ahead of a miss in the read direction
+    static constexpr uint32_t DEFAULT_READAHEAD_BLOCKS = 2;
+
+    struct Stats {
+        uint64_t block_hits{0};     ///< Requested blocks already cached
+        uint64_t block_misses{0};   ///< Requested blocks that had to be fetched
+        uint64_t prefetched{0};     ///< Readahead blocks fetched
+        uint64_t fetches{0};        ///< Range requests issued
+        uint64_t bytes_fetched{0};  ///< Bytes received from the fetcher
+        uint64_t evictions{0};      ///< Blocks dropped to stay under budget
+        size_t cached_bytes{0};     ///< Bytes currently cached
+    };
+
+    /**
+     * @param file_size Size of the backing file
+     * @param budget_bytes Cache size limit (at least 2 blocks are kept)
+     * @param fetcher Backend reader
+     * @param block_size Block size in bytes
+     * @param readahead_blocks Blocks fetched ahead of a miss (0 = none)
+     */
+    RangeBlockCache(uint64_t file_size, size_t budget_bytes, Fetcher fetcher,
+                    uint32_t block_size = DEFAULT_BLOCK_SIZE,
+                    uint32_t readahead_blocks = DEFAULT_READAHEAD_BLOCKS);
+
+    RangeBlockCache(const RangeBlockCache&) = delete;
+    RangeBlockCache& operator=(const RangeBlockCache&) = delete;
+
+    /**
+     * @brief Read a byte range through the cache
+     * @return Bytes (clamped to end of file), or empty on fetch failure
+     */
+    std::vector<char> read(uint64_t offset, uint32_t length);
+
+    Stats stats() const;
+
+    /// Drop every cached block
+    void clear();
+
+    uint32_t block_size() const {
+        return block_size_;
+    }
+
+    size_t budget_bytes() const {
+        return budget_bytes_;
+    }
+
+  private:
+    struct Block {
+        std::vector<char> data;
+        std::list<uint64_t>::iterator lru; ///< Position in lru_ (front = most recent)
+    };
+
+    /// Contiguous blocks [first, first + count) fetched with one request
+    struct Run {
+        uint64_t first;
+        uint32_t count;
+    };
+
+    uint64_t block_count() const {
+        return (file_size_ + block_size_ - 1) / block_size_;
+    }
+
+    bool fetch_runs(const std::vector<Run>& runs,
+                    std::vector<std::pair<uint64_t, std::vector<char>>>& fetched);
+    void evict_to_budget();
+
+    const uint64_t file_size_;
+    const size_t budget_bytes_;
+    const Fetcher fetcher_;
+    const uint32_t block_size_;
+    const uint32_t readahead_blocks_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable fetched_cv_;
+    std::unordered_map<uint64_t, Block> blocks_;
+    std::list<uint64_t> lru_;
+    std::unordered_set<uint64_t> in_flight_; ///< Blocks some thread is fetching
+    size_t cached_bytes_{0};
+
+    uint64_t last_offset_{0};
+    int direction_{1}; ///< +1 forward, -1 backward (of the last moving read)
+
+    Stats stats_;
+};
+
+} // namespace gcode
+} // namespace helix
@@ -0,0 +1,121 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_raster_band_pool.h
+ * @brief Worker threads that rasterize TinyGL triangle chunks in horizontal bands
+ *
+ * @pattern attach() installs the pool as TinyGL's band handler; glFinish() is the join
+ * @threading attach()/detach() and all GL calls on the render thread; workers only
+ *            rasterize (glRasterChunkBand)
+ * @gotchas The framebuffer is only complete after glFinish() (or any GL call that
+ *          reads it) - read zb->pbuf directly only after that
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct GLRasterChunk;
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief Splits TinyGL rasterization of each triangle chunk across band threads
+ *
+ * With the pool attached, TinyGL queues transformed, lit and clipped triangles
+ * into chunks instead of drawing them one by one. Each chunk is rasterized by
+ * every worker at once, worker i owning rows [i*h/N, (i+1)*h/N) of the color
+ * and depth buffers, so no two threads touch the same pixel. While the workers
+ * rasterize one chunk, the render thread transforms the next one.
+ *
+ * Every band draws the triangles in submission order with the state they were
+ * queued with, so the image is identical to the serial TinyGL path.
+ *
+ * @code
+ *   RasterBandPool pool(RasterBandPool::configured_band_count());
+ *   pool.attach();
+ *   draw_triangles();
+ *   glFinish(); // framebuffer complete
+ * @endcode
+ */
+class RasterBandPool {
+  public:
+    /// Counters since construction
+    struct Stats {
+        size_t chunks{0}; ///< Chunks rasterized
+    };
+
+    /**
+     * @brief Start one worker per band
+     * @param band_count Bands (and threads); fewer if threads fail to start
+     */
+    explicit RasterBandPool(unsigned band_count);
+
+    /// Detaches from TinyGL (waiting for queued work) and joins the workers
+    ~RasterBandPool();
+
+    RasterBandPool(const RasterBandPool&) = delete;
+    RasterBandPool& operator=(const RasterBandPool&) = delete;
+
+    /**
+     * @brief Install as the current TinyGL context's band handler
+     * @return false if no worker could be started (TinyGL stays serial)
+     */
+    bool attach();
+
+    /**
+     * @brief Wait for queued triangles and return TinyGL to serial rasterization
+     *
+     * Must be called before glClose() of the context the pool is attached to.
+     */
+    void detach();
+
+    unsigned band_count() const {
+        return static_cast<unsigned>(workers_.size());
+    }
+
+    Stats stats() const;
+
+    /**
+     * @brief Rasterizer band count from settings
+     *
+     * Checks in order:
+     * 1. HELIX_GCODE_RASTER_THREADS env var
+     * 2. Config file gcode_viewer.raster_threads
+     * 3. 0 = auto: one band per core, at most 4 (1 on single-core devices)
+     *
+     * @return Bands to use, 1 = serial rasterization on the render thread
+     */
+    static unsigned configured_band_count();
+
+  private:
+    static void dispatch_thunk(void* user, const GLRasterChunk* chunk);
+    static void wait_thunk(void* user);
+
+    void dispatch(const GLRasterChunk* chunk);
+    void wait();
+    void worker_loop(unsigned band);
+    void stop();
+
+    std::vector<std::thread> workers_;
+    bool attached_{false};
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_cv_; ///< Signals a new chunk or stop
+    std::condition_variable done_cv_; ///< Signals all bands finished the chunk
+    const GLRasterChunk* chunk_{nullptr};
+    uint64_t generation_{0}; ///< Bumped per dispatched chunk
+    unsigned remaining_{0};  ///< Bands still rasterizing the current chunk
+    bool stopping_{false};
+    Stats stats_;
+};
+
+} // namespace gcode
+} // namespace helix
@@ -0,0 +1,99 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_ribbon_submitter.h
+ * @brief Submits RibbonGeometry triangle strips to TinyGL with retained per-pass state
+ *
+ * @pattern prepare() once per pass (retained palettes), submit() per layer range
+ * @threading Render thread only (TinyGL context is not thread-safe)
+ * @gotchas Elides glNormal/glColor calls across strips - nothing else may change the
+ *          current color or normal between prepare() and the last submit() of a pass
+ */
+
+#pragma once
+
+#include "gcode_geometry_builder.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief Feeds ribbon strips to TinyGL without per-vertex conversion work
+ *
+ * The straightforward submission loop converts every vertex's palette color
+ * to floats (three divides plus the dim factor), looks up its normal and
+ * re-issues glNormal/glColor for all four corners of every strip - even though
+ * a flat-shaded face has one normal and neighbouring strips usually share a
+ * color. In TinyGL each glColor with GL_COLOR_MATERIAL also updates the
+ * material, so the redundant calls are not free.
+ *
+ * RibbonSubmitter keeps a float color palette (already dimmed) that is rebuilt
+ * only when the geometry's palette or the dim factor changes, and skips
+ * glNormal/glColor when the palette index is the same as the last vertex.
+ * Output is pixel-identical to the per-vertex loop.
+ *
+ * TinyGL's glDrawArrays and display lists replay the same per-vertex ops
+ * (glArrayElement calls glColor for every vertex) while needing float copies
+ * of the geometry (~36-60 bytes per vertex vs 10), so they are not used.
+ *
+ * @code
+ *   submitter.prepare(geometry, dim_factor);
+ *   for (auto [first, count] : visible_layer_ranges) {
+ *       submitter.submit(first, count);
+ *   }
+ * @endcode
+ */
+class RibbonSubmitter {
+  public:
+    /**
+     * @brief Bind geometry for the next submit() calls and reset state elision
+     *
+     * Rebuilds the float color palette only if the geometry's palette or the
+     * dim factor changed since the last call.
+     *
+     * @param geometry Geometry to draw (must outlive the submit() calls)
+     * @param dim_factor Color multiplier (1.0 = full, ghost layers use less)
+     */
+    void prepare(const RibbonGeometry& geometry, float dim_factor);
+
+    /**
+     * @brief Submit a contiguous range of strips
+     * @param first_strip Index of the first strip
+     * @param strip_count Number of strips (clamped to the geometry)
+     */
+    void submit(size_t first_strip, size_t strip_count);
+
+    /**
+     * @brief Drop the retained palette (next prepare() rebuilds it)
+     */
+    void invalidate();
+
+    /// @return Number of palette rebuilds (for tests and stats)
+    size_t palette_rebuilds() const {
+        return palette_rebuilds_;
+    }
+
+  private:
+    static constexpr uint32_t NO_INDEX = UINT32_MAX;
+
+    const RibbonGeometry* geometry_{nullptr};
+
+    // Retained state: rebuilt when the source palette or dim factor changes
+    std::vector<uint32_t> source_palette_;
+    std::vector<std::array<float, 3>> colors_; ///< Dimmed RGB per palette entry
+    float dim_factor_{-1.0f};
+    size_t palette_rebuilds_{0};
+
+    // Last state sent to TinyGL (reset by prepare())
+    uint32_t last_normal_{NO_INDEX};
+    uint32_t last_color_{NO_INDEX};
+};
+
+} // namespace gcode
+} // namespace helix
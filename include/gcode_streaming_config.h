@@ -79,4 +79,72 @@ bool should_use_gcode_streaming(size_t file_size_bytes);
  */
 std::string get_streaming_config_description();
 
+/**
+ * @brief Determine if streamed G-code files should be memory-mapped
+ *
+ * Checks in order:
+ * 1. HELIX_GCODE_MMAP env var ("on", "off", "auto")
+ * 2. Config file gcode_viewer.mmap
+ * 3. AUTO: on for 64-bit targets; 32-bit targets use stdio because a large
+ *    file can exhaust the address space
+ *
+ * @return true to open FileDataSource in MMAP mode
+ */
+bool use_gcode_mmap();
+
+/**
+ * @brief Determine if streamed G-code layer indexes should be cached on disk
+ *
+ * Checks in order:
+ * 1. HELIX_GCODE_INDEX_CACHE env var ("on", "off")
+ * 2. Config file gcode_viewer.index_cache
+ * 3. Default: on
+ *
+ * @return true to load/save layer index sidecars in the "gcode_index" cache dir
+ */
+bool use_gcode_index_cache();
+
+/**
+ * @brief Read an integer G-code viewer setting
+ *
+ * Checks in order:
+ * 1. Environment variable @p env_name, parsed by EnvironmentConfig::get_int();
+ *    a value that is not an integer in [min, max] is logged and ignored
+ * 2. Config file key @p config_key, clamped to [min, max]
+ * 3. @p default_value
+ *
+ * Every HELIX_GCODE_* numeric variable goes through this, so they all
+ * validate the same way.
+ *
+ * @param env_name Environment variable, e.g. "HELIX_GCODE_RASTER_THREADS"
+ * @param config_key Config JSON pointer, e.g. "/gcode_viewer/raster_threads"
+ * @return Setting value in [min, max]
+ */
+int get_gcode_int_setting(const char* env_name, const char* config_key, int default_value,
+                          int min, int max);
+
+/**
+ * @brief Get the disk budget for cached 3D preview geometry
+ *
+ * Checks in order:
+ * 1. HELIX_GCODE_GEOMETRY_CACHE_MB env var (0-1024, 0 = off)
+ * 2. Config file gcode_viewer.geometry_cache_mb
+ * 3. Default: 64 MB
+ *
+ * @return Budget in bytes for the "gcode_geometry" cache dir (0 = don't cache)
+ */
+size_t get_gcode_geometry_cache_bytes();
+
+/**
+ * @brief Get the RAM budget for cached blocks of remotely streamed G-code
+ *
+ * Checks in order:
+ * 1. HELIX_GCODE_REMOTE_CACHE_MB env var (1-256)
+ * 2. Config file gcode_viewer.remote_cache_mb
+ * 3. Default: 8 MB
+ *
+ * @return Budget in bytes for MoonrakerDataSource's range block cache
+ */
+size_t get_gcode_remote_cache_bytes();
+
 } // namespace helix
@@ -6,6 +6,7 @@
 #include "gcode_data_source.h"
 #include "gcode_layer_cache.h"
 #include "gcode_layer_index.h"
+#include "gcode_layer_prefetcher.h"
 #include "gcode_parser.h"
 #include "gcode_streaming_config.h"
 
@@ -168,6 +169,17 @@ class GCodeStreamingController {
     /// Default prefetch radius (layers around current view to preload)
     static constexpr size_t DEFAULT_PREFETCH_RADIUS = 3;
 
+    /// Layer loading performance counters (see get_streaming_stats())
+    struct StreamingStats {
+        float cache_hit_rate{0.0f};     ///< Cache hits / lookups [0.0, 1.0]
+        double p95_layer_ready_ms{0.0}; ///< 95th percentile get_packed_layer() latency
+        size_t latency_samples{0};      ///< Samples behind p95_layer_ready_ms
+        size_t prefetch_scheduled{0};   ///< Layers queued for background loading
+        size_t prefetch_loaded{0};      ///< Layers loaded by the prefetch workers
+        size_t prefetch_cancelled{0};   ///< Queued layers dropped by a layer jump
+        size_t shared_loads{0};         ///< Requests that awaited an in-flight load
+    };
+
     /// Minimum cache budget (1MB)
     static constexpr size_t MIN_CACHE_BUDGET = 1 * 1024 * 1024;
 
@@ -279,20 +291,34 @@ class GCodeStreamingController {
      * Returns cached data if available, otherwise loads from source.
      * Thread-safe but blocks if loading is needed.
      *
+     * The cache keeps layers packed; this decodes a fresh vector on every
+     * call. Prefer get_packed_layer() for repeated or per-frame access.
+     *
      * @param layer_index Zero-based layer index
      * @return Shared pointer to segment vector, or nullptr if layer doesn't exist.
      *         Data stays valid as long as the shared_ptr is held, even if the
      *         cache entry is evicted. This is critical for thread safety.
      *
-     * @note For background loading, use request_layer() + is_layer_ready()
+     * @note For background loading, use request_layer() + is_layer_cached()
      */
     std::shared_ptr<const std::vector<ToolpathSegment>> get_layer_segments(size_t layer_index);
 
+    /**
+     * @brief Get a layer's segments in their cached, packed form
+     *
+     * Same loading and prefetch behavior as get_layer_segments(), without
+     * decoding.
+     *
+     * @param layer_index Zero-based layer index
+     * @return Shared pointer to the packed layer, or nullptr if layer doesn't exist
+     */
+    std::shared_ptr<const PackedLayer> get_packed_layer(size_t layer_index);
+
     /**
      * @brief Request a layer to be loaded (non-blocking)
      *
-     * If layer is not cached, queues it for background loading.
-     * Check is_layer_ready() or get_layer_segments() later.
+     * If layer is not cached, queues it for background loading ahead of the
+     * prefetch window. Check is_layer_cached() or get_layer_segments() later.
      *
      * @param layer_index Zero-based layer index
      */
@@ -308,15 +334,36 @@ class GCodeStreamingController {
     /**
      * @brief Prefetch layers around current view
      *
-     * Loads layers in range [center - radius, center + radius].
-     * Called automatically by get_layer_segments() but can be
-     * called explicitly for more control.
+     * Queues layers in range [center - radius, center + radius] on the
+     * background prefetch workers, layers in the scrub direction first.
+     * Pending loads outside the range are cancelled, so jumping to a distant
+     * layer doesn't wait behind a stale window. Called automatically by
+     * get_layer_segments() but can be called explicitly for more control.
      *
      * @param center_layer Center layer index
      * @param radius Number of layers on each side (default: 3)
      */
     void prefetch_around(size_t center_layer, size_t radius = DEFAULT_PREFETCH_RADIUS);
 
+    /**
+     * @brief Set the radius used by automatic prefetching
+     * @param radius Layers on each side of the viewed layer
+     */
+    void set_prefetch_radius(size_t radius);
+
+    /**
+     * @brief Get the radius used by automatic prefetching
+     * @return Layers on each side of the viewed layer
+     */
+    size_t get_prefetch_radius() const;
+
+    /**
+     * @brief Wait for queued and running prefetch loads to finish
+     * @param timeout Maximum time to wait
+     * @return true if the prefetch workers are idle
+     */
+    bool wait_for_prefetch(std::chrono::milliseconds timeout);
+
     // =========================================================================
     // Layer Information
     // =========================================================================
@@ -363,6 +410,12 @@ class GCodeStreamingController {
      */
     float get_cache_hit_rate() const;
 
+    /**
+     * @brief Get layer loading statistics
+     * @return Hit rate, layer-ready latency and prefetch counters
+     */
+    StreamingStats get_streaming_stats() const;
+
     /**
      * @brief Get current cache memory usage
      * @return Bytes used
@@ -432,6 +485,22 @@ class GCodeStreamingController {
      */
     std::function<std::vector<ToolpathSegment>(size_t)> make_loader();
 
+    /**
+     * @brief Load one layer into the cache (prefetch worker entry point)
+     * @param layer_index Layer to load; skipped if already cached or file closed
+     */
+    void prefetch_layer(size_t layer_index);
+
+    /**
+     * @brief Tell the data source an evicted layer's bytes are no longer needed
+     *
+     * Installed as the cache eviction callback. Only memory-mapped sources act
+     * on it, dropping the layer's page-cache pages from our mapping.
+     *
+     * @param layer_index Evicted layer
+     */
+    void release_layer_bytes(size_t layer_index);
+
     // Components (order matters for destruction)
     std::unique_ptr<GCodeDataSource> data_source_;
     GCodeLayerIndex index_;
@@ -449,12 +518,19 @@ class GCodeStreamingController {
     std::unique_ptr<GCodeHeaderMetadata> header_metadata_;
     bool metadata_extracted_{false};
 
+    // Serializes data source reads (stdio sources share one FILE*)
+    std::mutex source_mutex_;
+
     // State
     std::atomic<bool> is_open_{false};
-    size_t prefetch_radius_{DEFAULT_PREFETCH_RADIUS};
+    std::atomic<size_t> prefetch_radius_{DEFAULT_PREFETCH_RADIUS};
+    LatencyWindow layer_ready_latency_;
 
     // Empty stats for when not open
     static const LayerIndexStats empty_stats_;
+
+    // Background loading - declared last so workers stop before the members above go away
+    LayerPrefetcher prefetcher_;
 };
 
 } // namespace gcode
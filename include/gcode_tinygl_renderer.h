@@ -7,8 +7,11 @@
 #pragma once
 
 #include "gcode_camera.h"
+#include "gcode_framebuffer_blit.h"
 #include "gcode_geometry_builder.h"
 #include "gcode_parser.h"
+#include "gcode_raster_band_pool.h"
+#include "gcode_ribbon_submitter.h"
 
 #include <lvgl/lvgl.h>
 
@@ -498,6 +501,7 @@ class GCodeTinyGLRenderer {
     // TinyGL context (opaque pointer to avoid header dependency)
     void* zbuffer_{nullptr};
     unsigned int* framebuffer_{nullptr};
+    std::unique_ptr<RasterBandPool> raster_pool_; ///< Band rasterizer threads (null = serial)
 
     // Geometry (full detail + coarse LOD for interaction)
     std::unique_ptr<GeometryBuilder> geometry_builder_;
@@ -505,12 +509,15 @@ class GCodeTinyGLRenderer {
     std::optional<RibbonGeometry> coarse_geometry_; ///< Coarse LOD (for interaction)
     RibbonGeometry* active_geometry_{nullptr}; ///< Currently rendering geometry (set per-frame)
     std::string current_gcode_filename_;       // Track if we need to rebuild
+    RibbonSubmitter submitter_; ///< Strip submission with retained color palette
 
     /// Use LOD geometry during interaction (Phase 6 optimization)
     bool use_lod_for_interaction_{true};
 
     // LVGL image buffer for display
     lv_draw_buf_t* draw_buf_{nullptr};
+    FramebufferBlitter blitter_;      ///< Framebuffer -> draw_buf_ conversion/upscale
+    bool native_color_format_{true}; ///< Output in the display's color format (config)
 
     // ==============================================
     // Render State Caching (dirty flag optimization)
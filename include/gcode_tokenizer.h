@@ -0,0 +1,170 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @file gcode_tokenizer.h
+ * @brief Allocation-free G-code line splitting and tokenizing
+ *
+ * Shared by GCodeParser (full parse) and GCodeLayerIndex (layer scan).
+ * Hot loops are vectorized with SSE2 on x86-64 and NEON on ARM, with a
+ * scalar fallback elsewhere:
+ * - find_newline(): 16 bytes per step
+ * - tokenize_gcode_line(): one pass finds the comment start and the first
+ *   X/Y/Z/E/F letter of the command, 16 bytes per step
+ *
+ * Numbers are parsed straight from the line with parse_gcode_float() instead
+ * of going through std::string + std::stof.
+ */
+
+/// Parameter letters located by tokenize_gcode_line() (case-insensitive)
+enum class GCodeAxis : uint8_t { X = 0, Y, Z, E, F, COUNT };
+
+/**
+ * @brief One G-code line split into command and comment
+ *
+ * Views point into the tokenized line and are only valid while it is.
+ */
+struct GCodeTokens {
+    static constexpr uint16_t NO_AXIS = 0xFFFF;
+
+    std::string_view code;    ///< Command text, comment stripped, whitespace trimmed
+    std::string_view comment; ///< From ';' to end of line (empty if none)
+
+    /// Offset in code of the first occurrence of each parameter letter
+    uint16_t axis_pos[static_cast<size_t>(GCodeAxis::COUNT)] = {NO_AXIS, NO_AXIS, NO_AXIS,
+                                                                NO_AXIS, NO_AXIS};
+
+    /// @return true if the command contains the parameter letter
+    bool has(GCodeAxis axis) const {
+        return axis_pos[static_cast<size_t>(axis)] != NO_AXIS;
+    }
+
+    /// @return Characters following the first occurrence of the letter (empty if absent)
+    std::string_view after(GCodeAxis axis) const {
+        uint16_t pos = axis_pos[static_cast<size_t>(axis)];
+        return pos == NO_AXIS ? std::string_view() : code.substr(pos + 1u);
+    }
+
+    /**
+     * @brief Parse the value of a parameter (first occurrence of its letter)
+     *
+     * @param axis Parameter letter
+     * @param out_value Parsed value
+     * @param require_word_start Letter must start a word (follow whitespace or
+     *        start the command), as GCodeParser requires
+     * @return true if the letter is present and followed by a number
+     */
+    bool param(GCodeAxis axis, float& out_value, bool require_word_start = true) const;
+};
+
+/**
+ * @brief Tokenize one line (without its '\n')
+ * @param line Raw line, may contain a comment and a trailing '\r'
+ * @return Command/comment views and parameter letter positions
+ */
+GCodeTokens tokenize_gcode_line(std::string_view line);
+
+/**
+ * @brief Find the next '\n'
+ * @return Pointer to the newline, or end if there is none
+ */
+const char* find_newline(const char* begin, const char* end);
+
+/**
+ * @brief Parse a G-code number: [+-]digits[.digits]
+ *
+ * No exponents, matching how G-code parameters are written. Stops at the
+ * first character that can't continue the number.
+ *
+ * @param begin Start of the number
+ * @param end End of the available text
+ * @param out_value Parsed value
+ * @param stop If non-null, receives the first unparsed character
+ * @return false if no digits were found
+ */
+bool parse_gcode_float(const char* begin, const char* end, float& out_value,
+                       const char** stop = nullptr);
+
+/// @return Name of the compiled-in SIMD backend ("sse2", "neon" or "scalar")
+const char* gcode_tokenizer_backend();
+
+/**
+ * @brief Reads a file line by line through a large reusable buffer
+ *
+ * Replaces std::getline() loops: one fread per chunk, lines handed out as
+ * views into the buffer (no per-line allocation or copy). Lines keep any
+ * trailing '\r', like std::getline().
+ *
+ * Can be limited to a byte range of the file, so several readers can scan
+ * newline-aligned chunks of one file in parallel.
+ *
+ * @code
+ *   GCodeLineReader reader(path);
+ *   std::string_view line;
+ *   while (reader.next(line)) {
+ *       parser.parse_line(line);
+ *   }
+ * @endcode
+ */
+class GCodeLineReader {
+  public:
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 256 * 1024;
+
+    /**
+     * @brief Open a file for line reading
+     * @param filepath File to read
+     * @param chunk_size Read buffer size (grows if a line is longer)
+     * @param begin First byte to read (should start a line)
+     * @param end Byte after the last one to read (clamped to end of file)
+     */
+    explicit GCodeLineReader(const std::string& filepath, size_t chunk_size = DEFAULT_CHUNK_SIZE,
+                             uint64_t begin = 0,
+                             uint64_t end = std::numeric_limits<uint64_t>::max());
+    ~GCodeLineReader();
+
+    GCodeLineReader(const GCodeLineReader&) = delete;
+    GCodeLineReader& operator=(const GCodeLineReader&) = delete;
+
+    bool is_open() const {
+        return file_ != nullptr;
+    }
+
+    /**
+     * @brief Get the next line
+     * @param line Receives the line without '\n' (valid until the next call)
+     * @return false at end of file
+     */
+    bool next(std::string_view& line);
+
+    /// @return Byte offset of the line last returned by next()
+    uint64_t line_offset() const {
+        return line_offset_;
+    }
+
+  private:
+    bool refill();
+
+    FILE* file_{nullptr};
+    std::vector<char> buffer_;
+    size_t pos_{0};             ///< Start of unread data in buffer_
+    size_t end_{0};             ///< End of valid data in buffer_
+    uint64_t buffer_offset_{0}; ///< File offset of buffer_[0]
+    uint64_t line_offset_{0};
+    uint64_t remaining_{0}; ///< Bytes left to read before the range end
+    bool eof_{false};
+};
+
+} // namespace gcode
+} // namespace helix
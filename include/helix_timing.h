@@ -15,9 +15,8 @@
 
 #ifdef HELIX_DISPLAY_SDL
 #include <SDL.h>
-#else
-#include <time.h>
 #endif
+#include <time.h>
 
 namespace helix {
 namespace timing {
@@ -57,5 +56,20 @@ inline void delay(uint32_t ms) {
 
 #endif
 
+/**
+ * @brief Monotonic microsecond clock for profiling
+ *
+ * Same clock on every build; the epoch is arbitrary, so only differences
+ * (and ordering between threads) are meaningful.
+ *
+ * @return Microseconds since an unspecified starting point
+ */
+inline uint64_t get_micros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000ULL +
+           static_cast<uint64_t>(ts.tv_nsec) / 1000ULL;
+}
+
 } // namespace timing
 } // namespace helix
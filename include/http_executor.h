@@ -0,0 +1,209 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file http_executor.h
+ * @brief Bounded HTTP worker pool with per-host keep-alive connections
+ *
+ * @pattern submit() jobs with a priority; each job runs on a worker with that
+ *          worker's HttpSession, which reuses one keep-alive connection per host
+ * @threading submit()/metrics() from any thread; jobs run on workers
+ * @gotchas Jobs dropped by still_wanted or shutdown() never run, so
+ *          none of their callbacks fire. Workers start lazily on first use.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// libhv types (global namespace / hv::) - kept out of this header
+class HttpRequest;
+class HttpResponse;
+namespace hv {
+class HttpClient;
+}
+
+namespace helix {
+
+/// Scheduling class of an HTTP job (lower runs first)
+enum class HttpPriority : uint8_t {
+    VISIBLE = 0, ///< On screen right now (thumbnails of visible cards, detail views)
+    NORMAL = 1,  ///< REST calls, metadata, history
+    BULK = 2,    ///< Long file transfers; never allowed to occupy every worker
+};
+
+/// Per-job scheduling options
+struct HttpJobOptions {
+    HttpPriority priority = HttpPriority::NORMAL;
+
+    /// Checked on a worker right before the job starts; returning false drops
+    /// it (e.g. the panel that asked for a thumbnail is gone). Runs off the UI
+    /// thread, so it must only read state it shares ownership of.
+    std::function<bool()> still_wanted;
+};
+
+/// Counters shared by an executor and its workers' sessions
+struct HttpConnectionCounters {
+    std::atomic<uint64_t> requests{0};           ///< Requests sent
+    std::atomic<uint64_t> connections_opened{0}; ///< New TCP connections
+    std::atomic<uint64_t> connections_reused{0}; ///< Requests on an already-open connection
+};
+
+/**
+ * @brief One worker's HTTP client: a keep-alive connection per host
+ *
+ * Drop-in for libhv's requests::get/post/request, which open (and close) a
+ * fresh TCP connection per call. Connections idle for longer than
+ * IDLE_TIMEOUT are reopened rather than risked, and a GET that fails on a
+ * reused connection (server closed it) is retried once on a new one.
+ */
+class HttpSession {
+  public:
+    /// Hosts kept open per session (printer, Spoolman, a WLED device, ...)
+    static constexpr size_t MAX_HOSTS = 4;
+
+    /// Reopen connections idle for longer than this
+    static constexpr std::chrono::seconds IDLE_TIMEOUT{30};
+
+    explicit HttpSession(HttpConnectionCounters& counters);
+    ~HttpSession();
+
+    HttpSession(const HttpSession&) = delete;
+    HttpSession& operator=(const HttpSession&) = delete;
+
+    /// Send a prepared request
+    /// @return Response, or nullptr on connection failure (like requests::request)
+    std::shared_ptr<HttpResponse> send(const std::shared_ptr<HttpRequest>& req);
+
+    /// GET url (like requests::get)
+    std::shared_ptr<HttpResponse> get(const std::string& url);
+
+    /// POST body to url (like requests::post)
+    std::shared_ptr<HttpResponse> post(const std::string& url, const std::string& body);
+
+    /// Close every open connection
+    void close_all();
+
+    /// @return "scheme://host:port" connection key of a URL ("" if unparseable)
+    static std::string host_key(const std::string& url);
+
+  private:
+    struct Connection {
+        std::unique_ptr<hv::HttpClient> client;
+        std::chrono::steady_clock::time_point last_used;
+        bool keep_alive{false}; ///< Server agreed to keep the last connection open
+    };
+
+    Connection& connection_for(const std::string& key);
+
+    HttpConnectionCounters& counters_;
+    std::unordered_map<std::string, Connection> connections_;
+};
+
+/**
+ * @brief Fixed-size pool that runs HTTP jobs by priority
+ *
+ * MoonrakerAPI used to spawn a thread per HTTP call, each with its own TCP
+ * connection - opening Print Select with 60 files meant dozens of threads
+ * and handshakes at once. Jobs are queued here instead and run by at most
+ * worker_count() threads, VISIBLE before NORMAL before BULK, FIFO within a
+ * priority. At most max_bulk() BULK jobs run at once so a multi-minute
+ * upload can't starve thumbnails.
+ *
+ * Jobs are dropped through HttpJobOptions::still_wanted rather than by
+ * handle: the requester decides when the job is picked, so a queued job whose
+ * panel went away is skipped without anyone having to track it.
+ *
+ * @code
+ *   HttpExecutor executor(3);
+ *   executor.submit([](HttpSession& http) {
+ *       auto resp = http.get(url);
+ *   }, {HttpPriority::VISIBLE, [ctx] { return ctx.is_valid(); }});
+ * @endcode
+ */
+class HttpExecutor {
+  public:
+    using Job = std::function<void(HttpSession&)>;
+
+    /// Default worker cap (sized for 512 MB boards)
+    static constexpr unsigned DEFAULT_WORKERS = 3;
+
+    struct Metrics {
+        size_t queue_depth{0};      ///< Jobs waiting right now
+        size_t peak_queue_depth{0}; ///< Largest queue_depth seen
+        unsigned active{0};         ///< Jobs running right now
+        unsigned workers{0};        ///< Worker threads started
+        uint64_t submitted{0};
+        uint64_t completed{0};
+        uint64_t dropped{0}; ///< still_wanted returned false, or shut down while queued
+        uint64_t requests{0};
+        uint64_t connections_opened{0};
+        uint64_t connections_reused{0};
+
+        /// @return Fraction of requests sent on an existing connection (0 if none sent)
+        double reuse_ratio() const {
+            return requests == 0 ? 0.0
+                                 : static_cast<double>(connections_reused) /
+                                       static_cast<double>(requests);
+        }
+    };
+
+    /**
+     * @param max_workers Worker threads (at least 1)
+     * @param max_bulk Concurrent BULK jobs (0 = max_workers - 1, at least 1)
+     */
+    explicit HttpExecutor(unsigned max_workers = DEFAULT_WORKERS, unsigned max_bulk = 0);
+
+    /// shutdown() with the default timeout
+    ~HttpExecutor();
+
+    HttpExecutor(const HttpExecutor&) = delete;
+    HttpExecutor& operator=(const HttpExecutor&) = delete;
+
+    /**
+     * @brief Queue a job
+     * @return false if it was not queued (empty job, or after shutdown())
+     */
+    bool submit(Job job, HttpJobOptions options = {});
+
+    /**
+     * @brief Stop accepting jobs, drop queued ones and wait for running ones
+     *
+     * File transfers can block in libhv for a long time, so workers still
+     * running after the timeout are detached and finish (or die) with the
+     * process; they only touch state they share ownership of.
+     *
+     * @return true if every worker finished within the timeout
+     */
+    bool shutdown(std::chrono::milliseconds timeout = std::chrono::seconds(2));
+
+    Metrics metrics() const;
+
+    unsigned max_workers() const {
+        return max_workers_;
+    }
+
+    unsigned max_bulk() const {
+        return max_bulk_;
+    }
+
+  private:
+    struct State;
+
+    static void worker_loop(std::shared_ptr<State> state);
+
+    const unsigned max_workers_;
+    const unsigned max_bulk_;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace helix
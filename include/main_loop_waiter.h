@@ -0,0 +1,180 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file main_loop_waiter.h
+ * @brief Blocking wait and wakeup accounting for the idle-aware main loop
+ *
+ * The main loop used to run lv_timer_handler() and then sleep a fixed 5ms,
+ * waking ~200 times a second even when nothing on screen changed. It now
+ * sleeps until the next LVGL timer deadline, or until one of:
+ * - an input device becomes readable (evdev touch/pointer)
+ * - another thread queues UI work or a Moonraker notification (wake())
+ *
+ * @pattern LoopWaiter wraps a poll() set of one eventfd (or pipe) plus input
+ *          fds; LoopStats counts wakeups and input-to-frame latency
+ * @threading wait() and LoopStats on the main thread only; wake() from any
+ *            thread or a signal handler
+ * @gotchas Input fds are separate opens of the same /dev/input nodes LVGL
+ *          reads. evdev gives every reader its own copy of each event, so the
+ *          waiter just drains and discards its copy.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace helix::application {
+
+/**
+ * @brief Why LoopWaiter::wait() returned
+ */
+struct LoopWakeResult {
+    bool input = false; ///< An input device became readable
+    bool woken = false; ///< wake() was called (queued work, notification, quit)
+
+    [[nodiscard]] bool timed_out() const {
+        return !input && !woken;
+    }
+};
+
+/**
+ * @brief poll()-based sleep that other threads and input devices can cut short
+ */
+class LoopWaiter {
+  public:
+    LoopWaiter() = default;
+    ~LoopWaiter();
+
+    LoopWaiter(const LoopWaiter&) = delete;
+    LoopWaiter& operator=(const LoopWaiter&) = delete;
+
+    /**
+     * @brief Create the wake channel (eventfd on Linux, a pipe elsewhere)
+     *
+     * @return false if no channel could be created; wait() then just sleeps
+     */
+    bool init();
+
+    /**
+     * @brief Watch an input device node for readability
+     *
+     * @param device_path e.g. /dev/input/event0
+     * @return true if the device was opened
+     */
+    bool watch_input(const std::string& device_path);
+
+    /**
+     * @brief Watch an already-open fd as an input source (takes ownership)
+     *
+     * @param fd Non-blocking readable fd
+     * @return true if the fd was added
+     */
+    bool watch_input_fd(int fd);
+
+    /// Number of input sources still being watched (unplugged devices drop out)
+    [[nodiscard]] size_t input_count() const {
+        return input_fds_.size();
+    }
+
+    /**
+     * @brief Interrupt the current (or next) wait()
+     *
+     * Thread-safe and async-signal-safe. Repeated calls before the waiter
+     * runs collapse into one wakeup.
+     */
+    void wake();
+
+    /**
+     * @brief Sleep until timeout, wake() or input
+     *
+     * Drains the wake channel and any readable input fds before returning.
+     *
+     * @param timeout_ms Longest time to sleep (0 = just poll)
+     */
+    LoopWakeResult wait(uint32_t timeout_ms);
+
+  private:
+    void drain_wake();
+    void drain_inputs();
+
+    int wake_read_fd_ = -1;  ///< eventfd, or pipe read end
+    int wake_write_fd_ = -1; ///< Same as wake_read_fd_ for eventfd
+    std::vector<int> input_fds_;
+};
+
+/**
+ * @brief Main loop wakeup and input latency counters
+ *
+ * A wakeup is "idle" when it was not caused by input and no frame was
+ * rendered before the next one - i.e. the loop woke for nothing visible.
+ * Input latency is measured from the wakeup that saw the input to the end
+ * of the next rendered frame.
+ */
+class LoopStats {
+  public:
+    /// Upper bounds (exclusive) of the latency histogram buckets; the last bucket is open
+    static constexpr std::array<uint32_t, 6> LATENCY_LIMITS_MS = {8, 16, 33, 50, 100, 250};
+    static constexpr size_t LATENCY_BUCKETS = LATENCY_LIMITS_MS.size() + 1;
+
+    /// Input with no frame within this long produced no visible change; not a latency sample
+    static constexpr uint32_t LATENCY_GIVE_UP_MS = 1000;
+
+    struct Report {
+        uint32_t elapsed_ms = 0;
+        uint64_t wakeups = 0;
+        uint64_t idle_wakeups = 0;
+        uint64_t input_wakeups = 0;
+        uint64_t work_wakeups = 0;  ///< wake() calls
+        uint64_t timer_wakeups = 0; ///< Timeouts (LVGL timer deadline or housekeeping)
+        uint64_t frames = 0;
+        std::array<uint64_t, LATENCY_BUCKETS> latency_histogram{};
+        uint64_t latency_samples = 0;
+        uint32_t latency_max_ms = 0;
+
+        [[nodiscard]] double wakeups_per_sec() const;
+        [[nodiscard]] double idle_wakeups_per_sec() const;
+
+        /**
+         * @brief Upper bound of the bucket holding the given percentile
+         *
+         * @param fraction e.g. 0.95
+         * @return Bucket limit in ms, latency_max_ms for the open bucket, 0 if no samples
+         */
+        [[nodiscard]] uint32_t latency_percentile_ms(double fraction) const;
+
+        /// One-line summary for the log
+        [[nodiscard]] std::string to_string() const;
+    };
+
+    /// Start a new reporting window
+    void start(uint32_t now_ms);
+
+    /// Count a return from LoopWaiter::wait()
+    void record_wakeup(const LoopWakeResult& result, uint32_t now_ms);
+
+    /// Count a rendered frame (LV_EVENT_REFR_READY)
+    void record_frame(uint32_t now_ms);
+
+    /// Window counters so far
+    [[nodiscard]] const Report& current() const {
+        return report_;
+    }
+
+    /// Close the window and start the next one
+    Report take_report(uint32_t now_ms);
+
+  private:
+    Report report_;
+    uint32_t window_start_ms_ = 0;
+    bool last_wakeup_idle_candidate_ = false; ///< Previous wakeup was not input
+    bool frame_since_wakeup_ = false;
+    bool input_pending_ = false; ///< Input seen, no frame yet
+    uint32_t input_tick_ms_ = 0;
+};
+
+} // namespace helix::application
@@ -46,6 +46,7 @@
 
 #include "advanced_panel_types.h"
 #include "calibration_types.h"
+#include "http_executor.h"
 #include "moonraker_client.h"
 #include "moonraker_error.h"
 #include "moonraker_history_api.h"
@@ -57,13 +58,11 @@
 
 #include <atomic>
 #include <functional>
-#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
-#include <thread>
 #include <vector>
 
 /**
@@ -756,10 +755,12 @@ class MoonrakerAPI {
      * @param cache_path Local filesystem path to save the thumbnail
      * @param on_success Callback with local cache path
      * @param on_error Error callback
+     * @param options HTTP priority (VISIBLE for on-screen thumbnails) and a
+     *        still_wanted check; a dropped download invokes neither callback
      */
     virtual void download_thumbnail(const std::string& thumbnail_path,
                                     const std::string& cache_path, StringCallback on_success,
-                                    ErrorCallback on_error);
+                                    ErrorCallback on_error, helix::HttpJobOptions options = {});
 
     /**
      * @brief Upload file content to the printer via HTTP multipart form
@@ -838,6 +839,13 @@ class MoonrakerAPI {
         return http_base_url_;
     }
 
+    /**
+     * @brief Queue depth, worker and connection reuse counters of the HTTP executor
+     */
+    helix::HttpExecutor::Metrics get_http_metrics() const {
+        return http_executor_.metrics();
+    }
+
     /**
      * @brief Ensure HTTP base URL is set, auto-deriving from WebSocket if needed
      *
@@ -1415,21 +1423,21 @@ class MoonrakerAPI {
     std::map<std::string, BedMeshProfile> stored_bed_mesh_profiles_; // All profiles with mesh data
     mutable std::mutex bed_mesh_mutex_;
 
-    // Track pending HTTP request threads to ensure clean shutdown
-    // IMPORTANT: Prevents use-after-free when threads outlive the API object
-    mutable std::mutex http_threads_mutex_;
-    std::list<std::thread> http_threads_;
-    std::atomic<bool> shutting_down_{false};
+    // Bounded worker pool for all HTTP calls; shut down (with a timed wait) in
+    // the destructor so no request outlives the API object
+    helix::HttpExecutor http_executor_;
 
     /**
-     * @brief Launch an HTTP request thread with automatic lifecycle management
+     * @brief Queue an HTTP request on the executor
      *
-     * Spawns a thread for async HTTP operations and tracks it for cleanup.
-     * Thread is automatically removed from tracking when it completes.
+     * The function runs on an HTTP worker with that worker's keep-alive
+     * session. Dropped silently once the API is shutting down.
      *
-     * @param func The function to execute in the thread
+     * @param func The request to run (use the session instead of requests::)
+     * @param options Priority and still_wanted predicate (checked on the worker)
      */
-    void launch_http_thread(std::function<void()> func);
+    void launch_http_request(std::function<void(helix::HttpSession&)> func,
+                             helix::HttpJobOptions options = {});
 
     /**
      * @brief Parse file list response from server.files.list
@@ -361,7 +361,8 @@ class MoonrakerAPIMock : public MoonrakerAPI {
      * @param on_error Error callback (never called - mock always returns placeholder)
      */
     void download_thumbnail(const std::string& thumbnail_path, const std::string& cache_path,
-                            StringCallback on_success, ErrorCallback on_error) override;
+                            StringCallback on_success, ErrorCallback on_error,
+                            helix::HttpJobOptions options = {}) override;
 
     // ========================================================================
     // Overridden Timelapse Methods (mock render/frame operations)
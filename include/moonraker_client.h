@@ -50,6 +50,7 @@
 #include <chrono>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -77,6 +78,34 @@ using RequestId = uint64_t;
 
 /** @brief Invalid request ID constant */
 constexpr RequestId INVALID_REQUEST_ID = 0;
+
+/**
+ * @brief Immutable, shared status notification
+ *
+ * A single parsed notify_status_update (or notify_filelist_changed) message,
+ * shared by every subscriber. Subscribers may hold on to it (e.g. to marshal
+ * it to the UI thread) without copying the underlying JSON.
+ */
+using StatusDelta = std::shared_ptr<const nlohmann::json>;
+
+/** @brief Zero-copy status notification callback */
+using StatusDeltaCallback = std::function<void(const StatusDelta&)>;
+
+/**
+ * @brief Status fan-out counters
+ *
+ * bytes_delivered is what the old per-subscriber copy path would have copied
+ * (payload size x subscribers). bytes_copied is what is still copied for
+ * subscribers registered through the legacy by-value register_notify_update().
+ * Bytes count only notifications received from Moonraker, not ones built locally.
+ */
+struct StatusFanoutStats {
+    uint64_t notifications = 0;     ///< Notifications fanned out
+    uint64_t deliveries = 0;        ///< Callback invocations (all subscribers)
+    uint64_t legacy_deliveries = 0; ///< Invocations through the by-value adapter
+    uint64_t bytes_delivered = 0;   ///< Payload bytes x subscribers
+    uint64_t bytes_copied = 0;      ///< Payload bytes x legacy subscribers
+};
 } // namespace helix
 
 namespace helix {
@@ -172,11 +201,33 @@ class MoonrakerClient : public hv::WebSocketClient {
      * Invoked when Moonraker sends "notify_status_update" messages
      * (triggered by printer.objects.subscribe subscriptions).
      *
+     * Legacy adapter: the shared notification is copied into the by-value
+     * parameter on every call. Prefer register_status_delta() on hot paths.
+     *
      * @param cb Callback function receiving parsed JSON notification
      * @return Subscription ID for later unsubscription (0 = invalid/failed)
      */
     SubscriptionId register_notify_update(std::function<void(json)> cb);
 
+    /**
+     * @brief Register zero-copy callback for status update notifications
+     *
+     * Same notifications as register_notify_update(), but every subscriber
+     * receives the same immutable StatusDelta instead of its own JSON copy.
+     * Unsubscribe with unsubscribe_notify_update().
+     *
+     * @param cb Callback receiving the shared notification
+     * @return Subscription ID for later unsubscription (0 = invalid/failed)
+     */
+    SubscriptionId register_status_delta(StatusDeltaCallback cb);
+
+    /**
+     * @brief Get status fan-out counters
+     *
+     * Thread-safe. Counters are cumulative since construction.
+     */
+    StatusFanoutStats get_status_fanout_stats() const;
+
     /**
      * @brief Unsubscribe from status update notifications
      *
@@ -568,6 +619,18 @@ class MoonrakerClient : public hv::WebSocketClient {
      */
     void dispatch_status_update(const json& status);
 
+    /**
+     * @brief Deliver a shared notification to all notify subscribers
+     *
+     * Two-phase: snapshots subscriber handles under callbacks_mutex_, then
+     * invokes them outside the lock. Updates the fan-out counters.
+     *
+     * @param notification Notification shared by every subscriber
+     * @param payload_bytes Raw message size (for counters); 0 for notifications
+     *        built locally rather than received from Moonraker
+     */
+    void fan_out_status(const StatusDelta& notification, size_t payload_bytes);
+
     /**
      * @brief Emit event to registered handler
      *
@@ -635,9 +698,16 @@ class MoonrakerClient : public hv::WebSocketClient {
     // Bed mesh callback (P7b) - data now owned by MoonrakerAPI
     std::function<void(const json&)> bed_mesh_callback_;
 
+    // Notify subscriber entry. Held by shared_ptr so fan-out snapshots copy a
+    // pointer rather than the std::function and its captures.
+    struct NotifySubscriber {
+        StatusDeltaCallback cb;
+        bool legacy = false; // Registered via by-value register_notify_update()
+    };
+
     // Notification callbacks (protected to allow mock to trigger notifications)
-    // Map of subscription ID -> callback for O(1) unsubscription
-    std::map<SubscriptionId, std::function<void(json)>> notify_callbacks_;
+    // Map of subscription ID -> subscriber for O(1) unsubscription
+    std::map<SubscriptionId, std::shared_ptr<const NotifySubscriber>> notify_callbacks_;
     std::atomic<SubscriptionId> next_subscription_id_{1}; // Start at 1 (0 = invalid)
     std::mutex callbacks_mutex_; // Protect notify_callbacks_ and method_callbacks_
 
@@ -689,6 +759,17 @@ class MoonrakerClient : public hv::WebSocketClient {
     std::chrono::steady_clock::time_point suppress_disconnect_modal_until_{};
     mutable std::mutex suppress_mutex_;
 
+    // Status fan-out counters (see StatusFanoutStats)
+    std::atomic<uint64_t> fanout_notifications_{0};
+    std::atomic<uint64_t> fanout_deliveries_{0};
+    std::atomic<uint64_t> fanout_legacy_deliveries_{0};
+    std::atomic<uint64_t> fanout_bytes_delivered_{0};
+    std::atomic<uint64_t> fanout_bytes_copied_{0};
+    // Periodic copy-rate report window
+    std::atomic<int64_t> fanout_report_start_ms_{0};
+    std::atomic<uint64_t> fanout_report_bytes_copied_{0};
+    std::atomic<uint64_t> fanout_report_bytes_delivered_{0};
+
     // Lifetime guard for safe callback execution
     // Callbacks capture a weak_ptr to this sentinel. When the destructor runs,
     // it resets the shared_ptr FIRST, causing all weak_ptr::lock() calls to
@@ -198,7 +198,7 @@ class MoonrakerManager {
     std::unique_ptr<MoonrakerAPI> m_api;
 
     // Thread-safe notification queue
-    std::queue<nlohmann::json> m_notification_queue;
+    std::queue<std::shared_ptr<const nlohmann::json>> m_notification_queue;
     mutable std::mutex m_notification_mutex;
 
     // Print start collector (monitors PRINT_START macro progress)
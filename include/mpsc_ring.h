@@ -0,0 +1,138 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+/**
+ * @file mpsc_ring.h
+ * @brief Bounded lock-free multi-producer / single-consumer ring buffer
+ *
+ * Each cell carries a sequence number (Vyukov bounded queue). Producers claim a
+ * slot with one CAS on the enqueue position and publish it with a release store;
+ * the consumer owns the dequeue position outright. No locks and no allocation
+ * after construction. Positions are 64-bit so they never wrap in practice, which
+ * lets callers use them as a global enqueue order.
+ *
+ * T must be default-constructible and move-assignable.
+ *
+ * @threading try_push() from any thread; try_pop() from one consumer thread only
+ * @gotchas A producer preempted between claiming and publishing its slot hides
+ *          later slots until it finishes - try_pop() just reports empty meanwhile
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace helix {
+
+template <typename T> class MpscRing {
+  public:
+    /**
+     * @param capacity Slot count, rounded up to a power of two (minimum 2)
+     */
+    explicit MpscRing(size_t capacity) {
+        size_t cap = 2;
+        while (cap < capacity) {
+            cap <<= 1;
+        }
+        mask_ = static_cast<uint64_t>(cap - 1);
+        cells_ = std::make_unique<Cell[]>(cap);
+        for (size_t i = 0; i < cap; ++i) {
+            cells_[i].sequence.store(static_cast<uint64_t>(i), std::memory_order_relaxed);
+        }
+    }
+
+    ~MpscRing() {
+        T discard;
+        while (try_pop(discard)) {
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    /**
+     * @brief Enqueue an item (any thread)
+     * @return false if the ring is full; @p item is left untouched
+     */
+    bool try_push(T&& item) {
+        uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &cells_[static_cast<size_t>(pos & mask_)];
+            uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<int64_t>(seq - pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                       std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Full: consumer hasn't freed this slot yet
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        ::new (static_cast<void*>(cell->storage)) T(std::move(item));
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Dequeue the oldest published item (consumer thread only)
+     * @return false if nothing is ready
+     */
+    bool try_pop(T& out) {
+        uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Cell& cell = cells_[static_cast<size_t>(pos & mask_)];
+        uint64_t seq = cell.sequence.load(std::memory_order_acquire);
+        if (seq != pos + 1) {
+            return false;
+        }
+        T* item = std::launder(reinterpret_cast<T*>(cell.storage));
+        out = std::move(*item);
+        item->~T();
+        cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        dequeue_pos_.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    [[nodiscard]] size_t capacity() const {
+        return static_cast<size_t>(mask_ + 1);
+    }
+
+    /// Approximate item count (exact only when producers are quiet)
+    [[nodiscard]] size_t size_approx() const {
+        uint64_t deq = dequeue_pos_.load(std::memory_order_relaxed);
+        uint64_t enq = enqueue_pos_.load(std::memory_order_relaxed);
+        return enq > deq ? static_cast<size_t>(enq - deq) : 0;
+    }
+
+    /// Slots claimed so far; the next try_push() gets a position >= this
+    [[nodiscard]] uint64_t producer_position() const {
+        return enqueue_pos_.load(std::memory_order_acquire);
+    }
+
+    /// Position of the next item try_pop() returns (every earlier item has been popped)
+    [[nodiscard]] uint64_t consumer_position() const {
+        return dequeue_pos_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct Cell {
+        std::atomic<uint64_t> sequence{0};
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    uint64_t mask_ = 0;
+
+    // Separate cache lines: producers hammer enqueue_pos_, the consumer owns dequeue_pos_
+    alignas(64) std::atomic<uint64_t> enqueue_pos_{0};
+    alignas(64) std::atomic<uint64_t> dequeue_pos_{0}; ///< Written by the consumer only
+};
+
+} // namespace helix
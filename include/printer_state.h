@@ -19,6 +19,7 @@
 #include "printer_network_state.h"
 #include "printer_plugin_status_state.h"
 #include "printer_print_state.h"
+#include "printer_status_router.h"
 #include "printer_temperature_state.h"
 #include "printer_versions_state.h"
 #include "spdlog/spdlog.h"
@@ -239,10 +240,23 @@ class PrinterState {
      * with subscription response data or extracted from notifications.
      * This is the core update logic used by both initial state and notifications.
      *
+     * Each top-level object key is routed to the sub-states that own it
+     * (see PrinterStatusRouter), so only affected sub-states are visited.
+     *
      * @param status Printer status object (e.g., from result.status or params[0])
      */
     void update_from_status(const json& status);
 
+    /**
+     * @brief Pre-resolve status routing for the subscribed Klipper objects
+     *
+     * Optional: unknown keys are resolved on first sight. Priming moves that
+     * work to discovery time so steady-state updates are pure lookups.
+     *
+     * @param objects Klipper object names (printer.objects.list)
+     */
+    void prime_status_routes(const std::vector<std::string>& objects);
+
     /**
      * @brief Get raw JSON state for complex queries
      *
@@ -1648,10 +1662,22 @@ class PrinterState {
     // - printer_connection_message_buf_ is now in network_state_ component
     // - klipper_version_buf_, moonraker_version_buf_ are now in versions_state_ component
 
+    /// Register status routes (key ownership -> sub-state handler), in update order
+    void init_status_routes();
+
+    /// Handle exclude_object status (defined/excluded/current objects)
+    void update_exclude_object_from_status(const json& eo);
+
+    /// Handle webhooks status (klippy state)
+    void update_webhooks_from_status(const json& webhooks);
+
     // JSON cache for complex data
     json json_state_;
     std::mutex state_mutex_;
 
+    // Routes status keys to owning sub-states (guarded by state_mutex_)
+    helix::PrinterStatusRouter status_router_;
+
     // Initialization guard to prevent multiple subject initializations
     bool subjects_initialized_ = false;
 
@@ -0,0 +1,104 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hv/json.hpp"
+
+namespace helix {
+
+/**
+ * @brief Routes Klipper status deltas to the sub-states that own their objects
+ *
+ * Each route declares which Klipper object keys it owns (e.g. "extruder",
+ * "heater_bed", "filament_switch_sensor runout"). A delta only visits the
+ * routes owning at least one of its keys, so per-update cost scales with the
+ * changed keys instead of handlers x keys.
+ *
+ * Key ownership is resolved once per distinct key and cached as a route
+ * bitmask. prime() resolves the subscription list up front so steady-state
+ * dispatch is one hash lookup per key.
+ *
+ * Fallback routes also receive deltas containing keys that no route claims
+ * (e.g. LED strips with arbitrary names, TD-1 color sensor device IDs).
+ *
+ * Routes run in registration order. Not thread-safe: PrinterState calls it
+ * under state_mutex_.
+ */
+class PrinterStatusRouter {
+  public:
+    using Handler = std::function<void(const nlohmann::json& status)>;
+    using KeyMatcher = std::function<bool(const std::string& key)>;
+
+    /// Maximum number of routes (one bit each in the cached route mask)
+    static constexpr size_t MAX_ROUTES = 64;
+
+    /**
+     * @brief Register a route
+     *
+     * Clears cached key resolution.
+     *
+     * @param name Route name (for logging)
+     * @param owns Returns true for object keys this route handles (nullptr = none)
+     * @param handler Called with the full status delta
+     * @param fallback Also receive deltas containing unclaimed keys
+     * @return false if MAX_ROUTES is exceeded
+     */
+    bool add_route(std::string name, KeyMatcher owns, Handler handler, bool fallback = false);
+
+    /**
+     * @brief Resolve route ownership for the subscribed objects up front
+     * @param objects Klipper object names (printer.objects.subscribe list)
+     */
+    void prime(const std::vector<std::string>& objects);
+
+    /// Drop cached key resolution (call if a matcher's answer can change)
+    void invalidate();
+
+    /**
+     * @brief Dispatch a status delta to the owning routes
+     * @param status Status object ({"extruder": {...}, "toolhead": {...}})
+     * @return Number of handlers invoked
+     */
+    size_t dispatch(const nlohmann::json& status);
+
+    [[nodiscard]] size_t route_count() const {
+        return routes_.size();
+    }
+
+    [[nodiscard]] size_t cached_key_count() const {
+        return key_routes_.size();
+    }
+
+    /// Route mask a key resolves to (bit N = route N). Resolves and caches on miss.
+    uint64_t routes_for_key(const std::string& key);
+
+    /**
+     * @brief Build a matcher from exact object names and name prefixes
+     *
+     * @param exact Object names matched exactly (e.g. "toolhead")
+     * @param prefixes Object name prefixes (e.g. "heater_fan ")
+     */
+    static KeyMatcher match_objects(std::vector<std::string> exact,
+                                    std::vector<std::string> prefixes = {});
+
+  private:
+    struct Route {
+        std::string name;
+        KeyMatcher owns;
+        Handler handler;
+    };
+
+    uint64_t resolve_key(const std::string& key) const;
+
+    std::vector<Route> routes_;
+    uint64_t fallback_mask_ = 0;
+    std::unordered_map<std::string, uint64_t> key_routes_;
+};
+
+} // namespace helix
@@ -78,6 +78,9 @@ class ProbeSensorManager : public ISensorManager {
     /// @brief Update state from Moonraker status JSON
     void update_from_status(const nlohmann::json& status) override;
 
+    /// @brief Whether a status key names an object type this manager tracks
+    [[nodiscard]] bool handles_status_object(const std::string& klipper_name) const override;
+
     /// @brief Inject mock sensor objects for testing UI
     void inject_mock_sensors(std::vector<std::string>& objects, nlohmann::json& config_keys,
                              nlohmann::json& moonraker_info) override;
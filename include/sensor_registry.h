@@ -66,6 +66,14 @@ class ISensorManager {
     /// @brief Update state from Moonraker status JSON
     virtual void update_from_status(const nlohmann::json& status) = 0;
 
+    /// @brief Whether a Klipper object key in a status update may belong to this manager
+    /// @note Used to route status deltas; must depend only on the key, not on discovery state
+    /// @note Default claims every key (manager sees every update)
+    [[nodiscard]] virtual bool handles_status_object(const std::string& klipper_name) const {
+        (void)klipper_name;
+        return true;
+    }
+
     /// @brief Load configuration from JSON
     virtual void load_config(const nlohmann::json& config) = 0;
 
@@ -0,0 +1,136 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+/**
+ * @file small_callback.h
+ * @brief Move-only void() callable with inline storage for small captures
+ *
+ * std::function heap-allocates once a capture outgrows its tiny internal buffer
+ * (16 bytes on libstdc++), which is most UI update lambdas. SmallCallback stores
+ * captures up to InlineSize bytes in place, so queueing them never allocates.
+ * Larger (or throwing-move) callables fall back to a single heap allocation.
+ *
+ * @threading Not synchronized; a SmallCallback is owned by one thread at a time
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace helix {
+
+template <size_t InlineSize = 48> class SmallCallback {
+  public:
+    SmallCallback() noexcept = default;
+    SmallCallback(std::nullptr_t) noexcept {}
+
+    template <typename F, typename Fn = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<Fn, SmallCallback> &&
+                                          std::is_invocable_r_v<void, Fn&>>>
+    SmallCallback(F&& f) {
+        if constexpr (fits_inline<Fn>()) {
+            ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(f));
+            ops_ = &InlineOps<Fn>::ops;
+        } else {
+            *reinterpret_cast<Fn**>(storage_) = new Fn(std::forward<F>(f));
+            ops_ = &HeapOps<Fn>::ops;
+        }
+    }
+
+    SmallCallback(SmallCallback&& other) noexcept {
+        take(other);
+    }
+
+    SmallCallback& operator=(SmallCallback&& other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    SmallCallback(const SmallCallback&) = delete;
+    SmallCallback& operator=(const SmallCallback&) = delete;
+
+    ~SmallCallback() {
+        reset();
+    }
+
+    explicit operator bool() const noexcept {
+        return ops_ != nullptr;
+    }
+
+    /// Invoke the callable (must not be empty)
+    void operator()() {
+        ops_->invoke(storage_);
+    }
+
+    void reset() noexcept {
+        if (ops_) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    /// True if the callable lives in the inline buffer (no heap allocation)
+    [[nodiscard]] bool is_inline() const noexcept {
+        return ops_ && ops_->inline_storage;
+    }
+
+    /// True if a callable of type F would be stored inline
+    template <typename F> static constexpr bool fits_inline() {
+        return sizeof(F) <= InlineSize && alignof(F) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<F>;
+    }
+
+  private:
+    struct Ops {
+        void (*invoke)(void* storage);
+        void (*relocate)(void* dst, void* src) noexcept; ///< Move src into dst, destroy src
+        void (*destroy)(void* storage) noexcept;
+        bool inline_storage;
+    };
+
+    template <typename Fn> struct InlineOps {
+        static void invoke(void* s) {
+            (*static_cast<Fn*>(s))();
+        }
+        static void relocate(void* dst, void* src) noexcept {
+            auto* from = static_cast<Fn*>(src);
+            ::new (dst) Fn(std::move(*from));
+            from->~Fn();
+        }
+        static void destroy(void* s) noexcept {
+            static_cast<Fn*>(s)->~Fn();
+        }
+        static constexpr Ops ops{&invoke, &relocate, &destroy, true};
+    };
+
+    template <typename Fn> struct HeapOps {
+        static void invoke(void* s) {
+            (**static_cast<Fn**>(s))();
+        }
+        static void relocate(void* dst, void* src) noexcept {
+            *static_cast<Fn**>(dst) = *static_cast<Fn**>(src);
+        }
+        static void destroy(void* s) noexcept {
+            delete *static_cast<Fn**>(s);
+        }
+        static constexpr Ops ops{&invoke, &relocate, &destroy, false};
+    };
+
+    void take(SmallCallback& other) noexcept {
+        if (other.ops_) {
+            other.ops_->relocate(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[InlineSize];
+    const Ops* ops_ = nullptr;
+};
+
+} // namespace helix
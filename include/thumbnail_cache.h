@@ -4,11 +4,13 @@
 #pragma once
 
 #include "moonraker_api.h"
+#include "thumbnail_index.h"
 #include "thumbnail_load_context.h"
 #include "thumbnail_processor.h"
 
 #include <filesystem>
 #include <functional>
+#include <memory>
 #include <string>
 
 /**
@@ -21,6 +23,8 @@
  * - Cache directory creation
  * - Async download with callbacks
  * - LVGL-compatible path formatting ("A:" prefix)
+ * - Size accounting and LRU eviction from an in-memory index
+ *   (helix::ThumbnailIndex), so lookups and inserts never scan the directory
  *
  * ## Usage Example
  * ```cpp
@@ -110,7 +114,8 @@ class ThumbnailCache {
     /**
      * @brief Get LVGL path if thumbnail is already cached
      *
-     * Checks if the file exists locally without network request.
+     * Answered from the in-memory index without network request. Only a miss
+     * stats the file, to pick up thumbnails written behind the cache's back.
      * Useful for instant display when revisiting cached content.
      *
      * @param relative_path Moonraker relative path
@@ -178,13 +183,15 @@ class ThumbnailCache {
      * @param source_modified Optional source file modification time (Unix timestamp).
      *        If provided and the cached file is older than this, the cache is
      *        invalidated and a fresh download is triggered. Use 0 to skip validation.
+     * @param http Priority and still_wanted check for the download, if one is needed
      *
      * @note Falls back to PNG on pre-scaling failure - display still works, just slower
      * @see docs/THUMBNAIL_OPTIMIZATION_PLAN.md
      */
     void fetch_optimized(MoonrakerAPI* api, const std::string& relative_path,
                          const helix::ThumbnailTarget& target, SuccessCallback on_success,
-                         ErrorCallback on_error, time_t source_modified = 0);
+                         ErrorCallback on_error, time_t source_modified = 0,
+                         helix::HttpJobOptions http = {});
 
     /**
      * @brief Check if a pre-scaled version exists in cache
@@ -312,6 +319,8 @@ class ThumbnailCache {
     /**
      * @brief Get the total size of cached thumbnails
      *
+     * Tracked by the index; does not touch the filesystem.
+     *
      * @return Total size in bytes
      */
     [[nodiscard]] size_t get_cache_size() const;
@@ -376,6 +385,8 @@ class ThumbnailCache {
     size_t disk_low_;       ///< Evict aggressively below this available space
     size_t configured_max_; ///< Max size from config (before dynamic sizing)
 
+    std::unique_ptr<helix::ThumbnailIndex> index_; ///< Size and LRU order of cache files
+
     /**
      * @brief Determine the optimal cache base directory
      *
@@ -402,6 +413,22 @@ class ThumbnailCache {
      */
     void ensure_cache_dir() const;
 
+    /**
+     * @brief Create the index and load it from the journal in the cache directory
+     */
+    void load_index();
+
+    /**
+     * @brief Index entry for a cache file name, refreshing its LRU position
+     *
+     * Answered from the index alone; every writer in this process records its
+     * file, so a miss means the file isn't cached and nothing is stat()ed.
+     *
+     * @param name File name inside the cache directory
+     * @return Entry, or nullopt if the file isn't cached
+     */
+    std::optional<helix::ThumbnailIndex::Entry> lookup_entry(const std::string& name) const;
+
     /**
      * @brief Compute hash for a path string
      *
@@ -411,10 +438,10 @@ class ThumbnailCache {
     [[nodiscard]] static std::string compute_hash(const std::string& path);
 
     /**
-     * @brief Evict oldest files if cache exceeds max size
+     * @brief Evict least recently used files if cache exceeds max size
      *
-     * Uses file modification time (mtime) as LRU approximation.
-     * Removes oldest files until cache is under max_size_.
+     * Pops entries from the index's LRU order until the cache is under
+     * max_size_ (less under disk pressure). No directory scan.
      */
     void evict_if_needed();
 
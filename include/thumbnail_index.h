@@ -0,0 +1,171 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * @file thumbnail_index.h
+ * @brief In-memory index of the thumbnail cache directory, persisted as a journal
+ *
+ * ThumbnailCache used to walk and stat() the whole cache directory to get its
+ * size, and again (plus a sort) to evict, after every thumbnail fetch. The
+ * index keeps size, cache time and last access per file in memory so lookups
+ * never touch the filesystem and eviction pops the least recently used entry
+ * in O(log n).
+ *
+ * The index is saved in a small text journal inside the cache directory. Each
+ * change appends one line; load() replays it, reconciles it with the file
+ * names in the directory (files added or deleted behind the cache's back) and
+ * rewrites it compacted.
+ *
+ * Journal lines (the file name is last, so it may contain spaces):
+ * @code
+ * HXTHUMBIDX 1
+ * + <size> <cached_time> <last_access> <name>   add or replace
+ * @ <last_access> <name>                        accessed
+ * - <name>                                     removed
+ * @endcode
+ *
+ * @threading All methods are thread-safe (one mutex). Download callbacks and
+ *            the UI thread share one instance.
+ * @gotchas Last-access updates are only journaled when they move by more than
+ *          ACCESS_PERSIST_INTERVAL, so scrolling a list of cached thumbnails
+ *          does not write for every card. LRU order in memory is exact.
+ */
+
+namespace helix {
+
+class ThumbnailIndex {
+  public:
+    /// Journal file name inside the cache directory
+    static constexpr const char* JOURNAL_NAME = ".thumbnail_index";
+
+    /// Minimum change in last access (seconds) before a hit is journaled
+    static constexpr int64_t ACCESS_PERSIST_INTERVAL = 5 * 60;
+
+    /// Compact once appended lines exceed this many times the live entries
+    static constexpr size_t COMPACT_RATIO = 4;
+
+    struct Entry {
+        uint64_t size = 0;
+        int64_t cached_time = 0; ///< Unix time the file was written (compare to source mtime)
+        int64_t last_access = 0; ///< Unix time of the last lookup hit
+    };
+
+    /// Outcome of load(), for logging and benchmarks
+    struct LoadStats {
+        size_t entries = 0;
+        size_t journal_lines = 0;
+        size_t adopted = 0; ///< Files on disk missing from the journal (stat'ed once)
+        size_t dropped = 0; ///< Journal entries whose file is gone
+        bool rebuilt = false; ///< No usable journal; index built from a directory scan
+    };
+
+    explicit ThumbnailIndex(std::string cache_dir);
+    ~ThumbnailIndex();
+
+    ThumbnailIndex(const ThumbnailIndex&) = delete;
+    ThumbnailIndex& operator=(const ThumbnailIndex&) = delete;
+
+    /**
+     * @brief Replay the journal, reconcile with the directory and compact
+     *
+     * Reads the directory listing once (names only; only files missing from
+     * the journal are stat'ed). Call once at startup.
+     */
+    LoadStats load();
+
+    /// Entry for a file name, refreshing its last access
+    std::optional<Entry> lookup(const std::string& name);
+
+    /// Entry for a file name, without counting it as an access
+    [[nodiscard]] std::optional<Entry> peek(const std::string& name) const;
+
+    /**
+     * @brief Add or replace an entry for a file that was just written
+     *
+     * @param cached_time Unix time the file was written (0 = now)
+     */
+    void record(const std::string& name, uint64_t size, int64_t cached_time = 0);
+
+    /**
+     * @brief Index a file found on disk that the index doesn't know about
+     *
+     * Stats the file once. Used by writers that report only the path
+     * (downloads, pre-scaled variants); files created by other processes are
+     * picked up by the directory scan in load().
+     *
+     * @return The new entry, or nullopt if the file doesn't exist
+     */
+    std::optional<Entry> adopt(const std::string& name);
+
+    /// Drop an entry (the caller removes the file)
+    void erase(const std::string& name);
+
+    /// Drop all entries and truncate the journal
+    void clear();
+
+    /**
+     * @brief Delete least recently used files until the total is at most @p limit
+     *
+     * @return Files and bytes removed
+     */
+    std::pair<size_t, uint64_t> evict_to(uint64_t limit);
+
+    [[nodiscard]] uint64_t total_bytes() const;
+    [[nodiscard]] size_t size() const;
+
+    /// Lines currently in the journal file (tests)
+    [[nodiscard]] size_t journal_lines() const;
+
+    /// Full path of the journal file
+    [[nodiscard]] std::string journal_path() const {
+        return cache_dir_ + "/" + JOURNAL_NAME;
+    }
+
+  private:
+    /// LRU order: (last access, sequence) so ties keep insertion order
+    using LruKey = std::pair<int64_t, uint64_t>;
+
+    struct Slot {
+        Entry entry;
+        uint64_t sequence = 0;
+        int64_t persisted_access = 0; ///< last_access as last written to the journal
+    };
+
+    // All private helpers expect mutex_ held
+    void put(const std::string& name, const Entry& entry);
+    void remove(const std::string& name);
+    void touch(const std::string& name, Slot& slot, int64_t now);
+    bool replay_line(const char* line);
+    std::optional<Entry> stat_file(const std::string& name) const;
+
+    void append(const char* fmt, ...);
+    void maybe_compact();
+    bool compact();
+    void open_journal();
+    void close_journal();
+
+    std::string cache_dir_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Slot> entries_;
+    std::set<std::pair<LruKey, std::string>> lru_;
+    uint64_t total_bytes_ = 0;
+    uint64_t next_sequence_ = 0;
+
+    FILE* journal_ = nullptr;
+    size_t journal_lines_ = 0;
+};
+
+} // namespace helix
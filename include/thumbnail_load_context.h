@@ -23,10 +23,11 @@
  * ```cpp
  * // In your panel class:
  * std::shared_ptr<std::atomic<bool>> m_alive;
- * std::atomic<uint32_t> thumbnail_gen_{0};
+ * std::shared_ptr<std::atomic<uint32_t>> thumbnail_gen_ =
+ *     std::make_shared<std::atomic<uint32_t>>(0);
  *
  * void load_thumbnail() {
- *     auto ctx = ThumbnailLoadContext::create(m_alive, &thumbnail_gen_);
+ *     auto ctx = ThumbnailLoadContext::create(m_alive, thumbnail_gen_);
  *
  *     get_thumbnail_cache().fetch_for_detail_view(
  *         api_, path, ctx,
@@ -37,6 +38,10 @@
  * }
  * ```
  *
+ * The context only holds shared state, so is_valid() may be called from any
+ * thread, including after the owner is destroyed (the HTTP executor checks it
+ * on a worker before starting a queued download).
+ *
  * @see ThumbnailCache::fetch_for_detail_view
  * @see ThumbnailCache::fetch_for_card_view
  */
@@ -44,11 +49,11 @@ struct ThumbnailLoadContext {
     /// Shared flag indicating if the owner object is still alive
     std::shared_ptr<std::atomic<bool>> alive;
 
-    /// Pointer to the owner's generation counter (may be nullptr if not used)
-    std::atomic<uint32_t>* generation;
+    /// Owner's generation counter, shared so it outlives the owner (nullptr if not used)
+    std::shared_ptr<std::atomic<uint32_t>> generation;
 
     /// The generation value captured at creation time
-    uint32_t captured_gen;
+    uint32_t captured_gen = 0;
 
     /**
      * @brief Check if this context is still valid
@@ -79,15 +84,15 @@ struct ThumbnailLoadContext {
      * increments the generation counter and captures the new value.
      *
      * @param alive_flag Shared alive flag from the calling object
-     * @param gen Pointer to generation counter (nullptr if not used)
+     * @param gen Shared generation counter (nullptr if not used)
      * @return A context that can be passed to async callbacks
      */
     static ThumbnailLoadContext create(std::shared_ptr<std::atomic<bool>> alive_flag,
-                                       std::atomic<uint32_t>* gen = nullptr) {
+                                       std::shared_ptr<std::atomic<uint32_t>> gen = nullptr) {
         ThumbnailLoadContext ctx;
         ctx.alive = std::move(alive_flag);
-        ctx.generation = gen;
         ctx.captured_gen = gen ? ++(*gen) : 0;
+        ctx.generation = std::move(gen);
         return ctx;
     }
 
@@ -98,15 +103,15 @@ struct ThumbnailLoadContext {
      * invalidate previous callbacks (e.g., for chained operations).
      *
      * @param alive_flag Shared alive flag from the calling object
-     * @param gen Pointer to generation counter (nullptr if not used)
+     * @param gen Shared generation counter (nullptr if not used)
      * @return A context that captures current generation without incrementing
      */
     static ThumbnailLoadContext capture(std::shared_ptr<std::atomic<bool>> alive_flag,
-                                        std::atomic<uint32_t>* gen = nullptr) {
+                                        std::shared_ptr<std::atomic<uint32_t>> gen = nullptr) {
         ThumbnailLoadContext ctx;
         ctx.alive = std::move(alive_flag);
-        ctx.generation = gen;
         ctx.captured_gen = gen ? gen->load() : 0;
+        ctx.generation = std::move(gen);
         return ctx;
     }
 };
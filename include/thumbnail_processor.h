@@ -156,6 +156,17 @@ class ThumbnailProcessor {
     std::string get_if_processed(const std::string& source_path,
                                  const ThumbnailTarget& target) const;
 
+    /**
+     * @brief Generate cache filename for a source/target combination
+     *
+     * Format: {hash}_{w}x{h}_{format}.bin
+     * Example: a1b2c3d4_160x160_ARGB8888.bin
+     *
+     * Public so ThumbnailCache can look pre-scaled files up in its index.
+     */
+    static std::string generate_cache_filename(const std::string& source_path,
+                                               const ThumbnailTarget& target);
+
     /**
      * @brief Get optimal thumbnail target for current display
      *
@@ -239,15 +250,6 @@ class ThumbnailProcessor {
     ThumbnailProcessor();
     ~ThumbnailProcessor();
 
-    /**
-     * @brief Generate cache filename for a source/target combination
-     *
-     * Format: {hash}_{w}x{h}_{format}.bin
-     * Example: a1b2c3d4_160x160_ARGB8888.bin
-     */
-    std::string generate_cache_filename(const std::string& source_path,
-                                        const ThumbnailTarget& target) const;
-
     /**
      * @brief Core processing implementation
      *
@@ -0,0 +1,128 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "console_line_buffer.h"
+
+#include <lvgl.h>
+#include <string>
+#include <vector>
+
+namespace helix::ui {
+
+/**
+ * @file ui_console_log_view.h
+ * @brief Virtualized view of a ConsoleLineBuffer
+ *
+ * Renders only the visible console lines from a fixed pool of spangroups,
+ * using the same leading/trailing spacer virtualization as PrintSelectListView.
+ *
+ * ## Key Features:
+ * - Fixed widget pool (POOL_SIZE spangroups created once)
+ * - Variable line heights: the buffer caches each line's measured height, and the
+ *   row is sized to match so spacer math stays exact
+ * - Rows are assigned by sequence number (seq % POOL_SIZE), so as the window slides
+ *   only lines entering the viewport are (re)configured
+ * - Appends never create or delete widgets
+ */
+class ConsoleLogView {
+  public:
+    static constexpr int POOL_SIZE = 64;  ///< Fixed pool of line widgets
+    static constexpr int BUFFER_ROWS = 2; ///< Extra lines above/below viewport
+
+    ConsoleLogView() = default;
+    ~ConsoleLogView();
+
+    // Non-copyable
+    ConsoleLogView(const ConsoleLogView&) = delete;
+    ConsoleLogView& operator=(const ConsoleLogView&) = delete;
+
+    // === Setup / Cleanup ===
+
+    /**
+     * @brief Initialize the view
+     *
+     * Installs the view's measure callback on the buffer.
+     *
+     * @param container Scrollable flex-column container for the lines
+     * @param buffer Line storage (must outlive the view or be detached with cleanup())
+     * @return true if setup succeeded
+     */
+    bool setup(lv_obj_t* container, ConsoleLineBuffer* buffer);
+
+    /**
+     * @brief Drop widget references and detach from the buffer
+     */
+    void cleanup();
+
+    // === Rendering ===
+
+    /**
+     * @brief Bring rows and spacers in line with the buffer
+     *
+     * @param follow_tail Lay out the newest lines and scroll to the bottom
+     *                    (terminal-style); otherwise render around the current scroll position
+     */
+    void render(bool follow_tail);
+
+    /**
+     * @brief Forget what rows show (after the buffer was cleared or refilled)
+     */
+    void invalidate();
+
+    // === State Queries ===
+
+    [[nodiscard]] bool is_initialized() const {
+        return !pool_.empty();
+    }
+
+    [[nodiscard]] lv_obj_t* container() const {
+        return container_;
+    }
+
+    /// Lines currently rendered (first index, count)
+    void get_visible_range(size_t& first, size_t& count) const {
+        first = visible_first_;
+        count = visible_count_;
+    }
+
+    /// Number of row (re)configurations since setup (for profiling)
+    [[nodiscard]] uint64_t rows_configured() const {
+        return rows_configured_;
+    }
+
+  private:
+    static constexpr uint64_t NO_SEQ = UINT64_MAX;
+
+    // === Widget References ===
+    lv_obj_t* container_ = nullptr;
+    lv_obj_t* leading_spacer_ = nullptr;
+    lv_obj_t* trailing_spacer_ = nullptr;
+    ConsoleLineBuffer* buffer_ = nullptr;
+
+    // === Pool State ===
+    std::vector<lv_obj_t*> pool_;
+    std::vector<uint64_t> pool_seq_; ///< Sequence number each pool row shows
+
+    // === Visible Range ===
+    size_t visible_first_ = 0;
+    size_t visible_count_ = 0;
+
+    // === Cached Style ===
+    const lv_font_t* font_ = nullptr;
+    int32_t row_gap_ = 0;
+    int32_t measured_width_ = 0; ///< Content width the buffer's heights were measured at
+    lv_color_t colors_[5] = {};  ///< Indexed by ConsoleColor
+
+    std::string scratch_; ///< Span text staging (reused to avoid allocations)
+    uint64_t rows_configured_ = 0;
+
+    // === Internal Methods ===
+    void init_pool();
+    int32_t measure(const ConsoleLine& line) const;
+    void configure_row(lv_obj_t* row, const ConsoleLine& line);
+    void apply_window(size_t first, size_t last);
+};
+
+} // namespace helix::ui
@@ -0,0 +1,169 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "print_history_data.h"
+
+#include <functional>
+#include <lvgl.h>
+#include <vector>
+
+namespace helix::ui {
+
+/**
+ * @file ui_history_list_view.h
+ * @brief Virtualized list view for the print history list
+ *
+ * Manages a fixed pool of history_list_row widgets that are recycled as the user scrolls.
+ * Follows the same spacer-based virtualization pattern as PrintSelectListView.
+ *
+ * ## Key Features:
+ * - Fixed widget pool (POOL_SIZE rows created once, regardless of job count)
+ * - Leading/trailing spacers for smooth scroll virtualization
+ * - Rows bind to jobs through a display order of indices into the job vector,
+ *   so search/filter/sort never copy jobs or rebuild widgets
+ * - Imperative row updates (XML props only apply at creation)
+ *
+ * ## Containers:
+ * The rows live in a non-scrolling container (list_rows) inside the scrollable
+ * list_content, below the loading/empty states. Visible ranges are computed from
+ * the scroll position relative to the top of the rows container.
+ */
+
+/**
+ * @brief Callback for row clicks
+ * @param display_index Position of the clicked row in the display order
+ */
+using HistoryRowClickCallback = std::function<void(size_t display_index)>;
+
+class HistoryListView {
+  public:
+    static constexpr int POOL_SIZE = 24;  ///< Fixed pool of history row widgets
+    static constexpr int BUFFER_ROWS = 2; ///< Extra rows above/below viewport
+
+    HistoryListView() = default;
+    ~HistoryListView();
+
+    // Non-copyable
+    HistoryListView(const HistoryListView&) = delete;
+    HistoryListView& operator=(const HistoryListView&) = delete;
+
+    // === Setup / Cleanup ===
+
+    /**
+     * @brief Initialize the list view
+     * @param container Container the row widgets are created in
+     * @param scroll_container Scrollable ancestor of container (may be container itself)
+     * @param on_row_click Callback when a row is clicked
+     * @return true if setup succeeded
+     */
+    bool setup(lv_obj_t* container, lv_obj_t* scroll_container,
+               HistoryRowClickCallback on_row_click);
+
+    /**
+     * @brief Clean up pool and spacers
+     */
+    void cleanup();
+
+    // === Population ===
+
+    /**
+     * @brief Populate view with jobs in display order
+     * @param jobs All jobs
+     * @param order Indices into jobs, in display order
+     * @param preserve_scroll If true, preserve scroll position; otherwise reset to top
+     */
+    void populate(const std::vector<PrintHistoryJob>& jobs, const std::vector<size_t>& order,
+                  bool preserve_scroll = false);
+
+    /**
+     * @brief Update visible rows based on scroll position
+     * @param jobs All jobs
+     * @param order Indices into jobs, in display order
+     */
+    void update_visible(const std::vector<PrintHistoryJob>& jobs,
+                        const std::vector<size_t>& order);
+
+    /**
+     * @brief Refresh content of visible rows without repositioning
+     * @param jobs All jobs
+     * @param order Indices into jobs, in display order
+     */
+    void refresh_content(const std::vector<PrintHistoryJob>& jobs,
+                         const std::vector<size_t>& order);
+
+    // === State Queries ===
+
+    [[nodiscard]] bool is_initialized() const {
+        return !pool_.empty();
+    }
+
+    [[nodiscard]] lv_obj_t* container() const {
+        return container_;
+    }
+
+    void get_visible_range(int& start, int& end) const {
+        start = visible_start_;
+        end = visible_end_;
+    }
+
+    // === Status Presentation (shared with the detail overlay) ===
+
+    /**
+     * @brief Get status color for a job status
+     * @return Hex color string (e.g., "#00C853")
+     */
+    static const char* status_color(PrintJobStatus status);
+
+    /**
+     * @brief Get display text for a job status
+     * @return Display string (e.g., "Completed", "Failed")
+     */
+    static const char* status_text(PrintJobStatus status);
+
+  private:
+    /// Named children of a pooled row, looked up once at pool creation
+    struct RowWidgets {
+        lv_obj_t* status_bar = nullptr;
+        lv_obj_t* filename = nullptr;
+        lv_obj_t* date = nullptr;
+        lv_obj_t* duration = nullptr;
+        lv_obj_t* filament = nullptr;
+        lv_obj_t* status = nullptr;
+    };
+
+    // === Widget References ===
+    lv_obj_t* container_ = nullptr;
+    lv_obj_t* scroll_container_ = nullptr;
+    lv_obj_t* leading_spacer_ = nullptr;
+    lv_obj_t* trailing_spacer_ = nullptr;
+
+    // === Pool State ===
+    std::vector<lv_obj_t*> pool_;
+    std::vector<RowWidgets> pool_widgets_;
+    std::vector<ssize_t> pool_indices_; ///< Maps pool slot -> display index
+
+    // === Visible Range ===
+    int visible_start_ = -1;
+    int visible_end_ = -1;
+    int total_items_ = 0; ///< Track data size to detect filter changes
+
+    // === Cached Dimensions ===
+    int cached_row_height_ = 0;
+    int cached_row_gap_ = 0;
+
+    // === Callbacks ===
+    HistoryRowClickCallback on_row_click_;
+
+    // === Internal Methods ===
+    void init_pool();
+    void create_spacers();
+    void configure_row(size_t pool_index, size_t display_index, const PrintHistoryJob& job);
+    int32_t rows_scroll_offset() const;
+
+    // === Static Callbacks ===
+    static void on_row_clicked(lv_event_t* e);
+};
+
+} // namespace helix::ui
@@ -3,11 +3,13 @@
 
 #pragma once
 
+#include "console_line_buffer.h"
 #include "lvgl.h"
 #include "overlay_base.h"
 #include "subject_managed_panel.h"
+#include "ui_console_log_view.h"
 
-#include <deque>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -21,6 +23,10 @@
  * from Moonraker's gcode_store endpoint. Uses color-coded output to
  * distinguish commands from responses and errors.
  *
+ * Lines live in a ConsoleLineBuffer ring and are rendered by a ConsoleLogView
+ * widget pool, so appending never creates or deletes widgets. Responses
+ * arriving from the WebSocket are batched and applied once per UI drain.
+ *
  * ## Features (Phase 1)
  * - Read-only command history display
  * - Color-coded output (errors red, responses green)
@@ -66,7 +72,7 @@ class ConsolePanel : public OverlayBase {
     /**
      * @brief Clear all entries from the console display
      *
-     * Removes all entries and widgets, shows empty state.
+     * Removes all entries, shows empty state.
      * Public for callback access.
      */
     void clear_display();
@@ -96,40 +102,27 @@ class ConsolePanel : public OverlayBase {
     /**
      * @brief Populate the console with fetched entries
      *
-     * Clears any existing entries and creates text widgets for each
-     * entry in the history.
+     * Clears any existing entries and pushes each entry in the history
+     * into the line buffer.
      *
      * @param entries Vector of gcode entries from API (oldest first)
      */
     void populate_entries(const std::vector<GcodeEntry>& entries);
 
     /**
-     * @brief Create a single console line widget
-     *
-     * Creates a text_small label with appropriate color based on entry type:
-     * - Commands: primary text color
-     * - Success responses: success color (green)
-     * - Error responses: error color (red)
+     * @brief Push an entry into the line buffer (no rendering)
      *
-     * @param entry The gcode entry to display
+     * @param entry The gcode entry to store
      */
-    void create_entry_widget(const GcodeEntry& entry);
+    void push_entry(const GcodeEntry& entry);
 
     /**
      * @brief Clear all console entries
      *
-     * Removes all child widgets from console_container_.
+     * Empties the line buffer and hides every pooled row.
      */
     void clear_entries();
 
-    /**
-     * @brief Scroll console to bottom (newest entries)
-     *
-     * Called after populating entries to ensure most recent
-     * content is visible (terminal-style scrolling).
-     */
-    void scroll_to_bottom();
-
     /**
      * @brief Check if a response message indicates an error
      *
@@ -152,18 +145,48 @@ class ConsolePanel : public OverlayBase {
     /**
      * @brief Add a single entry to the console (real-time)
      *
-     * Appends entry to history, creates widget, and auto-scrolls if
-     * user hasn't manually scrolled up. Used by notify_gcode_response handler.
+     * Appends entry to history and re-renders, auto-scrolling if the
+     * user hasn't manually scrolled up.
      *
      * @param entry The gcode entry to add
      */
     void add_entry(const GcodeEntry& entry);
 
+    /**
+     * @brief Re-render after one or more push_entry() calls
+     */
+    void commit_appends();
+
+    /**
+     * @brief Apply responses batched by on_gcode_response() (main thread)
+     */
+    void drain_pending_responses();
+
+    /**
+     * @brief Track scroll position and render the lines now in view
+     */
+    void on_console_scroll();
+    static void on_console_scroll_static(lv_event_t* e);
+
+    // === Stress mode (HELIX_CONSOLE_STRESS) ===
+
+    /**
+     * @brief Start feeding synthetic responses at the given rate
+     *
+     * Measures sustained lines/sec and late UI ticks to validate the
+     * console under high-volume output (e.g. verbose macros, AFC debug).
+     *
+     * @param lines_per_sec Target input rate
+     */
+    void start_stress(int lines_per_sec);
+    void stop_stress();
+    void stress_tick();
+
     /**
      * @brief Handle incoming G-code response from WebSocket
      *
-     * Called by notify_gcode_response callback. Parses the notification
-     * and adds entry to console.
+     * Called by notify_gcode_response callback on the WebSocket thread.
+     * Parses the notification and queues the entry for the next drain.
      *
      * @param msg JSON notification message
      */
@@ -202,9 +225,15 @@ class ConsolePanel : public OverlayBase {
     lv_obj_t* gcode_input_ = nullptr;       ///< G-code text input field
 
     // Data
-    std::deque<GcodeEntry> entries_;           ///< History buffer
-    static constexpr size_t MAX_ENTRIES = 200; ///< Maximum entries to display
-    static constexpr int FETCH_COUNT = 100;    ///< Number of entries to fetch
+    static constexpr size_t MAX_ENTRIES = 1000;       ///< Lines kept in the ring
+    static constexpr int FETCH_COUNT = 100;           ///< Number of entries to fetch
+    static constexpr int SCROLL_FOLLOW_THRESHOLD = 8; ///< px from bottom still "following"
+    helix::ConsoleLineBuffer lines_{MAX_ENTRIES};     ///< History ring (outlives log_view_)
+    helix::ui::ConsoleLogView log_view_;              ///< Virtualized line renderer
+
+    // WebSocket -> UI batching
+    std::mutex pending_mutex_;
+    std::vector<GcodeEntry> pending_responses_; ///< Protected by pending_mutex_
 
     // Real-time subscription state
     std::string gcode_handler_name_; ///< Unique handler name for callback registration
@@ -212,6 +241,21 @@ class ConsolePanel : public OverlayBase {
     bool user_scrolled_up_ = false;  ///< True if user manually scrolled up
     bool filter_temps_ = true;       ///< Filter out temperature status messages
 
+    // Stress mode state
+    struct StressState {
+        lv_timer_t* timer = nullptr;
+        int rate = 0;                 ///< Target lines/sec
+        double owed = 0.0;            ///< Fractional lines carried between ticks
+        uint32_t last_tick_ms = 0;    ///< Previous tick time
+        uint32_t window_start_ms = 0; ///< Start of the current report window
+        uint64_t window_lines = 0;    ///< Lines pushed in the current report window
+        uint32_t late_ticks = 0;      ///< Ticks arriving > 2 periods late
+        uint32_t max_gap_ms = 0;      ///< Longest gap between ticks
+        uint64_t rows_at_start = 0;   ///< log_view_.rows_configured() at window start
+    } stress_;
+    static constexpr uint32_t STRESS_TICK_MS = 16;
+    static constexpr uint32_t STRESS_REPORT_MS = 5000;
+
     // Subjects
     SubjectManager subjects_;
     char status_buf_[128] = {};
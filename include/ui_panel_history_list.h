@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "ui_history_list_view.h"
 #include "ui_observer_guard.h"
 
 #include "overlay_base.h"
@@ -41,9 +42,9 @@ struct FileInfo;
  *
  * ## Data Flow:
  * 1. On activate, receives job list from HistoryDashboardPanel
- * 2. Applies search/filter/sort to create filtered_jobs_ for display
- * 3. Dynamically creates row widgets for filtered jobs
- * 4. Caches job data for row click handling (indexes into filtered_jobs_)
+ * 2. Applies search/filter/sort to build filtered_indices_ (indices into jobs_)
+ * 3. HistoryListView renders the visible slice with a fixed, recycled row pool
+ * 4. Row clicks map display index -> filtered_indices_ -> jobs_
  *
  * @see print_history_data.h for PrintHistoryJob struct
  * @see OverlayBase for base class documentation
@@ -204,12 +205,14 @@ class HistoryListPanel : public OverlayBase {
     //
 
     std::vector<PrintHistoryJob> jobs_;              ///< Source of truth - all jobs
-    std::vector<PrintHistoryJob> filtered_jobs_;     ///< Filtered/sorted for display
+    std::vector<size_t> filtered_indices_;           ///< Indices into jobs_, filtered/sorted
     bool jobs_received_ = false;                     ///< True if jobs were set externally
     bool is_active_ = false;                         ///< True if panel is currently visible
     bool detail_overlay_open_ = false;               ///< True while detail overlay is showing
     bool history_changed_while_detail_open_ = false; ///< True if history changed while detail open
 
+    helix::ui::HistoryListView list_view_; ///< Virtualized row pool for list_rows_
+
     // Connection state observer to auto-refresh when connected (ObserverGuard handles cleanup)
     ObserverGuard connection_observer_;
 
@@ -268,7 +271,7 @@ class HistoryListPanel : public OverlayBase {
     //
 
     lv_obj_t* detail_overlay_ = nullptr;     ///< Detail overlay widget (created on first use)
-    size_t selected_job_index_ = 0;          ///< Index of currently selected job in filtered_jobs_
+    size_t selected_job_index_ = 0;          ///< Index of currently selected job in jobs_
     uint64_t detail_overlay_generation_ = 0; ///< Generation counter for async callback safety
 
     // Detail overlay subjects (string subjects for reactive binding)
@@ -311,16 +314,13 @@ class HistoryListPanel : public OverlayBase {
     //
 
     /**
-     * @brief Populate the list with row widgets from filtered_jobs_
+     * @brief Show filtered_indices_ in the list
      *
-     * Clears existing rows and creates new ones from filtered_jobs_ vector.
-     */
-    void populate_list();
-
-    /**
-     * @brief Clear all row widgets from the list
+     * Rebinds the pooled row widgets; no widgets are created or deleted.
+     *
+     * @param preserve_scroll Keep the scroll position (e.g. after loading more jobs)
      */
-    void clear_list();
+    void populate_list(bool preserve_scroll = false);
 
     /**
      * @brief Update the empty state visibility and message
@@ -333,72 +333,54 @@ class HistoryListPanel : public OverlayBase {
      * @brief Apply all filters and sort, then populate list
      *
      * Chain: search → status filter → sort → populate_list()
+     *
+     * @param preserve_scroll Keep the scroll position (jobs changed, filters didn't)
      */
-    void apply_filters_and_sort();
+    void apply_filters_and_sort(bool preserve_scroll = false);
 
     /**
-     * @brief Apply search filter to jobs
+     * @brief Apply search filter to job indices
      *
      * Case-insensitive substring match on filename.
      *
-     * @param source Source job list
-     * @return Filtered job list
-     */
-    std::vector<PrintHistoryJob> apply_search_filter(const std::vector<PrintHistoryJob>& source);
-
-    /**
-     * @brief Apply status filter to jobs
-     *
-     * @param source Source job list
-     * @return Filtered job list
+     * @param source Indices into jobs_
+     * @return Indices of matching jobs
      */
-    std::vector<PrintHistoryJob> apply_status_filter(const std::vector<PrintHistoryJob>& source);
+    std::vector<size_t> apply_search_filter(const std::vector<size_t>& source) const;
 
     /**
-     * @brief Sort jobs in place
+     * @brief Apply status filter to job indices
      *
-     * @param jobs Jobs to sort (modified in place)
+     * @param source Indices into jobs_
+     * @return Indices of matching jobs
      */
-    void apply_sort(std::vector<PrintHistoryJob>& jobs);
+    std::vector<size_t> apply_status_filter(const std::vector<size_t>& source) const;
 
     /**
-     * @brief Get status color for a job status
+     * @brief Sort job indices in place by the current sort column/direction
      *
-     * @param status Job status enum
-     * @return Hex color string (e.g., "#00C853")
+     * @param indices Indices into jobs_ (modified in place)
      */
-    static const char* get_status_color(PrintJobStatus status);
+    void apply_sort(std::vector<size_t>& indices) const;
 
     /**
-     * @brief Get display text for a job status
+     * @brief Get the job shown in the detail overlay
      *
-     * @param status Job status enum
-     * @return Display string (e.g., "Completed", "Failed")
+     * @return Selected job, or nullptr if the selection is no longer valid
      */
-    static const char* get_status_text(PrintJobStatus status);
+    const PrintHistoryJob* selected_job() const;
 
     //
     // === Click Handlers ===
     //
 
-    /**
-     * @brief Attach click handler to a row widget
-     *
-     * @param row Row widget
-     * @param index Index into filtered_jobs_ vector
-     */
-    void attach_row_click_handler(lv_obj_t* row, size_t index);
-
     /**
      * @brief Handle row click - opens detail overlay
      *
-     * @param index Index of clicked row in filtered_jobs_
+     * @param index Display index of clicked row (position in filtered_indices_)
      */
     void handle_row_click(size_t index);
 
-    // Static callback wrapper for row clicks
-    static void on_row_clicked_static(lv_event_t* e);
-
     //
     // === Detail Overlay Methods ===
     //
@@ -488,16 +470,14 @@ class HistoryListPanel : public OverlayBase {
     void check_scroll_position();
 
     /**
-     * @brief Static callback for scroll events
+     * @brief Static callback for scroll end events (infinite scroll)
      */
     static void on_scroll_static(lv_event_t* e);
 
     /**
-     * @brief Append rows for newly loaded jobs (without clearing existing rows)
-     *
-     * @param start_index Index in filtered_jobs_ to start appending from
+     * @brief Static callback for scroll events (recycles visible rows)
      */
-    void append_rows(size_t start_index);
+    static void on_list_scroll_static(lv_event_t* e);
 };
 
 /**
@@ -514,7 +514,9 @@ class PrintSelectPanel : public PanelBase {
     /// Navigation generation counter: incremented on each directory change.
     /// Metadata callbacks capture the current value and discard results
     /// if the generation has changed (user navigated away).
-    std::atomic<uint32_t> nav_generation_{0};
+    /// Shared so thumbnail download predicates can read it off the UI thread.
+    std::shared_ptr<std::atomic<uint32_t>> nav_generation_ =
+        std::make_shared<std::atomic<uint32_t>>(0);
 
     // File list change notification handler name (for unregistering)
     std::string filelist_handler_name_;
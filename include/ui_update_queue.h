@@ -18,6 +18,28 @@
  * This is similar to React's batched state updates - changes are queued and
  * applied together at a safe point.
  *
+ * Producers:
+ * - NORMAL-priority updates go through a bounded lock-free MPSC ring, and captures
+ *   up to 48 bytes are stored inline (SmallCallback), so the websocket thread,
+ *   thumbnail pool and ghost builder never lock or allocate to queue a small update
+ * - HIGH/LOW, coalesced updates and ring overflow use the mutex-protected lanes
+ * - Lane entries are stamped with the ring's producer position; the drain merges
+ *   ring and lane entries by that order, so each producer's updates still run in
+ *   the order it queued them
+ *
+ * Load shedding:
+ * - Priority classes: HIGH drains first and ignores the time budget, then NORMAL, then LOW
+ * - Per-drain time budget: once exceeded, remaining NORMAL/LOW work carries over to the
+ *   next tick (ahead of anything queued since), so a burst can't stall a frame
+ * - Keyed coalescing: queue_update_coalesced() keeps only the latest closure per key,
+ *   at the position of the first pending one
+ *
+ * Idle mode (set_wake_callback()):
+ * - The drain timer pauses itself once the queue is empty, so an idle main loop can
+ *   sleep until the next real LVGL deadline instead of waking every millisecond
+ * - The first update queued after a drain calls the wake callback from the producer's
+ *   thread; the loop then calls resume_if_pending() before lv_timer_handler()
+ *
  * Usage:
  * @code
  * // From any thread (WebSocket callback, async operation, etc.):
@@ -39,13 +61,21 @@
 #pragma once
 
 #include "lvgl/lvgl.h"
+#include "mpsc_ring.h"
+#include "small_callback.h"
 
 #include <spdlog/spdlog.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace helix::ui {
 
@@ -54,6 +84,36 @@ namespace helix::ui {
  */
 using UpdateCallback = std::function<void()>;
 
+/**
+ * @brief Type-erased storage for queued updates (inline for captures up to 48 bytes)
+ */
+using QueuedCallback = helix::SmallCallback<48>;
+
+/**
+ * @brief Drain priority for queued updates
+ */
+enum class UpdatePriority : uint8_t {
+    HIGH = 0,   ///< Input feedback, connection state - never deferred by the budget
+    NORMAL = 1, ///< Default for subject/widget updates
+    LOW = 2,    ///< Bulk refreshes that can lag a frame (lists, metadata, thumbnails)
+};
+
+/**
+ * @brief Queue health counters (see UpdateQueue::get_stats())
+ */
+struct UpdateQueueStats {
+    size_t depth = 0;             ///< Callbacks currently pending (approximate)
+    size_t peak_depth = 0;        ///< Highest depth seen since reset
+    uint64_t executed = 0;        ///< Callbacks run
+    uint64_t coalesced = 0;       ///< Closures replaced by a newer one with the same key
+    uint64_t ring_overflows = 0;  ///< NORMAL updates that found the ring full
+    uint64_t drains = 0;          ///< Non-empty drain passes
+    uint64_t deferred_drains = 0; ///< Drains that hit the budget and carried work over
+    uint64_t last_drain_us = 0;   ///< Duration of the last non-empty drain
+    uint64_t max_drain_us = 0;    ///< Longest drain since reset
+    uint64_t max_wait_us = 0;     ///< Longest enqueue-to-execution latency since reset
+};
+
 /**
  * @brief Thread-safe UI update queue
  *
@@ -103,12 +163,92 @@ class UpdateQueue {
      *
      * Thread-safe. Can be called from any thread.
      * The callback will be executed on the main LVGL thread before rendering.
+     * NORMAL priority is lock-free and allocation-free for small captures.
      *
+     * @param callback Function to execute (any void() callable)
+     * @param priority Drain priority
+     */
+    template <typename F>
+    void queue(F&& callback, UpdatePriority priority = UpdatePriority::NORMAL) {
+        RingItem item{QueuedCallback(std::forward<F>(callback)), Clock::now()};
+        if (priority == UpdatePriority::NORMAL && ring_.try_push(std::move(item))) {
+            signal_work();
+            return;
+        }
+        // HIGH/LOW, or ring full (try_push left item intact): use the locked lane
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (priority == UpdatePriority::NORMAL) {
+                ++stats_.ring_overflows;
+            }
+            push_locked(priority, Entry{std::move(item.callback), nullptr, item.enqueued});
+        }
+        signal_work();
+    }
+
+    /**
+     * @brief Queue an update that supersedes any pending update with the same key
+     *
+     * Thread-safe. If an update with @p key is still pending, its closure is replaced
+     * and keeps its queue position; otherwise this behaves like queue(). Use for
+     * "refresh X" style updates where only the latest state matters.
+     *
+     * @param key Coalescing key (e.g. "ams.sync.0")
      * @param callback Function to execute
+     * @param priority Priority used if no update with @p key is pending
      */
-    void queue(UpdateCallback callback) {
+    template <typename F>
+    void queue_coalesced(const std::string& key, F&& callback,
+                         UpdatePriority priority = UpdatePriority::NORMAL) {
+        QueuedCallback cb(std::forward<F>(callback));
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = coalesce_slots_.find(key);
+            if (it != coalesce_slots_.end()) {
+                it->second->callback = std::move(cb);
+                ++stats_.coalesced;
+                return; // Already pending, so the loop is already awake for it
+            }
+            auto slot = std::make_shared<CoalescedSlot>(CoalescedSlot{key, std::move(cb)});
+            coalesce_slots_.emplace(key, slot);
+            push_locked(priority, Entry{nullptr, std::move(slot), Clock::now()});
+        }
+        signal_work();
+    }
+
+    /**
+     * @brief Set the per-drain time budget
+     *
+     * NORMAL/LOW callbacks stop running once a drain has used this much time; the
+     * rest run on the next tick. At least one callback runs per drain so work always
+     * progresses. Zero disables the budget.
+     */
+    void set_drain_budget(std::chrono::microseconds budget) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        drain_budget_ = budget;
+    }
+
+    [[nodiscard]] std::chrono::microseconds drain_budget() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return drain_budget_;
+    }
+
+    /**
+     * @brief Snapshot queue depth and drain latency counters
+     */
+    [[nodiscard]] UpdateQueueStats get_stats() const {
         std::lock_guard<std::mutex> lock(mutex_);
-        pending_.push(std::move(callback));
+        UpdateQueueStats out = stats_;
+        out.depth = depth_locked() + ring_.size_approx();
+        return out;
+    }
+
+    /**
+     * @brief Reset peak/max counters (depth is live and unaffected)
+     */
+    void reset_stats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_ = UpdateQueueStats{};
     }
 
     /**
@@ -118,14 +258,7 @@ class UpdateQueue {
      * stale callbacks from executing after objects they reference are
      * destroyed. The actual LVGL timer is freed by lv_deinit().
      */
-    void shutdown() {
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            std::queue<UpdateCallback>().swap(pending_); // Clear pending queue
-        }
-        timer_ = nullptr;
-        initialized_ = false;
-    }
+    void shutdown();
 
     /**
      * @brief Pause the update queue timer
@@ -152,6 +285,37 @@ class UpdateQueue {
         }
     }
 
+    /**
+     * @brief Enable idle mode with a main-loop wake function
+     *
+     * @param wake Thread-safe, non-blocking function that wakes the main loop,
+     *             or nullptr to go back to draining on every lv_timer_handler()
+     */
+    void set_wake_callback(void (*wake)()) {
+        wake_fn_.store(wake, std::memory_order_release);
+        if (!wake && idle_paused_) {
+            resume_timer();
+            idle_paused_ = false;
+        }
+    }
+
+    /**
+     * @brief Resume the drain timer if updates arrived while it was paused
+     *
+     * Main thread only. Call before lv_timer_handler() in idle mode.
+     */
+    void resume_if_pending() {
+        if (idle_paused_ && has_work_.load(std::memory_order_acquire)) {
+            resume_timer();
+            idle_paused_ = false;
+        }
+    }
+
+    /// True if updates were queued since the last drain started
+    [[nodiscard]] bool has_pending_work() const {
+        return has_work_.load(std::memory_order_acquire);
+    }
+
   private:
     friend class UpdateQueueTestAccess;
     UpdateQueue() = default;
@@ -173,35 +337,109 @@ class UpdateQueue {
         auto* self = static_cast<UpdateQueue*>(lv_timer_get_user_data(timer));
         if (self && self->initialized_) {
             self->process_pending();
+            self->pause_if_idle();
         }
     }
 
-    void process_pending() {
-        // Move pending updates to local queue to minimize lock time
-        std::queue<UpdateCallback> to_process;
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            std::swap(to_process, pending_);
+    /// Mark work pending; the first producer after a drain wakes the main loop
+    void signal_work() {
+        if (!has_work_.exchange(true, std::memory_order_acq_rel)) {
+            auto wake = wake_fn_.load(std::memory_order_acquire);
+            if (wake) {
+                wake();
+            }
         }
+    }
 
-        // Execute all pending updates - safe because render hasn't started yet
-        while (!to_process.empty()) {
-            try {
-                auto& callback = to_process.front();
-                callback();
-            } catch (const std::exception& e) {
-                spdlog::error("[UpdateQueue] Exception in queued callback: {}", e.what());
-            } catch (...) {
-                spdlog::error("[UpdateQueue] Unknown exception in queued callback");
-            }
-            to_process.pop();
+    /// Idle mode: stop the 1ms drain timer while nothing is queued
+    void pause_if_idle();
+
+    using Clock = std::chrono::steady_clock;
+
+    /// Default drain budget: half a 60 Hz frame, leaving the rest for layout/render
+    static constexpr std::chrono::microseconds DEFAULT_DRAIN_BUDGET{8000};
+    static constexpr size_t PRIORITY_COUNT = 3;
+    static constexpr size_t NORMAL_LANE = static_cast<size_t>(UpdatePriority::NORMAL);
+
+    /// Lock-free slots for NORMAL updates; a full ring spills into the locked lane
+    static constexpr size_t RING_CAPACITY = 1024;
+
+    struct CoalescedSlot {
+        std::string key;
+        QueuedCallback callback; ///< Latest closure queued under key
+    };
+
+    struct Entry {
+        QueuedCallback callback;             ///< Plain update
+        std::shared_ptr<CoalescedSlot> slot; ///< Coalesced update
+        Clock::time_point enqueued;
+        /// Merge order: 2 * ring position + 1 for ring entries; 2 * ring producer
+        /// position (read under mutex_) for lane entries, so a lane entry sorts after
+        /// every ring entry its producer pushed before it and before any pushed after
+        uint64_t order = 0;
+    };
+    using Lane = std::vector<Entry>;
+
+    struct RingItem {
+        QueuedCallback callback;
+        Clock::time_point enqueued;
+    };
+
+    void push_locked(UpdatePriority priority, Entry&& entry) {
+        entry.order = 2 * ring_.producer_position();
+        pending_[static_cast<size_t>(priority)].push_back(std::move(entry));
+        size_t depth = depth_locked();
+        if (depth > stats_.peak_depth) {
+            stats_.peak_depth = depth;
+        }
+    }
+
+    size_t depth_locked() const {
+        size_t depth = 0;
+        for (const auto& lane : pending_) {
+            depth += lane.size();
         }
+        return depth;
     }
 
-    std::mutex mutex_;
-    std::queue<UpdateCallback> pending_;
+    /**
+     * @brief Run pending updates, HIGH first, within the drain budget
+     *
+     * Updates queued by callbacks during the drain run on the next tick.
+     * Must only be called from the LVGL thread (the ring's single consumer).
+     *
+     * @param budgeted false to ignore the budget and run everything (tests, shutdown paths)
+     */
+    void process_pending(bool budgeted = true);
+
+    /// Move published ring entries into the NORMAL drain lane, merged with lane entries
+    void collect_ring(Lane& normal, Lane& waiting);
+
+    /// Run one entry, catching exceptions
+    void run_entry(Entry& entry);
+
+    /// Put unfinished NORMAL entries back, in merge order with newer lane entries
+    void requeue_normal_locked(Lane& waiting, Lane& carried, size_t carried_from);
+
+    mutable std::mutex mutex_;
+    std::array<Lane, PRIORITY_COUNT> pending_;
+    std::unordered_map<std::string, std::shared_ptr<CoalescedSlot>> coalesce_slots_;
+    std::chrono::microseconds drain_budget_ = DEFAULT_DRAIN_BUDGET;
+    UpdateQueueStats stats_;
+    helix::MpscRing<RingItem> ring_{RING_CAPACITY};
+
+    // LVGL thread only: reused drain buffers and re-entrancy guard
+    std::array<Lane, PRIORITY_COUNT> drain_lanes_;
+    Lane waiting_;
+    bool draining_ = false;
+
     lv_timer_t* timer_ = nullptr;
     bool initialized_ = false;
+
+    /// Set by producers, cleared when a drain starts
+    std::atomic<bool> has_work_{false};
+    std::atomic<void (*)()> wake_fn_{nullptr};
+    bool idle_paused_ = false; ///< LVGL thread only: timer paused by pause_if_idle()
 };
 
 /**
@@ -213,8 +451,34 @@ class UpdateQueue {
  *
  * @param callback Function to execute on the main thread
  */
-inline void queue_update(UpdateCallback callback) {
-    UpdateQueue::instance().queue(std::move(callback));
+template <typename F> void queue_update(F&& callback) {
+    UpdateQueue::instance().queue(std::forward<F>(callback));
+}
+
+/**
+ * @brief Queue a UI update with an explicit drain priority
+ *
+ * @param callback Function to execute on the main thread
+ * @param priority HIGH is never deferred by the drain budget; LOW runs last
+ */
+template <typename F> void queue_update(F&& callback, UpdatePriority priority) {
+    UpdateQueue::instance().queue(std::forward<F>(callback), priority);
+}
+
+/**
+ * @brief Queue a UI update that replaces any pending update with the same key
+ *
+ * Only the latest closure per key runs. Use for idempotent "refresh from current
+ * state" updates that can arrive in bursts (e.g. AMS lane events).
+ *
+ * @param key Coalescing key
+ * @param callback Function to execute on the main thread
+ * @param priority Drain priority
+ */
+template <typename F>
+void queue_update_coalesced(const std::string& key, F&& callback,
+                            UpdatePriority priority = UpdatePriority::NORMAL) {
+    UpdateQueue::instance().queue_coalesced(key, std::forward<F>(callback), priority);
 }
 
 /**
@@ -261,7 +525,7 @@ inline void update_queue_shutdown() {
  *
  * Has the EXACT same signature as lv_async_call() but uses the UI update queue
  * to ensure callbacks run BEFORE rendering, not during. Exceptions thrown by
- * callbacks are caught and logged by UpdateQueue::process_pending().
+ * callbacks are caught and logged by UpdateQueue::run_entry().
  *
  * Migration: Simply replace `lv_async_call(` with `async_call(`
  *
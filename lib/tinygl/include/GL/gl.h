@@ -803,6 +803,25 @@ void glDrawText(const GLubyte* text, GLint x, GLint y, GLuint pixel);
 void glTextSize(GLTEXTSIZE mode); 
 void glPlotPixel(GLint x, GLint y, GLuint pixel); 
 
+/*
+ * Deferred band rasterization (TinyGL extension, see zbands.c).
+ * While a handler is set, filled triangles are transformed, lit and clipped on the
+ * calling thread and queued in chunks instead of being drawn. Each full chunk is
+ * passed to dispatch(), which must run glRasterChunkBand() once for every band
+ * (usually one worker thread per band) and return without waiting. wait() blocks
+ * until the last dispatched chunk has been rasterized in all bands.
+ * glFinish() draws everything queued so far; calls that touch the framebuffer
+ * directly (glClear, lines, points, glReadPixels, ...) do so implicitly.
+ * Output is identical to immediate rasterization.
+ */
+typedef struct GLRasterChunk GLRasterChunk;
+typedef void (*GLRasterDispatchFunc)(void* user, const GLRasterChunk* chunk);
+typedef void (*GLRasterWaitFunc)(void* user);
+void glSetRasterBandHandler(GLRasterDispatchFunc dispatch, GLRasterWaitFunc wait, void* user);
+/* Rasterize rows [ysize*band/band_count, ysize*(band+1)/band_count) of a chunk.
+   Safe to call concurrently for different bands of the same chunk. */
+void glRasterChunkBand(const GLRasterChunk* chunk, GLint band, GLint band_count);
+
 #define PROTO_GL1(name)				\
 void gl ## name ## 1f(GLfloat);	\
 void gl ## name ## 1d(GLdouble);	\
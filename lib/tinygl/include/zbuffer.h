@@ -273,6 +273,12 @@ typedef struct {
     GLint depth_test;
     GLint depth_write;
     GLubyte frame_buffer_allocated;
+
+    /* triangle rows drawn: [band_y0, band_y1). The whole buffer unless
+       narrowed by glRasterChunkBand() (see zbands.c) */
+    GLint band_y0, band_y1;
+    /* material for GL_PHONG pixels, NULL = current context material */
+    const void* shade_material;
 } ZBuffer;
 
 typedef struct {
@@ -188,7 +188,9 @@ void glPolygonMode(GLint face, GLint mode) {
 
 void glDepthMask(GLint i) {
 #include "error_check_no_context.h"
-	gl_get_context()->zb->depth_write = (i == GL_TRUE);
+	GLContext* c = gl_get_context();
+	c->zb->depth_write = (i == GL_TRUE);
+	c->raster_state_serial++;
 }
 /* glEnable / glDisable */
 /* TODO go to glopEnableDisable and add error checking there on values there.*/
@@ -632,8 +634,7 @@ void glCallList(GLuint list) {
 
 	gl_add_op(p);
 }
-void glFlush(void) { /* nothing to do */
-}
+void glFlush(void) { gl_raster_flush(gl_get_context()); }
 
 void glHint(GLint target, GLint mode) {
 #include "error_check_no_context.h"
@@ -19,6 +19,7 @@ void glopClear(GLParam* p) {
 	GLint r = (GLint)(c->clear_color.v[0] * COLOR_MULT_MASK);
 	GLint g = (GLint)(c->clear_color.v[1] * COLOR_MULT_MASK);
 	GLint b = (GLint)(c->clear_color.v[2] * COLOR_MULT_MASK);
+	gl_raster_flush(c);
 
 	/* TODO : correct value of Z */
 
@@ -86,6 +86,7 @@ static void gl_add_select1(GLint z1, GLint z2, GLint z3) {
 #endif
 void gl_draw_point(GLVertex* p0) {
 	GLContext* c = gl_get_context();
+	gl_raster_flush(c);
 	if (p0->clip_code == 0) {
 #if TGL_FEATURE_ALT_RENDERMODES == 1
 		if (c->render_mode == GL_SELECT) {
@@ -153,6 +154,7 @@ void gl_draw_line(GLVertex* p1, GLVertex* p2) {
 	GLVertex q1, q2;
 	GLint cc1, cc2;
 
+	gl_raster_flush(c);
 	cc1 = p1->clip_code;
 	cc2 = p2->clip_code;
 
@@ -408,6 +410,12 @@ int count_triangles, count_triangles_textured, count_pixels;
 /* see vertex.c to see how the draw functions are assigned.*/
 void gl_draw_triangle_fill(GLVertex* p0, GLVertex* p1, GLVertex* p2) { 
 	GLContext* c = gl_get_context();
+	if (c->raster_bands) {
+		/* queued for band rasterization (zbands.c), except textured triangles */
+		if (!c->texture_2d_enabled && gl_raster_queue_triangle(c, p0, p1, p2))
+			return;
+		gl_raster_flush(c);
+	}
 	if (c->texture_2d_enabled) {
 		/* if(c->current_texture)*/
 #if TGL_FEATURE_LIT_TEXTURES == 1
@@ -462,6 +470,7 @@ void gl_draw_triangle_fill(GLVertex* p0, GLVertex* p1, GLVertex* p2) {
 
 void gl_draw_triangle_line(GLVertex* p0, GLVertex* p1, GLVertex* p2) {
 	GLContext* c = gl_get_context();
+	gl_raster_flush(c);
 	if (c->zb->depth_test) {
 		if (p0->edge_flag)
 			ZB_line_z(c->zb, &p0->zp, &p1->zp);
@@ -482,6 +491,7 @@ void gl_draw_triangle_line(GLVertex* p0, GLVertex* p1, GLVertex* p2) {
 /* Render a clipped triangle in point mode */
 void gl_draw_triangle_point(GLVertex* p0, GLVertex* p1, GLVertex* p2) {
 	GLContext* c = gl_get_context();
+	gl_raster_flush(c);
 	if (p0->edge_flag)
 		ZB_plot(c->zb, &p0->zp);
 	if (p1->edge_flag)
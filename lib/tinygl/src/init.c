@@ -358,6 +358,7 @@ void glClose(void) {
 
 	GLuint i;
 	GLContext* c = gl_get_context();
+	gl_raster_close(c);
 	for (i = 0; i < 3; i++) {
 		gl_free(c->matrix_stack[i]);
 	}
@@ -14,6 +14,7 @@ void glopMaterial(GLParam* p) {
 	GLint i;
 	GLMaterial* m;
 
+	c->raster_state_serial++;
 	if (mode == GL_FRONT_AND_BACK) {
 		p[1].i = GL_FRONT;
 		glopMaterial(p);
@@ -82,6 +83,8 @@ void glopLight(GLParam* p) {
 	GLLight* l;
 	GLint i;
 
+	gl_raster_flush(c);
+
 	/* assert(light >= GL_LIGHT0 && light < GL_LIGHT0 + MAX_LIGHTS);*/
 
 #if TGL_FEATURE_ERROR_CHECK == 1
@@ -174,6 +177,8 @@ void glopLightModel(GLParam* p) {
 	GLint* v = &p[2].i;
 	GLint i;
 
+	gl_raster_flush(c);
+
 	switch (pname) {
 	case GL_LIGHT_MODEL_AMBIENT:
 		for (i = 0; i < 4; i++)
@@ -201,6 +206,7 @@ void glopLightModel(GLParam* p) {
 void gl_enable_disable_light(GLint light, GLint v) {
 	GLContext* c = gl_get_context();
 	GLLight* l = &c->lights[light];
+	gl_raster_flush(c);
 	if (v && !l->enabled) {
 		l->enabled = 1;
 		l->next = c->first_light;
@@ -224,7 +230,11 @@ void glSetEnableSpecular(GLint s) {
 	p[0].op = OP_SetEnableSpecular;
 	gl_add_op(p);
 }
-void glopSetEnableSpecular(GLParam* p) { gl_get_context()->zEnableSpecular = p[1].i; }
+void glopSetEnableSpecular(GLParam* p) {
+	GLContext* c = gl_get_context();
+	gl_raster_flush(c);
+	c->zEnableSpecular = p[1].i;
+}
 
 void glSetEnableDithering(GLint enable) {
 	GLParam p[2];
@@ -233,23 +243,27 @@ void glSetEnableDithering(GLint enable) {
 	p[0].op = OP_SetEnableDithering;
 	gl_add_op(p);
 }
-void glopSetEnableDithering(GLParam* p) { tgl_dithering_enabled = p[1].i; }
+void glopSetEnableDithering(GLParam* p) {
+	gl_raster_flush(gl_get_context());
+	tgl_dithering_enabled = p[1].i;
+}
 
 /*
  * Per-pixel lighting for Phong shading
  * Simplified version that works with interpolated normals
  * For full quality, use gl_shade_vertex() at vertices (Gouraud)
  */
-void gl_shade_pixel(GLfloat* R_out, GLfloat* G_out, GLfloat* B_out, V3* normal) {
+void gl_shade_pixel(const void* material, GLfloat* R_out, GLfloat* G_out, GLfloat* B_out, V3* normal) {
 	GLContext* c = gl_get_context();
 	GLfloat R, G, B;
-	GLMaterial* m;
+	const GLMaterial* m;
 	GLLight* l;
 	V3 n, s, d;
 	GLfloat tmp, att, dot, dot_spec;
 	GLint twoside = c->light_model_two_side;
 
-	m = &c->materials[0];
+	/* Deferred band rasterization passes the material captured with the triangle */
+	m = material ? (const GLMaterial*)material : &c->materials[0];
 
 	/* Use provided normal (assumed to be normalized by caller) */
 	n.X = normal->X;
@@ -7,6 +7,7 @@ void glPolygonStipple(void* a) {
 #include "error_check.h"
 	ZBuffer* zb = c->zb;
 
+	c->raster_state_serial++;
 	memcpy(zb->stipplepattern, a, TGL_POLYGON_STIPPLE_BYTES);
 	for (GLint i = 0; i < TGL_POLYGON_STIPPLE_BYTES; i++) {
 		zb->stipplepattern[i] = ((GLubyte*)a)[i];
@@ -18,6 +19,8 @@ void glopViewport(GLParam* p) {
 	GLContext* c = gl_get_context();
 	GLint xsize, ysize, xmin, ymin, xsize_req, ysize_req;
 
+	gl_raster_flush(c);
+
 	xmin = p[1].i;
 	ymin = p[2].i;
 	xsize = p[3].i;
@@ -61,6 +64,7 @@ void glopBlendFunc(GLParam* p) {
 	GLContext* c = gl_get_context();
 	c->zb->sfactor = p[1].i;
 	c->zb->dfactor = p[2].i;
+	c->raster_state_serial++;
 }
 
 void glBlendEquation(GLenum mode) {
@@ -73,6 +77,7 @@ void glBlendEquation(GLenum mode) {
 void glopBlendEquation(GLParam* p) {
 	GLContext* c = gl_get_context();
 	c->zb->blendeq = p[1].i;
+	c->raster_state_serial++;
 }
 
 void glopPointSize(GLParam* p) {
@@ -92,6 +97,7 @@ void glopEnableDisable(GLParam* p) {
 	GLint code = p[1].i;
 	GLint v = p[2].i;
 
+	c->raster_state_serial++;
 	switch (code) {
 	case GL_CULL_FACE:
 		c->cull_face_enabled = v;
@@ -253,7 +259,9 @@ void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format
 		return;
 #endif
 	}
+	gl_raster_flush(c);
 	/* TODO: implement read pixels.*/
 }
 
-void glFinish(void) { return; }
+/* Waits for queued triangles when band rasterization is enabled (zbands.c) */
+void glFinish(void) { gl_raster_flush(gl_get_context()); }
@@ -214,6 +214,7 @@ void glopCopyTexImage2D(GLParam* p) {
 	GLsizei h = p[7].i;
 	GLint border = p[8].i;
 	GLContext* c = gl_get_context();
+	gl_raster_flush(c);
 	y -= h;
 
 	if (c->readbuffer != GL_FRONT || c->current_texture == NULL || target != GL_TEXTURE_2D || border != 0 ||
@@ -0,0 +1,232 @@
+/*
+ * Deferred band rasterization.
+ *
+ * Normally gl_draw_triangle_fill() rasterizes every triangle as soon as it has
+ * been transformed, lit and clipped. Once a band handler is installed with
+ * glSetRasterBandHandler(), untextured filled triangles are queued into a chunk
+ * instead, together with a snapshot of the ZBuffer and material state they are
+ * drawn with. Full chunks go to the handler, which calls glRasterChunkBand()
+ * once per horizontal band of the framebuffer (typically one thread per band).
+ * A band only writes its own rows of the color and depth buffers and draws the
+ * chunk's triangles in submission order, so the image is identical to drawing
+ * them one at a time.
+ *
+ * There are two chunks: the caller fills one while the other is rasterized.
+ * Everything else that touches the framebuffer (clears, lines, points, pixel
+ * ops, textured triangles) or the lighting read by GL_PHONG pixels calls
+ * gl_raster_flush() first.
+ */
+#include "msghandling.h"
+#include "zgl.h"
+
+static void raster_capture_state(GLContext* c, GLRasterState* s) {
+	ZBuffer* zb = c->zb;
+	s->depth_test = zb->depth_test;
+	s->depth_write = zb->depth_write;
+	s->enable_blend = zb->enable_blend;
+	s->blendeq = zb->blendeq;
+	s->sfactor = zb->sfactor;
+	s->dfactor = zb->dfactor;
+#if TGL_FEATURE_POLYGON_STIPPLE == 1
+	s->dostipple = zb->dostipple;
+	memcpy(s->stipplepattern, zb->stipplepattern, TGL_POLYGON_STIPPLE_BYTES);
+#endif
+	s->material = c->materials[0];
+}
+
+static void raster_apply_state(ZBuffer* zb, const GLRasterState* s) {
+	zb->depth_test = s->depth_test;
+	zb->depth_write = s->depth_write;
+	zb->enable_blend = s->enable_blend;
+	zb->blendeq = s->blendeq;
+	zb->sfactor = s->sfactor;
+	zb->dfactor = s->dfactor;
+#if TGL_FEATURE_POLYGON_STIPPLE == 1
+	zb->dostipple = s->dostipple;
+	memcpy(zb->stipplepattern, s->stipplepattern, TGL_POLYGON_STIPPLE_BYTES);
+#endif
+	zb->shade_material = &s->material;
+}
+
+/* Hand the current chunk to the handler and start filling the other one */
+static void raster_submit(GLRasterBands* b) {
+	GLRasterChunk* chunk = &b->chunks[b->current];
+	if (b->in_flight) {
+		b->wait(b->user);
+		b->in_flight = 0;
+	}
+	if (chunk->triangle_count == 0)
+		return;
+	b->dispatch(b->user, chunk);
+	b->in_flight = 1;
+	b->current ^= 1;
+	b->chunks[b->current].triangle_count = 0;
+	b->chunks[b->current].state_count = 0;
+}
+
+void gl_raster_flush(GLContext* c) {
+	GLRasterBands* b = c->raster_bands;
+	if (b == NULL)
+		return;
+	raster_submit(b);
+	if (b->in_flight) {
+		b->wait(b->user);
+		b->in_flight = 0;
+	}
+}
+
+void gl_raster_close(GLContext* c) {
+	gl_raster_flush(c);
+	gl_free(c->raster_bands);
+	c->raster_bands = NULL;
+}
+
+GLint gl_raster_queue_triangle(GLContext* c, GLVertex* p0, GLVertex* p1, GLVertex* p2) {
+	GLRasterBands* b = c->raster_bands;
+	GLRasterChunk* chunk;
+	GLRasterTriangle* t;
+	GLint fill;
+
+	if (b == NULL)
+		return 0;
+	/* same choice as gl_draw_triangle_fill() */
+	if (c->current_shade_model == GL_PHONG) {
+#if TGL_FEATURE_SPECULAR_BUFFERS == 1
+		return 0; /* the specular buffer cache is not thread-safe */
+#else
+		fill = RASTER_FILL_PHONG;
+#endif
+	} else if (c->current_shade_model == GL_SMOOTH) {
+		fill = RASTER_FILL_SMOOTH_NOBLEND;
+#if TGL_FEATURE_BLEND == 1
+		if (c->zb->enable_blend)
+			fill = RASTER_FILL_SMOOTH;
+#endif
+	} else {
+		fill = RASTER_FILL_FLAT_NOBLEND;
+#if TGL_FEATURE_BLEND == 1
+		if (c->zb->enable_blend)
+			fill = RASTER_FILL_FLAT;
+#endif
+	}
+
+	chunk = &b->chunks[b->current];
+	if (chunk->triangle_count == RASTER_CHUNK_TRIANGLES) {
+		raster_submit(b);
+		chunk = &b->chunks[b->current];
+	}
+	if (chunk->state_count == 0 || b->state_serial != c->raster_state_serial) {
+		if (chunk->state_count == RASTER_CHUNK_STATES) {
+			raster_submit(b);
+			chunk = &b->chunks[b->current];
+		}
+		raster_capture_state(c, &chunk->states[chunk->state_count++]);
+		b->state_serial = c->raster_state_serial;
+	}
+
+	t = &chunk->triangles[chunk->triangle_count++];
+	t->p[0] = p0->zp;
+	t->p[1] = p1->zp;
+	t->p[2] = p2->zp;
+	if (fill == RASTER_FILL_PHONG) {
+		memcpy(t->n[0], p0->normal.v, sizeof(t->n[0]));
+		memcpy(t->n[1], p1->normal.v, sizeof(t->n[1]));
+		memcpy(t->n[2], p2->normal.v, sizeof(t->n[2]));
+	}
+	t->state = (GLushort)(chunk->state_count - 1);
+	t->fill = (GLubyte)fill;
+	return 1;
+}
+
+void glSetRasterBandHandler(GLRasterDispatchFunc dispatch, GLRasterWaitFunc wait, void* user) {
+	GLContext* c = gl_get_context();
+	GLRasterBands* b;
+#include "error_check.h"
+	if (dispatch == NULL || wait == NULL) {
+		gl_raster_close(c);
+		return;
+	}
+	gl_raster_flush(c);
+	b = c->raster_bands;
+	if (b == NULL) {
+		b = gl_zalloc(sizeof(GLRasterBands));
+		if (b == NULL) {
+#if TGL_FEATURE_ERROR_CHECK == 1
+#define ERROR_FLAG GL_OUT_OF_MEMORY
+#include "error_check.h"
+#else
+			gl_fatal_error("GL_OUT_OF_MEMORY");
+#endif
+		}
+		c->raster_bands = b;
+	}
+	b->dispatch = dispatch;
+	b->wait = wait;
+	b->user = user;
+}
+
+void glRasterChunkBand(const GLRasterChunk* chunk, GLint band, GLint band_count) {
+	GLContext* c = gl_get_context();
+	ZBuffer zb;
+	GLint i, y0, y1, last_state = -1;
+
+	/* Only the buffers and their size are read from the context's ZBuffer:
+	   the caller may be changing its state for the next chunk meanwhile. */
+	memset(&zb, 0, sizeof(zb));
+	zb.pbuf = c->zb->pbuf;
+	zb.zbuf = c->zb->zbuf;
+	zb.xsize = c->zb->xsize;
+	zb.ysize = c->zb->ysize;
+	zb.linesize = c->zb->linesize;
+	y0 = (GLint)((long)zb.ysize * band / band_count);
+	y1 = (GLint)((long)zb.ysize * (band + 1) / band_count);
+	zb.band_y0 = y0;
+	zb.band_y1 = y1;
+
+	for (i = 0; i < chunk->triangle_count; i++) {
+		const GLRasterTriangle* t = &chunk->triangles[i];
+		ZBufferPoint p0, p1, p2;
+		GLint ymin = t->p[0].y, ymax = t->p[0].y;
+		if (t->p[1].y < ymin)
+			ymin = t->p[1].y;
+		if (t->p[1].y > ymax)
+			ymax = t->p[1].y;
+		if (t->p[2].y < ymin)
+			ymin = t->p[2].y;
+		if (t->p[2].y > ymax)
+			ymax = t->p[2].y;
+		if (ymax < y0 || ymin >= y1)
+			continue;
+
+		if (t->state != last_state) {
+			raster_apply_state(&zb, &chunk->states[t->state]);
+			last_state = t->state;
+		}
+		/* the fill functions may reorder and modify their points */
+		p0 = t->p[0];
+		p1 = t->p[1];
+		p2 = t->p[2];
+		switch (t->fill) {
+		case RASTER_FILL_FLAT:
+			ZB_fillTriangleFlat(&zb, &p0, &p1, &p2);
+			break;
+		case RASTER_FILL_FLAT_NOBLEND:
+			ZB_fillTriangleFlatNOBLEND(&zb, &p0, &p1, &p2);
+			break;
+		case RASTER_FILL_SMOOTH:
+			ZB_fillTriangleSmooth(&zb, &p0, &p1, &p2);
+			break;
+		case RASTER_FILL_SMOOTH_NOBLEND:
+			ZB_fillTriangleSmoothNOBLEND(&zb, &p0, &p1, &p2);
+			break;
+		default: {
+			GLfloat n0[3], n1[3], n2[3];
+			memcpy(n0, t->n[0], sizeof(n0));
+			memcpy(n1, t->n[1], sizeof(n1));
+			memcpy(n2, t->n[2], sizeof(n2));
+			ZB_fillTrianglePhong(&zb, &p0, &p1, &p2, n0, n1, n2);
+			break;
+		}
+		}
+	}
+}
@@ -169,6 +169,47 @@ typedef struct GLSharedState {
 
 struct GLContext;
 
+/* Deferred band rasterization (zbands.c) */
+#define RASTER_CHUNK_TRIANGLES 4096
+#define RASTER_CHUNK_STATES 256
+
+enum { RASTER_FILL_FLAT, RASTER_FILL_FLAT_NOBLEND, RASTER_FILL_SMOOTH, RASTER_FILL_SMOOTH_NOBLEND, RASTER_FILL_PHONG };
+
+/* ZBuffer/material state a queued triangle is drawn with */
+typedef struct GLRasterState {
+	GLint depth_test, depth_write, enable_blend;
+	GLenum blendeq, sfactor, dfactor;
+#if TGL_FEATURE_POLYGON_STIPPLE == 1
+	GLuint dostipple;
+	GLubyte stipplepattern[TGL_POLYGON_STIPPLE_BYTES];
+#endif
+	GLMaterial material; /* front material, read by GL_PHONG pixels */
+} GLRasterState;
+
+/* A transformed, lit and clipped triangle waiting for rasterization */
+typedef struct GLRasterTriangle {
+	ZBufferPoint p[3];
+	GLfloat n[3][3]; /* GL_PHONG only */
+	GLushort state;
+	GLubyte fill;
+} GLRasterTriangle;
+
+struct GLRasterChunk {
+	GLRasterTriangle triangles[RASTER_CHUNK_TRIANGLES];
+	GLRasterState states[RASTER_CHUNK_STATES];
+	GLint triangle_count, state_count;
+};
+
+typedef struct GLRasterBands {
+	GLRasterChunk chunks[2]; /* one filled by the caller while the other is rasterized */
+	GLint current;			 /* chunk being filled */
+	GLint in_flight;		 /* the other chunk was dispatched and not waited for */
+	GLint state_serial;		 /* raster_state_serial of the last captured state */
+	GLRasterDispatchFunc dispatch;
+	GLRasterWaitFunc wait;
+	void* user;
+} GLRasterBands;
+
 typedef void (*gl_draw_triangle_func)(GLVertex* p0, GLVertex* p1, GLVertex* p2);
 
 /* display context */
@@ -316,6 +357,11 @@ typedef struct GLContext {
 #endif
 	GLint zEnableSpecular;
 
+	/* deferred band rasterization, NULL = rasterize immediately (zbands.c) */
+	GLRasterBands* raster_bands;
+	/* bumped whenever state captured in GLRasterState changes */
+	GLint raster_state_serial;
+
 	/* raster position */
 	GLint rasterpos_zz;
 	GLfloat pzoomx, pzoomy;
@@ -417,6 +463,11 @@ void gl_draw_triangle_line(GLVertex* p0, GLVertex* p1, GLVertex* p2);
 void gl_draw_triangle_fill(GLVertex* p0, GLVertex* p1, GLVertex* p2);	
 void gl_draw_triangle_select(GLVertex* p0, GLVertex* p1, GLVertex* p2); 
 void gl_draw_triangle_feedback(GLVertex* p0, GLVertex* p1, GLVertex* p2);
+
+/* zbands.c */
+GLint gl_raster_queue_triangle(GLContext* c, GLVertex* p0, GLVertex* p1, GLVertex* p2);
+void gl_raster_flush(GLContext* c);
+void gl_raster_close(GLContext* c);
 /* matrix.c */
 void gl_print_matrix(const GLfloat* m);
 /*
@@ -426,7 +477,7 @@ void glopTranslate(GLParam *p);*/
 /* light.c */
 void gl_enable_disable_light(GLint light, GLint v);
 void gl_shade_vertex(GLVertex* v);
-void gl_shade_pixel(GLfloat* R_out, GLfloat* G_out, GLfloat* B_out, V3* normal);
+void gl_shade_pixel(const void* material, GLfloat* R_out, GLfloat* G_out, GLfloat* B_out, V3* normal);
 
 void glInitTextures(void);
 void glEndTextures(void);
@@ -5,6 +5,7 @@
 void glPostProcess(GLuint (*postprocess)(GLint x, GLint y, GLuint pixel, GLushort z)) {
 	GLint i, j;
 	GLContext* c = gl_get_context();
+	gl_raster_flush(c);
 #ifdef _OPENMP
 #pragma omp parallel for collapse(2)
 #endif
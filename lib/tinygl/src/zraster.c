@@ -103,6 +103,7 @@ void glopDrawPixels(GLParam* p) {
 	GLContext* c = gl_get_context();
 	GLint sy, sx, ty, tx;
 	
+	gl_raster_flush(c);
 	GLint w = p[1].i;
 	GLint h = p[2].i;
 	V4 rastpos = c->rasterpos;
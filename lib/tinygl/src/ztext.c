@@ -44,6 +44,7 @@ void glopPlotPixel(GLParam* p) {
 	GLContext* c = gl_get_context();
 	GLint x = p[1].i;
 	PIXEL pix = p[2].ui;
+	gl_raster_flush(c);
 	c->zb->pbuf[x] = pix;
 	
 }
@@ -30,6 +30,7 @@ Things to keep in mind:
 	GLint the_y;
 #endif
 	GLint dither_y;  /* Y coordinate for dithering (always tracked) */
+	GLint band_y0 = zb->band_y0, band_y1 = zb->band_y1; /* rows this call may draw */
 	GLint error, derror;
 	GLint x1, dxdy_min, dxdy_max;
 	/* warning: x2 is multiplied by 2^16 */
@@ -75,6 +76,10 @@ Things to keep in mind:
 		p2 = t;
 	}
 
+	/* nothing to draw in this band (see zbands.c); rows p0->y..p2->y are covered */
+	if (p2->y < band_y0 || p0->y >= band_y1)
+		return;
+
 	/* we compute dXdx and dXdy for all GLinterpolated values */
 	fdx1 = p1->x - p0->x; 
 	fdy1 = p1->y - p0->y; 
@@ -337,6 +342,8 @@ Things to keep in mind:
 
 		while (nb_lines > 0) {
 			nb_lines--;
+			/* rows above the band are stepped, not drawn, so edges match a full pass */
+			if (dither_y >= band_y0) {
 #ifndef DRAW_LINE
 			/* generic draw line */
 			{
@@ -410,6 +417,7 @@ Things to keep in mind:
 #else
 			DRAW_LINE();
 #endif
+			}
 
 			/* left edge */
 			error += derror;
@@ -473,6 +481,8 @@ Things to keep in mind:
 #endif
 			dither_y++;  /* Increment Y for dithering */
 			pz1 += zb->xsize;
+			if (dither_y >= band_y1)
+				return;
 		}
 	}
 }
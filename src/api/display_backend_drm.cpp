@@ -272,12 +272,14 @@ lv_indev_t* DisplayBackendDRM::create_input_pointer() {
         pointer_ = lv_libinput_create(LV_INDEV_TYPE_POINTER, device_override.c_str());
         if (pointer_ != nullptr) {
             spdlog::info("[DRM Backend] Libinput pointer device created on {}", device_override);
+            input_path_ = device_override;
             return pointer_;
         }
         // Try evdev as fallback for the specified device
         pointer_ = lv_evdev_create(LV_INDEV_TYPE_POINTER, device_override.c_str());
         if (pointer_ != nullptr) {
             spdlog::info("[DRM Backend] Evdev pointer device created on {}", device_override);
+            input_path_ = device_override;
             return pointer_;
         }
         spdlog::warn("[DRM Backend] Could not open specified touch device: {}", device_override);
@@ -294,6 +296,7 @@ lv_indev_t* DisplayBackendDRM::create_input_pointer() {
         pointer_ = lv_libinput_create(LV_INDEV_TYPE_POINTER, touch_path);
         if (pointer_ != nullptr) {
             spdlog::info("[DRM Backend] Libinput touch device created on {}", touch_path);
+            input_path_ = touch_path;
             return pointer_;
         }
         spdlog::warn("[DRM Backend] Failed to create libinput device for: {}", touch_path);
@@ -306,6 +309,7 @@ lv_indev_t* DisplayBackendDRM::create_input_pointer() {
         pointer_ = lv_libinput_create(LV_INDEV_TYPE_POINTER, pointer_path);
         if (pointer_ != nullptr) {
             spdlog::info("[DRM Backend] Libinput pointer device created on {}", pointer_path);
+            input_path_ = pointer_path;
             return pointer_;
         }
         spdlog::warn("[DRM Backend] Failed to create libinput device for: {}", pointer_path);
@@ -320,6 +324,7 @@ lv_indev_t* DisplayBackendDRM::create_input_pointer() {
         pointer_ = lv_evdev_create(LV_INDEV_TYPE_POINTER, dev);
         if (pointer_ != nullptr) {
             spdlog::info("[DRM Backend] Evdev pointer device created on {}", dev);
+            input_path_ = dev;
             return pointer_;
         }
     }
@@ -449,6 +449,7 @@ lv_indev_t* DisplayBackendFbdev::create_input_pointer() {
     }
 
     spdlog::info("[Fbdev Backend] Evdev touch input created on {}", touch_path);
+    touch_path_ = touch_path;
     return touch_;
 }
 
@@ -0,0 +1,249 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "http_executor.h"
+
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+
+namespace helix {
+
+namespace {
+
+constexpr size_t kPriorityCount = 3;
+
+} // namespace
+
+// ============================================================================
+// Shared state
+// ============================================================================
+
+// Owned jointly by the executor and every worker, so a worker detached at
+// shutdown never touches freed memory
+struct HttpExecutor::State {
+    struct Entry {
+        Job job;
+        std::function<bool()> still_wanted;
+    };
+
+    mutable std::mutex mutex;
+    std::condition_variable work_cv;
+    std::condition_variable exit_cv;
+
+    std::array<std::deque<Entry>, kPriorityCount> queues; ///< Indexed by HttpPriority
+    std::vector<std::thread> workers;
+
+    unsigned max_workers{1};
+    unsigned max_bulk{1};
+    unsigned idle{0};        ///< Workers waiting for a job
+    unsigned running{0};     ///< Workers not yet exited
+    unsigned active{0};      ///< Jobs running
+    unsigned bulk_active{0}; ///< BULK jobs running
+    bool stopping{false};
+
+    size_t peak_queue_depth{0};
+    uint64_t submitted{0};
+    uint64_t completed{0};
+    uint64_t dropped{0};
+
+    HttpConnectionCounters counters;
+
+    size_t queue_depth() const {
+        size_t depth = 0;
+        for (const auto& queue : queues) {
+            depth += queue.size();
+        }
+        return depth;
+    }
+
+    /// A queue a worker may take from now (BULK only under its cap), or -1
+    int runnable_queue() const {
+        for (size_t p = 0; p < kPriorityCount; ++p) {
+            if (queues[p].empty()) {
+                continue;
+            }
+            if (p == static_cast<size_t>(HttpPriority::BULK) && bulk_active >= max_bulk) {
+                continue;
+            }
+            return static_cast<int>(p);
+        }
+        return -1;
+    }
+};
+
+// ============================================================================
+// HttpExecutor
+// ============================================================================
+
+HttpExecutor::HttpExecutor(unsigned max_workers, unsigned max_bulk)
+    : max_workers_(std::max(1u, max_workers)),
+      max_bulk_(max_bulk > 0 ? std::min(max_bulk, max_workers_)
+                             : std::max(1u, max_workers_ - 1)),
+      state_(std::make_shared<State>()) {
+    state_->max_workers = max_workers_;
+    state_->max_bulk = max_bulk_;
+}
+
+HttpExecutor::~HttpExecutor() {
+    shutdown();
+}
+
+bool HttpExecutor::submit(Job job, HttpJobOptions options) {
+    if (!job) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->stopping) {
+        return false;
+    }
+
+    auto& queue = state_->queues[static_cast<size_t>(options.priority)];
+    queue.push_back(State::Entry{std::move(job), std::move(options.still_wanted)});
+    ++state_->submitted;
+
+    size_t depth = state_->queue_depth();
+    state_->peak_queue_depth = std::max(state_->peak_queue_depth, depth);
+
+    // Start another worker only when the waiting ones can't take the queue
+    if (depth > state_->idle && state_->workers.size() < state_->max_workers) {
+        // Counted before the thread exists (it decrements on exit, under this lock);
+        // a failed spawn must not leave shutdown() waiting for a worker that never ran
+        ++state_->running;
+        try {
+            state_->workers.emplace_back(&HttpExecutor::worker_loop, state_);
+        } catch (const std::exception& e) {
+            --state_->running;
+            spdlog::error("[HttpExecutor] Failed to start HTTP worker ({} running): {}",
+                          state_->workers.size(), e.what());
+        }
+    }
+    // Queued either way: a running worker or the next submit() picks it up
+    state_->work_cv.notify_one();
+    return true;
+}
+
+bool HttpExecutor::shutdown(std::chrono::milliseconds timeout) {
+    std::vector<std::thread> workers;
+    {
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        if (!state_->stopping) {
+            state_->stopping = true;
+            state_->dropped += state_->queue_depth();
+            for (auto& queue : state_->queues) {
+                queue.clear();
+            }
+            state_->work_cv.notify_all();
+        }
+        if (state_->workers.empty()) {
+            return true;
+        }
+
+        if (state_->active > 0) {
+            spdlog::debug("[HttpExecutor] Waiting for {} HTTP request(s) to finish...",
+                          state_->active);
+        }
+        bool finished =
+            state_->exit_cv.wait_for(lock, timeout, [this] { return state_->running == 0; });
+        workers = std::move(state_->workers);
+        state_->workers.clear();
+
+        if (!finished) {
+            // Stuck transfers (libhv timeouts can be up to an hour) must not
+            // block shutdown; the workers own a reference to the shared state
+            spdlog::warn("[HttpExecutor] {} HTTP request(s) still running after {}ms - "
+                         "will terminate with process",
+                         state_->active, timeout.count());
+            for (auto& t : workers) {
+                t.detach();
+            }
+            return false;
+        }
+    }
+
+    // Every worker has left its loop; joining just reaps the threads
+    for (auto& t : workers) {
+        if (t.joinable()) {
+            t.join();
+        }
+    }
+    return true;
+}
+
+HttpExecutor::Metrics HttpExecutor::metrics() const {
+    Metrics m;
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    m.queue_depth = state_->queue_depth();
+    m.peak_queue_depth = state_->peak_queue_depth;
+    m.active = state_->active;
+    m.workers = static_cast<unsigned>(state_->workers.size());
+    m.submitted = state_->submitted;
+    m.completed = state_->completed;
+    m.dropped = state_->dropped;
+    m.requests = state_->counters.requests.load();
+    m.connections_opened = state_->counters.connections_opened.load();
+    m.connections_reused = state_->counters.connections_reused.load();
+    return m;
+}
+
+void HttpExecutor::worker_loop(std::shared_ptr<State> state) {
+    HttpSession session(state->counters);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (true) {
+        ++state->idle;
+        state->work_cv.wait(lock,
+                            [&state] { return state->stopping || state->runnable_queue() >= 0; });
+        --state->idle;
+        if (state->stopping) {
+            break;
+        }
+
+        int priority = state->runnable_queue();
+        auto& queue = state->queues[static_cast<size_t>(priority)];
+        State::Entry entry = std::move(queue.front());
+        queue.pop_front();
+        bool bulk = priority == static_cast<int>(HttpPriority::BULK);
+
+        ++state->active;
+        if (bulk) {
+            ++state->bulk_active;
+        }
+        lock.unlock();
+
+        bool ran = false;
+        if (!entry.still_wanted || entry.still_wanted()) {
+            ran = true;
+            try {
+                entry.job(session);
+            } catch (const std::exception& e) {
+                spdlog::error("[HttpExecutor] HTTP job threw: {}", e.what());
+            }
+        }
+        entry = State::Entry{}; // Release captures before re-taking the lock
+
+        lock.lock();
+        --state->active;
+        if (bulk) {
+            --state->bulk_active;
+            // A BULK job may have been waiting on the cap
+            state->work_cv.notify_one();
+        }
+        if (ran) {
+            ++state->completed;
+        } else {
+            ++state->dropped;
+        }
+    }
+
+    --state->running;
+    state->exit_cv.notify_all();
+}
+
+} // namespace helix
@@ -0,0 +1,144 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "http_executor.h"
+
+#include "hv/HttpClient.h"
+#include "spdlog/spdlog.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace helix {
+
+HttpSession::HttpSession(HttpConnectionCounters& counters) : counters_(counters) {}
+
+HttpSession::~HttpSession() = default;
+
+std::string HttpSession::host_key(const std::string& url) {
+    size_t scheme_end = url.find("://");
+    if (scheme_end == std::string::npos || scheme_end == 0) {
+        return "";
+    }
+
+    size_t authority_start = scheme_end + 3;
+    size_t authority_end = url.find_first_of("/?#", authority_start);
+    std::string authority = url.substr(authority_start, authority_end == std::string::npos
+                                                            ? std::string::npos
+                                                            : authority_end - authority_start);
+    if (authority.empty()) {
+        return "";
+    }
+
+    std::string scheme = url.substr(0, scheme_end);
+    std::transform(scheme.begin(), scheme.end(), scheme.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+
+    // Spell out default ports so "host" and "host:80" share a connection
+    // (IPv6 literals are bracketed: the port colon comes after ']')
+    size_t port_colon = authority.rfind(':');
+    size_t bracket = authority.rfind(']');
+    if (port_colon == std::string::npos ||
+        (bracket != std::string::npos && port_colon < bracket)) {
+        authority += scheme == "https" ? ":443" : ":80";
+    }
+    return scheme + "://" + authority;
+}
+
+HttpSession::Connection& HttpSession::connection_for(const std::string& key) {
+    auto now = std::chrono::steady_clock::now();
+
+    auto it = connections_.find(key);
+    if (it != connections_.end() && now - it->second.last_used > IDLE_TIMEOUT) {
+        // Servers drop idle keep-alive connections; reopening beats a failed write
+        connections_.erase(it);
+        it = connections_.end();
+    }
+
+    if (it == connections_.end()) {
+        if (connections_.size() >= MAX_HOSTS) {
+            auto lru = std::min_element(connections_.begin(), connections_.end(),
+                                        [](const auto& a, const auto& b) {
+                                            return a.second.last_used < b.second.last_used;
+                                        });
+            connections_.erase(lru);
+        }
+        Connection conn;
+        conn.client = std::make_unique<hv::HttpClient>();
+        conn.last_used = now;
+        it = connections_.emplace(key, std::move(conn)).first;
+    }
+    return it->second;
+}
+
+std::shared_ptr<HttpResponse> HttpSession::send(const std::shared_ptr<HttpRequest>& req) {
+    if (!req) {
+        return nullptr;
+    }
+
+    counters_.requests.fetch_add(1);
+    auto resp = std::make_shared<HttpResponse>();
+
+    std::string key = host_key(req->url);
+    if (key.empty()) {
+        // Not something we can key a connection on - let libhv report the error
+        counters_.connections_opened.fetch_add(1);
+        hv::HttpClient client;
+        return client.send(req.get(), resp.get()) == 0 ? resp : nullptr;
+    }
+
+    Connection& conn = connection_for(key);
+    bool reused = conn.keep_alive;
+    int ret = conn.client->send(req.get(), resp.get());
+
+    if (ret != 0 && reused && (req->method == HTTP_GET || req->method == HTTP_HEAD)) {
+        // The server closed the idle connection under us; retry once on a
+        // fresh one (only for idempotent requests)
+        spdlog::debug("[HttpSession] Reused connection to {} failed ({}), reconnecting", key,
+                      ret);
+        reused = false;
+        conn.client = std::make_unique<hv::HttpClient>();
+        resp = std::make_shared<HttpResponse>();
+        ret = conn.client->send(req.get(), resp.get());
+    }
+
+    if (reused) {
+        counters_.connections_reused.fetch_add(1);
+    } else {
+        counters_.connections_opened.fetch_add(1);
+    }
+
+    if (ret != 0) {
+        connections_.erase(key);
+        return nullptr;
+    }
+
+    conn.last_used = std::chrono::steady_clock::now();
+    conn.keep_alive = resp->IsKeepAlive();
+    if (!conn.keep_alive) {
+        // Server is closing its end; don't try to reuse it
+        connections_.erase(key);
+    }
+    return resp;
+}
+
+std::shared_ptr<HttpResponse> HttpSession::get(const std::string& url) {
+    auto req = std::make_shared<HttpRequest>();
+    req->method = HTTP_GET;
+    req->url = url;
+    return send(req);
+}
+
+std::shared_ptr<HttpResponse> HttpSession::post(const std::string& url, const std::string& body) {
+    auto req = std::make_shared<HttpRequest>();
+    req->method = HTTP_POST;
+    req->url = url;
+    req->body = body;
+    return send(req);
+}
+
+void HttpSession::close_all() {
+    connections_.clear();
+}
+
+} // namespace helix
@@ -284,21 +284,24 @@ void MoonrakerAPI::download_file(const std::string& root, const std::string& pat
 
     spdlog::debug("[Moonraker API] Downloading file: {}", url);
 
-    // Run HTTP request in a tracked thread to ensure clean shutdown
-    launch_http_thread([url, path, on_success, on_error]() {
-        auto resp = requests::get(url.c_str());
+    // Whole files can be large: BULK keeps them from occupying every HTTP worker
+    launch_http_request(
+        [url, path, on_success, on_error](helix::HttpSession& http) {
+            auto resp = http.get(url);
 
-        if (!handle_http_response(resp, "download_file", on_error)) {
-            return;
-        }
+            if (!handle_http_response(resp, "download_file", on_error)) {
+                return;
+            }
 
-        spdlog::debug("[Moonraker API] Downloaded {} bytes from {}", resp->body.size(), path);
-        helix::MemoryMonitor::log_now("moonraker_download_done");
+            spdlog::debug("[Moonraker API] Downloaded {} bytes from {}", resp->body.size(),
+                          path);
+            helix::MemoryMonitor::log_now("moonraker_download_done");
 
-        if (on_success) {
-            on_success(resp->body);
-        }
-    });
+            if (on_success) {
+                on_success(resp->body);
+            }
+        },
+        {helix::HttpPriority::BULK, nullptr});
 }
 
 void MoonrakerAPI::download_file_partial(const std::string& root, const std::string& path,
@@ -321,8 +324,8 @@ void MoonrakerAPI::download_file_partial(const std::string& root, const std::str
 
     spdlog::debug("[Moonraker API] Partial download (first {} bytes): {}", max_bytes, url);
 
-    // Run HTTP request in a tracked thread
-    launch_http_thread([url, path, max_bytes, on_success, on_error]() {
+    // Run HTTP request on the executor (keep-alive session)
+    launch_http_request([url, path, max_bytes, on_success, on_error](helix::HttpSession& http) {
         // Create request with Range header for partial content
         auto req = std::make_shared<HttpRequest>();
         req->method = HTTP_GET;
@@ -334,7 +337,7 @@ void MoonrakerAPI::download_file_partial(const std::string& root, const std::str
         std::string range_header = "bytes=0-" + std::to_string(max_bytes - 1);
         req->SetHeader("Range", range_header);
 
-        auto resp = requests::request(req);
+        auto resp = http.send(req);
 
         // Accept both 200 (full file) and 206 (partial content)
         if (!handle_http_response(resp, "download_file_partial", on_error, {200, 206})) {
@@ -366,30 +369,34 @@ void MoonrakerAPI::download_file_to_path(const std::string& root, const std::str
 
     spdlog::debug("[Moonraker API] Streaming download: {} -> {}", url, dest_path);
 
-    // Run HTTP request in a tracked thread to ensure clean shutdown
-    // Use requests::downloadFile which streams directly to disk
-    launch_http_thread([url, path, dest_path, on_success, on_error, on_progress]() {
-        // libhv's downloadFile progress callback signature matches our ProgressCallback
-        size_t bytes_written = requests::downloadFile(url.c_str(), dest_path.c_str(), on_progress);
-
-        if (bytes_written == 0) {
-            spdlog::error("[Moonraker API] Streaming download failed: {} -> {}", url, dest_path);
-            report_connection_error(on_error, "download_file_to_path",
-                                    "Streaming download failed: " + path);
-            return;
-        }
+    // Run as a BULK job on the executor
+    // Use requests::downloadFile which streams directly to disk (on its own connection)
+    launch_http_request(
+        [url, path, dest_path, on_success, on_error, on_progress](helix::HttpSession&) {
+            // libhv's downloadFile progress callback signature matches our ProgressCallback
+            size_t bytes_written =
+                requests::downloadFile(url.c_str(), dest_path.c_str(), on_progress);
+
+            if (bytes_written == 0) {
+                spdlog::error("[Moonraker API] Streaming download failed: {} -> {}", url,
+                              dest_path);
+                report_connection_error(on_error, "download_file_to_path",
+                                        "Streaming download failed: " + path);
+                return;
+            }
 
-        spdlog::info("[Moonraker API] Streamed {} bytes to {}", bytes_written, dest_path);
+            spdlog::info("[Moonraker API] Streamed {} bytes to {}", bytes_written, dest_path);
 
-        if (on_success) {
-            on_success(dest_path);
-        }
-    });
+            if (on_success) {
+                on_success(dest_path);
+            }
+        },
+        {helix::HttpPriority::BULK, nullptr});
 }
 
 void MoonrakerAPI::download_thumbnail(const std::string& thumbnail_path,
                                       const std::string& cache_path, StringCallback on_success,
-                                      ErrorCallback on_error) {
+                                      ErrorCallback on_error, helix::HttpJobOptions options) {
     // Validate inputs
     if (thumbnail_path.empty()) {
         spdlog::warn("[Moonraker API] Empty thumbnail path");
@@ -413,34 +420,36 @@ void MoonrakerAPI::download_thumbnail(const std::string& thumbnail_path,
 
     spdlog::trace("[Moonraker API] Downloading thumbnail: {} -> {}", url, cache_path);
 
-    // Run HTTP request in a tracked thread to ensure clean shutdown
-    launch_http_thread([url, thumbnail_path, cache_path, on_success, on_error]() {
-        auto resp = requests::get(url.c_str());
+    // Queued by priority: thumbnails of visible cards go ahead of everything else
+    launch_http_request(
+        [url, thumbnail_path, cache_path, on_success, on_error](helix::HttpSession& http) {
+            auto resp = http.get(url);
 
-        if (!handle_http_response(resp, "download_thumbnail", on_error)) {
-            return;
-        }
+            if (!handle_http_response(resp, "download_thumbnail", on_error)) {
+                return;
+            }
 
-        // Write to cache file
-        std::ofstream file(cache_path, std::ios::binary);
-        if (!file) {
-            spdlog::error("[Moonraker API] Failed to create cache file: {}", cache_path);
-            report_error(on_error, MoonrakerErrorType::UNKNOWN, "download_thumbnail",
-                         "Failed to create cache file: " + cache_path);
-            return;
-        }
+            // Write to cache file
+            std::ofstream file(cache_path, std::ios::binary);
+            if (!file) {
+                spdlog::error("[Moonraker API] Failed to create cache file: {}", cache_path);
+                report_error(on_error, MoonrakerErrorType::UNKNOWN, "download_thumbnail",
+                             "Failed to create cache file: " + cache_path);
+                return;
+            }
 
-        file.write(resp->body.data(), static_cast<std::streamsize>(resp->body.size()));
-        file.close();
+            file.write(resp->body.data(), static_cast<std::streamsize>(resp->body.size()));
+            file.close();
 
-        spdlog::trace("[Moonraker API] Cached thumbnail {} bytes -> {}", resp->body.size(),
-                      cache_path);
-        helix::MemoryMonitor::log_now("moonraker_thumb_downloaded");
+            spdlog::trace("[Moonraker API] Cached thumbnail {} bytes -> {}", resp->body.size(),
+                          cache_path);
+            helix::MemoryMonitor::log_now("moonraker_thumb_downloaded");
 
-        if (on_success) {
-            on_success(cache_path);
-        }
-    });
+            if (on_success) {
+                on_success(cache_path);
+            }
+        },
+        std::move(options));
 }
 
 void MoonrakerAPI::upload_file(const std::string& root, const std::string& path,
@@ -468,50 +477,53 @@ void MoonrakerAPI::upload_file_with_name(const std::string& root, const std::str
 
     spdlog::debug("[Moonraker API] Uploading {} bytes to {}/{}", content.size(), root, path);
 
-    // Run HTTP request in a tracked thread to ensure clean shutdown
-    launch_http_thread([url, root, path, filename, content, on_success, on_error]() {
-        // Create multipart form request
-        auto req = std::make_shared<HttpRequest>();
-        req->method = HTTP_POST;
-        req->url = url;
-        req->timeout = 120; // 2 minute timeout for uploads
-        req->content_type = MULTIPART_FORM_DATA;
-
-        // Add root parameter (e.g., "gcodes" or "config")
-        req->SetFormData("root", root);
-
-        // Add path parameter if uploading to subdirectory
-        if (path.find('/') != std::string::npos) {
-            // Extract directory from path
-            size_t last_slash = path.rfind('/');
-            if (last_slash != std::string::npos) {
-                std::string directory = path.substr(0, last_slash);
-                req->SetFormData("path", directory);
+    // Uploads hold the whole file in memory and can run for minutes: BULK
+    launch_http_request(
+        [url, root, path, filename, content, on_success, on_error](helix::HttpSession& http) {
+            // Create multipart form request
+            auto req = std::make_shared<HttpRequest>();
+            req->method = HTTP_POST;
+            req->url = url;
+            req->timeout = 120; // 2 minute timeout for uploads
+            req->content_type = MULTIPART_FORM_DATA;
+
+            // Add root parameter (e.g., "gcodes" or "config")
+            req->SetFormData("root", root);
+
+            // Add path parameter if uploading to subdirectory
+            if (path.find('/') != std::string::npos) {
+                // Extract directory from path
+                size_t last_slash = path.rfind('/');
+                if (last_slash != std::string::npos) {
+                    std::string directory = path.substr(0, last_slash);
+                    req->SetFormData("path", directory);
+                }
             }
-        }
 
-        // Add file content with filename
-        // Use hv::FormData for multipart file upload
-        hv::FormData file_data;
-        file_data.content = content;
-        file_data.filename = filename;
-        req->form["file"] = file_data;
-        helix::MemoryMonitor::log_now("moonraker_upload_start");
+            // Add file content with filename
+            // Use hv::FormData for multipart file upload
+            hv::FormData file_data;
+            file_data.content = content;
+            file_data.filename = filename;
+            req->form["file"] = file_data;
+            helix::MemoryMonitor::log_now("moonraker_upload_start");
 
-        // Send request
-        auto resp = requests::request(req);
+            // Send request
+            auto resp = http.send(req);
 
-        // Upload accepts 200 or 201
-        if (!handle_http_response(resp, "upload_file", on_error, {200, 201})) {
-            return;
-        }
+            // Upload accepts 200 or 201
+            if (!handle_http_response(resp, "upload_file", on_error, {200, 201})) {
+                return;
+            }
 
-        spdlog::info("[Moonraker API] Successfully uploaded {} ({} bytes)", path, content.size());
+            spdlog::info("[Moonraker API] Successfully uploaded {} ({} bytes)", path,
+                         content.size());
 
-        if (on_success) {
-            on_success();
-        }
-    });
+            if (on_success) {
+                on_success();
+            }
+        },
+        {helix::HttpPriority::BULK, nullptr});
 }
 
 void MoonrakerAPI::upload_file_from_path(const std::string& root, const std::string& dest_path,
@@ -564,9 +576,11 @@ void MoonrakerAPI::upload_file_from_path(const std::string& root, const std::str
         params["path"] = directory;
     }
 
-    // Run streaming upload in a tracked thread using libhv's uploadLargeFormFile
-    launch_http_thread(
-        [url, params, filename, local_path, file_size, on_success, on_error, on_progress]() {
+    // Run streaming upload as a BULK job using libhv's uploadLargeFormFile
+    // (which opens its own connection)
+    launch_http_request(
+        [url, params, filename, local_path, file_size, on_success, on_error,
+         on_progress](helix::HttpSession&) {
             // Use libhv's streaming multipart upload with custom filename
             // Combine external progress callback with internal logging
             size_t last_progress_log = 0;
@@ -601,7 +615,8 @@ void MoonrakerAPI::upload_file_from_path(const std::string& root, const std::str
             if (on_success) {
                 on_success();
             }
-        });
+        },
+        {helix::HttpPriority::BULK, nullptr});
 }
 
 // ============================================================================
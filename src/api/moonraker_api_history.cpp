@@ -31,8 +31,8 @@ void MoonrakerAPI::get_timelapse_settings(TimelapseSettingsCallback on_success,
     std::string url = http_base_url_ + "/machine/timelapse/settings";
     spdlog::debug("[Moonraker API] Fetching timelapse settings from: {}", url);
 
-    launch_http_thread([url, on_success, on_error]() {
-        auto resp = requests::get(url.c_str());
+    launch_http_request([url, on_success, on_error](helix::HttpSession& http) {
+        auto resp = http.get(url);
 
         if (!resp) {
             spdlog::error("[Moonraker API] HTTP request failed for timelapse settings");
@@ -149,8 +149,8 @@ void MoonrakerAPI::set_timelapse_settings(const TimelapseSettings& settings,
                  settings.mode, settings.output_framerate);
     spdlog::debug("[Moonraker API] Timelapse URL: {}", url_str);
 
-    launch_http_thread([url_str, on_success, on_error]() {
-        auto resp = requests::post(url_str.c_str(), "");
+    launch_http_request([url_str, on_success, on_error](helix::HttpSession& http) {
+        auto resp = http.post(url_str, "");
 
         if (!resp) {
             spdlog::error("[Moonraker API] HTTP request failed for timelapse settings update");
@@ -205,8 +205,8 @@ void MoonrakerAPI::set_timelapse_enabled(bool enabled, SuccessCallback on_succes
 
     spdlog::info("[Moonraker API] Setting timelapse enabled={}", enabled);
 
-    launch_http_thread([url, enabled, on_success, on_error]() {
-        auto resp = requests::post(url.c_str(), "");
+    launch_http_request([url, enabled, on_success, on_error](helix::HttpSession& http) {
+        auto resp = http.post(url, "");
 
         if (!resp) {
             spdlog::error("[Moonraker API] HTTP request failed for timelapse enable");
@@ -358,8 +358,9 @@ void MoonrakerAPIMock::upload_file_with_name(const std::string& root, const std:
 
 void MoonrakerAPIMock::download_thumbnail(const std::string& thumbnail_path,
                                           const std::string& cache_path, StringCallback on_success,
-                                          ErrorCallback on_error) {
+                                          ErrorCallback on_error, helix::HttpJobOptions options) {
     (void)on_error; // Unused - mock falls back to placeholder on failure
+    (void)options;  // Mock resolves synchronously; nothing to schedule
 
     spdlog::debug("[MoonrakerAPIMock] download_thumbnail: path='{}' -> cache='{}'", thumbnail_path,
                   cache_path);
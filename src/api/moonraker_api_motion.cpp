@@ -302,8 +302,8 @@ void MoonrakerAPI::get_power_devices(PowerDevicesCallback on_success, ErrorCallb
     std::string url = http_base_url_ + "/machine/device_power/devices";
     spdlog::debug("[Moonraker API] Fetching power devices from: {}", url);
 
-    launch_http_thread([url, on_success, on_error]() {
-        auto resp = requests::get(url.c_str());
+    launch_http_request([url, on_success, on_error](helix::HttpSession& http) {
+        auto resp = http.get(url);
 
         if (!resp) {
             spdlog::error("[Moonraker API] HTTP request failed for power devices");
@@ -410,8 +410,8 @@ void MoonrakerAPI::set_device_power(const std::string& device, const std::string
 
     spdlog::info("[Moonraker API] Setting power device '{}' to '{}'", device, action);
 
-    launch_http_thread([url, device, action, on_success, on_error]() {
-        auto resp = requests::post(url.c_str(), "");
+    launch_http_request([url, device, action, on_success, on_error](helix::HttpSession& http) {
+        auto resp = http.post(url, "");
 
         if (!resp) {
             spdlog::error("[Moonraker API] HTTP request failed for power device");
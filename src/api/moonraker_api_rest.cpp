@@ -95,8 +95,8 @@ void MoonrakerAPI::call_rest_get(const std::string& endpoint, RestCallback on_co
 
     spdlog::debug("[Moonraker API] REST GET: {}", url);
 
-    // Run HTTP request in a tracked thread
-    launch_http_thread([url, endpoint, on_complete]() {
+    // Run HTTP request on the executor (keep-alive session)
+    launch_http_request([url, endpoint, on_complete](helix::HttpSession& http) {
         RestResponse result;
 
         // Use explicit HttpRequest for timeout control (consistent with POST)
@@ -105,7 +105,7 @@ void MoonrakerAPI::call_rest_get(const std::string& endpoint, RestCallback on_co
         req->url = url;
         req->timeout = 30; // 30 second timeout
 
-        auto resp = requests::request(req);
+        auto resp = http.send(req);
 
         if (!resp) {
             spdlog::error("[Moonraker API] REST GET failed (no response): {}", url);
@@ -211,8 +211,8 @@ void MoonrakerAPI::call_rest_post(const std::string& endpoint, const json& param
     // Log without body content to avoid exposing sensitive data
     spdlog::debug("[Moonraker API] REST POST: {} ({} bytes)", url, body.size());
 
-    // Run HTTP request in a tracked thread
-    launch_http_thread([url, endpoint, body, on_complete]() {
+    // Run HTTP request on the executor (keep-alive session)
+    launch_http_request([url, endpoint, body, on_complete](helix::HttpSession& http) {
         RestResponse result;
 
         // Create POST request with JSON body
@@ -223,7 +223,7 @@ void MoonrakerAPI::call_rest_post(const std::string& endpoint, const json& param
         req->content_type = APPLICATION_JSON;
         req->body = body;
 
-        auto resp = requests::request(req);
+        auto resp = http.send(req);
 
         if (!resp) {
             spdlog::error("[Moonraker API] REST POST failed (no response): {}", url);
@@ -479,22 +479,16 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
                 }
 
                 std::string method = j["method"].get<std::string>();
+                const bool is_status_notification =
+                    method == "notify_status_update" || method == "notify_filelist_changed";
 
-                // Copy callbacks to invoke (to avoid holding lock during callback execution)
+                // Copy method callbacks to invoke (to avoid holding lock during callback
+                // execution). Notify subscribers are snapshotted by fan_out_status().
                 std::vector<std::function<void(json)>> callbacks_to_invoke;
 
                 {
                     std::lock_guard<std::mutex> lock(callbacks_mutex_);
 
-                    // Printer status updates (most common)
-                    if (method == "notify_status_update" || method == "notify_filelist_changed") {
-                        // Copy all notify callbacks from map
-                        callbacks_to_invoke.reserve(notify_callbacks_.size());
-                        for (const auto& [id, cb] : notify_callbacks_) {
-                            callbacks_to_invoke.push_back(cb);
-                        }
-                    }
-
                     // Method-specific persistent callbacks
                     auto method_it = method_callbacks_.find(method);
                     if (method_it != method_callbacks_.end()) {
@@ -513,10 +507,19 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
                     }
                 }
 
+                // Freeze the message so every subscriber shares one instance.
+                // j is not used past this point (only the extracted method name).
+                StatusDelta notification = std::make_shared<const json>(std::move(j));
+
+                // Printer status updates (most common)
+                if (is_status_notification) {
+                    fan_out_status(notification, msg.size());
+                }
+
                 // Invoke callbacks outside lock to prevent deadlock
                 for (auto& cb : callbacks_to_invoke) {
                     try {
-                        cb(j);
+                        cb(*notification);
                     } catch (const std::exception& e) {
                         LOG_ERROR_INTERNAL("[Moonraker Client] Callback for {} threw exception: {}",
                                            method, e.what());
@@ -697,15 +700,114 @@ SubscriptionId MoonrakerClient::register_notify_update(std::function<void(json)>
         return INVALID_SUBSCRIPTION_ID;
     }
 
+    // Adapter: the by-value signature forces one copy of the shared notification per call
+    auto subscriber = std::make_shared<NotifySubscriber>();
+    subscriber->cb = [legacy_cb = std::move(cb)](const StatusDelta& notification) {
+        legacy_cb(*notification);
+    };
+    subscriber->legacy = true;
+
     SubscriptionId id = next_subscription_id_.fetch_add(1);
     {
         std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        notify_callbacks_.emplace(id, cb);
+        notify_callbacks_.emplace(id, std::move(subscriber));
     }
     spdlog::trace("[Moonraker Client] Registered notify callback with ID {}", id);
     return id;
 }
 
+SubscriptionId MoonrakerClient::register_status_delta(StatusDeltaCallback cb) {
+    if (!cb) {
+        spdlog::warn("[Moonraker Client] register_status_delta called with null callback");
+        return INVALID_SUBSCRIPTION_ID;
+    }
+
+    auto subscriber = std::make_shared<NotifySubscriber>();
+    subscriber->cb = std::move(cb);
+
+    SubscriptionId id = next_subscription_id_.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(callbacks_mutex_);
+        notify_callbacks_.emplace(id, std::move(subscriber));
+    }
+    spdlog::trace("[Moonraker Client] Registered status delta callback with ID {}", id);
+    return id;
+}
+
+StatusFanoutStats MoonrakerClient::get_status_fanout_stats() const {
+    StatusFanoutStats stats;
+    stats.notifications = fanout_notifications_.load(std::memory_order_relaxed);
+    stats.deliveries = fanout_deliveries_.load(std::memory_order_relaxed);
+    stats.legacy_deliveries = fanout_legacy_deliveries_.load(std::memory_order_relaxed);
+    stats.bytes_delivered = fanout_bytes_delivered_.load(std::memory_order_relaxed);
+    stats.bytes_copied = fanout_bytes_copied_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void MoonrakerClient::fan_out_status(const StatusDelta& notification, size_t payload_bytes) {
+    if (!notification) {
+        return;
+    }
+
+    // Two-phase: snapshot subscriber handles under lock, invoke outside to avoid deadlock
+    std::vector<std::shared_ptr<const NotifySubscriber>> subscribers;
+    {
+        std::lock_guard<std::mutex> lock(callbacks_mutex_);
+        subscribers.reserve(notify_callbacks_.size());
+        for (const auto& [id, subscriber] : notify_callbacks_) {
+            subscribers.push_back(subscriber);
+        }
+    }
+
+    size_t legacy_count = 0;
+    for (const auto& subscriber : subscribers) {
+        if (subscriber->legacy) {
+            ++legacy_count;
+        }
+        try {
+            subscriber->cb(notification);
+        } catch (const std::exception& e) {
+            LOG_ERROR_INTERNAL("[Moonraker Client] Status callback threw exception: {}", e.what());
+        } catch (...) {
+            LOG_ERROR_INTERNAL("[Moonraker Client] Status callback threw unknown exception");
+        }
+    }
+
+    const uint64_t bytes_delivered = static_cast<uint64_t>(payload_bytes) * subscribers.size();
+    const uint64_t bytes_copied = static_cast<uint64_t>(payload_bytes) * legacy_count;
+    fanout_notifications_.fetch_add(1, std::memory_order_relaxed);
+    fanout_deliveries_.fetch_add(subscribers.size(), std::memory_order_relaxed);
+    fanout_legacy_deliveries_.fetch_add(legacy_count, std::memory_order_relaxed);
+    fanout_bytes_delivered_.fetch_add(bytes_delivered, std::memory_order_relaxed);
+    fanout_bytes_copied_.fetch_add(bytes_copied, std::memory_order_relaxed);
+
+    // Report copy rate once per window. "before" is what per-subscriber copies would cost.
+    static constexpr int64_t FANOUT_REPORT_INTERVAL_MS = 30000;
+    const int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                               std::chrono::steady_clock::now().time_since_epoch())
+                               .count();
+    const uint64_t window_copied =
+        fanout_report_bytes_copied_.fetch_add(bytes_copied, std::memory_order_relaxed) +
+        bytes_copied;
+    const uint64_t window_delivered =
+        fanout_report_bytes_delivered_.fetch_add(bytes_delivered, std::memory_order_relaxed) +
+        bytes_delivered;
+    int64_t window_start = fanout_report_start_ms_.load(std::memory_order_relaxed);
+    if (window_start == 0) {
+        fanout_report_start_ms_.compare_exchange_strong(window_start, now_ms);
+    } else if (now_ms - window_start >= FANOUT_REPORT_INTERVAL_MS &&
+               fanout_report_start_ms_.compare_exchange_strong(window_start, now_ms)) {
+        const double secs = static_cast<double>(now_ms - window_start) / 1000.0;
+        fanout_report_bytes_copied_.fetch_sub(window_copied, std::memory_order_relaxed);
+        fanout_report_bytes_delivered_.fetch_sub(window_delivered, std::memory_order_relaxed);
+        spdlog::debug("[Moonraker Client] Status fan-out: {:.0f} B/s copied ({:.0f} B/s with "
+                      "per-subscriber copies), {} subscribers ({} legacy)",
+                      static_cast<double>(window_copied) / secs,
+                      static_cast<double>(window_delivered) / secs, subscribers.size(),
+                      legacy_count);
+    }
+}
+
 bool MoonrakerClient::unsubscribe_notify_update(SubscriptionId id) {
     if (id == INVALID_SUBSCRIPTION_ID) {
         return false;
@@ -788,31 +890,17 @@ void MoonrakerClient::dispatch_status_update(const json& status) {
     }
 
     // Wrap raw status into notify_status_update format
-    json notification = {
+    auto notification = std::make_shared<const json>(json{
         {"method", "notify_status_update"},
         {"params", json::array({status, 0.0})} // [status, eventtime]
-    };
-
-    // Dispatch to all registered callbacks
-    // Two-phase: copy under lock, invoke outside to avoid deadlock
-    std::vector<std::function<void(json)>> callbacks_copy;
-    {
-        std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        callbacks_copy.reserve(notify_callbacks_.size());
-        for (const auto& [id, cb] : notify_callbacks_) {
-            callbacks_copy.push_back(cb);
-        }
-    }
+    });
 
-    for (const auto& cb : callbacks_copy) {
-        if (cb) {
-            cb(notification);
-        }
-    }
+    // Initial subscription responses and mock updates only: no raw payload to measure,
+    // and serializing the whole status just for the counters isn't worth it
+    fan_out_status(notification, 0);
 
-    spdlog::trace(
-        "[Moonraker Client] Dispatched status update to {} callbacks (has print_stats: {})",
-        callbacks_copy.size(), status.contains("print_stats"));
+    spdlog::trace("[Moonraker Client] Dispatched status update (has print_stats: {})",
+                  status.contains("print_stats"));
 }
 
 void MoonrakerClient::register_method_callback(const std::string& method,
@@ -2823,18 +2823,14 @@ void MoonrakerClientMock::dispatch_historical_temperatures() {
     constexpr int HOLD_PHASE_SAMPLES = 120; // ~30 seconds hold at peak
     // Cooling phase = remaining samples (~70s, cools extruder ~20°C to ~40°C)
 
-    // Copy callbacks to avoid holding lock during dispatch
-    std::vector<std::function<void(json)>> callbacks_copy;
+    bool has_subscribers = false;
     {
         std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        callbacks_copy.reserve(notify_callbacks_.size());
-        for (const auto& [id, cb] : notify_callbacks_) {
-            callbacks_copy.push_back(cb);
-        }
+        has_subscribers = !notify_callbacks_.empty();
     }
 
     // If no callbacks registered yet, skip (caller should register before connect)
-    if (callbacks_copy.empty()) {
+    if (!has_subscribers) {
         spdlog::warn(
             "[MoonrakerClientMock] No callbacks registered for historical temps - skipping");
         return;
@@ -2927,15 +2923,12 @@ void MoonrakerClientMock::dispatch_historical_temperatures() {
             }
         }
 
-        json notification = {{"method", "notify_status_update"},
-                             {"params", json::array({status_obj, timestamp_sec})}};
+        auto notification =
+            std::make_shared<const json>(json{{"method", "notify_status_update"},
+                                              {"params", json::array({status_obj, timestamp_sec})}});
 
-        // Dispatch to all callbacks
-        for (const auto& cb : callbacks_copy) {
-            if (cb) {
-                cb(notification);
-            }
-        }
+        // Dispatch to all callbacks (synthetic backfill, not counted as traffic)
+        fan_out_status(notification, 0);
     }
 
     // Store final historical values as current temps
@@ -3472,29 +3465,17 @@ void MoonrakerClientMock::temperature_simulation_loop() {
             }
         }
 
-        json notification = {{"method", "notify_status_update"},
-                             {"params", json::array({status_obj, tick * base_dt})}};
+        auto notification =
+            std::make_shared<const json>(json{{"method", "notify_status_update"},
+                                              {"params", json::array({status_obj, tick * base_dt})}});
 
-        // Push notification through all registered callbacks
-        // Two-phase: copy under lock, invoke outside to avoid deadlock
-        std::vector<std::function<void(json)>> callbacks_copy;
-        {
-            std::lock_guard<std::mutex> lock(callbacks_mutex_);
-            callbacks_copy.reserve(notify_callbacks_.size());
-            for (const auto& [id, cb] : notify_callbacks_) {
-                callbacks_copy.push_back(cb);
-            }
-        }
-        for (const auto& cb : callbacks_copy) {
-            if (cb) {
-                cb(notification);
-            }
-        }
+        // Push notification through all registered callbacks (simulated, not counted as traffic)
+        fan_out_status(notification, 0);
 
         // Log every 40 ticks (~10 seconds) to confirm loop is running
         if (tick % 40 == 0) {
-            spdlog::trace("[MoonrakerClientMock] Simulation tick {} - callbacks={}", tick,
-                          callbacks_copy.size());
+            spdlog::trace("[MoonrakerClientMock] Simulation tick {} - deliveries={}", tick,
+                          get_status_fanout_stats().deliveries);
         }
 
         // Sleep wall-clock interval with early-exit support for clean shutdown
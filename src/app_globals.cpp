@@ -24,6 +24,7 @@
 
 #include <spdlog/spdlog.h>
 
+#include <atomic>
 #include <cerrno>
 #include <climits>
 #include <csignal>
@@ -56,6 +57,9 @@ static lv_subject_t g_show_beta_features_subject;
 // Application quit flag (volatile sig_atomic_t for async-signal-safety)
 static volatile sig_atomic_t g_quit_requested = 0;
 
+// Main loop wake hook (set by Application; lock-free so signal handlers can use it)
+static std::atomic<void (*)()> g_main_loop_wake{nullptr};
+
 // Wizard active flag
 static bool g_wizard_active = false;
 
@@ -201,10 +205,12 @@ void app_store_argv(int argc, char** argv) {
 void app_request_quit() {
     spdlog::info("[App Globals] Application quit requested");
     g_quit_requested = 1;
+    app_wake_main_loop();
 }
 
 void app_request_quit_signal_safe() {
     g_quit_requested = 1;
+    app_wake_main_loop();
 }
 
 void app_request_restart() {
@@ -218,6 +224,10 @@ void app_request_restart() {
     }
 
 #if defined(__unix__) || defined(__APPLE__)
+    // The new process reads the config file at startup - don't let it race
+    // a debounced save that hasn't been written yet
+    Config::get_instance()->flush();
+
     // Fork a new process
     pid_t pid = fork();
 
@@ -243,6 +253,7 @@ void app_request_restart() {
     // Parent process - signal main loop to exit cleanly
     spdlog::info("[App Globals] Forked new process (PID {}), parent exiting", pid);
     g_quit_requested = 1;
+    app_wake_main_loop();
 
 #else
     // Unsupported platform - fall back to quit
@@ -270,6 +281,17 @@ bool app_quit_requested() {
     return g_quit_requested != 0;
 }
 
+void app_set_main_loop_wake(void (*wake)()) {
+    g_main_loop_wake.store(wake, std::memory_order_release);
+}
+
+void app_wake_main_loop() {
+    auto wake = g_main_loop_wake.load(std::memory_order_acquire);
+    if (wake) {
+        wake();
+    }
+}
+
 bool is_wizard_active() {
     return g_wizard_active;
 }
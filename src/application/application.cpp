@@ -124,6 +124,7 @@
 #include "action_prompt_modal.h"
 #include "app_globals.h"
 #include "filament_sensor_manager.h"
+#include "frame_profiler.h"
 #include "gcode_file_modifier.h"
 #include "hv/hlog.h" // libhv logging - sync level with spdlog
 #include "logging_init.h"
@@ -151,6 +152,8 @@
 #include <SDL.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <csignal>
 #include <cstdlib>
@@ -199,6 +202,24 @@ void graceful_quit_signal_handler(int /*sig*/) {
     app_request_quit_signal_safe();
 }
 
+/**
+ * @brief SIGUSR2 handler — asks the main loop to export the frame profiler trace
+ */
+void trace_export_signal_handler(int /*sig*/) {
+    helix::profiling::FrameProfiler::request_export();
+    app_wake_main_loop();
+}
+
+/// Waiter of the running main loop, for wake_main_loop() (lock-free: signal-safe)
+std::atomic<helix::application::LoopWaiter*> g_loop_waiter{nullptr};
+
+void wake_main_loop() {
+    auto* waiter = g_loop_waiter.load(std::memory_order_acquire);
+    if (waiter) {
+        waiter->wake();
+    }
+}
+
 } // namespace
 
 Application::Application() = default;
@@ -2057,6 +2078,18 @@ int Application::main_loop() {
     loop_config.benchmark_report_interval_ms = 5000;
     m_loop_handler.init(loop_config, start_time);
 
+    // Idle-aware sleeping. The loop used to wake every 5ms regardless of work; now it
+    // sleeps until the next LVGL timer, input, queued UI work or housekeeping deadline.
+    static constexpr uint32_t MAX_LOOP_WAIT_MS = 1000; // Display sleep/dim granularity
+    static constexpr uint32_t STARTUP_POLL_MS = 10;    // Splash handoff is polled
+    static constexpr uint32_t AUTOMATION_POLL_MS = 50; // --screenshot / --timeout
+    static constexpr uint32_t LOOP_STATS_INTERVAL_MS = 60000;
+    init_loop_wakeups();
+    m_loop_stats.start(start_time);
+    init_frame_profiler(loop_config.benchmark_mode);
+    uint32_t last_loop_stats_tick = start_time;
+    const bool automation_polling = m_args.screenshot_enabled || m_args.timeout_sec > 0;
+
     // Main event loop
     while (lv_display_get_next(nullptr) && !app_quit_requested()) {
         uint32_t current_tick = DisplayManager::get_ticks();
@@ -2088,7 +2121,10 @@ int Application::main_loop() {
         check_timeouts();
 
         // Process Moonraker notifications
-        process_notifications();
+        {
+            HELIX_PROFILE_SCOPE("moonraker.notifications");
+            process_notifications();
+        }
 
         // Check display sleep
         m_display->check_display_sleep();
@@ -2100,8 +2136,13 @@ int Application::main_loop() {
             last_fb_selfheal_tick = current_tick;
         }
 
-        // Run LVGL tasks
-        lv_timer_handler();
+        // Run LVGL tasks; returns ms until the next timer is due
+        helix::ui::UpdateQueue::instance().resume_if_pending();
+        uint32_t next_timer_ms;
+        {
+            HELIX_PROFILE_SCOPE("lvgl.timers");
+            next_timer_ms = lv_timer_handler();
+        }
 
         // Signal splash to exit when discovery completes (or timeout)
         m_splash_manager.check_and_signal();
@@ -2145,11 +2186,68 @@ int Application::main_loop() {
             }
         }
 
-        DisplayManager::delay(5);
+        // Sleep until the earliest of: next LVGL timer, housekeeping deadlines below,
+        // input (fd readiness), or a wake() from a thread that queued work
+        uint32_t now = DisplayManager::get_ticks();
+        uint32_t wait_ms = (next_timer_ms == LV_NO_TIMER_READY)
+                               ? MAX_LOOP_WAIT_MS
+                               : std::min(next_timer_ms, MAX_LOOP_WAIT_MS);
+        auto until = [now](uint32_t last, uint32_t interval) {
+            uint32_t since = now - last;
+            return since >= interval ? 0U : interval - since;
+        };
+        wait_ms = std::min(wait_ms, until(m_last_timeout_check, m_timeout_check_interval));
+        if (needs_fb_self_heal) {
+            wait_ms = std::min(wait_ms, until(last_fb_selfheal_tick, FB_SELFHEAL_INTERVAL_MS));
+        }
+        if (invalidation_suppressed || !m_splash_manager.has_exited()) {
+            wait_ms = std::min(wait_ms, STARTUP_POLL_MS);
+        }
+        if (automation_polling) {
+            wait_ms = std::min(wait_ms, AUTOMATION_POLL_MS);
+        }
+
+        auto wake = m_loop_waiter.wait(wait_ms);
+        now = DisplayManager::get_ticks();
+        m_loop_stats.record_wakeup(wake, now);
+        update_input_polling(wake.input, now);
+
+        if (helix::profiling::FrameProfiler::take_export_request()) {
+            export_frame_trace();
+        }
+
+        if (now - last_loop_stats_tick >= LOOP_STATS_INTERVAL_MS) {
+            last_loop_stats_tick = now;
+            spdlog::debug("[Application] Main loop: {}", m_loop_stats.take_report(now).to_string());
+        }
     }
 
     m_running = false;
 
+    // Tear down wakeups before members they point at go away
+    helix::ui::UpdateQueue::instance().set_wake_callback(nullptr);
+    app_set_main_loop_wake(nullptr);
+    g_loop_waiter.store(nullptr, std::memory_order_release);
+    if (lv_display_t* disp = lv_display_get_default()) {
+        lv_display_remove_event_cb_with_user_data(disp, on_display_refr_ready, this);
+    }
+    if (m_input_read_timer && m_input_read_paused) {
+        lv_timer_resume(m_input_read_timer);
+        m_input_read_paused = false;
+    }
+    spdlog::info("[Application] Main loop: {}",
+                 m_loop_stats.take_report(DisplayManager::get_ticks()).to_string());
+
+    if (!m_trace_path.empty()) {
+        if (lv_display_t* disp = lv_display_get_default()) {
+            lv_display_remove_event_cb_with_user_data(disp, on_display_profile_event, this);
+        }
+        helix::profiling::FrameProfiler::instance().log_summary();
+        if (!m_args.profile_trace_path.empty()) {
+            export_frame_trace();
+        }
+    }
+
     if (loop_config.benchmark_mode) {
         auto final_report = m_loop_handler.benchmark_get_final_report();
         spdlog::info("[Application] Benchmark total runtime: {:.1f}s",
@@ -2234,6 +2332,161 @@ void Application::process_notifications() {
     }
 }
 
+void Application::init_loop_wakeups() {
+    if (m_loop_waiter.init()) {
+        g_loop_waiter.store(&m_loop_waiter, std::memory_order_release);
+        app_set_main_loop_wake(wake_main_loop);
+        // Drain timer pauses while the queue is empty; producers wake the loop
+        helix::ui::UpdateQueue::instance().set_wake_callback(wake_main_loop);
+    } else {
+        spdlog::warn("[Application] No main loop wake channel, falling back to polling");
+        return;
+    }
+
+    // Frames rendered, for idle-wakeup and input-to-frame latency stats
+    if (lv_display_t* disp = lv_display_get_default()) {
+        lv_display_add_event_cb(disp, on_display_refr_ready, LV_EVENT_REFR_READY, this);
+    }
+
+    // Pointer input: watch the device node ourselves so its read timer can be
+    // paused while idle. Without a pollable node (SDL, event-mode drivers) the
+    // read timer keeps polling as before.
+    lv_indev_t* pointer = m_display->pointer_input();
+    DisplayBackend* backend = m_display->backend();
+    if (pointer && backend && lv_indev_get_mode(pointer) == LV_INDEV_MODE_TIMER &&
+        m_loop_waiter.watch_input(backend->input_device_path())) {
+        m_input_read_timer = lv_indev_get_read_timer(pointer);
+        spdlog::debug("[Application] Pointer input wakes the main loop ({})",
+                      backend->input_device_path());
+    }
+}
+
+void Application::update_input_polling(bool input_ready, uint32_t now) {
+    // Pause the pointer read timer once the pointer is released and quiet; resume
+    // and read immediately when the device becomes readable again
+    static constexpr uint32_t INPUT_IDLE_PAUSE_MS = 500;
+
+    if (!m_input_read_timer) {
+        return;
+    }
+    if (input_ready) {
+        m_last_input_tick = now;
+        if (m_input_read_paused) {
+            lv_timer_resume(m_input_read_timer);
+            lv_timer_ready(m_input_read_timer);
+            m_input_read_paused = false;
+        }
+        return;
+    }
+    if (m_loop_waiter.input_count() == 0) {
+        // Device went away - back to plain polling
+        if (m_input_read_paused) {
+            lv_timer_resume(m_input_read_timer);
+        }
+        m_input_read_timer = nullptr;
+        m_input_read_paused = false;
+        return;
+    }
+    if (!m_input_read_paused && now - m_last_input_tick >= INPUT_IDLE_PAUSE_MS &&
+        lv_indev_get_state(m_display->pointer_input()) == LV_INDEV_STATE_RELEASED) {
+        lv_timer_pause(m_input_read_timer);
+        m_input_read_paused = true;
+    }
+}
+
+void Application::on_display_refr_ready(lv_event_t* e) {
+    auto* self = static_cast<Application*>(lv_event_get_user_data(e));
+    self->m_loop_stats.record_frame(DisplayManager::get_ticks());
+}
+
+void Application::init_frame_profiler(bool benchmark_mode) {
+    using helix::profiling::FrameProfiler;
+
+    if (!benchmark_mode && m_args.profile_trace_path.empty()) {
+        return;
+    }
+    if (!FrameProfiler::compiled_in()) {
+        spdlog::warn("[Application] Frame profiler not compiled in "
+                     "(build with ENABLE_FRAME_PROFILER=yes)");
+        return;
+    }
+
+    FrameProfiler::instance().enable();
+    m_trace_path = !m_args.profile_trace_path.empty()
+                       ? m_args.profile_trace_path
+                       : "/tmp/helix-trace-" + std::to_string(getpid()) + ".json";
+
+    // Refresh, layout, render and flush are bracketed by display events
+    if (lv_display_t* disp = lv_display_get_default()) {
+        for (lv_event_code_t code :
+             {LV_EVENT_REFR_START, LV_EVENT_REFR_READY, LV_EVENT_RENDER_START,
+              LV_EVENT_RENDER_READY, LV_EVENT_FLUSH_START, LV_EVENT_FLUSH_FINISH}) {
+            lv_display_add_event_cb(disp, on_display_profile_event, code, this);
+        }
+    }
+
+    std::signal(SIGUSR2, trace_export_signal_handler);
+    spdlog::info("[Application] Frame profiler on: kill -USR2 {} writes {}", getpid(),
+                 m_trace_path);
+}
+
+void Application::export_frame_trace() {
+    if (m_trace_path.empty()) {
+        spdlog::warn("[Application] Trace export requested but the frame profiler is off "
+                     "(use HELIX_BENCHMARK or --profile-trace)");
+        return;
+    }
+    std::string error;
+    if (!helix::profiling::FrameProfiler::instance().write_chrome_trace(m_trace_path, error)) {
+        spdlog::error("[Application] Trace export failed: {}", error);
+    }
+}
+
+void Application::on_display_profile_event(lv_event_t* e) {
+    using helix::profiling::FrameProfiler;
+    auto& profiler = FrameProfiler::instance();
+    static const auto refresh = profiler.register_phase("lvgl.refresh");
+    static const auto layout = profiler.register_phase("lvgl.layout");
+    static const auto render = profiler.register_phase("lvgl.render");
+    static const auto flush = profiler.register_phase("display.flush");
+
+    // Display events arrive on the main thread, strictly nested
+    static uint64_t refresh_start = 0;
+    static uint64_t render_start = 0;
+    static uint64_t flush_start = 0;
+    static bool layout_pending = false;
+
+    uint64_t now = helix::timing::get_micros();
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        refresh_start = now;
+        layout_pending = true;
+        break;
+    case LV_EVENT_RENDER_START:
+        // Layout runs between the refresh start and the first render
+        if (layout_pending) {
+            profiler.record(layout, refresh_start, now - refresh_start);
+            layout_pending = false;
+        }
+        render_start = now;
+        break;
+    case LV_EVENT_RENDER_READY:
+        profiler.record(render, render_start, now - render_start);
+        break;
+    case LV_EVENT_FLUSH_START:
+        flush_start = now;
+        break;
+    case LV_EVENT_FLUSH_FINISH:
+        profiler.record(flush, flush_start, now - flush_start);
+        break;
+    case LV_EVENT_REFR_READY:
+        profiler.record(refresh, refresh_start, now - refresh_start);
+        break;
+    default:
+        break;
+    }
+}
+
 void Application::check_timeouts() {
     uint32_t current_time = DisplayManager::get_ticks();
     if (current_time - m_last_timeout_check >= m_timeout_check_interval) {
@@ -2366,5 +2619,11 @@ void Application::shutdown() {
     // removed above, so widget deletion is clean — no observer linked list access.
     m_display.reset();
 
+    // Write the last debounced config save. Config is a leaked singleton, so no
+    // destructor will do it for us.
+    if (m_config) {
+        m_config->flush();
+    }
+
     spdlog::info("[Application] Shutdown complete");
 }
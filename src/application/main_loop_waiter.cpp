@@ -0,0 +1,312 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "main_loop_waiter.h"
+
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+namespace helix::application {
+
+// ============================================================================
+// LoopWaiter
+// ============================================================================
+
+LoopWaiter::~LoopWaiter() {
+    for (int fd : input_fds_) {
+        ::close(fd);
+    }
+    if (wake_write_fd_ >= 0 && wake_write_fd_ != wake_read_fd_) {
+        ::close(wake_write_fd_);
+    }
+    if (wake_read_fd_ >= 0) {
+        ::close(wake_read_fd_);
+    }
+}
+
+bool LoopWaiter::init() {
+    if (wake_read_fd_ >= 0) {
+        return true;
+    }
+#ifdef __linux__
+    int fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd >= 0) {
+        wake_read_fd_ = fd;
+        wake_write_fd_ = fd;
+        return true;
+    }
+    spdlog::warn("[LoopWaiter] eventfd failed: {}, falling back to pipe", std::strerror(errno));
+#endif
+    int fds[2];
+    if (::pipe(fds) != 0) {
+        spdlog::error("[LoopWaiter] pipe failed: {}", std::strerror(errno));
+        return false;
+    }
+    for (int fd : fds) {
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+    wake_read_fd_ = fds[0];
+    wake_write_fd_ = fds[1];
+    return true;
+}
+
+bool LoopWaiter::watch_input(const std::string& device_path) {
+    if (device_path.empty()) {
+        return false;
+    }
+    int fd = ::open(device_path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        spdlog::debug("[LoopWaiter] Cannot watch {}: {}", device_path, std::strerror(errno));
+        return false;
+    }
+    spdlog::debug("[LoopWaiter] Watching {} for input", device_path);
+    return watch_input_fd(fd);
+}
+
+bool LoopWaiter::watch_input_fd(int fd) {
+    if (fd < 0) {
+        return false;
+    }
+    input_fds_.push_back(fd);
+    return true;
+}
+
+void LoopWaiter::wake() {
+    // Only write(): safe from signal handlers and any thread
+    int fd = wake_write_fd_;
+    if (fd < 0) {
+        return;
+    }
+#ifdef __linux__
+    if (fd == wake_read_fd_) {
+        uint64_t one = 1;
+        ssize_t n = ::write(fd, &one, sizeof(one));
+        (void)n; // EAGAIN only when the counter is saturated - already signalled
+        return;
+    }
+#endif
+    char byte = 1;
+    ssize_t n = ::write(fd, &byte, 1);
+    (void)n; // EAGAIN means the pipe is full - already signalled
+}
+
+LoopWakeResult LoopWaiter::wait(uint32_t timeout_ms) {
+    LoopWakeResult result;
+
+    if (wake_read_fd_ < 0 && input_fds_.empty()) {
+        if (timeout_ms > 0) {
+            ::usleep(timeout_ms * 1000U);
+        }
+        return result;
+    }
+
+    // Wake channel first, then inputs. Small fixed set, rebuilt each call.
+    std::array<pollfd, 8> fds{};
+    size_t count = 0;
+    if (wake_read_fd_ >= 0) {
+        fds[count++] = pollfd{wake_read_fd_, POLLIN, 0};
+    }
+    const size_t first_input = count;
+    for (int fd : input_fds_) {
+        if (count == fds.size()) {
+            break;
+        }
+        fds[count++] = pollfd{fd, POLLIN, 0};
+    }
+
+    int ready = ::poll(fds.data(), static_cast<nfds_t>(count), static_cast<int>(timeout_ms));
+    if (ready < 0) {
+        // EINTR: a signal (e.g. SIGTERM) arrived - let the loop re-check its state
+        result.woken = errno == EINTR;
+        return result;
+    }
+    if (ready == 0) {
+        return result;
+    }
+
+    if (wake_read_fd_ >= 0 && (fds[0].revents & POLLIN)) {
+        result.woken = true;
+        drain_wake();
+    }
+    bool dropped = false;
+    for (size_t i = first_input; i < count; ++i) {
+        if (fds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+            dropped = true;
+        }
+        if (fds[i].revents & POLLIN) {
+            result.input = true;
+        }
+    }
+    if (result.input || dropped) {
+        drain_inputs();
+    }
+    return result;
+}
+
+void LoopWaiter::drain_wake() {
+    uint64_t buf[8];
+    while (::read(wake_read_fd_, buf, sizeof(buf)) > 0) {
+        if (wake_write_fd_ == wake_read_fd_) {
+            break; // eventfd: one read resets the counter
+        }
+    }
+}
+
+void LoopWaiter::drain_inputs() {
+    // Our copy of the events is only a readiness signal; LVGL reads its own
+    char buf[1024];
+    for (auto it = input_fds_.begin(); it != input_fds_.end();) {
+        ssize_t n;
+        do {
+            n = ::read(*it, buf, sizeof(buf));
+        } while (n > 0);
+
+        if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR)) {
+            // ENODEV: device unplugged. Stop watching rather than spinning on POLLERR.
+            spdlog::warn("[LoopWaiter] Input fd {} gone ({}), no longer watching", *it,
+                         n == 0 ? "EOF" : std::strerror(errno));
+            ::close(*it);
+            it = input_fds_.erase(it);
+            continue;
+        }
+        ++it;
+    }
+}
+
+// ============================================================================
+// LoopStats
+// ============================================================================
+
+double LoopStats::Report::wakeups_per_sec() const {
+    return elapsed_ms > 0 ? static_cast<double>(wakeups) * 1000.0 / elapsed_ms : 0.0;
+}
+
+double LoopStats::Report::idle_wakeups_per_sec() const {
+    return elapsed_ms > 0 ? static_cast<double>(idle_wakeups) * 1000.0 / elapsed_ms : 0.0;
+}
+
+uint32_t LoopStats::Report::latency_percentile_ms(double fraction) const {
+    if (latency_samples == 0) {
+        return 0;
+    }
+    auto target = static_cast<uint64_t>(fraction * static_cast<double>(latency_samples) + 0.5);
+    target = std::clamp<uint64_t>(target, 1, latency_samples);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+        seen += latency_histogram[i];
+        if (seen >= target) {
+            return i < LATENCY_LIMITS_MS.size() ? LATENCY_LIMITS_MS[i] : latency_max_ms;
+        }
+    }
+    return latency_max_ms;
+}
+
+std::string LoopStats::Report::to_string() const {
+    std::string out =
+        fmt::format("{:.1f} wakeups/s ({:.1f} idle/s; {} input, {} work, {} timer), {} frames",
+                    wakeups_per_sec(), idle_wakeups_per_sec(), input_wakeups, work_wakeups,
+                    timer_wakeups, frames);
+    if (latency_samples == 0) {
+        return out;
+    }
+
+    out += fmt::format("; input->frame n={} p50<{}ms p95<{}ms max={}ms [", latency_samples,
+                       latency_percentile_ms(0.5), latency_percentile_ms(0.95), latency_max_ms);
+    for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+        if (i > 0) {
+            out += ' ';
+        }
+        if (i < LATENCY_LIMITS_MS.size()) {
+            out += fmt::format("<{}:{}", LATENCY_LIMITS_MS[i], latency_histogram[i]);
+        } else {
+            out += fmt::format(">={}:{}", LATENCY_LIMITS_MS.back(), latency_histogram[i]);
+        }
+    }
+    out += ']';
+    return out;
+}
+
+void LoopStats::start(uint32_t now_ms) {
+    report_ = Report{};
+    window_start_ms_ = now_ms;
+    last_wakeup_idle_candidate_ = false;
+    frame_since_wakeup_ = false;
+    input_pending_ = false;
+}
+
+void LoopStats::record_wakeup(const LoopWakeResult& result, uint32_t now_ms) {
+    // Settle the previous wakeup now that we know whether it produced a frame
+    if (last_wakeup_idle_candidate_ && !frame_since_wakeup_) {
+        ++report_.idle_wakeups;
+    }
+
+    ++report_.wakeups;
+    if (result.input) {
+        ++report_.input_wakeups;
+    }
+    if (result.woken) {
+        ++report_.work_wakeups;
+    }
+    if (result.timed_out()) {
+        ++report_.timer_wakeups;
+    }
+    last_wakeup_idle_candidate_ = !result.input;
+    frame_since_wakeup_ = false;
+
+    if (result.input) {
+        // Unanswered input that never drew anything is not a latency sample
+        if (input_pending_ && now_ms - input_tick_ms_ > LATENCY_GIVE_UP_MS) {
+            input_pending_ = false;
+        }
+        if (!input_pending_) {
+            input_pending_ = true;
+            input_tick_ms_ = now_ms;
+        }
+    }
+}
+
+void LoopStats::record_frame(uint32_t now_ms) {
+    ++report_.frames;
+    frame_since_wakeup_ = true;
+
+    if (!input_pending_) {
+        return;
+    }
+    input_pending_ = false;
+    uint32_t latency = now_ms - input_tick_ms_;
+    if (latency > LATENCY_GIVE_UP_MS) {
+        return;
+    }
+
+    size_t bucket = 0;
+    while (bucket < LATENCY_LIMITS_MS.size() && latency >= LATENCY_LIMITS_MS[bucket]) {
+        ++bucket;
+    }
+    ++report_.latency_histogram[bucket];
+    ++report_.latency_samples;
+    report_.latency_max_ms = std::max(report_.latency_max_ms, latency);
+}
+
+LoopStats::Report LoopStats::take_report(uint32_t now_ms) {
+    Report out = report_;
+    out.elapsed_ms = now_ms - window_start_ms_;
+
+    // Keep per-wakeup state so the in-flight wakeup is settled in the next window
+    report_ = Report{};
+    window_start_ms_ = now_ms;
+    return out;
+}
+
+} // namespace helix::application
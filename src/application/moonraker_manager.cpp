@@ -172,8 +172,9 @@ void MoonrakerManager::process_notifications() {
     std::lock_guard<std::mutex> lock(m_notification_mutex);
 
     while (!m_notification_queue.empty()) {
-        json notification = m_notification_queue.front();
+        helix::StatusDelta shared_notification = std::move(m_notification_queue.front());
         m_notification_queue.pop();
+        const json& notification = *shared_notification;
 
         // Check for connection state change (queued from state_change_callback)
         if (notification.contains("_connection_state")) {
@@ -338,21 +339,38 @@ void MoonrakerManager::register_callbacks() {
             spdlog::trace("[MoonrakerManager] State change: {} -> {} (queueing)",
                           static_cast<int>(old_state), static_cast<int>(new_state));
 
-            std::lock_guard<std::mutex> lock(m_notification_mutex);
             json state_change;
             state_change["_connection_state"] = true;
             state_change["old_state"] = static_cast<int>(old_state);
             state_change["new_state"] = static_cast<int>(new_state);
-            m_notification_queue.push(state_change);
+            auto shared_change = std::make_shared<const json>(std::move(state_change));
+
+            bool was_empty;
+            {
+                std::lock_guard<std::mutex> lock(m_notification_mutex);
+                was_empty = m_notification_queue.empty();
+                m_notification_queue.push(std::move(shared_change));
+            }
+            if (was_empty) {
+                app_wake_main_loop(); // Drained by process_notifications()
+            }
         });
 
     // Register notification callback to queue updates for main thread
-    m_client->register_notify_update([this, alive](json notification) {
+    // Zero-copy: the queue holds the same shared notification every subscriber sees
+    m_client->register_status_delta([this, alive](const helix::StatusDelta& notification) {
         if (!alive->load())
             return;
 
-        std::lock_guard<std::mutex> lock(m_notification_mutex);
-        m_notification_queue.push(notification);
+        bool was_empty;
+        {
+            std::lock_guard<std::mutex> lock(m_notification_mutex);
+            was_empty = m_notification_queue.empty();
+            m_notification_queue.push(notification);
+        }
+        if (was_empty) {
+            app_wake_main_loop(); // Drained by process_notifications()
+        }
     });
 }
 
@@ -105,6 +105,10 @@ bool EnvironmentConfig::get_benchmark_mode() {
     return exists("HELIX_BENCHMARK");
 }
 
+std::optional<int> EnvironmentConfig::get_console_stress_rate() {
+    return get_int("HELIX_CONSOLE_STRESS", 1, 100000);
+}
+
 std::optional<std::string> EnvironmentConfig::get_data_dir() {
     return get_string("HELIX_DATA_DIR");
 }
@@ -1088,7 +1088,7 @@ void WledBackend::fetch_presets_from_device(const std::string& strip_id,
 
     // Use libhv's synchronous HTTP client in an async thread via the API's REST mechanism
     // Since we can't use call_rest_get (it's bound to Moonraker's base URL), we make
-    // a direct HTTP request. The API's launch_http_thread isn't accessible from here,
+    // a direct HTTP request. The API's launch_http_request isn't accessible from here,
     // so for the initial implementation, we skip the actual HTTP call and rely on
     // mock presets being set directly via set_strip_presets().
     // Real device fetching will be implemented when a live WLED device is available for testing.
@@ -91,13 +91,14 @@ MoonrakerSubscriptionId PluginAPI::subscribe_moonraker(const std::vector<std::st
     if (client_to_register != nullptr) {
         // Subscribe immediately
         // Use weak_ptr to detect if plugin has been unloaded (prevents use-after-free)
-        uint64_t client_sub_id = client_to_register->register_notify_update(
-            [callback, objects, weak_alive](const json& update) {
+        uint64_t client_sub_id = client_to_register->register_status_delta(
+            [callback, objects, weak_alive](const StatusDelta& delta) {
                 // Check if plugin is still alive before processing
                 auto alive = weak_alive.lock();
                 if (!alive || !*alive) {
                     return; // Plugin has been unloaded, skip callback
                 }
+                const json& update = *delta;
 
                 // Filter update to only include objects we subscribed to
                 // The update is in format: { "object_name": { ... }, ... }
@@ -380,13 +381,14 @@ void PluginAPI::apply_deferred_subscriptions() {
         auto objects = sub.objects;
 
         // Use weak_ptr to detect if plugin has been unloaded (prevents use-after-free)
-        uint64_t client_sub_id = client_to_register->register_notify_update(
-            [callback, objects, weak_alive](const json& update) {
+        uint64_t client_sub_id = client_to_register->register_status_delta(
+            [callback, objects, weak_alive](const StatusDelta& delta) {
                 // Check if plugin is still alive before processing
                 auto alive = weak_alive.lock();
                 if (!alive || !*alive) {
                     return; // Plugin has been unloaded, skip callback
                 }
+                const json& update = *delta;
 
                 json filtered;
                 for (const auto& obj : objects) {
@@ -646,6 +646,12 @@ void FilamentSensorManager::update_from_status(const json& status) {
     }
 }
 
+bool FilamentSensorManager::handles_status_object(const std::string& klipper_name) const {
+    std::string sensor_name;
+    FilamentSensorType type{};
+    return parse_klipper_name(klipper_name, sensor_name, type);
+}
+
 void FilamentSensorManager::inject_mock_sensors(std::vector<std::string>& objects,
                                                 nlohmann::json& /*config_keys*/,
                                                 nlohmann::json& /*moonraker_info*/) {
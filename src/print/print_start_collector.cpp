@@ -100,10 +100,11 @@ void PrintStartCollector::start() {
 
     // Register for printer status updates (fallback for printers with KAMP/custom macros)
     // This watches for _START_PRINT.print_started, START_PRINT.preparation_done, etc.
-    macro_subscription_id_ = client_.register_notify_update([self](const json& notification) {
+    macro_subscription_id_ = client_.register_status_delta([self](const StatusDelta& delta) {
         if (!self->active_.load())
             return;
 
+        const json& notification = *delta;
         if (!notification.contains("params") || !notification["params"].is_array() ||
             notification["params"].empty()) {
             return;
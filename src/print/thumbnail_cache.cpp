@@ -9,6 +9,7 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
@@ -96,6 +97,7 @@ ThumbnailCache::ThumbnailCache()
     load_config();
     // Now that directory exists and config is loaded, calculate dynamic size
     max_size_ = calculate_dynamic_max_size(cache_dir_, configured_max_);
+    load_index();
 
     // Sync ThumbnailProcessor's cache dir with ours
     helix::ThumbnailProcessor::instance().set_cache_dir(cache_dir_);
@@ -106,6 +108,7 @@ ThumbnailCache::ThumbnailCache(size_t max_size)
       disk_low_(DEFAULT_DISK_LOW), configured_max_(max_size) {
     ensure_cache_dir();
     spdlog::debug("[ThumbnailCache] Using explicit max size: {} MB", max_size_ / (1024 * 1024));
+    load_index();
 
     // Sync ThumbnailProcessor's cache dir with ours
     helix::ThumbnailProcessor::instance().set_cache_dir(cache_dir_);
@@ -120,6 +123,25 @@ void ThumbnailCache::ensure_cache_dir() const {
     }
 }
 
+void ThumbnailCache::load_index() {
+    index_ = std::make_unique<ThumbnailIndex>(cache_dir_);
+
+    auto start = std::chrono::steady_clock::now();
+    ThumbnailIndex::LoadStats stats = index_->load();
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+
+    spdlog::debug("[ThumbnailCache] Index: {} files, {} KB in {} ms ({} journal lines, {} "
+                  "adopted, {} dropped{})",
+                  stats.entries, index_->total_bytes() / 1024, elapsed_ms, stats.journal_lines,
+                  stats.adopted, stats.dropped, stats.rebuilt ? ", rebuilt" : "");
+}
+
+std::optional<ThumbnailIndex::Entry> ThumbnailCache::lookup_entry(const std::string& name) const {
+    return index_->lookup(name);
+}
+
 void ThumbnailCache::load_config() {
     Config* config = Config::get_instance();
     if (!config) {
@@ -187,34 +209,20 @@ std::string ThumbnailCache::get_if_cached(const std::string& relative_path,
         return "";
     }
 
-    // Check if cached locally
+    // Check the index (cached_time is when the file was written)
     std::string cache_path = get_cache_path(relative_path);
-    if (!std::filesystem::exists(cache_path)) {
+    auto entry = lookup_entry(std::filesystem::path(cache_path).filename().string());
+    if (!entry) {
         return "";
     }
 
     // If source_modified provided, validate cache freshness
-    if (source_modified > 0) {
-        try {
-            auto cache_time = std::filesystem::last_write_time(cache_path);
-            // Convert file_time_type to time_t for comparison
-            // C++20 provides a cleaner way, but this works for C++17
-            auto sctp = std::chrono::time_point_cast<std::chrono::system_clock::duration>(
-                cache_time - std::filesystem::file_time_type::clock::now() +
-                std::chrono::system_clock::now());
-            time_t cache_epoch = std::chrono::system_clock::to_time_t(sctp);
-
-            if (cache_epoch < source_modified) {
-                spdlog::debug("[ThumbnailCache] Cache stale for {} (cached: {}, source: {})",
-                              relative_path, cache_epoch, source_modified);
-                // Invalidate by removing the file (const_cast needed for invalidation)
-                const_cast<ThumbnailCache*>(this)->invalidate(relative_path);
-                return "";
-            }
-        } catch (const std::filesystem::filesystem_error& e) {
-            spdlog::warn("[ThumbnailCache] Failed to check cache age: {}", e.what());
-            // On error, assume cache is valid (don't break existing behavior)
-        }
+    if (source_modified > 0 && entry->cached_time < source_modified) {
+        spdlog::debug("[ThumbnailCache] Cache stale for {} (cached: {}, source: {})", relative_path,
+                      entry->cached_time, source_modified);
+        // Invalidate by removing the file (const_cast needed for invalidation)
+        const_cast<ThumbnailCache*>(this)->invalidate(relative_path);
+        return "";
     }
 
     spdlog::trace("[ThumbnailCache] Cache hit for {}", relative_path);
@@ -283,47 +291,8 @@ void ThumbnailCache::evict_if_needed() {
             current_size / (1024 * 1024), effective_limit / (1024 * 1024));
     }
 
-    // Collect files with their modification times
-    struct CacheEntry {
-        std::filesystem::path path;
-        std::filesystem::file_time_type mtime;
-        std::uintmax_t size; // Match std::filesystem::file_size() return type
-    };
-    std::vector<CacheEntry> entries;
-
-    try {
-        for (const auto& entry : std::filesystem::directory_iterator(cache_dir_)) {
-            if (std::filesystem::is_regular_file(entry.path())) {
-                entries.push_back({entry.path(), std::filesystem::last_write_time(entry.path()),
-                                   std::filesystem::file_size(entry.path())});
-            }
-        }
-    } catch (const std::filesystem::filesystem_error& e) {
-        spdlog::warn("[ThumbnailCache] Error scanning cache for eviction: {}", e.what());
-        return;
-    }
-
-    // Sort by modification time (oldest first)
-    std::sort(entries.begin(), entries.end(),
-              [](const CacheEntry& a, const CacheEntry& b) { return a.mtime < b.mtime; });
-
-    // Remove oldest files until under limit
-    size_t evicted_count = 0;
-    size_t evicted_bytes = 0;
-    for (const auto& entry : entries) {
-        if (current_size <= effective_limit) {
-            break;
-        }
-
-        try {
-            std::filesystem::remove(entry.path);
-            current_size -= entry.size;
-            evicted_bytes += entry.size;
-            ++evicted_count;
-        } catch (const std::filesystem::filesystem_error& e) {
-            spdlog::warn("[ThumbnailCache] Failed to evict {}: {}", entry.path.string(), e.what());
-        }
-    }
+    // Remove least recently used files until under limit
+    auto [evicted_count, evicted_bytes] = index_->evict_to(effective_limit);
 
     if (evicted_count > 0) {
         spdlog::info("[ThumbnailCache] Evicted {} files ({} KB) to stay under limit", evicted_count,
@@ -401,6 +370,7 @@ void ThumbnailCache::fetch(MoonrakerAPI* api, const std::string& relative_path,
         // Success callback
         [this, on_success, relative_path](const std::string& local_path) {
             spdlog::trace("[ThumbnailCache] Downloaded {} to {}", relative_path, local_path);
+            index_->adopt(std::filesystem::path(local_path).filename().string());
             // Check if we need eviction after download
             evict_if_needed();
             if (on_success) {
@@ -467,6 +437,7 @@ std::string ThumbnailCache::save_raw_png(const std::string& source_identifier,
 
     spdlog::debug("[ThumbnailCache] Saved {} bytes from gcode extraction: {}", png_data.size(),
                   cache_path);
+    index_->record(std::filesystem::path(cache_path).filename().string(), png_data.size());
 
     // Check if we need eviction after save
     evict_if_needed();
@@ -478,7 +449,8 @@ size_t ThumbnailCache::clear_cache() {
     size_t count = 0;
     try {
         for (const auto& entry : std::filesystem::directory_iterator(cache_dir_)) {
-            if (std::filesystem::is_regular_file(entry.path())) {
+            if (std::filesystem::is_regular_file(entry.path()) &&
+                entry.path().filename() != ThumbnailIndex::JOURNAL_NAME) {
                 std::filesystem::remove(entry.path());
                 ++count;
             }
@@ -487,6 +459,7 @@ size_t ThumbnailCache::clear_cache() {
     } catch (const std::filesystem::filesystem_error& e) {
         spdlog::warn("[ThumbnailCache] Error clearing cache: {}", e.what());
     }
+    index_->clear();
     return count;
 }
 
@@ -501,13 +474,15 @@ size_t ThumbnailCache::invalidate(const std::string& relative_path) {
     try {
         // Delete the PNG file
         std::string png_path = cache_dir_ + "/" + hash + ".png";
-        if (std::filesystem::exists(png_path)) {
-            std::filesystem::remove(png_path);
+        index_->erase(hash + ".png");
+        if (std::filesystem::remove(png_path)) {
             ++count;
             spdlog::debug("[ThumbnailCache] Invalidated PNG: {}", png_path);
         }
 
-        // Delete all pre-scaled .bin variants (e.g., {hash}_120x120_RGB565.bin)
+        // Delete all pre-scaled .bin variants (e.g., {hash}_120x120_RGB565.bin).
+        // Scans the directory rather than the index: this only runs when a
+        // file is overwritten, and must also catch variants not indexed yet.
         for (const auto& entry : std::filesystem::directory_iterator(cache_dir_)) {
             if (!std::filesystem::is_regular_file(entry.path())) {
                 continue;
@@ -520,6 +495,7 @@ size_t ThumbnailCache::invalidate(const std::string& relative_path) {
             bool has_suffix =
                 filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".bin") == 0;
             if (has_prefix && has_suffix) {
+                index_->erase(filename);
                 std::filesystem::remove(entry.path());
                 ++count;
                 spdlog::debug("[ThumbnailCache] Invalidated BIN: {}", entry.path().string());
@@ -539,17 +515,7 @@ size_t ThumbnailCache::invalidate(const std::string& relative_path) {
 }
 
 size_t ThumbnailCache::get_cache_size() const {
-    size_t total = 0;
-    try {
-        for (const auto& entry : std::filesystem::directory_iterator(cache_dir_)) {
-            if (std::filesystem::is_regular_file(entry.path())) {
-                total += std::filesystem::file_size(entry.path());
-            }
-        }
-    } catch (const std::filesystem::filesystem_error& e) {
-        spdlog::warn("[ThumbnailCache] Error calculating cache size: {}", e.what());
-    }
-    return total;
+    return static_cast<size_t>(index_->total_bytes());
 }
 
 // ============================================================================
@@ -563,50 +529,30 @@ std::string ThumbnailCache::get_if_optimized(const std::string& relative_path,
         return "";
     }
 
-    // Check for pre-scaled .bin via ThumbnailProcessor
-    std::string bin_path =
-        helix::ThumbnailProcessor::instance().get_if_processed(relative_path, target);
-    if (bin_path.empty()) {
+    // Check for pre-scaled .bin in the index (ThumbnailProcessor writes to our directory)
+    std::string bin_name =
+        helix::ThumbnailProcessor::generate_cache_filename(relative_path, target);
+    auto entry = lookup_entry(bin_name);
+    if (!entry) {
         return "";
     }
 
     // Validate cache freshness if source_modified provided
-    if (source_modified > 0) {
-        try {
-            // Strip "A:" prefix to get filesystem path
-            std::string fs_path = bin_path.substr(2);
-            if (!std::filesystem::exists(fs_path)) {
-                return "";
-            }
-
-            auto cache_time = std::filesystem::last_write_time(fs_path);
-            // Convert file_time_type to time_t for comparison
-            auto sctp = std::chrono::time_point_cast<std::chrono::system_clock::duration>(
-                cache_time - std::filesystem::file_time_type::clock::now() +
-                std::chrono::system_clock::now());
-            time_t cache_epoch = std::chrono::system_clock::to_time_t(sctp);
-
-            if (cache_epoch < source_modified) {
-                spdlog::debug(
-                    "[ThumbnailCache] Optimized cache stale for {} (cached: {}, source: {})",
-                    relative_path, cache_epoch, source_modified);
-                // Invalidate all cached variants (PNG + .bin files)
-                const_cast<ThumbnailCache*>(this)->invalidate(relative_path);
-                return "";
-            }
-        } catch (const std::filesystem::filesystem_error& e) {
-            spdlog::warn("[ThumbnailCache] Failed to check optimized cache age: {}", e.what());
-            // On error, assume cache is valid (don't break existing behavior)
-        }
+    if (source_modified > 0 && entry->cached_time < source_modified) {
+        spdlog::debug("[ThumbnailCache] Optimized cache stale for {} (cached: {}, source: {})",
+                      relative_path, entry->cached_time, source_modified);
+        // Invalidate all cached variants (PNG + .bin files)
+        const_cast<ThumbnailCache*>(this)->invalidate(relative_path);
+        return "";
     }
 
-    return bin_path;
+    return to_lvgl_path(cache_dir_ + "/" + bin_name);
 }
 
 void ThumbnailCache::fetch_optimized(MoonrakerAPI* api, const std::string& relative_path,
                                      const helix::ThumbnailTarget& target,
                                      SuccessCallback on_success, ErrorCallback on_error,
-                                     time_t source_modified) {
+                                     time_t source_modified, helix::HttpJobOptions http) {
     if (relative_path.empty()) {
         if (on_error) {
             on_error("Empty thumbnail path");
@@ -663,6 +609,7 @@ void ThumbnailCache::fetch_optimized(MoonrakerAPI* api, const std::string& relat
         // Success callback - PNG downloaded, now pre-scale it
         [this, on_success, on_error, relative_path, target](const std::string& local_path) {
             spdlog::trace("[ThumbnailCache] Downloaded, now pre-scaling: {}", local_path);
+            index_->adopt(std::filesystem::path(local_path).filename().string());
             evict_if_needed();
 
             // Process the downloaded PNG
@@ -676,7 +623,8 @@ void ThumbnailCache::fetch_optimized(MoonrakerAPI* api, const std::string& relat
             if (on_error) {
                 on_error(error.message);
             }
-        });
+        },
+        std::move(http));
 }
 
 void ThumbnailCache::process_and_callback(const std::string& png_lvgl_path,
@@ -720,9 +668,10 @@ void ThumbnailCache::process_and_callback(const std::string& png_lvgl_path,
     // Queue for background processing
     helix::ThumbnailProcessor::instance().process_async(
         png_data, source_path, target,
-        // Success - return optimized path
-        [on_success](const std::string& lvbin_path) {
+        // Success - index the new .bin and return optimized path
+        [this, on_success](const std::string& lvbin_path) {
             spdlog::debug("[ThumbnailCache] Pre-scaling complete: {}", lvbin_path);
+            index_->adopt(std::filesystem::path(lvbin_path).filename().string());
             if (on_success) {
                 on_success(lvbin_path);
             }
@@ -762,12 +711,17 @@ void ThumbnailCache::fetch_for_detail_view(MoonrakerAPI* api, const std::string&
     helix::ThumbnailTarget target =
         helix::ThumbnailProcessor::get_target_for_display(helix::ThumbnailSize::Detail);
 
+    // On screen now: download ahead of queued requests, skip if the view went away
+    // (the predicate runs on an HTTP worker; ctx only holds shared state)
+    helix::HttpJobOptions http{helix::HttpPriority::VISIBLE, [ctx] { return ctx.is_valid(); }};
+
     fetch_optimized(
         api, relative_path, target, std::move(guarded_success),
         on_error ? std::move(on_error) : [relative_path](const std::string& error) {
             spdlog::warn("[ThumbnailCache] Detail view fetch failed for {}: {}", relative_path,
                          error);
-        });
+        },
+        0, std::move(http));
 }
 
 void ThumbnailCache::fetch_for_card_view(MoonrakerAPI* api, const std::string& relative_path,
@@ -790,10 +744,15 @@ void ThumbnailCache::fetch_for_card_view(MoonrakerAPI* api, const std::string& r
 
     helix::ThumbnailTarget target = helix::ThumbnailProcessor::get_target_for_display();
 
+    // Cards are requested as they scroll into view; a navigation (generation
+    // change) drops the ones still queued. The predicate runs on an HTTP worker;
+    // ctx only holds shared state, so it is safe after the panel is gone.
+    helix::HttpJobOptions http{helix::HttpPriority::VISIBLE, [ctx] { return ctx.is_valid(); }};
+
     fetch_optimized(api, relative_path, target, std::move(guarded_success),
                     on_error ? std::move(on_error) : [relative_path](const std::string& error) {
                         spdlog::warn("[ThumbnailCache] Card view fetch failed for {}: {}",
                                      relative_path, error);
                     },
-                    source_modified);
+                    source_modified, std::move(http));
 }
@@ -0,0 +1,405 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+// Thumbnail Cache Index Implementation
+
+#include "thumbnail_index.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <unordered_set>
+#include <vector>
+
+#include <sys/stat.h>
+
+namespace helix {
+
+namespace {
+
+constexpr const char* JOURNAL_HEADER = "HXTHUMBIDX 1";
+
+/// Small caches compact no more often than this many lines
+constexpr size_t MIN_COMPACT_LINES = 256;
+
+int64_t now_seconds() {
+    return static_cast<int64_t>(std::time(nullptr));
+}
+
+/// Strip the trailing newline (and CR) fgets/getline leave on a line
+void chomp(char* line) {
+    size_t len = std::strlen(line);
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+        line[--len] = '\0';
+    }
+}
+
+/// Files the index never tracks: the journal, its temp file, write probes
+bool is_hidden(const std::string& name) {
+    return name.empty() || name[0] == '.';
+}
+
+} // namespace
+
+ThumbnailIndex::ThumbnailIndex(std::string cache_dir) : cache_dir_(std::move(cache_dir)) {}
+
+ThumbnailIndex::~ThumbnailIndex() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    close_journal();
+}
+
+// ============================================================================
+// Loading
+// ============================================================================
+
+ThumbnailIndex::LoadStats ThumbnailIndex::load() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    LoadStats stats;
+
+    close_journal();
+    entries_.clear();
+    lru_.clear();
+    total_bytes_ = 0;
+    next_sequence_ = 0;
+
+    // Replay the journal. A bad line (a write cut short by power loss) is
+    // skipped; everything before and after it still applies.
+    bool journal_ok = false;
+    if (FILE* file = std::fopen(journal_path().c_str(), "r")) {
+        char* line = nullptr;
+        size_t capacity = 0;
+        if (::getline(&line, &capacity, file) > 0) {
+            chomp(line);
+            journal_ok = std::strcmp(line, JOURNAL_HEADER) == 0;
+        }
+        while (journal_ok && ::getline(&line, &capacity, file) > 0) {
+            chomp(line);
+            ++stats.journal_lines;
+            if (!replay_line(line)) {
+                spdlog::debug("[ThumbnailIndex] Skipping malformed journal line: {}", line);
+            }
+        }
+        std::free(line);
+        std::fclose(file);
+    }
+    stats.rebuilt = !journal_ok;
+
+    // Reconcile with the directory listing. Names come from readdir() alone;
+    // only files the journal doesn't know are stat'ed.
+    std::unordered_set<std::string> on_disk;
+    std::error_code ec;
+    for (const auto& item : std::filesystem::directory_iterator(cache_dir_, ec)) {
+        std::error_code type_ec;
+        if (!item.is_regular_file(type_ec)) {
+            continue;
+        }
+        std::string name = item.path().filename().string();
+        if (is_hidden(name)) {
+            continue;
+        }
+        if (entries_.find(name) == entries_.end()) {
+            if (auto entry = stat_file(name)) {
+                put(name, *entry);
+                ++stats.adopted;
+            } else {
+                continue;
+            }
+        }
+        on_disk.insert(std::move(name));
+    }
+    if (ec) {
+        spdlog::warn("[ThumbnailIndex] Failed to list {}: {}", cache_dir_, ec.message());
+    }
+
+    std::vector<std::string> gone;
+    for (const auto& [name, slot] : entries_) {
+        if (on_disk.find(name) == on_disk.end()) {
+            gone.push_back(name);
+        }
+    }
+    for (const auto& name : gone) {
+        remove(name);
+    }
+    stats.dropped = gone.size();
+    stats.entries = entries_.size();
+
+    if (!compact()) {
+        // Still usable in memory; changes just aren't persisted this session
+        spdlog::warn("[ThumbnailIndex] Cannot write journal {}", journal_path());
+    }
+    return stats;
+}
+
+bool ThumbnailIndex::replay_line(const char* line) {
+    int consumed = 0;
+    switch (line[0]) {
+    case '+': {
+        unsigned long long size = 0;
+        long long cached_time = 0;
+        long long last_access = 0;
+        if (std::sscanf(line + 1, " %llu %lld %lld %n", &size, &cached_time, &last_access,
+                        &consumed) != 3 ||
+            line[1 + consumed] == '\0') {
+            return false;
+        }
+        put(line + 1 + consumed, Entry{static_cast<uint64_t>(size),
+                                       static_cast<int64_t>(cached_time),
+                                       static_cast<int64_t>(last_access)});
+        return true;
+    }
+    case '@': {
+        long long last_access = 0;
+        if (std::sscanf(line + 1, " %lld %n", &last_access, &consumed) != 1 ||
+            line[1 + consumed] == '\0') {
+            return false;
+        }
+        auto it = entries_.find(line + 1 + consumed);
+        if (it != entries_.end()) {
+            Slot& slot = it->second;
+            lru_.erase({{slot.entry.last_access, slot.sequence}, it->first});
+            slot.entry.last_access = last_access;
+            slot.persisted_access = last_access;
+            lru_.insert({{slot.entry.last_access, slot.sequence}, it->first});
+        }
+        return true;
+    }
+    case '-':
+        if (line[1] != ' ' || line[2] == '\0') {
+            return false;
+        }
+        remove(line + 2);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// ============================================================================
+// Queries and updates
+// ============================================================================
+
+std::optional<ThumbnailIndex::Entry> ThumbnailIndex::lookup(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(name);
+    if (it == entries_.end()) {
+        return std::nullopt;
+    }
+    touch(it->first, it->second, now_seconds());
+    return it->second.entry;
+}
+
+std::optional<ThumbnailIndex::Entry> ThumbnailIndex::peek(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(name);
+    if (it == entries_.end()) {
+        return std::nullopt;
+    }
+    return it->second.entry;
+}
+
+void ThumbnailIndex::record(const std::string& name, uint64_t size, int64_t cached_time) {
+    int64_t now = now_seconds();
+    Entry entry{size, cached_time > 0 ? cached_time : now, now};
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    put(name, entry);
+    append("+ %" PRIu64 " %" PRId64 " %" PRId64 " %s\n", entry.size, entry.cached_time,
+           entry.last_access, name.c_str());
+    maybe_compact();
+}
+
+std::optional<ThumbnailIndex::Entry> ThumbnailIndex::adopt(const std::string& name) {
+    // stat() outside the lock; racing updates describe the same file, last one wins
+    auto entry = stat_file(name);
+    if (!entry) {
+        return std::nullopt;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    put(name, *entry);
+    append("+ %" PRIu64 " %" PRId64 " %" PRId64 " %s\n", entry->size, entry->cached_time,
+           entry->last_access, name.c_str());
+    maybe_compact();
+    return entry;
+}
+
+void ThumbnailIndex::erase(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.find(name) == entries_.end()) {
+        return;
+    }
+    remove(name);
+    append("- %s\n", name.c_str());
+    maybe_compact();
+}
+
+void ThumbnailIndex::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    total_bytes_ = 0;
+    compact();
+}
+
+std::pair<size_t, uint64_t> ThumbnailIndex::evict_to(uint64_t limit) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t files = 0;
+    uint64_t bytes = 0;
+
+    while (total_bytes_ > limit && !lru_.empty()) {
+        std::string name = lru_.begin()->second;
+        std::string path = cache_dir_ + "/" + name;
+        uint64_t size = entries_[name].entry.size;
+
+        // Drop the entry even if unlink fails so eviction always progresses;
+        // a survivor is picked up again by the next load()
+        if (std::remove(path.c_str()) == 0 || errno == ENOENT) {
+            bytes += size;
+            ++files;
+        } else {
+            spdlog::warn("[ThumbnailIndex] Failed to evict {}: {}", path, std::strerror(errno));
+        }
+        remove(name);
+        append("- %s\n", name.c_str());
+    }
+
+    maybe_compact();
+    return {files, bytes};
+}
+
+uint64_t ThumbnailIndex::total_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_bytes_;
+}
+
+size_t ThumbnailIndex::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+size_t ThumbnailIndex::journal_lines() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return journal_lines_;
+}
+
+// ============================================================================
+// Private helpers (mutex_ held)
+// ============================================================================
+
+void ThumbnailIndex::put(const std::string& name, const Entry& entry) {
+    auto [it, inserted] = entries_.try_emplace(name);
+    Slot& slot = it->second;
+    if (!inserted) {
+        lru_.erase({{slot.entry.last_access, slot.sequence}, it->first});
+        total_bytes_ -= slot.entry.size;
+    }
+    slot.entry = entry;
+    slot.sequence = next_sequence_++;
+    slot.persisted_access = entry.last_access;
+    lru_.insert({{entry.last_access, slot.sequence}, it->first});
+    total_bytes_ += entry.size;
+}
+
+void ThumbnailIndex::remove(const std::string& name) {
+    auto it = entries_.find(name);
+    if (it == entries_.end()) {
+        return;
+    }
+    lru_.erase({{it->second.entry.last_access, it->second.sequence}, it->first});
+    total_bytes_ -= it->second.entry.size;
+    entries_.erase(it);
+}
+
+void ThumbnailIndex::touch(const std::string& name, Slot& slot, int64_t now) {
+    lru_.erase({{slot.entry.last_access, slot.sequence}, name});
+    slot.entry.last_access = now;
+    slot.sequence = next_sequence_++;
+    lru_.insert({{now, slot.sequence}, name});
+
+    if (now - slot.persisted_access >= ACCESS_PERSIST_INTERVAL) {
+        slot.persisted_access = now;
+        append("@ %" PRId64 " %s\n", now, name.c_str());
+        maybe_compact();
+    }
+}
+
+std::optional<ThumbnailIndex::Entry> ThumbnailIndex::stat_file(const std::string& name) const {
+    struct stat st {};
+    std::string path = cache_dir_ + "/" + name;
+    if (::stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) {
+        return std::nullopt;
+    }
+    int64_t mtime = static_cast<int64_t>(st.st_mtime);
+    return Entry{static_cast<uint64_t>(st.st_size), mtime, mtime};
+}
+
+void ThumbnailIndex::append(const char* fmt, ...) {
+    if (!journal_) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    std::vfprintf(journal_, fmt, args);
+    va_end(args);
+    std::fflush(journal_);
+    ++journal_lines_;
+}
+
+void ThumbnailIndex::maybe_compact() {
+    if (journal_ && journal_lines_ > std::max(entries_.size(), MIN_COMPACT_LINES) * COMPACT_RATIO) {
+        compact();
+    }
+}
+
+bool ThumbnailIndex::compact() {
+    close_journal();
+
+    // Oldest first, so replay rebuilds the same LRU order
+    std::string temp_path = journal_path() + ".tmp";
+    FILE* file = std::fopen(temp_path.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+    bool ok = std::fprintf(file, "%s\n", JOURNAL_HEADER) > 0;
+    for (const auto& [key, name] : lru_) {
+        const Entry& entry = entries_.at(name).entry;
+        ok = ok && std::fprintf(file, "+ %" PRIu64 " %" PRId64 " %" PRId64 " %s\n", entry.size,
+                                entry.cached_time, entry.last_access, name.c_str()) > 0;
+    }
+    ok = (std::fclose(file) == 0) && ok;
+    if (!ok || std::rename(temp_path.c_str(), journal_path().c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+
+    for (auto& [name, slot] : entries_) {
+        slot.persisted_access = slot.entry.last_access;
+    }
+    journal_lines_ = entries_.size();
+    open_journal();
+    return journal_ != nullptr;
+}
+
+void ThumbnailIndex::open_journal() {
+    journal_ = std::fopen(journal_path().c_str(), "a");
+    if (!journal_) {
+        spdlog::warn("[ThumbnailIndex] Failed to open journal {}: {}", journal_path(),
+                     std::strerror(errno));
+    }
+}
+
+void ThumbnailIndex::close_journal() {
+    if (journal_) {
+        std::fclose(journal_);
+        journal_ = nullptr;
+    }
+}
+
+} // namespace helix
@@ -301,7 +301,7 @@ void ThumbnailProcessor::wait_for_completion() {
 // ============================================================================
 
 std::string ThumbnailProcessor::generate_cache_filename(const std::string& source_path,
-                                                        const ThumbnailTarget& target) const {
+                                                        const ThumbnailTarget& target) {
     // Hash the source path for a unique identifier
     std::hash<std::string> hasher;
     size_t hash = hasher(source_path);
@@ -796,20 +796,22 @@ void AmsState::on_backend_event(int backend_index, const std::string& event,
     // This is required because backend events may come from background threads
     // and LVGL is not thread-safe
 
-    // Helper to safely queue async call using RAII pattern
+    // Syncs read current backend state when they run, so a burst of events for the
+    // same backend/slot coalesces into one pending update
     auto queue_sync = [backend_index](bool full_sync, int slot_index) {
-        auto sync_data =
-            std::make_unique<AsyncSyncData>(AsyncSyncData{backend_index, full_sync, slot_index});
-        helix::ui::queue_update<AsyncSyncData>(std::move(sync_data), [](AsyncSyncData* d) {
+        std::string key = full_sync ? fmt::format("ams.sync.{}", backend_index)
+                                    : fmt::format("ams.slot.{}.{}", backend_index, slot_index);
+        AsyncSyncData d{backend_index, full_sync, slot_index};
+        helix::ui::queue_update_coalesced(key, [d]() {
             // Skip if shutdown is in progress - AmsState singleton may be destroyed
             if (s_shutdown_flag.load(std::memory_order_acquire)) {
                 return;
             }
 
-            if (d->full_sync) {
-                AmsState::instance().sync_backend(d->backend_index);
+            if (d.full_sync) {
+                AmsState::instance().sync_backend(d.backend_index);
             } else {
-                AmsState::instance().update_slot_for_backend(d->backend_index, d->slot_index);
+                AmsState::instance().update_slot_for_backend(d.backend_index, d.slot_index);
             }
         });
     };
@@ -46,8 +46,10 @@ AmsError AmsSubscriptionBackend::start() {
             return extra_check;
         }
 
-        helix::SubscriptionId id = client_->register_notify_update(
-            [this](const nlohmann::json& notification) { handle_status_update(notification); });
+        helix::SubscriptionId id =
+            client_->register_status_delta([this](const helix::StatusDelta& notification) {
+                handle_status_update(*notification);
+            });
 
         if (id == helix::INVALID_SUBSCRIPTION_ID) {
             spdlog::error("{} Failed to register for status updates", backend_log_tag());
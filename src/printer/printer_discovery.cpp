@@ -109,6 +109,9 @@ void init_subsystems_from_hardware(const PrinterDiscovery& hardware, MoonrakerAP
     auto& printer_state = get_printer_state();
     printer_state.init_extruders(hardware.heaters());
 
+    // Resolve status routing for every subscribed object up front
+    printer_state.prime_status_routes(hardware.printer_objects());
+
     // Initialize tool changer state from discovered hardware
     helix::ToolState::instance().init_tools(hardware);
 
@@ -108,6 +108,8 @@ PrinterState::PrinterState() {
 
     // Load user-configured capability overrides from helixconfig.json
     capability_overrides_.load_from_config();
+
+    init_status_routes();
 }
 
 PrinterState::~PrinterState() {}
@@ -306,127 +308,217 @@ void PrinterState::update_from_status(const json& state) {
     // Debug: Check if we're in render phase (this should never be true)
     LV_DEBUG_RENDER_STATE();
 
-    // Delegate temperature updates to temperature state component
-    temperature_state_.update_from_status(state);
-
-    // Delegate motion updates to motion state component
-    motion_state_.update_from_status(state);
-
-    // Delegate print updates to print state component
-    print_domain_.update_from_status(state);
+    // Visit only the sub-states owning the objects in this delta
+    status_router_.dispatch(state);
 
-    // Note: Toolhead position, homed_axes, speed_factor, flow_factor, and gcode_z_offset
-    // are now updated by motion_state_.update_from_status() above
-
-    // Extract kinematics type (determines if bed moves on Z or gantry moves)
-    // This is not part of motion_state_ as it affects printer_bed_moves_ subject
-    if (state.contains("toolhead")) {
-        const auto& toolhead = state["toolhead"];
-        if (toolhead.contains("kinematics") && toolhead["kinematics"].is_string()) {
-            std::string kin = toolhead["kinematics"].get<std::string>();
-            set_kinematics(kin);
-        }
+    // Cache full state for complex queries
+    // (already under state_mutex_ from top of function)
+    json_state_.merge_patch(state);
+}
 
-        // Track active extruder from toolhead (for tool changers and multi-extruder setups)
-        if (toolhead.contains("extruder") && toolhead["extruder"].is_string()) {
-            std::string active_ext = toolhead["extruder"].get<std::string>();
-            temperature_state_.set_active_extruder(active_ext);
-        }
-    }
+void PrinterState::prime_status_routes(const std::vector<std::string>& objects) {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    status_router_.prime(objects);
+}
+
+void PrinterState::init_status_routes() {
+    using Router = helix::PrinterStatusRouter;
+
+    // Routes run in registration order, which preserves the historical update order:
+    // temperatures, motion, print, kinematics, fans, LEDs, exclude_object, webhooks,
+    // calibration, then sensor managers.
+
+    // Extruders, bed and chamber sensor (chamber may be a temperature_sensor,
+    // heater_generic or temperature_fan, so route the whole families)
+    status_router_.add_route(
+        "temperature",
+        Router::match_objects({"heater_bed"}, {"extruder", "heater_generic ", "temperature_sensor ",
+                                               "temperature_fan "}),
+        [this](const json& state) { temperature_state_.update_from_status(state); });
+
+    status_router_.add_route(
+        "motion", Router::match_objects({"toolhead", "gcode_move"}),
+        [this](const json& state) { motion_state_.update_from_status(state); });
+
+    status_router_.add_route(
+        "print", Router::match_objects({"print_stats", "virtual_sdcard", "display_status"}),
+        [this](const json& state) { print_domain_.update_from_status(state); });
+
+    // Kinematics type (determines if bed moves on Z or gantry moves) and active extruder.
+    // Not part of motion_state_ as it affects printer_bed_moves_ subject
+    status_router_.add_route("toolhead", Router::match_objects({"toolhead"}),
+                             [this](const json& state) {
+                                 const auto& toolhead = state["toolhead"];
+                                 if (toolhead.contains("kinematics") &&
+                                     toolhead["kinematics"].is_string()) {
+                                     set_kinematics(toolhead["kinematics"].get<std::string>());
+                                 }
+
+                                 // Track active extruder (tool changers, multi-extruder setups)
+                                 if (toolhead.contains("extruder") &&
+                                     toolhead["extruder"].is_string()) {
+                                     temperature_state_.set_active_extruder(
+                                         toolhead["extruder"].get<std::string>());
+                                 }
+                             });
+
+    status_router_.add_route(
+        "fan", Router::match_objects({"fan"}, {"heater_fan ", "fan_generic ", "controller_fan "}),
+        [this](const json& state) { fan_state_.update_from_status(state); });
+
+    // LED strips can be native objects with arbitrary names, so this route also
+    // receives deltas with otherwise unclaimed keys
+    status_router_.add_route(
+        "led",
+        Router::match_objects({}, {"neopixel", "dotstar", "led ", "led_effect ", "output_pin ",
+                                   "pca9533 ", "pca9632 "}),
+        [this](const json& state) {
+            led_state_component_.update_from_status(state);
+
+            // Update LED controller per-strip color cache
+            auto& led_ctrl = helix::led::LedController::instance();
+            if (led_ctrl.is_initialized()) {
+                led_ctrl.native().update_from_status(state);
+                led_ctrl.effects().update_from_status(state);
+                led_ctrl.output_pin().update_from_status(state);
+            }
+        },
+        /*fallback=*/true);
+
+    // Mid-print object exclusion
+    status_router_.add_route(
+        "exclude_object", Router::match_objects({"exclude_object"}),
+        [this](const json& state) { update_exclude_object_from_status(state["exclude_object"]); });
+
+    // Klippy state from webhooks (for restart simulation)
+    status_router_.add_route(
+        "webhooks", Router::match_objects({"webhooks"}),
+        [this](const json& state) { update_webhooks_from_status(state["webhooks"]); });
+
+    // Manual probe, motor state, firmware retraction
+    status_router_.add_route(
+        "calibration",
+        Router::match_objects(
+            {"manual_probe", "toolhead", "stepper_enable", "firmware_retraction"}),
+        [this](const json& state) { calibration_state_.update_from_status(state); });
+
+    // Sensor managers claim keys by Klipper object type
+    status_router_.add_route(
+        "filament_sensors",
+        [](const std::string& key) {
+            return helix::FilamentSensorManager::instance().handles_status_object(key);
+        },
+        [](const json& state) {
+            helix::FilamentSensorManager::instance().update_from_status(state);
+        });
 
-    // Delegate fan state updates to fan component
-    fan_state_.update_from_status(state);
+    status_router_.add_route(
+        "humidity_sensors",
+        [](const std::string& key) {
+            return helix::sensors::HumiditySensorManager::instance().handles_status_object(key);
+        },
+        [](const json& state) {
+            helix::sensors::HumiditySensorManager::instance().update_from_status(state);
+        });
 
-    // Delegate LED state updates to LED component
-    led_state_component_.update_from_status(state);
+    status_router_.add_route(
+        "width_sensors",
+        [](const std::string& key) {
+            return helix::sensors::WidthSensorManager::instance().handles_status_object(key);
+        },
+        [](const json& state) {
+            helix::sensors::WidthSensorManager::instance().update_from_status(state);
+        });
 
-    // Update LED controller per-strip color cache
-    auto& led_ctrl = helix::led::LedController::instance();
-    if (led_ctrl.is_initialized()) {
-        led_ctrl.native().update_from_status(state);
-        led_ctrl.effects().update_from_status(state);
-        led_ctrl.output_pin().update_from_status(state);
-    }
+    status_router_.add_route(
+        "probe_sensors",
+        [](const std::string& key) {
+            return helix::sensors::ProbeSensorManager::instance().handles_status_object(key);
+        },
+        [](const json& state) {
+            helix::sensors::ProbeSensorManager::instance().update_from_status(state);
+        });
 
-    // Update exclude_object state (for mid-print object exclusion)
-    if (state.contains("exclude_object")) {
-        const auto& eo = state["exclude_object"];
+    status_router_.add_route(
+        "accel_sensors",
+        [](const std::string& key) {
+            return helix::sensors::AccelSensorManager::instance().handles_status_object(key);
+        },
+        [](const json& state) {
+            helix::sensors::AccelSensorManager::instance().update_from_status(state);
+        });
 
-        if (eo.contains("excluded_objects") && eo["excluded_objects"].is_array()) {
-            std::unordered_set<std::string> excluded;
-            for (const auto& obj : eo["excluded_objects"]) {
-                if (obj.is_string()) {
-                    excluded.insert(obj.get<std::string>());
-                }
-            }
-            // set_excluded_objects handles change detection and notification
-            // Note: We're inside state_mutex_ lock, but set_excluded_objects only modifies
-            // its own data and calls lv_subject_set_int which is safe
-            set_excluded_objects(excluded);
-        }
+    // TD-1 color sensors are keyed by device ID, which has no recognizable prefix
+    status_router_.add_route(
+        "color_sensors", nullptr,
+        [](const json& state) {
+            helix::sensors::ColorSensorManager::instance().update_from_status(state);
+        },
+        /*fallback=*/true);
+
+    status_router_.add_route(
+        "temperature_sensors",
+        [](const std::string& key) {
+            return helix::sensors::TemperatureSensorManager::instance().handles_status_object(key);
+        },
+        [](const json& state) {
+            helix::sensors::TemperatureSensorManager::instance().update_from_status(state);
+        });
+}
 
-        // Parse defined objects list
-        if (eo.contains("objects") && eo["objects"].is_array()) {
-            std::vector<std::string> defined;
-            for (const auto& obj : eo["objects"]) {
-                if (obj.is_object() && obj.contains("name") && obj["name"].is_string()) {
-                    defined.push_back(obj["name"].get<std::string>());
-                }
+void PrinterState::update_exclude_object_from_status(const json& eo) {
+    if (eo.contains("excluded_objects") && eo["excluded_objects"].is_array()) {
+        std::unordered_set<std::string> excluded;
+        for (const auto& obj : eo["excluded_objects"]) {
+            if (obj.is_string()) {
+                excluded.insert(obj.get<std::string>());
             }
-            excluded_objects_state_.set_defined_objects(defined);
         }
+        // set_excluded_objects handles change detection and notification
+        // Note: We're inside state_mutex_ lock, but set_excluded_objects only modifies
+        // its own data and calls lv_subject_set_int which is safe
+        set_excluded_objects(excluded);
+    }
 
-        // Parse current object
-        if (eo.contains("current_object")) {
-            if (eo["current_object"].is_string()) {
-                excluded_objects_state_.set_current_object(eo["current_object"].get<std::string>());
-            } else if (eo["current_object"].is_null()) {
-                excluded_objects_state_.set_current_object("");
+    // Parse defined objects list
+    if (eo.contains("objects") && eo["objects"].is_array()) {
+        std::vector<std::string> defined;
+        for (const auto& obj : eo["objects"]) {
+            if (obj.is_object() && obj.contains("name") && obj["name"].is_string()) {
+                defined.push_back(obj["name"].get<std::string>());
             }
         }
+        excluded_objects_state_.set_defined_objects(defined);
     }
 
-    // Update klippy state from webhooks (for restart simulation)
-    if (state.contains("webhooks")) {
-        const auto& webhooks = state["webhooks"];
-        if (webhooks.contains("state") && webhooks["state"].is_string()) {
-            std::string klippy_state_str = webhooks["state"].get<std::string>();
-            KlippyState new_state = KlippyState::READY; // default
-
-            if (klippy_state_str == "ready") {
-                new_state = KlippyState::READY;
-            } else if (klippy_state_str == "startup") {
-                new_state = KlippyState::STARTUP;
-            } else if (klippy_state_str == "shutdown") {
-                new_state = KlippyState::SHUTDOWN;
-            } else if (klippy_state_str == "error") {
-                new_state = KlippyState::ERROR;
-            }
-
-            network_state_.set_klippy_state_internal(new_state);
-            spdlog::debug("[PrinterState] Klippy state from webhooks: {}", klippy_state_str);
+    // Parse current object
+    if (eo.contains("current_object")) {
+        if (eo["current_object"].is_string()) {
+            excluded_objects_state_.set_current_object(eo["current_object"].get<std::string>());
+        } else if (eo["current_object"].is_null()) {
+            excluded_objects_state_.set_current_object("");
         }
     }
+}
 
-    // Delegate calibration updates (manual probe, motor state, firmware retraction)
-    // to calibration_state_ component
-    calibration_state_.update_from_status(state);
-
-    // Forward filament sensor updates to FilamentSensorManager
-    // The manager handles all sensor types: filament_switch_sensor and filament_motion_sensor
-    helix::FilamentSensorManager::instance().update_from_status(state);
+void PrinterState::update_webhooks_from_status(const json& webhooks) {
+    if (webhooks.contains("state") && webhooks["state"].is_string()) {
+        std::string klippy_state_str = webhooks["state"].get<std::string>();
+        KlippyState new_state = KlippyState::READY; // default
 
-    // Forward updates to all other sensor managers
-    helix::sensors::HumiditySensorManager::instance().update_from_status(state);
-    helix::sensors::WidthSensorManager::instance().update_from_status(state);
-    helix::sensors::ProbeSensorManager::instance().update_from_status(state);
-    helix::sensors::AccelSensorManager::instance().update_from_status(state);
-    helix::sensors::ColorSensorManager::instance().update_from_status(state);
-    helix::sensors::TemperatureSensorManager::instance().update_from_status(state);
+        if (klippy_state_str == "ready") {
+            new_state = KlippyState::READY;
+        } else if (klippy_state_str == "startup") {
+            new_state = KlippyState::STARTUP;
+        } else if (klippy_state_str == "shutdown") {
+            new_state = KlippyState::SHUTDOWN;
+        } else if (klippy_state_str == "error") {
+            new_state = KlippyState::ERROR;
+        }
 
-    // Cache full state for complex queries
-    // (already under state_mutex_ from top of function)
-    json_state_.merge_patch(state);
+        network_state_.set_klippy_state_internal(new_state);
+        spdlog::debug("[PrinterState] Klippy state from webhooks: {}", klippy_state_str);
+    }
 }
 
 json PrinterState::get_json_state() {
@@ -0,0 +1,115 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+/**
+ * @file printer_status_router.cpp
+ * @brief Key-based dispatch of Klipper status deltas to PrinterState sub-states
+ *
+ * @threading Not thread-safe; PrinterState dispatches under state_mutex_ on the main thread
+ *
+ * @see printer_state.cpp
+ */
+
+#include "printer_status_router.h"
+
+#include <spdlog/spdlog.h>
+
+namespace helix {
+
+bool PrinterStatusRouter::add_route(std::string name, KeyMatcher owns, Handler handler,
+                                    bool fallback) {
+    if (routes_.size() >= MAX_ROUTES) {
+        spdlog::error("[PrinterStatusRouter] Cannot add route '{}': limit of {} routes reached",
+                      name, MAX_ROUTES);
+        return false;
+    }
+
+    if (fallback) {
+        fallback_mask_ |= uint64_t{1} << routes_.size();
+    }
+    routes_.push_back({std::move(name), std::move(owns), std::move(handler)});
+
+    // Cached masks were computed without this route
+    key_routes_.clear();
+    return true;
+}
+
+void PrinterStatusRouter::prime(const std::vector<std::string>& objects) {
+    key_routes_.reserve(key_routes_.size() + objects.size());
+    for (const auto& key : objects) {
+        routes_for_key(key);
+    }
+    spdlog::debug("[PrinterStatusRouter] Primed {} object keys across {} routes",
+                  key_routes_.size(), routes_.size());
+}
+
+void PrinterStatusRouter::invalidate() {
+    key_routes_.clear();
+}
+
+uint64_t PrinterStatusRouter::routes_for_key(const std::string& key) {
+    auto it = key_routes_.find(key);
+    if (it != key_routes_.end()) {
+        return it->second;
+    }
+    uint64_t mask = resolve_key(key);
+    key_routes_.emplace(key, mask);
+    return mask;
+}
+
+uint64_t PrinterStatusRouter::resolve_key(const std::string& key) const {
+    uint64_t mask = 0;
+    for (size_t i = 0; i < routes_.size(); ++i) {
+        const auto& owns = routes_[i].owns;
+        if (owns && owns(key)) {
+            mask |= uint64_t{1} << i;
+        }
+    }
+    if (mask == 0) {
+        mask = fallback_mask_;
+        spdlog::trace("[PrinterStatusRouter] Unclaimed object '{}' -> fallback routes", key);
+    }
+    return mask;
+}
+
+size_t PrinterStatusRouter::dispatch(const nlohmann::json& status) {
+    if (!status.is_object() || status.empty()) {
+        return 0;
+    }
+
+    uint64_t mask = 0;
+    for (auto it = status.begin(); it != status.end(); ++it) {
+        mask |= routes_for_key(it.key());
+    }
+
+    size_t invoked = 0;
+    for (size_t i = 0; i < routes_.size() && mask != 0; ++i) {
+        const uint64_t bit = uint64_t{1} << i;
+        if (mask & bit) {
+            mask &= ~bit;
+            routes_[i].handler(status);
+            ++invoked;
+        }
+    }
+    return invoked;
+}
+
+PrinterStatusRouter::KeyMatcher
+PrinterStatusRouter::match_objects(std::vector<std::string> exact,
+                                   std::vector<std::string> prefixes) {
+    return [exact_names = std::move(exact),
+            name_prefixes = std::move(prefixes)](const std::string& key) {
+        for (const auto& name : exact_names) {
+            if (key == name) {
+                return true;
+            }
+        }
+        for (const auto& prefix : name_prefixes) {
+            if (key.rfind(prefix, 0) == 0) {
+                return true;
+            }
+        }
+        return false;
+    };
+}
+
+} // namespace helix
@@ -12,6 +12,7 @@
 #include "bed_mesh_overlays.h"
 #include "bed_mesh_projection.h"
 #include "bed_mesh_rasterizer.h"
+#include "frame_profiler.h"
 #include "memory_monitor.h"
 #include "theme_manager.h"
 
@@ -431,6 +432,8 @@ void bed_mesh_renderer_auto_color_range(bed_mesh_renderer_t* renderer) {
 
 bool bed_mesh_renderer_render(bed_mesh_renderer_t* renderer, lv_layer_t* layer, int canvas_width,
                               int canvas_height, int widget_x, int widget_y) {
+    HELIX_PROFILE_SCOPE("draw.bed_mesh");
+
     if (!renderer || !layer) {
         spdlog::error("[Bed Mesh Renderer] Invalid parameters for render: renderer={}, layer={}",
                       (void*)renderer, (void*)layer);
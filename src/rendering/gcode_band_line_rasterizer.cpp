@@ -0,0 +1,379 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_band_line_rasterizer.h"
+
+#include "gcode_streaming_config.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <system_error>
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+constexpr unsigned MAX_AUTO_THREADS = 4;
+constexpr unsigned MAX_THREADS = 16;
+
+/// 1px Bresenham line, clipped to columns [0, width) and rows [row_begin, row_end)
+void draw_line_1px(uint32_t* pixels, int stride, int width, int row_begin, int row_end, int x0,
+                   int y0, int x1, int y1, uint32_t color) {
+    if (std::max(y0, y1) < row_begin || std::min(y0, y1) >= row_end) {
+        return; // Entirely outside the band
+    }
+
+    int dx = std::abs(x1 - x0);
+    int dy = -std::abs(y1 - y0);
+    int sx = x0 < x1 ? 1 : -1;
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+
+    while (true) {
+        if (y0 >= row_begin && y0 < row_end) {
+            if (x0 >= 0 && x0 < width) {
+                pixels[static_cast<size_t>(y0) * stride + x0] = color;
+            }
+        } else if (sy > 0 ? y0 >= row_end : y0 < row_begin) {
+            break; // Left the band in the direction of travel
+        }
+
+        if (x0 == x1 && y0 == y1)
+            break;
+
+        int e2 = 2 * err;
+        if (e2 >= dy) {
+            if (x0 == x1)
+                break;
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            if (y0 == y1)
+                break;
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+} // namespace
+
+void draw_raster_line(uint32_t* pixels, int stride, int width, int row_begin, int row_end,
+                      const RasterLine& line) {
+    if (line.width <= 1) {
+        draw_line_1px(pixels, stride, width, row_begin, row_end, line.x0, line.y0, line.x1, line.y1,
+                      line.color);
+        return;
+    }
+
+    // Compute perpendicular direction to the line
+    float dx = static_cast<float>(line.x1 - line.x0);
+    float dy = static_cast<float>(line.y1 - line.y0);
+    float len = std::sqrt(dx * dx + dy * dy);
+
+    if (len < 0.001f) {
+        draw_line_1px(pixels, stride, width, row_begin, row_end, line.x0, line.y0, line.x1, line.y1,
+                      line.color);
+        return;
+    }
+
+    // Perpendicular unit vector (rotated 90 degrees)
+    float px = -dy / len;
+    float py = dx / len;
+
+    // Draw parallel lines offset by [-width/2, +width/2]
+    float half = static_cast<float>(line.width - 1) * 0.5f;
+    for (int i = 0; i < line.width; ++i) {
+        float offset = static_cast<float>(i) - half;
+        int ox = static_cast<int>(std::round(px * offset));
+        int oy = static_cast<int>(std::round(py * offset));
+        draw_line_1px(pixels, stride, width, row_begin, row_end, line.x0 + ox, line.y0 + oy,
+                      line.x1 + ox, line.y1 + oy, line.color);
+    }
+}
+
+// ============================================================================
+// BandLineRasterizer
+// ============================================================================
+
+BandLineRasterizer::BandLineRasterizer(unsigned thread_count) {
+    if (thread_count == 0) {
+        thread_count = configured_thread_count();
+    }
+    thread_count = std::clamp(thread_count, 1u, MAX_THREADS);
+
+    // The job thread is worker 0; work is split by thread_count(), so a
+    // partial start just means fewer workers
+    workers_.reserve(thread_count - 1);
+    for (unsigned i = 1; i < thread_count; ++i) {
+        try {
+            workers_.emplace_back(&BandLineRasterizer::helper_loop, this, i);
+        } catch (const std::system_error& e) {
+            spdlog::warn("[BandLineRasterizer] Failed to start worker {}: {}", i, e.what());
+            break;
+        }
+    }
+}
+
+BandLineRasterizer::~BandLineRasterizer() {
+    cancel();
+    stop_helpers();
+}
+
+bool BandLineRasterizer::start(int width, int height, int from_layer, int to_layer,
+                               const LineSourceFactory& make_source) {
+    if (state_.load() != State::IDLE || width <= 0 || height <= 0 || from_layer > to_layer) {
+        return false;
+    }
+    if (job_thread_.joinable()) {
+        job_thread_.join(); // Previous job already finished
+    }
+
+    width_ = width;
+    height_ = height;
+    from_layer_ = from_layer;
+    to_layer_ = to_layer;
+    staging_.assign(static_cast<size_t>(width) * height, 0);
+
+    const unsigned threads = thread_count();
+    // Lines crossing several bands are walked once per band, so a single
+    // worker draws the whole buffer as one band
+    int bands = threads > 1 ? static_cast<int>(threads) * BANDS_PER_THREAD : 1;
+    bands = std::clamp(bands, 1, height);
+    band_height_ = (height + bands - 1) / bands;
+    band_count_ = (height + band_height_ - 1) / band_height_;
+
+    std::vector<LineSource> sources;
+    sources.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i) {
+        sources.push_back(make_source());
+    }
+
+    cancel_.store(false);
+    layers_done_.store(0);
+    state_.store(State::RUNNING);
+    try {
+        job_thread_ = std::thread(&BandLineRasterizer::run_job, this, std::move(sources));
+    } catch (const std::system_error& e) {
+        spdlog::warn("[BandLineRasterizer] Failed to start job: {}", e.what());
+        state_.store(State::IDLE);
+        std::vector<uint32_t>().swap(staging_);
+        return false;
+    }
+    return true;
+}
+
+void BandLineRasterizer::cancel() {
+    cancel_.store(true);
+    if (job_thread_.joinable()) {
+        job_thread_.join();
+    }
+    state_.store(State::IDLE);
+    std::vector<uint32_t>().swap(staging_);
+}
+
+bool BandLineRasterizer::composite_into(uint8_t* dst, size_t dst_stride) {
+    if (state_.load() != State::READY || dst == nullptr) {
+        return false;
+    }
+    if (job_thread_.joinable()) {
+        job_thread_.join();
+    }
+
+    // Every line color has a non-zero alpha, so 0 marks pixels the job never wrote
+    for (int y = 0; y < height_; ++y) {
+        const uint32_t* src = staging_.data() + static_cast<size_t>(y) * width_;
+        auto* out = reinterpret_cast<uint32_t*>(dst + static_cast<size_t>(y) * dst_stride);
+        for (int x = 0; x < width_; ++x) {
+            if (src[x] != 0) {
+                out[x] = src[x];
+            }
+        }
+    }
+
+    std::vector<uint32_t>().swap(staging_);
+    state_.store(State::IDLE);
+    return true;
+}
+
+BandLineRasterizer::Stats BandLineRasterizer::stats() const {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return stats_;
+}
+
+unsigned BandLineRasterizer::configured_thread_count() {
+    // 0 = auto
+    int threads = get_gcode_int_setting("HELIX_GCODE_LAYER_CACHE_THREADS",
+                                        "/gcode_viewer/layer_cache_threads", 0, 0,
+                                        static_cast<int>(MAX_THREADS));
+    if (threads > 0) {
+        return std::min(static_cast<unsigned>(threads), MAX_THREADS);
+    }
+    unsigned cores = std::thread::hardware_concurrency();
+    return std::clamp(cores, 1u, MAX_AUTO_THREADS);
+}
+
+// ============================================================================
+// Job
+// ============================================================================
+
+void BandLineRasterizer::run_job(std::vector<LineSource> sources) {
+    auto start_time = std::chrono::steady_clock::now();
+    const unsigned threads = thread_count();
+
+    sources_ = std::move(sources);
+    scratch_.assign(threads, {});
+    bins_.assign(threads, std::vector<std::vector<RasterLine>>(band_count_));
+    std::vector<size_t> lines(threads, 0);
+    std::vector<size_t> band_lines(threads, 0);
+
+    const int chunk_layers = static_cast<int>(threads) * LAYERS_PER_SLICE;
+    for (int first = from_layer_; first <= to_layer_ && !cancel_.load(); first += chunk_layers) {
+        const int last = std::min(first + chunk_layers - 1, to_layer_);
+
+        // Bin: worker w takes the w-th slice of the chunk, so bins_[0..N) stay in draw order
+        run_parallel([&](unsigned worker) {
+            int slice_first = first + static_cast<int>(worker) * LAYERS_PER_SLICE;
+            int slice_last = std::min(slice_first + LAYERS_PER_SLICE - 1, last);
+            bin_slice(worker, slice_first, slice_last);
+            lines[worker] += scratch_[worker].size();
+        });
+        if (cancel_.load()) {
+            break;
+        }
+
+        // Rasterize: workers claim bands until none are left
+        next_band_.store(0);
+        run_parallel([&](unsigned worker) {
+            for (int band = next_band_.fetch_add(1); band < band_count_ && !cancel_.load();
+                 band = next_band_.fetch_add(1)) {
+                int row_begin = band * band_height_;
+                int row_end = std::min(row_begin + band_height_, height_);
+                for (auto& worker_bins : bins_) {
+                    for (const RasterLine& line : worker_bins[band]) {
+                        draw_raster_line(staging_.data(), width_, width_, row_begin, row_end, line);
+                    }
+                    band_lines[worker] += worker_bins[band].size();
+                }
+            }
+        });
+
+        layers_done_.store(last - from_layer_ + 1);
+    }
+
+    // Release the chunk working set (can be large on dense layers)
+    sources_.clear();
+    scratch_.clear();
+    bins_.clear();
+
+    bool cancelled = cancel_.load();
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        stats_.layers = layers_done_.load();
+        stats_.lines = 0;
+        stats_.band_lines = 0;
+        for (unsigned i = 0; i < threads; ++i) {
+            stats_.lines += lines[i];
+            stats_.band_lines += band_lines[i];
+        }
+        stats_.elapsed_ms = std::chrono::duration<double, std::milli>(
+                                std::chrono::steady_clock::now() - start_time)
+                                .count();
+    }
+    state_.store(cancelled ? State::IDLE : State::READY);
+}
+
+void BandLineRasterizer::bin_slice(unsigned worker, int first_layer, int last_layer) {
+    auto& lines = scratch_[worker];
+    auto& bins = bins_[worker];
+    lines.clear();
+    for (auto& band : bins) {
+        band.clear();
+    }
+
+    for (int layer = first_layer; layer <= last_layer && !cancel_.load(); ++layer) {
+        sources_[worker](layer, lines);
+    }
+
+    for (const RasterLine& line : lines) {
+        // Parallel offsets of a thick line move it at most width/2 rows
+        int margin = line.width / 2 + 1;
+        int top = std::max(std::min(line.y0, line.y1) - margin, 0);
+        int bottom = std::min(std::max(line.y0, line.y1) + margin, height_ - 1);
+        if (top > bottom) {
+            continue; // Off screen
+        }
+        for (int band = top / band_height_; band <= bottom / band_height_; ++band) {
+            bins[band].push_back(line);
+        }
+    }
+}
+
+// ============================================================================
+// Helper threads
+// ============================================================================
+
+void BandLineRasterizer::run_parallel(const std::function<void(unsigned)>& fn) {
+    if (workers_.empty()) {
+        fn(0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &fn;
+        remaining_ = static_cast<unsigned>(workers_.size());
+        ++generation_;
+    }
+    work_cv_.notify_all();
+
+    fn(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] { return remaining_ == 0; });
+    task_ = nullptr;
+}
+
+void BandLineRasterizer::helper_loop(unsigned worker) {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        work_cv_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+        if (stopping_) {
+            return;
+        }
+        seen = generation_;
+        const std::function<void(unsigned)>* task = task_;
+
+        lock.unlock();
+        (*task)(worker);
+        lock.lock();
+
+        if (--remaining_ == 0) {
+            done_cv_.notify_one();
+        }
+    }
+}
+
+void BandLineRasterizer::stop_helpers() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+}
+
+} // namespace gcode
+} // namespace helix
@@ -4,11 +4,15 @@
 #include "gcode_data_source.h"
 
 #include "app_globals.h"
+#include "gcode_range_block_cache.h"
+#include "gcode_streaming_config.h"
+#include "http_executor.h"
 #include "memory_monitor.h"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <cerrno>
 #include <cinttypes>
 #include <cstdio>
 #include <cstring>
@@ -16,7 +20,11 @@
 #include <fstream>
 #include <limits>
 
+#include <sys/mman.h>
+#include <unistd.h>
+
 // For HTTP requests - use libhv which is already in the project
+#include "hv/HttpClient.h"
 #include "hv/hurl.h"
 #include "hv/requests.h"
 
@@ -66,20 +74,25 @@ std::vector<char> GCodeDataSource::read_all() {
 // FileDataSource
 // =============================================================================
 
-FileDataSource::FileDataSource(const std::string& filepath) : filepath_(filepath) {
+FileDataSource::FileDataSource(const std::string& filepath, IoMode mode) : filepath_(filepath) {
     file_ = std::fopen(filepath.c_str(), "rb");
     if (file_) {
         // Get file size using 64-bit safe fseeko/ftello (handles > 2GB on 32-bit ARM)
         fseeko(file_, 0, SEEK_END);
         size_ = static_cast<uint64_t>(ftello(file_));
         fseeko(file_, 0, SEEK_SET);
-        spdlog::debug("[FileDataSource] Opened '{}' ({} bytes)", filepath, size_);
+        if (mode == IoMode::MMAP && !map_file()) {
+            spdlog::debug("[FileDataSource] mmap unavailable for '{}', using stdio", filepath);
+        }
+        spdlog::debug("[FileDataSource] Opened '{}' ({} bytes, {})", filepath, size_,
+                      map_ ? "mmap" : "stdio");
     } else {
         spdlog::error("[FileDataSource] Failed to open '{}'", filepath);
     }
 }
 
 FileDataSource::~FileDataSource() {
+    unmap_file();
     if (file_) {
         std::fclose(file_);
         file_ = nullptr;
@@ -87,25 +100,102 @@ FileDataSource::~FileDataSource() {
 }
 
 FileDataSource::FileDataSource(FileDataSource&& other) noexcept
-    : filepath_(std::move(other.filepath_)), file_(other.file_), size_(other.size_) {
+    : filepath_(std::move(other.filepath_)), file_(other.file_), size_(other.size_),
+      map_(other.map_) {
     other.file_ = nullptr;
     other.size_ = 0;
+    other.map_ = nullptr;
 }
 
 FileDataSource& FileDataSource::operator=(FileDataSource&& other) noexcept {
     if (this != &other) {
+        unmap_file();
         if (file_) {
             std::fclose(file_);
         }
         filepath_ = std::move(other.filepath_);
         file_ = other.file_;
         size_ = other.size_;
+        map_ = other.map_;
         other.file_ = nullptr;
         other.size_ = 0;
+        other.map_ = nullptr;
     }
     return *this;
 }
 
+bool FileDataSource::map_file() {
+    // Empty files can't be mapped; files beyond the address space can't either
+    if (size_ == 0 || size_ > std::numeric_limits<size_t>::max()) {
+        return false;
+    }
+
+    void* addr = mmap(nullptr, static_cast<size_t>(size_), PROT_READ, MAP_PRIVATE,
+                      fileno(file_), 0);
+    if (addr == MAP_FAILED) {
+        spdlog::warn("[FileDataSource] mmap failed for '{}': {}", filepath_, std::strerror(errno));
+        return false;
+    }
+
+    // Layers are read front to back in chunks; let the kernel read ahead normally
+    // and rely on advise_willneed() for the prefetch window
+    madvise(addr, static_cast<size_t>(size_), MADV_NORMAL);
+    map_ = static_cast<const char*>(addr);
+    return true;
+}
+
+void FileDataSource::unmap_file() {
+    if (map_) {
+        munmap(const_cast<char*>(map_), static_cast<size_t>(size_));
+        map_ = nullptr;
+    }
+}
+
+void FileDataSource::advise(uint64_t offset, uint64_t length, int advice,
+                            bool whole_pages_only) {
+    if (!map_ || offset >= size_ || length == 0) {
+        return;
+    }
+
+    static const uint64_t page = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    uint64_t end = std::min(size_, offset + length);
+
+    // madvise() needs a page-aligned start. WILLNEED rounds outward (reading a bit
+    // extra is harmless); DONTNEED rounds inward so pages shared with neighbouring
+    // layers stay resident.
+    uint64_t start;
+    if (whole_pages_only) {
+        start = (offset + page - 1) / page * page;
+        end = end == size_ ? end : end / page * page;
+    } else {
+        start = offset / page * page;
+    }
+    if (start >= end) {
+        return;
+    }
+
+    if (madvise(const_cast<char*>(map_) + start, static_cast<size_t>(end - start), advice) != 0) {
+        spdlog::trace("[FileDataSource] madvise({}) failed at {}+{}: {}", advice, start,
+                      end - start, std::strerror(errno));
+    }
+}
+
+void FileDataSource::advise_willneed(uint64_t offset, uint64_t length) {
+    advise(offset, length, MADV_WILLNEED, false);
+}
+
+void FileDataSource::advise_dontneed(uint64_t offset, uint64_t length) {
+    advise(offset, length, MADV_DONTNEED, true);
+}
+
+std::string_view FileDataSource::view_range(uint64_t offset, uint32_t length) {
+    if (!map_ || offset >= size_) {
+        return {};
+    }
+    auto available = static_cast<size_t>(std::min<uint64_t>(length, size_ - offset));
+    return {map_ + offset, available};
+}
+
 std::vector<char> FileDataSource::read_range(uint64_t offset, uint32_t length) {
     if (!file_ || offset >= size_) {
         return {};
@@ -117,6 +207,10 @@ std::vector<char> FileDataSource::read_range(uint64_t offset, uint32_t length) {
         return {};
     }
 
+    if (map_) {
+        return std::vector<char>(map_ + offset, map_ + offset + available);
+    }
+
     std::vector<char> buffer(available);
 
     // Seek using 64-bit safe fseeko (handles files > 2GB on 32-bit ARM)
@@ -160,7 +254,9 @@ std::string FileDataSource::indexable_file_path() const {
 
 MoonrakerDataSource::MoonrakerDataSource(const std::string& moonraker_url,
                                          const std::string& gcode_path)
-    : moonraker_url_(moonraker_url), gcode_path_(gcode_path) {
+    : moonraker_url_(moonraker_url), gcode_path_(gcode_path),
+      http_counters_(std::make_unique<HttpConnectionCounters>()),
+      range_session_(std::make_unique<HttpSession>(*http_counters_)) {
     // Normalize URL (remove trailing slash)
     while (!moonraker_url_.empty() && moonraker_url_.back() == '/') {
         moonraker_url_.pop_back();
@@ -175,6 +271,15 @@ MoonrakerDataSource::MoonrakerDataSource(const std::string& moonraker_url,
 }
 
 MoonrakerDataSource::~MoonrakerDataSource() {
+    if (block_cache_) {
+        auto stats = block_cache_->stats();
+        spdlog::debug("[MoonrakerDataSource] Range cache for '{}': {} block hits, {} misses, "
+                      "{} prefetched, {} requests ({} KB), {} connections for {} HTTP requests",
+                      gcode_path_, stats.block_hits, stats.block_misses, stats.prefetched,
+                      stats.fetches, stats.bytes_fetched / 1024,
+                      http_counters_->connections_opened.load(), http_counters_->requests.load());
+    }
+
     // Clean up temp file if we created one
     if (!temp_file_path_.empty()) {
         std::filesystem::remove(temp_file_path_);
@@ -198,7 +303,11 @@ bool MoonrakerDataSource::fetch_metadata() {
     std::string encoded_filename = HUrl::escape(gcode_path_);
     std::string url = moonraker_url_ + "/server/files/metadata?filename=" + encoded_filename;
 
-    auto resp = requests::get(url.c_str());
+    std::shared_ptr<HttpResponse> resp;
+    {
+        std::lock_guard<std::mutex> lock(range_mutex_);
+        resp = range_session_->get(url);
+    }
 
     if (!resp) {
         spdlog::error("[MoonrakerDataSource] Metadata request failed for '{}'", gcode_path_);
@@ -246,18 +355,20 @@ bool MoonrakerDataSource::fetch_metadata() {
 }
 
 bool MoonrakerDataSource::probe_range_support() {
+    std::lock_guard<std::mutex> lock(range_mutex_);
     if (range_support_probed_) {
         return range_support_;
     }
-    range_support_probed_ = true;
-
-    std::string url = get_download_url();
 
     // Make a HEAD request to check for Accept-Ranges header
-    auto resp = requests::head(url.c_str());
+    auto req = std::make_shared<HttpRequest>();
+    req->method = HTTP_HEAD;
+    req->url = get_download_url();
+    auto resp = range_session_->send(req);
 
     if (!resp) {
         spdlog::warn("[MoonrakerDataSource] Range probe failed");
+        range_support_probed_ = true;
         return false;
     }
 
@@ -274,28 +385,43 @@ bool MoonrakerDataSource::probe_range_support() {
     }
 
     if (range_support_) {
-        spdlog::info("[MoonrakerDataSource] Server supports range requests");
+        block_cache_ = std::make_unique<RangeBlockCache>(
+            size_, get_gcode_remote_cache_bytes(),
+            [this](uint64_t offset, uint32_t length, std::vector<char>& out) {
+                out = http_range_request(offset, length);
+                return !out.empty();
+            });
+        spdlog::info("[MoonrakerDataSource] Server supports range requests ({} KB blocks, "
+                     "{} MB cache)",
+                     block_cache_->block_size() / 1024, block_cache_->budget_bytes() >> 20);
     } else {
         spdlog::info("[MoonrakerDataSource] Server does NOT support range requests, "
                      "will use temp file fallback");
     }
 
+    // Published last: readers that see the flag also see block_cache_
+    range_support_probed_ = true;
     return range_support_;
 }
 
 std::vector<char> MoonrakerDataSource::http_range_request(uint64_t offset, uint32_t length) {
-    std::string url = get_download_url();
-
     // Build range header value
     char range_value[64];
     std::snprintf(range_value, sizeof(range_value), "bytes=%" PRIu64 "-%" PRIu64, offset,
                   offset + length - 1);
 
     // Create request with Range header
-    http_headers headers;
-    headers["Range"] = range_value;
+    auto req = std::make_shared<HttpRequest>();
+    req->method = HTTP_GET;
+    req->url = get_download_url();
+    req->headers["Range"] = range_value;
 
-    auto resp = requests::get(url.c_str(), headers);
+    // One keep-alive connection for every block fetch of this file
+    std::shared_ptr<HttpResponse> resp;
+    {
+        std::lock_guard<std::mutex> lock(range_mutex_);
+        resp = range_session_->send(req);
+    }
 
     if (!resp) {
         spdlog::error("[MoonrakerDataSource] Range request failed");
@@ -339,8 +465,12 @@ std::vector<char> MoonrakerDataSource::read_range(uint64_t offset, uint32_t leng
         probe_range_support();
     }
 
-    if (range_support_) {
-        return http_range_request(offset, length);
+    if (range_support_ && block_cache_) {
+        auto data = block_cache_->read(offset, length);
+        // A server that answers ranges with 200 clears range_support_ mid-read
+        if (!data.empty() || range_support_) {
+            return data;
+        }
     }
 
     // Fall back to downloading entire file
@@ -465,11 +595,10 @@ bool MoonrakerDataSource::ensure_indexable() {
         return download_to_temp();
     }
 
-    // Even with range request support, the layer indexer requires filesystem access
-    // to memory-map the file for efficient random-access parsing. Download once
-    // for indexing, then streaming can use range requests for actual rendering.
-    spdlog::info("[MoonrakerDataSource] Downloading for file-based layer indexing");
-    return download_to_temp();
+    // The layer index is built through read_range() (block cache), so a large
+    // remote file is streamed without ever being copied to flash
+    spdlog::debug("[MoonrakerDataSource] Range requests supported, indexing in place");
+    return true;
 }
 
 // =============================================================================
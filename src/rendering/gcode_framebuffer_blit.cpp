@@ -0,0 +1,225 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_framebuffer_blit.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HELIX_BLIT_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define HELIX_BLIT_SSE2 1
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define HELIX_BLIT_SSSE3 1
+#endif
+#endif
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+// =============================================================================
+// Row kernels (src pixels are 0x00RRGGBB)
+// =============================================================================
+
+inline uint16_t to_rgb565(uint32_t p) {
+    // Same truncation as lv_color_to_u16()
+    return static_cast<uint16_t>(((p >> 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 3) & 0x001F));
+}
+
+void convert_row_rgb888(const uint32_t* src, uint8_t* dst, int width) {
+    int i = 0;
+#if defined(HELIX_BLIT_NEON)
+    for (; i + 16 <= width; i += 16) {
+        uint8x16x4_t bgrx = vld4q_u8(reinterpret_cast<const uint8_t*>(src + i));
+        uint8x16x3_t bgr = {{bgrx.val[0], bgrx.val[1], bgrx.val[2]}};
+        vst3q_u8(dst + i * 3, bgr);
+    }
+#elif defined(HELIX_BLIT_SSSE3)
+    // 4 pixels -> 12 bytes per shuffle; each 16-byte store overlaps the next by 4,
+    // so stop while a full store still fits in the row
+    const __m128i pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    for (; i + 6 <= width; i += 4) {
+        __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 3), _mm_shuffle_epi8(px, pack));
+    }
+#endif
+    for (; i < width; ++i) {
+        uint32_t p = src[i];
+        uint8_t* d = dst + i * 3;
+        d[0] = static_cast<uint8_t>(p);
+        d[1] = static_cast<uint8_t>(p >> 8);
+        d[2] = static_cast<uint8_t>(p >> 16);
+    }
+}
+
+void convert_row_rgb565(const uint32_t* src, uint8_t* dst, int width) {
+    int i = 0;
+#if defined(HELIX_BLIT_NEON)
+    for (; i + 16 <= width; i += 16) {
+        uint8x16x4_t bgrx = vld4q_u8(reinterpret_cast<const uint8_t*>(src + i));
+        uint8x8_t b[2] = {vget_low_u8(bgrx.val[0]), vget_high_u8(bgrx.val[0])};
+        uint8x8_t g[2] = {vget_low_u8(bgrx.val[1]), vget_high_u8(bgrx.val[1])};
+        uint8x8_t r[2] = {vget_low_u8(bgrx.val[2]), vget_high_u8(bgrx.val[2])};
+        for (int half = 0; half < 2; ++half) {
+            uint16x8_t out = vshll_n_u8(r[half], 8);
+            out = vsriq_n_u16(out, vshll_n_u8(g[half], 8), 5);
+            out = vsriq_n_u16(out, vshll_n_u8(b[half], 8), 11);
+            vst1q_u16(reinterpret_cast<uint16_t*>(dst) + i + half * 8, out);
+        }
+    }
+#elif defined(HELIX_BLIT_SSE2)
+    const __m128i red = _mm_set1_epi32(0xF800);
+    const __m128i green = _mm_set1_epi32(0x07E0);
+    const __m128i blue = _mm_set1_epi32(0x001F);
+    const __m128i bias32 = _mm_set1_epi32(0x8000);
+    const __m128i bias16 = _mm_set1_epi16(static_cast<short>(0x8000));
+    auto pack4 = [&](__m128i px) {
+        __m128i v = _mm_or_si128(
+            _mm_or_si128(_mm_and_si128(_mm_srli_epi32(px, 8), red),
+                         _mm_and_si128(_mm_srli_epi32(px, 5), green)),
+            _mm_and_si128(_mm_srli_epi32(px, 3), blue));
+        return _mm_sub_epi32(v, bias32); // Signed range for the saturating pack
+    };
+    for (; i + 8 <= width; i += 8) {
+        __m128i lo = pack4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        __m128i hi = pack4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4)));
+        __m128i out = _mm_add_epi16(_mm_packs_epi32(lo, hi), bias16);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2), out);
+    }
+#endif
+    for (; i < width; ++i) {
+        uint16_t v = to_rgb565(src[i]);
+        std::memcpy(dst + i * 2, &v, sizeof(v));
+    }
+}
+
+/// dst[2i] = dst[2i+1] = src[i]
+void widen_row_2x(const uint32_t* src, uint32_t* dst, int src_width) {
+    int i = 0;
+#if defined(HELIX_BLIT_NEON)
+    for (; i + 4 <= src_width; i += 4) {
+        uint32x4_t px = vld1q_u32(src + i);
+        uint32x4x2_t twice = vzipq_u32(px, px);
+        vst1q_u32(dst + i * 2, twice.val[0]);
+        vst1q_u32(dst + i * 2 + 4, twice.val[1]);
+    }
+#elif defined(HELIX_BLIT_SSE2)
+    for (; i + 4 <= src_width; i += 4) {
+        __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2), _mm_unpacklo_epi32(px, px));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2 + 4), _mm_unpackhi_epi32(px, px));
+    }
+#endif
+    for (; i < src_width; ++i) {
+        dst[i * 2] = src[i];
+        dst[i * 2 + 1] = src[i];
+    }
+}
+
+} // namespace
+
+size_t blit_format_size(BlitFormat format) {
+    switch (format) {
+    case BlitFormat::XRGB8888:
+        return 4;
+    case BlitFormat::RGB565:
+        return 2;
+    case BlitFormat::RGB888:
+    default:
+        return 3;
+    }
+}
+
+const char* blit_format_name(BlitFormat format) {
+    switch (format) {
+    case BlitFormat::XRGB8888:
+        return "xrgb8888";
+    case BlitFormat::RGB565:
+        return "rgb565";
+    case BlitFormat::RGB888:
+    default:
+        return "rgb888";
+    }
+}
+
+void convert_framebuffer_row(const uint32_t* src, uint8_t* dst, int width, BlitFormat format) {
+    switch (format) {
+    case BlitFormat::XRGB8888:
+        std::memcpy(dst, src, static_cast<size_t>(width) * 4);
+        break;
+    case BlitFormat::RGB565:
+        convert_row_rgb565(src, dst, width);
+        break;
+    case BlitFormat::RGB888:
+    default:
+        convert_row_rgb888(src, dst, width);
+        break;
+    }
+}
+
+void FramebufferBlitter::configure(int src_width, int src_height, int dst_width, int dst_height,
+                                   BlitFormat format) {
+    format_ = format;
+    if (src_width == src_width_ && src_height == src_height_ && dst_width == dst_width_ &&
+        dst_height == dst_height_) {
+        return;
+    }
+    src_width_ = src_width;
+    src_height_ = src_height;
+    dst_width_ = dst_width;
+    dst_height_ = dst_height;
+
+    // Same nearest-neighbor mapping as the original per-pixel loop
+    row_map_.resize(static_cast<size_t>(std::max(dst_height, 0)));
+    for (int dy = 0; dy < dst_height; ++dy) {
+        row_map_[dy] = dy * src_height / dst_height;
+    }
+    column_map_.resize(static_cast<size_t>(std::max(dst_width, 0)));
+    for (int dx = 0; dx < dst_width; ++dx) {
+        column_map_[dx] = dx * src_width / dst_width;
+    }
+    scratch_.resize(column_map_.size());
+}
+
+void FramebufferBlitter::blit(const uint32_t* src, uint8_t* dst, size_t dst_stride) {
+    if (!src || !dst || dst_width_ <= 0 || dst_height_ <= 0 || src_width_ <= 0) {
+        return;
+    }
+    const size_t row_bytes = static_cast<size_t>(dst_width_) * blit_format_size(format_);
+    const bool same_width = dst_width_ == src_width_;
+    const bool double_width = dst_width_ == 2 * src_width_;
+
+    for (int dy = 0; dy < dst_height_; ++dy) {
+        uint8_t* dst_row = dst + static_cast<size_t>(dy) * dst_stride;
+        int sy = row_map_[dy];
+
+        // Upscaled rows repeat: copy the converted row instead of redoing it
+        if (dy > 0 && sy == row_map_[dy - 1]) {
+            std::memcpy(dst_row, dst_row - dst_stride, row_bytes);
+            continue;
+        }
+
+        const uint32_t* src_row = src + static_cast<size_t>(sy) * src_width_;
+        if (same_width) {
+            convert_framebuffer_row(src_row, dst_row, dst_width_, format_);
+            continue;
+        }
+        if (double_width) {
+            widen_row_2x(src_row, scratch_.data(), src_width_);
+        } else {
+            for (int dx = 0; dx < dst_width_; ++dx) {
+                scratch_[dx] = src_row[column_map_[dx]];
+            }
+        }
+        convert_framebuffer_row(scratch_.data(), dst_row, dst_width_, format_);
+    }
+}
+
+} // namespace gcode
+} // namespace helix
@@ -13,10 +13,16 @@
 
 #define GLM_ENABLE_EXPERIMENTAL
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <exception>
 #include <glm/gtx/norm.hpp>
 #include <limits>
+#include <mutex>
+#include <system_error>
+#include <thread>
 #include <unordered_map>
 
 namespace helix {
@@ -35,6 +41,92 @@ constexpr uint32_t START_CAP = 0xFF00FF; // Bright Magenta
 constexpr uint32_t END_CAP = 0x00FFFF;   // Bright Cyan
 } // namespace DebugColors
 
+namespace {
+
+// Below this many segments per thread, starting workers costs more than it saves
+constexpr size_t MIN_SEGMENTS_PER_THREAD = 20000;
+constexpr unsigned MAX_BUILD_THREADS = 4;
+
+// Layers a worker may run ahead of the in-order merge. Bounds the unmerged
+// chunks (simplified segments + layer geometry) held at once.
+constexpr size_t IN_FLIGHT_LAYERS_PER_THREAD = 2;
+
+unsigned auto_build_threads(size_t segments) {
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    size_t by_size = std::max<size_t>(1, segments / MIN_SEGMENTS_PER_THREAD);
+    return static_cast<unsigned>(std::min<size_t>({cores, MAX_BUILD_THREADS, by_size}));
+}
+
+// Tube cross-section sides from config, read once (thread-safe static init)
+int configured_tube_sides() {
+    static const int sides = [] {
+        int n = Config::get_instance()->get<int>("/gcode_viewer/tube_sides", 16);
+
+        // Validate: only 4, 8, or 16 sides supported
+        if (n != 4 && n != 8 && n != 16) {
+            spdlog::warn(
+                "[GCode Geometry] Invalid tube_sides={} (must be 4, 8, or 16), defaulting to 16",
+                n);
+            n = 16;
+        }
+
+        spdlog::info("[GCode Geometry] G-code tube geometry: N={} sides (elliptical cross-section)",
+                     n);
+        return n;
+    }();
+    return sides;
+}
+
+// Categorize the top layer's segments by angle and type (debug only)
+void log_top_layer_breakdown(const std::vector<ToolpathSegment>& segments, float z) {
+    if (segments.empty() || !spdlog::should_log(spdlog::level::debug)) {
+        return;
+    }
+
+    size_t extrusion_segs = 0, travel_segs = 0;
+    size_t diagonal_45_segs = 0, horizontal_segs = 0, vertical_segs = 0, other_angle_segs = 0;
+
+    for (const auto& segment : segments) {
+        // Categorize by extrusion vs travel
+        if (segment.is_extrusion) {
+            extrusion_segs++;
+        } else {
+            travel_segs++;
+        }
+
+        // Calculate segment angle in XY plane
+        glm::vec2 delta(segment.end.x - segment.start.x, segment.end.y - segment.start.y);
+        float length_2d = glm::length(delta);
+
+        if (length_2d > 0.01f) { // Skip near-zero length segments
+            float angle_rad = std::atan2(delta.y, delta.x);
+            float angle_deg = glm::degrees(angle_rad);
+
+            // Normalize angle to [0, 180) for direction-independent classification
+            if (angle_deg < 0)
+                angle_deg += 180.0f;
+
+            // Categorize by angle (±5° tolerance)
+            if (std::abs(angle_deg - 45.0f) < 5.0f || std::abs(angle_deg - 135.0f) < 5.0f) {
+                diagonal_45_segs++;
+            } else if (std::abs(angle_deg - 0.0f) < 5.0f || std::abs(angle_deg - 180.0f) < 5.0f) {
+                horizontal_segs++;
+            } else if (std::abs(angle_deg - 90.0f) < 5.0f) {
+                vertical_segs++;
+            } else {
+                other_angle_segs++;
+            }
+        }
+    }
+
+    spdlog::debug("[GCode Geometry] Top layer Z={:.2f}mm: {} segments ({} extrusion, {} travel, "
+                  "angles: {}°±45°, {}°h, {}°v, {} other)",
+                  z, segments.size(), extrusion_segs, travel_segs, diagonal_45_segs,
+                  horizontal_segs, vertical_segs, other_angle_segs);
+}
+
+} // namespace
+
 // ============================================================================
 // QuantizationParams Implementation
 // ============================================================================
@@ -209,6 +301,11 @@ uint16_t GeometryBuilder::add_to_normal_palette(RibbonGeometry& geometry, const
         quantized = normal; // Fallback if quantization created zero vector
     }
 
+    return add_quantized_normal(geometry, quantized);
+}
+
+uint16_t GeometryBuilder::add_quantized_normal(RibbonGeometry& geometry,
+                                               const glm::vec3& quantized) {
     // Check cache first (O(1) lookup)
     auto it = geometry.normal_cache->find(quantized);
     if (it != geometry.normal_cache->end()) {
@@ -217,11 +314,10 @@ uint16_t GeometryBuilder::add_to_normal_palette(RibbonGeometry& geometry, const
 
     // Not in cache - add to palette
     if (geometry.normal_palette.size() >= 65536) {
-        static bool warned = false;
-        if (!warned) {
+        static std::atomic<bool> warned{false};
+        if (!warned.exchange(true)) {
             spdlog::warn(
                 "[GCode Geometry] Normal palette full (65536 entries), reusing last entry");
-            warned = true;
         }
         return 65535;
     }
@@ -289,239 +385,68 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
         "[GCode Geometry] Expanded quantization bounds by {:.1f}mm for tube width {:.1f}mm",
         expansion_margin, max_tube_width);
 
-    // Build Z-height to layer index lookup map
-    // Used later to assign layer indices to strips for ghost layer rendering
-    std::unordered_map<int, uint16_t> z_to_layer_index;
-    for (size_t i = 0; i < gcode.layers.size(); ++i) {
-        // Quantize Z to 0.01mm precision for reliable lookups
-        int z_key = static_cast<int>(std::round(gcode.layers[i].z_height * 100.0f));
-        z_to_layer_index[z_key] = static_cast<uint16_t>(i);
-    }
+    // Read config on this thread before any worker needs it
+    configured_tube_sides();
 
-    // Collect all segments from all layers
-    std::vector<ToolpathSegment> all_segments;
+    size_t total_segments = 0;
     for (const auto& layer : gcode.layers) {
-        all_segments.insert(all_segments.end(), layer.segments.begin(), layer.segments.end());
+        total_segments += layer.segments.size();
     }
+    unsigned threads = worker_threads_ > 0 ? worker_threads_ : auto_build_threads(total_segments);
+    threads = static_cast<unsigned>(
+        std::min<size_t>(threads, std::max<size_t>(1, gcode.layers.size())));
+    spdlog::debug("[GCode::Builder] Building {} segments in {} layers on {} thread(s)",
+                  total_segments, gcode.layers.size(), threads);
+
+    // Layer tracking for ghost layer rendering and per-layer frustum culling.
+    // Layers without extrusions keep an empty range and an empty bounding box.
+    geometry.max_layer_index =
+        gcode.layers.empty() ? 0 : static_cast<uint16_t>(gcode.layers.size() - 1);
+    geometry.layer_strip_ranges.resize(gcode.layers.size(), {0, 0});
+    geometry.layer_bboxes.resize(gcode.layers.size());
 
-    stats_.input_segments = all_segments.size();
-    spdlog::debug("[GCode::Builder] Collected {} total segments from {} layers",
-                  all_segments.size(), gcode.layers.size());
+    spdlog::info("[GCode::Builder] Setting max_layer_index = {} (from {} layers)",
+                 geometry.max_layer_index, gcode.layers.size());
 
-    // Pre-filter: Remove degenerate (zero-length) segments before simplification
     size_t degenerate_count = 0;
-    all_segments.erase(std::remove_if(all_segments.begin(), all_segments.end(),
-                                      [&degenerate_count](const ToolpathSegment& seg) {
-                                          float length = glm::distance(seg.start, seg.end);
-                                          if (length < 0.0001f) {
-                                              degenerate_count++;
-                                              return true; // Remove this segment
-                                          }
-                                          return false; // Keep this segment
-                                      }),
-                       all_segments.end());
+    size_t segments_skipped = 0;
+    size_t sharing_candidates = 0;
+    size_t segments_shared = 0;
+
+    for_each_layer_chunk(gcode, validated_opts, threads, [&](size_t layer_idx, LayerChunk& chunk) {
+        stats_.input_segments += chunk.input_segments;
+        stats_.output_segments += chunk.output_segments;
+        degenerate_count += chunk.degenerate_segments;
+        segments_skipped += chunk.travel_segments;
+        sharing_candidates += chunk.sharing_candidates;
+        segments_shared += chunk.segments_shared;
+        append_chunk(geometry, chunk, layer_idx);
+    });
 
     if (degenerate_count > 0) {
         spdlog::debug("[GCode::Builder] Pre-filtered {} degenerate (zero-length) segments",
                       degenerate_count);
     }
 
-    // Step 1: Simplify segments (merge collinear lines)
-    std::vector<ToolpathSegment> simplified;
+    const size_t kept_segments = stats_.input_segments - degenerate_count;
     if (validated_opts.enable_merging) {
-        simplified = simplify_segments(all_segments, validated_opts);
-        stats_.output_segments = simplified.size();
         stats_.simplification_ratio =
-            1.0f - (static_cast<float>(simplified.size()) / all_segments.size());
+            kept_segments > 0
+                ? 1.0f - (static_cast<float>(stats_.output_segments) / kept_segments)
+                : 0.0f;
 
         spdlog::info(
             "[GCode::Builder] Toolpath simplification: {} → {} segments ({:.1f}% reduction)",
-            all_segments.size(), simplified.size(), stats_.simplification_ratio * 100.0f);
+            kept_segments, stats_.output_segments, stats_.simplification_ratio * 100.0f);
     } else {
-        simplified = all_segments;
-        stats_.output_segments = simplified.size();
         stats_.simplification_ratio = 0.0f;
         spdlog::info("[GCode::Builder] Toolpath simplification DISABLED: using {} raw segments",
-                     simplified.size());
-    }
-
-    // Find the maximum Z height (top layer) dynamically for debug filtering
-    float max_z = -std::numeric_limits<float>::infinity();
-    for (const auto& segment : simplified) {
-        float z = std::round(segment.start.z * 100.0f) / 100.0f;
-        if (z > max_z)
-            max_z = z;
-    }
-
-    // Step 2: Generate ribbon geometry with vertex sharing
-    // Track previous segment end vertices for reuse
-    std::optional<TubeCap> prev_end_cap;
-    glm::vec3 prev_end_pos{0.0f};
-
-    // DEBUG: Track segment Y range and vertex sharing statistics
-    float seg_y_min = FLT_MAX, seg_y_max = -FLT_MAX;
-    size_t segments_skipped = 0;
-    size_t segments_shared = 0;
-    size_t sharing_candidates = 0; // Segments where prev_end_cap exists
-
-    // Layer tracking for ghost layer rendering
-    // Temporary map to accumulate strips per layer, then convert to ranges
-    std::unordered_map<uint16_t, std::vector<size_t>> layer_to_strip_indices;
-    geometry.max_layer_index =
-        gcode.layers.empty() ? 0 : static_cast<uint16_t>(gcode.layers.size() - 1);
-
-    // Initialize per-layer bounding boxes for frustum culling
-    geometry.layer_bboxes.resize(gcode.layers.size());
-
-    spdlog::info("[GCode::Builder] Setting max_layer_index = {} (from {} layers)",
-                 geometry.max_layer_index, gcode.layers.size());
-
-    for (size_t i = 0; i < simplified.size(); ++i) {
-        const auto& segment = simplified[i];
-
-        // Note: Degenerate segments were already filtered before simplification
-
-        // Skip travel moves (non-extrusion moves)
-        // TODO: Make this configurable if we want to visualize travel paths
-        if (!segment.is_extrusion) {
-            segments_skipped++;
-            continue;
-        }
-
-        // Determine layer index from segment Z-height
-        int z_key = static_cast<int>(std::round(segment.start.z * 100.0f));
-        uint16_t layer_idx = 0;
-        auto it = z_to_layer_index.find(z_key);
-        if (it != z_to_layer_index.end()) {
-            layer_idx = it->second;
-        }
-
-        // Expand per-layer bounding box for frustum culling
-        if (layer_idx < geometry.layer_bboxes.size()) {
-            AABB& layer_bbox = geometry.layer_bboxes[layer_idx];
-            layer_bbox.expand(segment.start);
-            layer_bbox.expand(segment.end);
-        }
-
-        // Track Y range
-        seg_y_min = std::min({seg_y_min, segment.start.y, segment.end.y});
-        seg_y_max = std::max({seg_y_max, segment.start.y, segment.end.y});
-
-        // Check if we can share vertices with previous segment (OPTIMIZATION ENABLED!)
-        bool can_share = false;
-        float dist = 0.0f;
-        float connection_tolerance = 0.0f;
-        if (prev_end_cap.has_value()) {
-            sharing_candidates++;
-
-            // Segments must connect spatially (within epsilon) and be same type
-            dist = glm::distance(segment.start, prev_end_pos);
-            // Use width-based tolerance: if gap is less than extrusion width, consider them
-            // connected
-            connection_tolerance = segment.width * 1.5f; //  50% overlap tolerance
-            can_share = (dist < connection_tolerance) &&
-                        (segment.is_extrusion == simplified[i - 1].is_extrusion);
-
-            if (can_share) {
-                segments_shared++;
-            }
-
-            // Debug top layer connections
-            float z = std::round(segment.start.z * 100.0f) / 100.0f;
-            if (z == max_z) {
-                spdlog::trace("[GCode Geometry]   Seg {:3d}: dist={:.4f}mm, tol={:.4f}mm, "
-                              "width={:.4f}mm, can_share={}",
-                              i, dist, connection_tolerance, segment.width, can_share);
-            }
-        }
-
-        // Track strip count before generating geometry
-        size_t strips_before = geometry.strips.size();
-
-        // Generate geometry, reusing previous end cap if segments connect
-        TubeCap end_cap = generate_ribbon_vertices(segment, geometry, quant_params_,
-                                                   can_share ? prev_end_cap : std::nullopt);
-
-        // Track which strips belong to which layer
-        size_t strips_after = geometry.strips.size();
-        for (size_t s = strips_before; s < strips_after; ++s) {
-            geometry.strip_layer_index.push_back(layer_idx);
-            layer_to_strip_indices[layer_idx].push_back(s);
-        }
-
-        // Store for next iteration
-        prev_end_cap = end_cap;
-        prev_end_pos = segment.end;
-    }
-
-    // Build layer_strip_ranges from accumulated data
-    // Initialize with empty ranges for all layers
-    geometry.layer_strip_ranges.resize(gcode.layers.size(), {0, 0});
-    for (const auto& [layer_idx, strip_indices] : layer_to_strip_indices) {
-        if (!strip_indices.empty() && layer_idx < geometry.layer_strip_ranges.size()) {
-            // Find contiguous range (strips should be mostly contiguous per layer)
-            size_t first = strip_indices.front();
-            size_t count = strip_indices.size();
-            geometry.layer_strip_ranges[layer_idx] = {first, count};
-        }
+                     stats_.output_segments);
     }
 
     spdlog::debug("[GCode::Builder] Layer tracking: {} layers, {} total strips",
                   geometry.layer_strip_ranges.size(), geometry.strips.size());
 
-    spdlog::trace("[GCode Geometry] Segment Y range: [{:.1f}, {:.1f}]", seg_y_min, seg_y_max);
-
-    // Categorize segments in top layer by angle and type (max_z already calculated above)
-    size_t total_segs = 0, extrusion_segs = 0, travel_segs = 0;
-    size_t diagonal_45_segs = 0, horizontal_segs = 0, vertical_segs = 0, other_angle_segs = 0;
-
-    for (const auto& segment : simplified) {
-        float z = std::round(segment.start.z * 100.0f) / 100.0f;
-        if (std::abs(z - max_z) < 0.01f) {
-            total_segs++;
-
-            // Categorize by extrusion vs travel
-            if (segment.is_extrusion) {
-                extrusion_segs++;
-            } else {
-                travel_segs++;
-            }
-
-            // Calculate segment angle in XY plane
-            glm::vec2 delta(segment.end.x - segment.start.x, segment.end.y - segment.start.y);
-            float length_2d = glm::length(delta);
-
-            if (length_2d > 0.01f) { // Skip near-zero length segments
-                float angle_rad = std::atan2(delta.y, delta.x);
-                float angle_deg = glm::degrees(angle_rad);
-
-                // Normalize angle to [0, 180) for direction-independent classification
-                if (angle_deg < 0)
-                    angle_deg += 180.0f;
-
-                // Categorize by angle (±5° tolerance)
-                if (std::abs(angle_deg - 45.0f) < 5.0f || std::abs(angle_deg - 135.0f) < 5.0f) {
-                    diagonal_45_segs++;
-                } else if (std::abs(angle_deg - 0.0f) < 5.0f ||
-                           std::abs(angle_deg - 180.0f) < 5.0f) {
-                    horizontal_segs++;
-                } else if (std::abs(angle_deg - 90.0f) < 5.0f) {
-                    vertical_segs++;
-                } else {
-                    other_angle_segs++;
-                }
-            }
-        }
-    }
-
-    if (total_segs > 0) {
-        spdlog::debug(
-            "[GCode Geometry] Top layer Z={:.2f}mm: {} segments ({} extrusion, {} travel, angles: "
-            "{}°±45°, {}°h, {}°v, {} other)",
-            max_z, total_segs, extrusion_segs, travel_segs, diagonal_45_segs, horizontal_segs,
-            vertical_segs, other_angle_segs);
-    }
-
     // Store quantization parameters for dequantization during rendering
     geometry.quantization = quant_params_;
 
@@ -565,12 +490,232 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
     auto build_end = std::chrono::high_resolution_clock::now();
     auto build_duration =
         std::chrono::duration_cast<std::chrono::milliseconds>(build_end - build_start);
-    spdlog::info("[GCode::Builder] Geometry build completed in {:.3f} seconds",
-                 build_duration.count() / 1000.0);
+    spdlog::info("[GCode::Builder] Geometry build completed in {:.3f} seconds ({} thread(s))",
+                 build_duration.count() / 1000.0, threads);
 
     return geometry;
 }
 
+// ============================================================================
+// Per-Layer Pipeline
+// ============================================================================
+
+void GeometryBuilder::for_each_layer_chunk(const ParsedGCodeFile& gcode,
+                                           const SimplificationOptions& options, unsigned threads,
+                                           const std::function<void(size_t, LayerChunk&)>& merge) {
+    const size_t layer_count = gcode.layers.size();
+    const size_t top_layer = layer_count > 0 ? layer_count - 1 : 0;
+
+    if (threads <= 1) {
+        for (size_t i = 0; i < layer_count; ++i) {
+            LayerChunk chunk;
+            build_layer(gcode.layers[i], options, i == top_layer, chunk);
+            merge(i, chunk);
+        }
+        return;
+    }
+
+    // Workers never claim a layer more than `window` past the merge, so at most
+    // `window` layers are being built or waiting to be merged at any time
+    const size_t window = static_cast<size_t>(threads) * IN_FLIGHT_LAYERS_PER_THREAD;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<LayerChunk>> ready(layer_count);
+    size_t next_claim = 0;
+    size_t next_merge = 0;
+    bool abort = false;
+    std::exception_ptr error;
+
+    auto fail = [&](std::exception_ptr e) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error) {
+            error = std::move(e);
+        }
+        abort = true;
+    };
+
+    auto worker = [&]() {
+        for (;;) {
+            size_t layer;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&] {
+                    return abort || next_claim >= layer_count || next_claim < next_merge + window;
+                });
+                if (abort || next_claim >= layer_count) {
+                    return;
+                }
+                layer = next_claim++;
+            }
+            try {
+                auto chunk = std::make_unique<LayerChunk>();
+                build_layer(gcode.layers[layer], options, layer == top_layer, *chunk);
+                std::lock_guard<std::mutex> lock(mutex);
+                ready[layer] = std::move(chunk);
+            } catch (...) {
+                fail(std::current_exception()); // e.g. bad_alloc: surface it from build()
+            }
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i) {
+        try {
+            workers.emplace_back(worker);
+        } catch (const std::system_error& e) {
+            spdlog::warn("[GCode::Builder] Failed to start worker {}: {}", i, e.what());
+            break;
+        }
+    }
+    if (workers.empty()) {
+        for_each_layer_chunk(gcode, options, 1, merge);
+        return;
+    }
+
+    for (size_t layer = 0; layer < layer_count; ++layer) {
+        std::unique_ptr<LayerChunk> chunk;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&] { return abort || ready[layer] != nullptr; });
+            if (abort) {
+                break;
+            }
+            chunk = std::move(ready[layer]);
+            next_merge = layer + 1;
+        }
+        cv.notify_all();
+        try {
+            merge(layer, *chunk);
+        } catch (...) {
+            fail(std::current_exception());
+            cv.notify_all();
+            break;
+        }
+    }
+
+    for (auto& w : workers) {
+        w.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void GeometryBuilder::build_layer(const Layer& layer, const SimplificationOptions& options,
+                                  bool top_layer, LayerChunk& chunk) {
+    chunk.input_segments = layer.segments.size();
+
+    // Pre-filter: Remove degenerate (zero-length) segments before simplification
+    std::vector<ToolpathSegment> filtered;
+    filtered.reserve(layer.segments.size());
+    for (const auto& seg : layer.segments) {
+        if (glm::distance(seg.start, seg.end) < 0.0001f) {
+            chunk.degenerate_segments++;
+            continue;
+        }
+        filtered.push_back(seg);
+    }
+
+    // Step 1: Simplify segments (merge collinear lines)
+    std::vector<ToolpathSegment> simplified;
+    if (options.enable_merging) {
+        simplified = simplify_segments(filtered, options);
+        std::vector<ToolpathSegment>().swap(filtered); // Free before tessellating
+    } else {
+        simplified = std::move(filtered);
+    }
+    chunk.output_segments = simplified.size();
+
+    if (top_layer) {
+        log_top_layer_breakdown(simplified, layer.z_height);
+    }
+
+    // Step 2: Generate ribbon geometry with vertex sharing
+    // Track previous segment end vertices for reuse (never across layers, so every
+    // layer's strips only reference its own vertices)
+    std::optional<TubeCap> prev_end_cap;
+    glm::vec3 prev_end_pos{0.0f};
+
+    for (size_t i = 0; i < simplified.size(); ++i) {
+        const auto& segment = simplified[i];
+
+        // Skip travel moves (non-extrusion moves)
+        // TODO: Make this configurable if we want to visualize travel paths
+        if (!segment.is_extrusion) {
+            chunk.travel_segments++;
+            continue;
+        }
+
+        // Expand per-layer bounding box for frustum culling
+        chunk.bbox.expand(segment.start);
+        chunk.bbox.expand(segment.end);
+
+        // Check if we can share vertices with previous segment
+        bool can_share = false;
+        if (prev_end_cap.has_value()) {
+            chunk.sharing_candidates++;
+
+            // Segments must connect spatially (within epsilon) and be same type
+            float dist = glm::distance(segment.start, prev_end_pos);
+            // Use width-based tolerance: if gap is less than extrusion width, consider them
+            // connected
+            float connection_tolerance = segment.width * 1.5f; //  50% overlap tolerance
+            can_share = (dist < connection_tolerance) &&
+                        (segment.is_extrusion == simplified[i - 1].is_extrusion);
+
+            if (can_share) {
+                chunk.segments_shared++;
+            }
+        }
+
+        // Generate geometry, reusing previous end cap if segments connect
+        prev_end_cap = generate_ribbon_vertices(segment, chunk.geometry, quant_params_,
+                                                can_share ? prev_end_cap : std::nullopt);
+        prev_end_pos = segment.end;
+    }
+}
+
+void GeometryBuilder::append_chunk(RibbonGeometry& geometry, const LayerChunk& chunk,
+                                   size_t layer_idx) {
+    const RibbonGeometry& part = chunk.geometry;
+
+    // Chunk palettes -> shared palettes. Chunks arrive in layer order, so entries
+    // land in first-seen order exactly as a single-threaded build would add them.
+    std::vector<uint16_t> normal_map(part.normal_palette.size());
+    for (size_t i = 0; i < part.normal_palette.size(); ++i) {
+        normal_map[i] = add_quantized_normal(geometry, part.normal_palette[i]);
+    }
+    std::vector<uint8_t> color_map(part.color_palette.size());
+    for (size_t i = 0; i < part.color_palette.size(); ++i) {
+        color_map[i] = add_to_color_palette(geometry, part.color_palette[i]);
+    }
+
+    // Palette-full sentinels (65535 / 255) have no chunk entry and pass through
+    const auto vertex_base = static_cast<uint32_t>(geometry.vertices.size());
+    for (const auto& v : part.vertices) {
+        uint16_t normal = v.normal_index < normal_map.size() ? normal_map[v.normal_index] : 65535;
+        uint8_t color = v.color_index < color_map.size() ? color_map[v.color_index] : 255;
+        geometry.vertices.push_back({v.position, normal, color});
+    }
+
+    const size_t first_strip = geometry.strips.size();
+    for (const auto& s : part.strips) {
+        geometry.strips.push_back(
+            {s[0] + vertex_base, s[1] + vertex_base, s[2] + vertex_base, s[3] + vertex_base});
+    }
+    geometry.strip_layer_index.insert(geometry.strip_layer_index.end(), part.strips.size(),
+                                      static_cast<uint16_t>(layer_idx));
+    if (!part.strips.empty()) {
+        geometry.layer_strip_ranges[layer_idx] = {first_strip, part.strips.size()};
+    }
+    geometry.layer_bboxes[layer_idx] = chunk.bbox;
+
+    geometry.extrusion_triangle_count += part.extrusion_triangle_count;
+    geometry.travel_triangle_count += part.travel_triangle_count;
+}
+
 // ============================================================================
 // Segment Simplification
 // ============================================================================
@@ -661,25 +806,8 @@ GeometryBuilder::TubeCap
 GeometryBuilder::generate_ribbon_vertices(const ToolpathSegment& segment, RibbonGeometry& geometry,
                                           const QuantizationParams& quant,
                                           std::optional<TubeCap> prev_start_cap) {
-    // Read tube cross-section configuration
-    static int tube_sides = -1; // Cache config value (read once)
-    if (tube_sides == -1) {
-        tube_sides = Config::get_instance()->get<int>("/gcode_viewer/tube_sides", 16);
-
-        // Validate: only 4, 8, or 16 sides supported
-        if (tube_sides != 4 && tube_sides != 8 && tube_sides != 16) {
-            spdlog::warn(
-                "[GCode Geometry] Invalid tube_sides={} (must be 4, 8, or 16), defaulting to 16",
-                tube_sides);
-            tube_sides = 16;
-        }
-
-        spdlog::info("[GCode Geometry] G-code tube geometry: N={} sides (elliptical cross-section)",
-                     tube_sides);
-    }
-
-    // All phases complete - use configured N value
-    const int N = tube_sides;
+    // Tube cross-section configuration
+    const int N = configured_tube_sides();
 
     // Determine tube dimensions
     float width;
@@ -740,12 +868,11 @@ GeometryBuilder::generate_ribbon_vertices(const ToolpathSegment& segment, Ribbon
             face_colors[static_cast<size_t>(i)] = add_to_color_palette(geometry, color);
         }
 
-        static bool logged_once = false;
-        if (!logged_once) {
+        static std::atomic<bool> logged_once{false};
+        if (!logged_once.exchange(true)) {
             spdlog::debug("[GCode Geometry] DEBUG FACE COLORS ACTIVE: N={} faces, colors cycle "
                           "through Red/Yellow/Blue/Green",
                           N);
-            logged_once = true;
         }
     }
 
@@ -850,9 +977,10 @@ GeometryBuilder::generate_ribbon_vertices(const ToolpathSegment& segment, Ribbon
         end_cap[static_cast<size_t>(i)] = end_cap_base + static_cast<uint32_t>(2 * i);
     }
 
-    static int debug_count = 0;
-    if (debug_count < 2 && debug_face_colors_) {
-        spdlog::info("[GCode Geometry] === Segment {} | N={} | is_first={} ===", debug_count, N,
+    static std::atomic<int> debug_count{0};
+    int debug_segment = debug_face_colors_ ? debug_count.fetch_add(1) : 2;
+    if (debug_segment < 2) {
+        spdlog::info("[GCode Geometry] === Segment {} | N={} | is_first={} ===", debug_segment, N,
                      is_first_segment);
         spdlog::info(
             "[GCode Geometry]   Segment: start=({:.3f},{:.3f},{:.3f}) end=({:.3f},{:.3f},{:.3f})",
@@ -871,7 +999,6 @@ GeometryBuilder::generate_ribbon_vertices(const ToolpathSegment& segment, Ribbon
             spdlog::info("[GCode Geometry]     v{}[{}]: ({:.3f},{:.3f},{:.3f})", i,
                          end_cap[static_cast<size_t>(i)], pos.x, pos.y, pos.z);
         }
-        debug_count++;
     }
 
     // ========== TRIANGLE STRIPS GENERATION (Phase 4: N-based) ==========
@@ -1018,11 +1145,10 @@ uint32_t GeometryBuilder::compute_color_rgb(float z_height, float z_min, float z
         uint32_t color = (static_cast<uint32_t>(filament_r_) << 16) |
                          (static_cast<uint32_t>(filament_g_) << 8) |
                          static_cast<uint32_t>(filament_b_);
-        static bool logged_once = false;
-        if (!logged_once) {
+        static std::atomic<bool> logged_once{false};
+        if (!logged_once.exchange(true)) {
             spdlog::debug("[GCode Geometry] compute_color_rgb: R={}, G={}, B={} -> 0x{:06X}",
                           filament_r_, filament_g_, filament_b_, color);
-            logged_once = true;
         }
         return color;
     }
@@ -1095,6 +1221,51 @@ void GeometryBuilder::set_filament_color(const std::string& hex_color) {
                  filament_r_, filament_g_, filament_b_, filament_r_, filament_g_, filament_b_);
 }
 
+uint64_t GeometryBuilder::cache_key(const SimplificationOptions& options) const {
+    SimplificationOptions validated = options;
+    validated.validate();
+
+    // FNV-1a over each setting; strings are length-prefixed so lists can't alias
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const void* data, size_t length) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < length; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    };
+    auto mix_value = [&mix](const auto& value) { mix(&value, sizeof(value)); };
+    auto mix_string = [&mix, &mix_value](const std::string& str) {
+        mix_value(static_cast<uint64_t>(str.size()));
+        mix(str.data(), str.size());
+    };
+
+    mix_value(validated.enable_merging);
+    mix_value(validated.tolerance_mm);
+    mix_value(validated.min_segment_length_mm);
+    mix_value(extrusion_width_mm_);
+    mix_value(travel_width_mm_);
+    mix_value(layer_height_mm_);
+    mix_value(use_height_gradient_);
+    mix_value(use_smooth_shading_);
+    mix_value(debug_face_colors_);
+    const uint8_t filament[] = {filament_r_, filament_g_, filament_b_};
+    mix(filament, sizeof(filament));
+    mix_value(configured_tube_sides());
+
+    mix_value(static_cast<uint64_t>(tool_color_palette_.size()));
+    for (const auto& color : tool_color_palette_) {
+        mix_string(color);
+    }
+    // Set iteration order is unspecified
+    std::vector<std::string> highlighted(highlighted_objects_.begin(), highlighted_objects_.end());
+    std::sort(highlighted.begin(), highlighted.end());
+    mix_value(static_cast<uint64_t>(highlighted.size()));
+    for (const auto& name : highlighted) {
+        mix_string(name);
+    }
+    return hash;
+}
+
 uint32_t GeometryBuilder::parse_hex_color(const std::string& hex_color) const {
     auto parsed = ui_parse_hex_color(hex_color);
     return parsed.value_or(0x808080); // Default gray for invalid input
@@ -0,0 +1,488 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+// G-Code Geometry Cache Implementation
+
+#include "gcode_geometry_cache.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+// =============================================================================
+// Entry format
+// =============================================================================
+//
+// [EntryHeader][source path][vertices][indices][strips][normal palette]
+// [color palette][strip layer index][layer strip ranges as uint64 pairs]
+// [layer bboxes]
+//
+// Native byte order and struct layout (element sizes are recorded and must
+// match). Sections are copied out of the mapping because RibbonGeometry owns
+// its buffers; the mapping is released before returning.
+
+constexpr char ENTRY_MAGIC[8] = {'H', 'X', 'R', 'G', 'E', 'O', '\0', '\0'};
+constexpr const char* ENTRY_EXTENSION = ".rgeo";
+
+struct EntryHeader {
+    char magic[8];
+    uint32_t version;
+    uint16_t vertex_size; ///< sizeof(RibbonVertex) when written
+    uint16_t bbox_size;   ///< sizeof(AABB) when written
+    uint64_t source_size;
+    int64_t source_mtime;
+    uint64_t build_key;
+    uint64_t vertex_count;
+    uint64_t index_count;
+    uint64_t strip_count;
+    uint64_t strip_layer_count;
+    uint64_t extrusion_triangle_count;
+    uint64_t travel_triangle_count;
+    uint32_t normal_count;
+    uint32_t color_count;
+    uint32_t layer_range_count;
+    uint32_t bbox_count;
+    float quant_min[3];
+    float quant_max[3];
+    float quant_scale;
+    float layer_height_mm;
+    uint16_t max_layer_index;
+    uint16_t reserved;
+    uint32_t path_length;
+    uint64_t checksum; ///< Of everything after the header
+};
+
+/// FNV-1a over 8-byte words, fast enough to run over tens of MB on every load.
+/// Streaming: the result doesn't depend on how the input is split into update()
+/// calls, so the writer can hash section by section and the reader all at once.
+class Checksum {
+  public:
+    void update(const void* data, size_t length) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        while (length > 0 && pending_ > 0) {
+            push_byte(*bytes++);
+            --length;
+        }
+        for (; length >= 8; bytes += 8, length -= 8) {
+            uint64_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+            mix(word);
+        }
+        while (length-- > 0) {
+            push_byte(*bytes++);
+        }
+    }
+
+    /// Hash including the zero-padded trailing partial word
+    [[nodiscard]] uint64_t value() const {
+        if (pending_ == 0) {
+            return hash_;
+        }
+        uint64_t word = 0;
+        std::memcpy(&word, tail_, pending_);
+        return (hash_ ^ word) * PRIME;
+    }
+
+  private:
+    static constexpr uint64_t PRIME = 1099511628211ull;
+
+    void mix(uint64_t word) {
+        hash_ = (hash_ ^ word) * PRIME;
+    }
+
+    void push_byte(unsigned char byte) {
+        tail_[pending_++] = byte;
+        if (pending_ == sizeof(tail_)) {
+            uint64_t word;
+            std::memcpy(&word, tail_, sizeof(word));
+            mix(word);
+            pending_ = 0;
+        }
+    }
+
+    uint64_t hash_ = 14695981039346656037ull;
+    unsigned char tail_[8] = {};
+    size_t pending_ = 0;
+};
+
+/// One contiguous section of an entry
+struct Section {
+    const void* data;
+    size_t bytes;
+};
+
+template <typename T> Section section_of(const std::vector<T>& v) {
+    return {v.data(), v.size() * sizeof(T)};
+}
+
+/// Copy a section out of the mapping and advance the cursor
+template <typename T> void read_section(const char*& cursor, size_t count, std::vector<T>& out) {
+    out.resize(count);
+    std::memcpy(out.data(), cursor, count * sizeof(T));
+    cursor += count * sizeof(T);
+}
+
+std::vector<uint64_t> flatten_ranges(const std::vector<std::pair<size_t, size_t>>& ranges) {
+    std::vector<uint64_t> flat;
+    flat.reserve(ranges.size() * 2);
+    for (const auto& [first, count] : ranges) {
+        flat.push_back(first);
+        flat.push_back(count);
+    }
+    return flat;
+}
+
+/// Free space to leave on the cache filesystem after writing an entry
+/// (matches the thumbnail cache's "disk low" threshold)
+constexpr size_t MIN_FREE_DISK_BYTES = 20 * 1024 * 1024;
+
+/// Distinguishes temp files of concurrent saves in one process
+std::atomic<uint32_t> g_temp_counter{0};
+
+/// Suffix of in-progress entries: "<entry>.rgeo.tmp<pid>-<n>"
+constexpr std::string_view TEMP_MARKER = ".rgeo.tmp";
+
+/// A save writes for seconds at most; older temp files were left by a process
+/// that died mid-write (concurrent writers' temps are younger and kept)
+constexpr auto STALE_TEMP_AGE = std::chrono::minutes(10);
+
+bool is_temp_file(const std::filesystem::path& path) {
+    return path.filename().string().find(TEMP_MARKER) != std::string::npos;
+}
+
+} // anonymous namespace
+
+GeometryCache::GeometryCache(std::string cache_dir, size_t max_bytes)
+    : cache_dir_(std::move(cache_dir)), max_bytes_(max_bytes) {}
+
+std::optional<SourceStamp> GeometryCache::stamp(const std::string& source_path) {
+    std::error_code ec;
+    SourceStamp s;
+    s.size = std::filesystem::file_size(source_path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    auto time = std::filesystem::last_write_time(source_path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    s.mtime = static_cast<int64_t>(time.time_since_epoch().count());
+    return s;
+}
+
+std::string GeometryCache::entry_path(const std::string& source_path, uint64_t build_key) const {
+    char name[48];
+    std::snprintf(name, sizeof(name), "%016llx-%016llx",
+                  static_cast<unsigned long long>(std::hash<std::string>{}(source_path)),
+                  static_cast<unsigned long long>(build_key));
+    return cache_dir_ + "/" + name + ENTRY_EXTENSION;
+}
+
+std::unique_ptr<RibbonGeometry> GeometryCache::load(const std::string& source_path,
+                                                    const SourceStamp& stamp,
+                                                    uint64_t build_key) const {
+    if (!enabled()) {
+        return nullptr;
+    }
+    auto start_time = std::chrono::high_resolution_clock::now();
+    const std::string path = entry_path(source_path, build_key);
+
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr; // Not cached yet
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(EntryHeader)) {
+        ::close(fd);
+        return nullptr;
+    }
+    const size_t file_size = static_cast<size_t>(st.st_size);
+    void* map = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        return nullptr;
+    }
+    ::madvise(map, file_size, MADV_SEQUENTIAL);
+
+    const char* data = static_cast<const char*>(map);
+    EntryHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    const uint64_t payload_bytes =
+        header.path_length + header.vertex_count * sizeof(RibbonVertex) +
+        header.index_count * sizeof(TriangleIndices) +
+        header.strip_count * sizeof(TriangleStrip) +
+        uint64_t{header.normal_count} * sizeof(glm::vec3) +
+        uint64_t{header.color_count} * sizeof(uint32_t) +
+        header.strip_layer_count * sizeof(uint16_t) +
+        uint64_t{header.layer_range_count} * 2 * sizeof(uint64_t) +
+        uint64_t{header.bbox_count} * sizeof(AABB);
+    const char* payload = data + sizeof(EntryHeader);
+
+    const char* reason = nullptr;
+    if (std::memcmp(header.magic, ENTRY_MAGIC, sizeof(header.magic)) != 0) {
+        reason = "bad magic";
+    } else if (header.version != FORMAT_VERSION || header.vertex_size != sizeof(RibbonVertex) ||
+               header.bbox_size != sizeof(AABB)) {
+        reason = "format version changed";
+    } else if (header.vertex_count > file_size || header.strip_count > file_size ||
+               header.index_count > file_size || header.strip_layer_count > file_size ||
+               file_size - sizeof(EntryHeader) != payload_bytes) {
+        // Counts are bounded by the file size first so the sum cannot overflow
+        reason = "truncated";
+    } else if (header.build_key != build_key ||
+               std::string_view(payload, header.path_length) != source_path) {
+        reason = "hash collision";
+    } else if (header.source_size != stamp.size || header.source_mtime != stamp.mtime) {
+        reason = "source file changed";
+    } else {
+        Checksum checksum;
+        checksum.update(payload, payload_bytes);
+        if (checksum.value() != header.checksum) {
+            reason = "checksum mismatch";
+        }
+    }
+
+    std::unique_ptr<RibbonGeometry> geometry;
+    if (reason == nullptr) {
+        geometry = std::make_unique<RibbonGeometry>();
+        const char* cursor = payload + header.path_length;
+        read_section(cursor, header.vertex_count, geometry->vertices);
+        read_section(cursor, header.index_count, geometry->indices);
+        read_section(cursor, header.strip_count, geometry->strips);
+        read_section(cursor, header.normal_count, geometry->normal_palette);
+        read_section(cursor, header.color_count, geometry->color_palette);
+        read_section(cursor, header.strip_layer_count, geometry->strip_layer_index);
+        std::vector<uint64_t> ranges;
+        read_section(cursor, size_t{header.layer_range_count} * 2, ranges);
+        geometry->layer_strip_ranges.reserve(header.layer_range_count);
+        for (size_t i = 0; i < ranges.size(); i += 2) {
+            geometry->layer_strip_ranges.emplace_back(ranges[i], ranges[i + 1]);
+        }
+        read_section(cursor, header.bbox_count, geometry->layer_bboxes);
+
+        geometry->extrusion_triangle_count = header.extrusion_triangle_count;
+        geometry->travel_triangle_count = header.travel_triangle_count;
+        geometry->quantization.min_bounds =
+            glm::vec3(header.quant_min[0], header.quant_min[1], header.quant_min[2]);
+        geometry->quantization.max_bounds =
+            glm::vec3(header.quant_max[0], header.quant_max[1], header.quant_max[2]);
+        geometry->quantization.scale_factor = header.quant_scale;
+        geometry->layer_height_mm = header.layer_height_mm;
+        geometry->max_layer_index = header.max_layer_index;
+    }
+    ::munmap(map, file_size);
+
+    if (reason != nullptr) {
+        spdlog::debug("[GeometryCache] Ignoring cached geometry {}: {}", path, reason);
+        return nullptr;
+    }
+
+    // Refresh mtime so eviction keeps recently viewed files
+    std::error_code ec;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    spdlog::info("[GeometryCache] Loaded {} vertices, {} strips from cache in {:.1f}ms",
+                 geometry->vertices.size(), geometry->strips.size(),
+                 std::chrono::duration<double, std::milli>(end_time - start_time).count());
+    return geometry;
+}
+
+bool GeometryCache::save(const std::string& source_path, const SourceStamp& stamp,
+                         uint64_t build_key, const RibbonGeometry& geometry) const {
+    if (!enabled() || geometry.vertices.empty() ||
+        geometry.normal_palette.size() > std::numeric_limits<uint32_t>::max() ||
+        geometry.color_palette.size() > std::numeric_limits<uint32_t>::max() ||
+        geometry.layer_strip_ranges.size() > std::numeric_limits<uint32_t>::max() ||
+        geometry.layer_bboxes.size() > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+    auto current = GeometryCache::stamp(source_path);
+    if (!current || *current != stamp) {
+        spdlog::debug("[GeometryCache] {} changed while building, not caching", source_path);
+        return false;
+    }
+
+    const std::vector<uint64_t> ranges = flatten_ranges(geometry.layer_strip_ranges);
+    const Section sections[] = {
+        {source_path.data(), source_path.size()},
+        section_of(geometry.vertices),
+        section_of(geometry.indices),
+        section_of(geometry.strips),
+        section_of(geometry.normal_palette),
+        section_of(geometry.color_palette),
+        section_of(geometry.strip_layer_index),
+        section_of(ranges),
+        section_of(geometry.layer_bboxes),
+    };
+
+    size_t entry_bytes = sizeof(EntryHeader);
+    Checksum checksum;
+    for (const auto& s : sections) {
+        entry_bytes += s.bytes;
+        checksum.update(s.data, s.bytes);
+    }
+    if (entry_bytes > max_bytes_) {
+        spdlog::debug("[GeometryCache] Geometry ({} KB) exceeds cache budget ({} KB), not caching",
+                      entry_bytes / 1024, max_bytes_ / 1024);
+        return false;
+    }
+    std::error_code ec;
+    auto space = std::filesystem::space(cache_dir_, ec);
+    if (ec || space.available < entry_bytes + MIN_FREE_DISK_BYTES) {
+        spdlog::debug("[GeometryCache] Not enough free disk space to cache geometry");
+        return false;
+    }
+
+    EntryHeader header{};
+    std::memcpy(header.magic, ENTRY_MAGIC, sizeof(header.magic));
+    header.version = FORMAT_VERSION;
+    header.vertex_size = sizeof(RibbonVertex);
+    header.bbox_size = sizeof(AABB);
+    header.source_size = stamp.size;
+    header.source_mtime = stamp.mtime;
+    header.build_key = build_key;
+    header.vertex_count = geometry.vertices.size();
+    header.index_count = geometry.indices.size();
+    header.strip_count = geometry.strips.size();
+    header.strip_layer_count = geometry.strip_layer_index.size();
+    header.extrusion_triangle_count = geometry.extrusion_triangle_count;
+    header.travel_triangle_count = geometry.travel_triangle_count;
+    header.normal_count = static_cast<uint32_t>(geometry.normal_palette.size());
+    header.color_count = static_cast<uint32_t>(geometry.color_palette.size());
+    header.layer_range_count = static_cast<uint32_t>(geometry.layer_strip_ranges.size());
+    header.bbox_count = static_cast<uint32_t>(geometry.layer_bboxes.size());
+    const QuantizationParams& q = geometry.quantization;
+    header.quant_min[0] = q.min_bounds.x;
+    header.quant_min[1] = q.min_bounds.y;
+    header.quant_min[2] = q.min_bounds.z;
+    header.quant_max[0] = q.max_bounds.x;
+    header.quant_max[1] = q.max_bounds.y;
+    header.quant_max[2] = q.max_bounds.z;
+    header.quant_scale = q.scale_factor;
+    header.layer_height_mm = geometry.layer_height_mm;
+    header.max_layer_index = geometry.max_layer_index;
+    header.path_length = static_cast<uint32_t>(source_path.size());
+    header.checksum = checksum.value();
+
+    const std::string path = entry_path(source_path, build_key);
+    const std::string temp_path = path + ".tmp" + std::to_string(::getpid()) + "-" +
+                                  std::to_string(g_temp_counter.fetch_add(1));
+    FILE* file = std::fopen(temp_path.c_str(), "wb");
+    if (!file) {
+        spdlog::debug("[GeometryCache] Cannot write {}", temp_path);
+        return false;
+    }
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    for (const auto& s : sections) {
+        ok = ok && std::fwrite(s.data, 1, s.bytes, file) == s.bytes;
+    }
+    ok = (std::fclose(file) == 0) && ok;
+
+    if (!ok || std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        spdlog::warn("[GeometryCache] Failed to write {}", path);
+        std::remove(temp_path.c_str());
+        return false;
+    }
+
+    spdlog::debug("[GeometryCache] Saved {} ({} KB)", path, entry_bytes / 1024);
+    evict_to_budget();
+    return true;
+}
+
+size_t GeometryCache::total_bytes() const {
+    size_t total = 0;
+    std::error_code ec;
+    for (const auto& item : std::filesystem::directory_iterator(cache_dir_, ec)) {
+        // Temp files take disk space too, until they are renamed or swept
+        if (item.path().extension() == ENTRY_EXTENSION || is_temp_file(item.path())) {
+            std::error_code size_ec;
+            auto size = item.file_size(size_ec);
+            if (!size_ec) {
+                total += static_cast<size_t>(size);
+            }
+        }
+    }
+    return total;
+}
+
+void GeometryCache::evict_to_budget() const {
+    struct Entry {
+        std::filesystem::file_time_type mtime;
+        size_t size;
+        std::filesystem::path path;
+    };
+    std::vector<Entry> entries;
+    size_t total = 0;
+    size_t swept = 0;
+    const auto stale_before = std::filesystem::file_time_type::clock::now() - STALE_TEMP_AGE;
+    std::error_code ec;
+    for (const auto& item : std::filesystem::directory_iterator(cache_dir_, ec)) {
+        bool temp = is_temp_file(item.path());
+        if (!temp && item.path().extension() != ENTRY_EXTENSION) {
+            continue;
+        }
+        std::error_code item_ec;
+        auto size = static_cast<size_t>(item.file_size(item_ec));
+        auto mtime = item.last_write_time(item_ec);
+        if (item_ec) {
+            continue;
+        }
+        if (temp) {
+            // Orphaned by a crash or power loss mid-save; never renamed into place
+            if (mtime < stale_before && std::filesystem::remove(item.path(), item_ec)) {
+                ++swept;
+            } else {
+                total += size;
+            }
+            continue;
+        }
+        entries.push_back({mtime, size, item.path()});
+        total += size;
+    }
+    if (swept > 0) {
+        spdlog::debug("[GeometryCache] Removed {} stale temp file(s)", swept);
+    }
+    if (total <= max_bytes_) {
+        return;
+    }
+
+    // Oldest first
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.mtime < b.mtime; });
+    size_t removed = 0;
+    for (const auto& entry : entries) {
+        if (total <= max_bytes_) {
+            break;
+        }
+        if (std::filesystem::remove(entry.path, ec)) {
+            total -= entry.size;
+            ++removed;
+        }
+    }
+    spdlog::debug("[GeometryCache] Evicted {} old entries, {} KB remain", removed, total / 1024);
+}
+
+} // namespace gcode
+} // namespace helix
@@ -15,89 +15,150 @@ GCodeLayerCache::GCodeLayerCache(size_t memory_budget_bytes) : memory_budget_(me
                   static_cast<double>(memory_budget_) / (1024 * 1024));
 }
 
-size_t GCodeLayerCache::estimate_memory(const std::vector<ToolpathSegment>& segments) {
-    // Base cost: vector overhead + segment data
-    // Each ToolpathSegment is approximately:
-    // - glm::vec3 start: 12 bytes
-    // - glm::vec3 end: 12 bytes
-    // - bool is_extrusion: 1 byte (+ padding)
-    // - std::string object_name: 32 bytes (SSO buffer) + potential heap
-    // - float extrusion_amount: 4 bytes
-    // - float width: 4 bytes
-    // - int tool_index: 4 bytes
-    // Total: ~80 bytes base + string heap allocation
-
-    size_t base_cost = sizeof(std::vector<ToolpathSegment>) + 64; // Vector overhead + some slack
-
-    size_t per_segment = BYTES_PER_SEGMENT;
-
-    // Add extra for segments with long object names
-    size_t string_overhead = 0;
-    for (const auto& seg : segments) {
-        if (seg.object_name.length() > 15) { // Beyond SSO threshold
-            string_overhead += seg.object_name.length() + 1;
-        }
-    }
-
-    return base_cost + (segments.size() * per_segment) + string_overhead;
+size_t GCodeLayerCache::estimate_memory(const PackedLayer& layer) {
+    // Packed arrays (~21 bytes per segment) + name table + shared_ptr control block
+    return layer.memory_bytes() + 64;
 }
 
 GCodeLayerCache::CacheResult
 GCodeLayerCache::get_or_load(size_t layer_index,
                              std::function<std::vector<ToolpathSegment>(size_t)> loader) {
+    return lookup_or_load(layer_index, loader, true);
+}
+
+GCodeLayerCache::CacheResult
+GCodeLayerCache::preload(size_t layer_index,
+                         std::function<std::vector<ToolpathSegment>(size_t)> loader) {
+    return lookup_or_load(layer_index, loader, false);
+}
+
+GCodeLayerCache::CacheResult GCodeLayerCache::lookup_or_load(
+    size_t layer_index, const std::function<std::vector<ToolpathSegment>(size_t)>& loader,
+    bool count_lookup) {
     // Periodically check memory pressure and adapt budget (rate-limited internally)
     check_memory_pressure();
 
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
 
     // Check if already cached
     auto it = cache_.find(layer_index);
     if (it != cache_.end()) {
-        hit_count_++;
+        if (count_lookup) {
+            hit_count_++;
+        }
         touch(layer_index);
         spdlog::trace("[LayerCache] Hit layer {} ({} segments)", layer_index,
-                      it->second.segments->size());
+                      it->second.layer->size());
         // Return shared_ptr - data stays alive even if entry is evicted
-        return CacheResult{it->second.segments, true, false};
+        return CacheResult{it->second.layer, true, false};
     }
 
-    // Cache miss - need to load
-    miss_count_++;
+    // Another thread is already loading this layer: wait for its result
+    // instead of parsing the same bytes twice
+    // (clear() forgets older loads, so only current-generation ones are found)
+    auto pending = in_flight_.find(layer_index);
+    if (pending != in_flight_.end() && pending->second.generation == generation_) {
+        std::shared_future<CacheResult> in_flight = pending->second.result;
+        if (count_lookup) {
+            shared_count_++;
+        }
+        lock.unlock();
+        spdlog::trace("[LayerCache] Waiting for in-flight load of layer {}", layer_index);
+        CacheResult result = in_flight.get();
+        result.was_shared = true;
+        return result;
+    }
+
+    // Cache miss - load outside the lock so other layers stay available
+    if (count_lookup) {
+        miss_count_++;
+    }
     spdlog::debug("[LayerCache] Miss layer {}, loading...", layer_index);
 
-    // Load the layer data
-    std::vector<ToolpathSegment> segments;
+    std::promise<CacheResult> promise;
+    uint64_t generation = generation_;
+    in_flight_[layer_index] = InFlight{generation, promise.get_future().share()};
+    lock.unlock();
+
+    // Runs even if load_and_insert() throws (e.g. bad_alloc on insert), so
+    // waiters get a failed result rather than std::future_error(broken_promise)
+    // and the layer isn't stuck in flight
+    struct Publish {
+        GCodeLayerCache& cache;
+        size_t layer_index;
+        uint64_t generation;
+        std::promise<CacheResult>& promise;
+        CacheResult result{nullptr, false, true};
+
+        ~Publish() {
+            {
+                std::lock_guard<std::mutex> guard(cache.mutex_);
+                // After clear() a newer load may own the slot; leave it alone
+                auto own = cache.in_flight_.find(layer_index);
+                if (own != cache.in_flight_.end() && own->second.generation == generation) {
+                    cache.in_flight_.erase(own);
+                }
+            }
+            promise.set_value(result);
+        }
+    } publish{*this, layer_index, generation, promise};
+
+    publish.result = load_and_insert(layer_index, loader, generation);
+    return publish.result;
+}
+
+GCodeLayerCache::CacheResult GCodeLayerCache::load_and_insert(
+    size_t layer_index, const std::function<std::vector<ToolpathSegment>(size_t)>& loader,
+    uint64_t generation) {
+    // Load and pack (quantize + intern names), releasing the parsed segments
+    std::shared_ptr<const PackedLayer> packed;
     try {
-        segments = loader(layer_index);
+        std::vector<ToolpathSegment> segments = loader(layer_index);
+        if (segments.empty()) {
+            spdlog::debug("[LayerCache] Layer {} loaded but empty", layer_index);
+            // Still cache empty layers to avoid repeated loads
+        }
+        packed = std::make_shared<const PackedLayer>(segments);
     } catch (const std::exception& e) {
         spdlog::error("[LayerCache] Failed to load layer {}: {}", layer_index, e.what());
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!packed) {
         return CacheResult{nullptr, false, true};
     }
 
-    if (segments.empty()) {
-        spdlog::debug("[LayerCache] Layer {} loaded but empty", layer_index);
-        // Still cache empty layers to avoid repeated loads
+    if (generation != generation_) {
+        // clear() ran during the load (file closed or reopened) - data is stale
+        spdlog::debug("[LayerCache] Dropping layer {} loaded before clear()", layer_index);
+        return CacheResult{nullptr, false, true};
     }
 
     // Calculate memory needed
-    size_t needed = estimate_memory(segments);
+    size_t needed = estimate_memory(*packed);
 
     // Check if this single layer exceeds budget
     if (needed > memory_budget_) {
         spdlog::warn("[LayerCache] Layer {} ({} segments, {} bytes) exceeds budget ({} bytes)",
-                     layer_index, segments.size(), needed, memory_budget_);
-        // Return the data but don't cache it
-        // Note: This is a bit tricky - we return a temporary that will be destroyed
+                     layer_index, packed->size(), needed, memory_budget_);
         // The caller should check load_failed and handle accordingly
         return CacheResult{nullptr, false, true};
     }
 
+    // insert() may have supplied the layer while we were loading
+    auto existing = cache_.find(layer_index);
+    if (existing != cache_.end()) {
+        touch(layer_index);
+        return CacheResult{existing->second.layer, false, false};
+    }
+
     // Make room if needed
     evict_for_space(needed);
 
     // Insert into cache - use shared_ptr for thread-safe lifetime management
     CacheEntry entry;
-    entry.segments = std::make_shared<std::vector<ToolpathSegment>>(std::move(segments));
+    entry.layer = std::move(packed);
     entry.memory_bytes = needed;
 
     auto [inserted_it, success] = cache_.emplace(layer_index, std::move(entry));
@@ -112,11 +173,11 @@ GCodeLayerCache::get_or_load(size_t layer_index,
     current_memory_ += needed;
 
     spdlog::debug("[LayerCache] Cached layer {} ({} segments, {} bytes, total {:.1f}MB)",
-                  layer_index, inserted_it->second.segments->size(), needed,
+                  layer_index, inserted_it->second.layer->size(), needed,
                   static_cast<double>(current_memory_) / (1024 * 1024));
 
     // Return shared_ptr - data stays alive even if entry is evicted
-    return CacheResult{inserted_it->second.segments, false, false};
+    return CacheResult{inserted_it->second.layer, false, false};
 }
 
 bool GCodeLayerCache::is_cached(size_t layer_index) const {
@@ -133,9 +194,9 @@ void GCodeLayerCache::prefetch(size_t center_layer, size_t radius,
 
     spdlog::debug("[LayerCache] Prefetching layers [{}, {}] around {}", start, end, center_layer);
 
-    // Load layers - get_or_load handles "already cached" internally, avoiding TOCTOU race
+    // Load layers - preload handles "already cached" internally, avoiding TOCTOU race
     for (size_t i = start; i <= end; ++i) {
-        get_or_load(i, loader);
+        preload(i, loader);
     }
 }
 
@@ -149,7 +210,9 @@ bool GCodeLayerCache::insert(size_t layer_index, std::vector<ToolpathSegment>&&
         return true;
     }
 
-    size_t needed = estimate_memory(segments);
+    auto packed = std::make_shared<const PackedLayer>(segments);
+    segments = {};
+    size_t needed = estimate_memory(*packed);
 
     // Check if it would fit even with empty cache
     if (needed > memory_budget_) {
@@ -163,7 +226,7 @@ bool GCodeLayerCache::insert(size_t layer_index, std::vector<ToolpathSegment>&&
 
     // Insert - use shared_ptr for thread-safe lifetime management
     CacheEntry entry;
-    entry.segments = std::make_shared<std::vector<ToolpathSegment>>(std::move(segments));
+    entry.layer = std::move(packed);
     entry.memory_bytes = needed;
 
     cache_.emplace(layer_index, std::move(entry));
@@ -181,6 +244,9 @@ void GCodeLayerCache::clear() {
     lru_order_.clear();
     lru_map_.clear();
     current_memory_ = 0;
+    generation_++; // Loads still in flight must not repopulate the cache
+    // ...nor answer requests made after this point; their waiters keep the futures
+    in_flight_.clear();
 
     spdlog::debug("[LayerCache] Cleared");
 }
@@ -205,6 +271,7 @@ bool GCodeLayerCache::evict(size_t layer_index) {
 
     // Remove from cache
     cache_.erase(it);
+    notify_evicted(layer_index);
 
     spdlog::debug("[LayerCache] Evicted layer {}", layer_index);
     return true;
@@ -225,6 +292,11 @@ std::pair<size_t, size_t> GCodeLayerCache::hit_stats() const {
     return {hit_count_, miss_count_};
 }
 
+size_t GCodeLayerCache::shared_load_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return shared_count_;
+}
+
 float GCodeLayerCache::hit_rate() const {
     std::lock_guard<std::mutex> lock(mutex_);
     size_t total = hit_count_ + miss_count_;
@@ -238,6 +310,7 @@ void GCodeLayerCache::reset_stats() {
     std::lock_guard<std::mutex> lock(mutex_);
     hit_count_ = 0;
     miss_count_ = 0;
+    shared_count_ = 0;
 }
 
 void GCodeLayerCache::set_memory_budget(size_t budget_bytes) {
@@ -255,6 +328,7 @@ void GCodeLayerCache::set_memory_budget(size_t budget_bytes) {
         if (it != cache_.end()) {
             subtract_memory(it->second.memory_bytes);
             cache_.erase(it);
+            notify_evicted(oldest);
             spdlog::debug("[LayerCache] Budget reduced, evicted layer {}", oldest);
         }
     }
@@ -274,12 +348,25 @@ void GCodeLayerCache::evict_for_space(size_t required_bytes) {
             size_t freed = it->second.memory_bytes;
             cache_.erase(it);
             subtract_memory(freed);
+            notify_evicted(oldest);
             spdlog::debug("[LayerCache] Evicted layer {} to make room ({} bytes freed)", oldest,
                           freed);
         }
     }
 }
 
+void GCodeLayerCache::set_eviction_callback(std::function<void(size_t)> callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    eviction_callback_ = std::move(callback);
+}
+
+void GCodeLayerCache::notify_evicted(size_t layer_index) {
+    // Already holding lock when called
+    if (eviction_callback_) {
+        eviction_callback_(layer_index);
+    }
+}
+
 void GCodeLayerCache::touch(size_t layer_index) {
     // Already holding lock when called
 
@@ -376,6 +463,7 @@ bool GCodeLayerCache::check_memory_pressure() {
         if (it != cache_.end()) {
             subtract_memory(it->second.memory_bytes);
             cache_.erase(it);
+            notify_evicted(oldest);
         }
     }
 
@@ -413,6 +501,7 @@ void GCodeLayerCache::respond_to_pressure(float emergency_factor) {
             size_t freed = it->second.memory_bytes;
             cache_.erase(it);
             subtract_memory(freed);
+            notify_evicted(oldest);
             spdlog::debug("[LayerCache] Emergency evict layer {} ({} bytes)", oldest, freed);
         }
     }
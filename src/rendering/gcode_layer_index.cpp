@@ -3,14 +3,27 @@
 
 #include "gcode_layer_index.h"
 
+#include "gcode_data_source.h"
+#include "gcode_tokenizer.h"
+
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <functional>
 #include <limits>
+#include <system_error>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace helix {
 namespace gcode {
@@ -20,32 +33,11 @@ namespace {
 // Layer detection tolerance for Z changes
 constexpr float Z_EPSILON = 0.001f;
 
-// Extract float parameter from G-code line (e.g., "Z1.2" -> 1.2)
-bool extract_z_param(const char* line, size_t len, float& out_z) {
-    // Find 'Z' parameter (case-insensitive)
-    for (size_t i = 0; i < len; ++i) {
-        if ((line[i] == 'Z' || line[i] == 'z') && i + 1 < len) {
-            // Check if followed by a digit or sign
-            char next = line[i + 1];
-            if (next == '-' || next == '+' || next == '.' || (next >= '0' && next <= '9')) {
-                char* end = nullptr;
-                out_z = std::strtof(line + i + 1, &end);
-                if (end != line + i + 1) {
-                    return true;
-                }
-            }
-        }
-    }
-    return false;
-}
-
-// Check if line is a movement command (G0 or G1)
-bool is_movement_command(const char* line, size_t len) {
-    // Skip leading whitespace
+// Check if command is a movement command (G0 or G1)
+bool is_movement_command(std::string_view code) {
+    const char* line = code.data();
+    size_t len = code.size();
     size_t i = 0;
-    while (i < len && (line[i] == ' ' || line[i] == '\t')) {
-        ++i;
-    }
 
     // Check for G0 or G1
     if (i + 1 < len && (line[i] == 'G' || line[i] == 'g')) {
@@ -67,18 +59,25 @@ bool is_movement_command(const char* line, size_t len) {
     return false;
 }
 
-// Check if line contains E parameter with positive value (extrusion)
-bool has_positive_extrusion(const char* line, size_t len) {
-    for (size_t i = 0; i < len; ++i) {
-        if ((line[i] == 'E' || line[i] == 'e') && i + 1 < len) {
-            char next = line[i + 1];
-            // Positive number (or number starting with digit)
-            if ((next >= '0' && next <= '9') || next == '+') {
-                return true;
-            }
-        }
+// Check if command has an E parameter with positive value (extrusion)
+bool has_positive_extrusion(const GCodeTokens& tokens) {
+    std::string_view value = tokens.after(GCodeAxis::E);
+    // Positive number (or number starting with digit)
+    return !value.empty() && ((value[0] >= '0' && value[0] <= '9') || value[0] == '+');
+}
+
+// Extract Z parameter from a movement command (e.g., "Z1.2" -> 1.2)
+bool extract_z_param(const GCodeTokens& tokens, float& out_z) {
+    std::string_view value = tokens.after(GCodeAxis::Z);
+    if (value.empty()) {
+        return false;
     }
-    return false;
+    // Check if followed by a digit or sign
+    char next = value[0];
+    if (next != '-' && next != '+' && next != '.' && (next < '0' || next > '9')) {
+        return false;
+    }
+    return parse_gcode_float(value.data(), value.data() + value.size(), out_z);
 }
 
 // Extract filament/extruder color from metadata comment
@@ -86,7 +85,9 @@ bool has_positive_extrusion(const char* line, size_t len) {
 //   ; extruder_colour = #26A69A
 //   ; filament_colour = "#FF0000"
 //   ;extruder_color = #00FF00
-bool extract_filament_color(const char* line, size_t len, std::string& out_color) {
+bool extract_filament_color(std::string_view line, std::string& out_color) {
+    size_t len = line.size();
+
     // Only check comment lines
     if (len < 10 || line[0] != ';') {
         return false;
@@ -101,36 +102,38 @@ bool extract_filament_color(const char* line, size_t len, std::string& out_color
     lower[check_len] = '\0';
 
     // Look for color keywords
-    const char* color_pos = nullptr;
+    size_t color_pos = std::string_view::npos;
     if (std::strstr(lower, "extruder_colour") || std::strstr(lower, "extruder_color")) {
-        color_pos = std::strchr(line, '=');
+        color_pos = line.find('=');
     } else if (std::strstr(lower, "filament_colour") || std::strstr(lower, "filament_color")) {
-        color_pos = std::strchr(line, '=');
+        color_pos = line.find('=');
     }
 
-    if (!color_pos) {
+    if (color_pos == std::string_view::npos) {
         return false;
     }
 
     // Find the hex color after '='
     ++color_pos; // Skip '='
-    while (*color_pos && (*color_pos == ' ' || *color_pos == '"' || *color_pos == '\'')) {
+    while (color_pos < len &&
+           (line[color_pos] == ' ' || line[color_pos] == '"' || line[color_pos] == '\'')) {
         ++color_pos;
     }
 
     // Look for '#' followed by hex digits
-    const char* hash = std::strchr(color_pos, '#');
-    if (!hash) {
+    size_t hash = line.find('#', color_pos);
+    if (hash == std::string_view::npos) {
         return false;
     }
 
     // Extract 6 or 8 hex digits after #
     std::string color = "#";
-    const char* p = hash + 1;
-    while (*p &&
-           ((*p >= '0' && *p <= '9') || (*p >= 'A' && *p <= 'F') || (*p >= 'a' && *p <= 'f'))) {
-        color += *p;
-        ++p;
+    for (size_t p = hash + 1; p < len; ++p) {
+        char c = line[p];
+        if (!((c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f'))) {
+            break;
+        }
+        color += c;
         if (color.length() >= 9) { // #RRGGBBAA max
             break;
         }
@@ -145,19 +148,19 @@ bool extract_filament_color(const char* line, size_t len, std::string& out_color
 }
 
 // Check if line is a layer change marker
-bool is_layer_marker(const char* line, size_t len) {
+bool is_layer_marker(std::string_view line, std::string_view comment) {
     // Look for ;LAYER_CHANGE or ; LAYER_CHANGE
-    const char* pos = std::strstr(line, "LAYER_CHANGE");
-    if (pos && pos < line + len) {
+    if (line.find("LAYER_CHANGE") != std::string_view::npos) {
         return true;
     }
-    // Also check lowercase
-    // Manual search since strstr doesn't do case-insensitive
+    // Also check lowercase (only after a ';', so only the comment can match)
+    const char* text = comment.data();
+    size_t len = comment.size();
     for (size_t i = 0; i + 12 <= len; ++i) {
-        if (line[i] == ';') {
+        if (text[i] == ';') {
             // Skip spaces after semicolon
             size_t j = i + 1;
-            while (j < len && line[j] == ' ') {
+            while (j < len && text[j] == ' ') {
                 ++j;
             }
             // Compare case-insensitively
@@ -165,7 +168,7 @@ bool is_layer_marker(const char* line, size_t len) {
                 bool match = true;
                 const char* marker = "LAYER_CHANGE";
                 for (int k = 0; k < 12 && match; ++k) {
-                    char c = line[j + k];
+                    char c = text[j + k];
                     char m = marker[k];
                     // Case-insensitive compare
                     if (c != m && c != (m + 32) && (c - 32) != m) {
@@ -181,133 +184,453 @@ bool is_layer_marker(const char* line, size_t len) {
     return false;
 }
 
-} // anonymous namespace
+// Scan results for one newline-aligned chunk of the file
+enum ScanEventFlags : uint8_t {
+    EVENT_LAYER_MARKER = 1 << 0, ///< Line contains a LAYER_CHANGE marker
+    EVENT_Z_MOVE = 1 << 1,       ///< Line is a G0/G1 with a Z parameter
+};
+
+struct ScanEvent {
+    uint64_t offset; ///< File offset of the line
+    uint64_t line;   ///< Line number within the chunk (0-based)
+    float z;         ///< Z parameter (EVENT_Z_MOVE only)
+    uint8_t flags;   ///< ScanEventFlags
+};
+
+struct ChunkScan {
+    uint64_t begin{0}; ///< First byte (start of a line)
+    uint64_t end{0};   ///< Byte after the last line's newline
+    std::vector<ScanEvent> events;
+    size_t lines{0};
+    size_t extrusion_moves{0};
+    size_t travel_moves{0};
+    size_t color_line{0}; ///< Chunk line of the first filament color (if color set)
+    std::string color;
+    bool ok{true};
+};
+
+// Below this a chunk isn't worth a thread
+constexpr uint64_t MIN_CHUNK_BYTES = 2 * 1024 * 1024;
+constexpr unsigned MAX_INDEX_THREADS = 8;
+
+// Filament color is only taken from the header (first ~1000 lines)
+constexpr size_t COLOR_SCAN_LINES = 999;
+
+unsigned auto_thread_count(uint64_t file_size) {
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t by_size = std::max<uint64_t>(1, file_size / MIN_CHUNK_BYTES);
+    return static_cast<unsigned>(std::min<uint64_t>({cores, MAX_INDEX_THREADS, by_size}));
+}
 
-bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
-    auto start_time = std::chrono::high_resolution_clock::now();
+// Split [0, file_size) into up to `count` chunks that each start on a line
+std::vector<ChunkScan> split_chunks(std::ifstream& file, uint64_t file_size, unsigned count) {
+    std::vector<ChunkScan> chunks(1);
+    char buf[4096];
 
-    // Clear any previous data
-    entries_.clear();
-    stats_ = LayerIndexStats{};
-    source_path_ = filepath;
+    for (unsigned i = 1; i < count; ++i) {
+        uint64_t target = file_size * i / count;
+        if (target <= chunks.back().begin) {
+            continue;
+        }
 
-    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
-        spdlog::error("[LayerIndex] Failed to open file: {}", filepath);
-        return false;
+        // Boundary is just past the first newline at or after the target
+        uint64_t boundary = 0;
+        file.clear();
+        file.seekg(static_cast<std::streamoff>(target));
+        for (uint64_t pos = target; boundary == 0 && file;) {
+            file.read(buf, sizeof(buf));
+            auto got = static_cast<size_t>(file.gcount());
+            if (got == 0) {
+                break;
+            }
+            if (const char* nl = find_newline(buf, buf + got); nl != buf + got) {
+                boundary = pos + static_cast<uint64_t>(nl - buf) + 1;
+            }
+            pos += got;
+        }
+        if (boundary == 0 || boundary >= file_size) {
+            break; // No newline left: the rest belongs to the last chunk
+        }
+
+        chunks.back().end = boundary;
+        ChunkScan next;
+        next.begin = boundary;
+        chunks.push_back(std::move(next));
     }
+    chunks.back().end = file_size;
+    file.clear();
+    return chunks;
+}
 
-    // Get file size
-    stats_.total_bytes = static_cast<size_t>(file.tellg());
-    file.seekg(0, std::ios::beg);
+// GCodeLineReader over a GCodeDataSource, for sources without a local file
+class SourceLineReader {
+  public:
+    SourceLineReader(GCodeDataSource& source, uint32_t chunk_size)
+        : source_(source), size_(source.file_size()), chunk_size_(chunk_size) {}
+
+    bool next(std::string_view& line) {
+        size_t scanned = pos_;
+        for (;;) {
+            const char* base = buffer_.data();
+            const char* end = base + buffer_.size();
+            const char* nl = find_newline(base + scanned, end);
+            if (nl != end) {
+                size_t nl_pos = static_cast<size_t>(nl - base);
+                line = std::string_view(base + pos_, nl_pos - pos_);
+                line_offset_ = buffer_offset_ + pos_;
+                pos_ = nl_pos + 1;
+                return true;
+            }
 
-    spdlog::debug("[LayerIndex] Building index for {} ({} bytes)", filepath, stats_.total_bytes);
+            size_t partial = buffer_.size() - pos_;
+            if (!refill()) {
+                if (pos_ < buffer_.size()) {
+                    // Last line without a trailing newline
+                    line = std::string_view(buffer_.data() + pos_, buffer_.size() - pos_);
+                    line_offset_ = buffer_offset_ + pos_;
+                    pos_ = buffer_.size();
+                    return true;
+                }
+                return false;
+            }
+            scanned = pos_ + partial;
+        }
+    }
 
-    // Reserve estimated capacity (assume ~100 layers for now)
-    entries_.reserve(100);
+    uint64_t line_offset() const {
+        return line_offset_;
+    }
+
+    bool failed() const {
+        return failed_;
+    }
 
-    // Read line by line
-    std::string line;
-    line.reserve(256);
+  private:
+    bool refill() {
+        if (failed_ || read_pos_ >= size_) {
+            return false;
+        }
+        auto want = static_cast<uint32_t>(std::min<uint64_t>(chunk_size_, size_ - read_pos_));
+        std::vector<char> data = source_.read_range(read_pos_, want);
+        if (data.empty()) {
+            failed_ = true;
+            return false;
+        }
 
-    float current_z = -std::numeric_limits<float>::infinity();
-    uint64_t current_layer_start = 0;
-    uint64_t current_offset = 0;
-    uint16_t current_layer_lines = 0;
-    bool use_layer_markers = false;
-    bool pending_layer_start = false;
-    bool first_layer_started = false;
+        // Keep only the partial line
+        buffer_.erase(buffer_.begin(), buffer_.begin() + static_cast<std::ptrdiff_t>(pos_));
+        buffer_offset_ += pos_;
+        pos_ = 0;
+        buffer_.insert(buffer_.end(), data.begin(), data.end());
+        read_pos_ += data.size();
+        return true;
+    }
 
-    while (std::getline(file, line)) {
-        size_t line_len = line.length();
-        stats_.total_lines++;
+    GCodeDataSource& source_;
+    const uint64_t size_;
+    const uint32_t chunk_size_;
+    std::vector<char> buffer_;
+    size_t pos_{0};             ///< Start of unread data in buffer_
+    uint64_t buffer_offset_{0}; ///< Source offset of buffer_[0]
+    uint64_t read_pos_{0};      ///< Next source offset to read
+    uint64_t line_offset_{0};
+    bool failed_{false};
+};
+
+// Record one chunk's layer events; LineReader is GCodeLineReader or SourceLineReader
+//
+// Z moves that stitch_chunks() would provably ignore are not recorded, so a
+// chunk holds O(layers) events rather than one per Z move (z-hop on every
+// travel, vase mode). Since the last marker in this chunk (or its start):
+// - a Z move at or below the highest Z seen can't start a layer by Z change:
+//   that earlier move left the layer Z within Z_EPSILON below it or higher
+// - once this chunk has had a marker, marker-based detection is in effect
+//   and only the first Z move after each marker can start a layer
+// The first Z move of a chunk is always kept; it may complete a marker
+// pending from the previous chunk.
+template <typename LineReader> void scan_lines(LineReader& reader, ChunkScan& chunk) {
+    std::string_view line;
+    bool seen_marker = false;
+    bool z_since_marker = false;
+    float max_z_since_marker = -std::numeric_limits<float>::infinity();
+
+    while (reader.next(line)) {
+        GCodeTokens tokens = tokenize_gcode_line(line);
+        uint8_t flags = 0;
+        float z = 0.0f;
 
         // Check for layer marker
-        if (is_layer_marker(line.c_str(), line_len)) {
-            use_layer_markers = true;
-            pending_layer_start = true;
-            // We'll start the new layer when we see the next Z move
+        if (is_layer_marker(line, tokens.comment)) {
+            flags |= EVENT_LAYER_MARKER;
+            seen_marker = true;
+            z_since_marker = false;
+            max_z_since_marker = -std::numeric_limits<float>::infinity();
         }
 
-        // Extract filament color from metadata (only if not already found)
-        // Only check comment lines in the header (first ~1000 lines)
-        if (stats_.filament_color.empty() && stats_.total_lines < 1000) {
-            std::string color;
-            if (extract_filament_color(line.c_str(), line_len, color)) {
-                stats_.filament_color = color;
-                spdlog::debug("[LayerIndex] Found filament color: {}", color);
-            }
+        // Extract filament color from metadata (header lines only)
+        if (chunk.color.empty() && chunk.lines < COLOR_SCAN_LINES &&
+            extract_filament_color(line, chunk.color)) {
+            chunk.color_line = chunk.lines;
         }
 
         // Check for movement commands
-        if (is_movement_command(line.c_str(), line_len)) {
-            float z;
-            if (extract_z_param(line.c_str(), line_len, z)) {
-                // Z change detected
-                bool is_new_layer = false;
-
-                if (use_layer_markers) {
-                    // Use marker-based layer detection
-                    if (pending_layer_start) {
-                        is_new_layer = true;
-                        pending_layer_start = false;
-                    }
-                } else {
-                    // Use Z-change based layer detection
-                    if (z > current_z + Z_EPSILON) {
-                        is_new_layer = true;
-                    }
+        if (is_movement_command(tokens.code)) {
+            if (extract_z_param(tokens, z)) {
+                bool ignored = seen_marker ? z_since_marker : z <= max_z_since_marker;
+                if (!ignored) {
+                    flags |= EVENT_Z_MOVE;
                 }
+                z_since_marker = true;
+                max_z_since_marker = std::max(max_z_since_marker, z);
+            }
 
-                if (is_new_layer) {
-                    // Finalize previous layer if any
-                    if (first_layer_started && current_layer_lines > 0) {
-                        StreamingLayerEntry& last = entries_.back();
-                        last.byte_length =
-                            static_cast<uint32_t>(current_offset - current_layer_start);
-                        last.line_count = current_layer_lines;
-                    }
+            // Track extrusion vs travel
+            if (has_positive_extrusion(tokens)) {
+                chunk.extrusion_moves++;
+            } else {
+                chunk.travel_moves++;
+            }
+        }
 
-                    // Start new layer
-                    StreamingLayerEntry entry{};
-                    entry.file_offset = current_offset;
-                    entry.z_height = z;
-                    entry.byte_length = 0; // Will be filled when layer ends
-                    entry.line_count = 0;  // Will be filled when layer ends
-                    entry.flags = 0;
-                    entries_.push_back(entry);
-
-                    if (!first_layer_started) {
-                        stats_.min_z = z;
-                        first_layer_started = true;
-                    }
-                    stats_.max_z = z;
+        if (flags != 0) {
+            chunk.events.push_back({reader.line_offset(), chunk.lines, z, flags});
+        }
+        chunk.lines++;
+    }
+}
 
-                    current_z = z;
-                    current_layer_start = current_offset;
-                    current_layer_lines = 0;
-                }
+void scan_chunk(const std::string& filepath, ChunkScan& chunk) {
+    GCodeLineReader reader(filepath, GCodeLineReader::DEFAULT_CHUNK_SIZE, chunk.begin, chunk.end);
+    if (!reader.is_open()) {
+        chunk.ok = false;
+        return;
+    }
+    scan_lines(reader, chunk);
+}
+
+// Replay chunk events in file order through the serial layer detection logic
+void stitch_chunks(const std::vector<ChunkScan>& chunks, std::vector<StreamingLayerEntry>& entries,
+                   LayerIndexStats& stats) {
+    float current_z = -std::numeric_limits<float>::infinity();
+    uint64_t current_layer_start = 0;
+    uint64_t current_layer_first_line = 0;
+    uint64_t line_base = 0;
+    bool use_layer_markers = false;
+    bool pending_layer_start = false;
+    bool first_layer_started = false;
+
+    // Reserve estimated capacity (assume ~100 layers for now)
+    entries.reserve(100);
+
+    for (const auto& chunk : chunks) {
+        for (const auto& event : chunk.events) {
+            uint64_t line = line_base + event.line;
+
+            if (event.flags & EVENT_LAYER_MARKER) {
+                use_layer_markers = true;
+                pending_layer_start = true;
+                // We'll start the new layer when we see the next Z move
+            }
+            if (!(event.flags & EVENT_Z_MOVE)) {
+                continue;
             }
 
-            // Track extrusion vs travel
-            if (has_positive_extrusion(line.c_str(), line_len)) {
-                stats_.extrusion_moves++;
+            // Z change detected
+            bool is_new_layer = false;
+            if (use_layer_markers) {
+                // Use marker-based layer detection
+                if (pending_layer_start) {
+                    is_new_layer = true;
+                    pending_layer_start = false;
+                }
             } else {
-                stats_.travel_moves++;
+                // Use Z-change based layer detection
+                is_new_layer = event.z > current_z + Z_EPSILON;
+            }
+            if (!is_new_layer) {
+                continue;
+            }
+
+            // Finalize previous layer if any (line_count is a wrapping uint16_t)
+            auto layer_lines = static_cast<uint16_t>(line - current_layer_first_line);
+            if (first_layer_started && layer_lines > 0) {
+                StreamingLayerEntry& last = entries.back();
+                last.byte_length = static_cast<uint32_t>(event.offset - current_layer_start);
+                last.line_count = layer_lines;
+            }
+
+            // Start new layer
+            StreamingLayerEntry entry{};
+            entry.file_offset = event.offset;
+            entry.z_height = event.z;
+            entry.byte_length = 0; // Will be filled when layer ends
+            entry.line_count = 0;  // Will be filled when layer ends
+            entry.flags = 0;
+            entries.push_back(entry);
+
+            if (!first_layer_started) {
+                stats.min_z = event.z;
+                first_layer_started = true;
             }
+            stats.max_z = event.z;
+
+            current_z = event.z;
+            current_layer_start = event.offset;
+            current_layer_first_line = line;
         }
 
-        current_layer_lines++;
-        // Account for line length + newline character
-        current_offset += line_len + 1;
+        // First color within the header lines wins
+        if (stats.filament_color.empty() && !chunk.color.empty() &&
+            line_base + chunk.color_line < COLOR_SCAN_LINES) {
+            stats.filament_color = chunk.color;
+            spdlog::debug("[LayerIndex] Found filament color: {}", chunk.color);
+        }
+
+        line_base += chunk.lines;
+        stats.extrusion_moves += chunk.extrusion_moves;
+        stats.travel_moves += chunk.travel_moves;
     }
+    stats.total_lines = line_base;
 
     // Finalize last layer
-    if (first_layer_started && !entries_.empty()) {
-        StreamingLayerEntry& last = entries_.back();
-        last.byte_length = static_cast<uint32_t>(stats_.total_bytes - current_layer_start);
-        last.line_count = current_layer_lines;
+    if (first_layer_started && !entries.empty()) {
+        StreamingLayerEntry& last = entries.back();
+        last.byte_length = static_cast<uint32_t>(stats.total_bytes - current_layer_start);
+        last.line_count = static_cast<uint16_t>(line_base - current_layer_first_line);
+    }
+}
+
+// =============================================================================
+// Sidecar format
+// =============================================================================
+//
+// [SidecarHeader][StreamingLayerEntry x entry_count][source path][filament color]
+//
+// Native byte order: sidecars live in the local cache and are never shared
+// between machines. The entry table follows the 8-byte aligned header, so it
+// could be used in place; it is copied out instead so the index owns its
+// memory (a few KB) and the mapping is released immediately.
+
+constexpr char SIDECAR_MAGIC[8] = {'H', 'X', 'L', 'I', 'D', 'X', '\0', '\0'};
+constexpr const char* SIDECAR_EXTENSION = ".lidx";
+
+struct SidecarHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t entry_size;   ///< sizeof(StreamingLayerEntry) when written
+    uint64_t source_size;  ///< G-code file size
+    int64_t source_mtime;  ///< G-code file mtime (filesystem clock ticks)
+    uint64_t total_lines;
+    uint64_t extrusion_moves;
+    uint64_t travel_moves;
+    float min_z;
+    float max_z;
+    uint32_t entry_count;
+    uint32_t path_length;
+    uint32_t color_length;
+    uint32_t checksum;     ///< FNV-1a of everything after the header
+};
+
+static_assert(sizeof(SidecarHeader) % alignof(StreamingLayerEntry) == 0,
+              "entry table must stay aligned after the header");
+
+uint32_t fnv1a(const void* data, size_t length, uint32_t hash = 2166136261u) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
     }
+    return hash;
+}
+
+// Size and mtime identifying the current contents of a file
+bool source_identity(const std::string& path, uint64_t& size, int64_t& mtime) {
+    std::error_code ec;
+    size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return false;
+    }
+    auto time = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return false;
+    }
+    mtime = static_cast<int64_t>(time.time_since_epoch().count());
+    return true;
+}
+
+// Remove the least recently used sidecars beyond the limit
+void prune_sidecars(const std::string& cache_dir, size_t keep) {
+    std::error_code ec;
+    std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> sidecars;
+    for (const auto& item : std::filesystem::directory_iterator(cache_dir, ec)) {
+        if (item.path().extension() == SIDECAR_EXTENSION) {
+            sidecars.emplace_back(item.last_write_time(ec), item.path());
+        }
+    }
+    if (sidecars.size() <= keep) {
+        return;
+    }
+
+    std::sort(sidecars.begin(), sidecars.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+    for (size_t i = keep; i < sidecars.size(); ++i) {
+        std::filesystem::remove(sidecars[i].second, ec);
+    }
+    spdlog::debug("[LayerIndex] Pruned {} old index sidecars", sidecars.size() - keep);
+}
+
+} // anonymous namespace
+
+bool GCodeLayerIndex::build_from_file(const std::string& filepath, unsigned thread_count) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    // Clear any previous data
+    entries_.clear();
+    stats_ = LayerIndexStats{};
+    source_path_ = filepath;
+
+    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        spdlog::error("[LayerIndex] Failed to open file: {}", filepath);
+        return false;
+    }
+
+    // Get file size
+    stats_.total_bytes = static_cast<size_t>(file.tellg());
+    file.seekg(0, std::ios::beg);
+
+    spdlog::debug("[LayerIndex] Building index for {} ({} bytes)", filepath, stats_.total_bytes);
+
+    // Split into newline-aligned chunks and scan them in parallel. Each chunk
+    // records its layer markers and Z moves; stitch_chunks() replays them in
+    // file order through the serial layer detection logic.
+    unsigned threads = thread_count != 0 ? thread_count : auto_thread_count(stats_.total_bytes);
+    std::vector<ChunkScan> chunks = split_chunks(file, stats_.total_bytes, threads);
+
+    std::vector<std::thread> workers;
+    workers.reserve(chunks.size());
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        try {
+            workers.emplace_back(scan_chunk, std::cref(filepath), std::ref(chunks[i]));
+        } catch (const std::system_error& e) {
+            spdlog::warn("[LayerIndex] Worker thread failed to start ({}), scanning inline",
+                         e.what());
+            scan_chunk(filepath, chunks[i]);
+        }
+    }
+    scan_chunk(filepath, chunks[0]);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (const auto& chunk : chunks) {
+        if (!chunk.ok) {
+            spdlog::error("[LayerIndex] Failed to read {} at offset {}", filepath, chunk.begin);
+            entries_.clear();
+            return false;
+        }
+    }
+
+    stitch_chunks(chunks, entries_, stats_);
 
     stats_.total_layers = entries_.size();
 
@@ -318,9 +641,10 @@ bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
         file.clear();
         file.seekg(-static_cast<std::streamoff>(footer_size), std::ios::end);
 
-        while (std::getline(file, line)) {
+        std::string footer_line;
+        while (std::getline(file, footer_line)) {
             std::string color;
-            if (extract_filament_color(line.c_str(), line.length(), color)) {
+            if (extract_filament_color(footer_line, color)) {
                 stats_.filament_color = color;
                 spdlog::debug("[LayerIndex] Found filament color in footer: {}", color);
                 break;
@@ -331,9 +655,10 @@ bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
     auto end_time = std::chrono::high_resolution_clock::now();
     stats_.build_time_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
 
-    spdlog::info("[LayerIndex] Built index: {} layers, {} lines, Z=[{:.2f}, {:.2f}], {:.1f}ms",
+    spdlog::info("[LayerIndex] Built index: {} layers, {} lines, Z=[{:.2f}, {:.2f}], {:.1f}ms "
+                 "({} chunk{})",
                  stats_.total_layers, stats_.total_lines, stats_.min_z, stats_.max_z,
-                 stats_.build_time_ms);
+                 stats_.build_time_ms, chunks.size(), chunks.size() == 1 ? "" : "s");
 
     spdlog::debug("[LayerIndex] Memory usage: {} bytes ({} bytes/layer)", memory_usage_bytes(),
                   entries_.empty() ? 0 : memory_usage_bytes() / entries_.size());
@@ -341,6 +666,229 @@ bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
     return !entries_.empty();
 }
 
+bool GCodeLayerIndex::build_from_source(GCodeDataSource& source) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    entries_.clear();
+    stats_ = LayerIndexStats{};
+    source_path_ = source.source_name();
+    stats_.total_bytes = static_cast<size_t>(source.file_size());
+
+    spdlog::debug("[LayerIndex] Building index for {} ({} bytes, from source)", source_path_,
+                  stats_.total_bytes);
+
+    // Large reads keep the request count down on remote sources
+    constexpr uint32_t SOURCE_READ_SIZE = 1024 * 1024;
+    std::vector<ChunkScan> chunks(1);
+    chunks[0].end = stats_.total_bytes;
+    SourceLineReader reader(source, SOURCE_READ_SIZE);
+    scan_lines(reader, chunks[0]);
+    if (reader.failed()) {
+        spdlog::error("[LayerIndex] Failed to read {} at offset {}", source_path_,
+                      reader.line_offset());
+        return false;
+    }
+
+    stitch_chunks(chunks, entries_, stats_);
+    stats_.total_layers = entries_.size();
+
+    // Same footer fallback as build_from_file() (OrcaSlicer puts metadata at end)
+    if (stats_.filament_color.empty() && stats_.total_bytes > 0) {
+        size_t footer_size = std::min(stats_.total_bytes, size_t(32768));
+        std::vector<char> footer = source.read_range(stats_.total_bytes - footer_size,
+                                                     static_cast<uint32_t>(footer_size));
+        std::string_view rest(footer.data(), footer.size());
+        while (!rest.empty()) {
+            size_t nl = rest.find('\n');
+            std::string_view footer_line = rest.substr(0, nl);
+            rest = nl == std::string_view::npos ? std::string_view() : rest.substr(nl + 1);
+
+            std::string color;
+            if (extract_filament_color(footer_line, color)) {
+                stats_.filament_color = color;
+                spdlog::debug("[LayerIndex] Found filament color in footer: {}", color);
+                break;
+            }
+        }
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    stats_.build_time_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+
+    spdlog::info("[LayerIndex] Built index: {} layers, {} lines, Z=[{:.2f}, {:.2f}], {:.1f}ms "
+                 "(from {})",
+                 stats_.total_layers, stats_.total_lines, stats_.min_z, stats_.max_z,
+                 stats_.build_time_ms, source_path_);
+
+    return !entries_.empty();
+}
+
+bool GCodeLayerIndex::load_or_build(const std::string& filepath, const std::string& cache_dir,
+                                    unsigned thread_count) {
+    if (cache_dir.empty()) {
+        return build_from_file(filepath, thread_count);
+    }
+
+    std::string sidecar = sidecar_path_for(filepath, cache_dir);
+    if (load_sidecar(sidecar, filepath)) {
+        // Refresh mtime so pruning keeps recently opened files
+        std::error_code ec;
+        std::filesystem::last_write_time(sidecar, std::filesystem::file_time_type::clock::now(),
+                                         ec);
+        return true;
+    }
+
+    if (!build_from_file(filepath, thread_count)) {
+        return false;
+    }
+    if (save_sidecar(sidecar)) {
+        prune_sidecars(cache_dir, MAX_SIDECARS);
+    }
+    return true;
+}
+
+bool GCodeLayerIndex::save_sidecar(const std::string& sidecar_path) const {
+    SidecarHeader header{};
+    if (entries_.empty() || entries_.size() > std::numeric_limits<uint32_t>::max() ||
+        !source_identity(source_path_, header.source_size, header.source_mtime) ||
+        header.source_size != stats_.total_bytes) {
+        // Nothing to save, or the file changed since it was indexed
+        return false;
+    }
+
+    std::memcpy(header.magic, SIDECAR_MAGIC, sizeof(header.magic));
+    header.version = SIDECAR_VERSION;
+    header.entry_size = sizeof(StreamingLayerEntry);
+    header.total_lines = stats_.total_lines;
+    header.extrusion_moves = stats_.extrusion_moves;
+    header.travel_moves = stats_.travel_moves;
+    header.min_z = stats_.min_z;
+    header.max_z = stats_.max_z;
+    header.entry_count = static_cast<uint32_t>(entries_.size());
+    header.path_length = static_cast<uint32_t>(source_path_.size());
+    header.color_length = static_cast<uint32_t>(stats_.filament_color.size());
+
+    const size_t table_bytes = entries_.size() * sizeof(StreamingLayerEntry);
+    header.checksum = fnv1a(entries_.data(), table_bytes);
+    header.checksum = fnv1a(source_path_.data(), source_path_.size(), header.checksum);
+    header.checksum =
+        fnv1a(stats_.filament_color.data(), stats_.filament_color.size(), header.checksum);
+
+    std::string temp_path = sidecar_path + ".tmp";
+    FILE* file = std::fopen(temp_path.c_str(), "wb");
+    if (!file) {
+        spdlog::debug("[LayerIndex] Cannot write index sidecar {}", temp_path);
+        return false;
+    }
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+              std::fwrite(entries_.data(), 1, table_bytes, file) == table_bytes &&
+              std::fwrite(source_path_.data(), 1, source_path_.size(), file) ==
+                  source_path_.size() &&
+              std::fwrite(stats_.filament_color.data(), 1, stats_.filament_color.size(), file) ==
+                  stats_.filament_color.size();
+    ok = (std::fclose(file) == 0) && ok;
+
+    if (!ok || std::rename(temp_path.c_str(), sidecar_path.c_str()) != 0) {
+        spdlog::warn("[LayerIndex] Failed to write index sidecar {}", sidecar_path);
+        std::remove(temp_path.c_str());
+        return false;
+    }
+
+    spdlog::debug("[LayerIndex] Saved index sidecar {} ({} layers)", sidecar_path,
+                  entries_.size());
+    return true;
+}
+
+bool GCodeLayerIndex::load_sidecar(const std::string& sidecar_path,
+                                   const std::string& source_path) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    clear();
+
+    uint64_t source_size = 0;
+    int64_t source_mtime = 0;
+    if (!source_identity(source_path, source_size, source_mtime)) {
+        return false;
+    }
+
+    int fd = ::open(sidecar_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false; // No sidecar yet
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SidecarHeader)) {
+        ::close(fd);
+        return false;
+    }
+    const size_t file_size = static_cast<size_t>(st.st_size);
+    void* map = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+
+    const char* data = static_cast<const char*>(map);
+    SidecarHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    const char* reason = nullptr;
+    const size_t table_bytes = static_cast<size_t>(header.entry_count) * header.entry_size;
+    const char* table = data + sizeof(SidecarHeader);
+    const char* path = table + table_bytes;
+    const char* color = path + header.path_length;
+
+    if (std::memcmp(header.magic, SIDECAR_MAGIC, sizeof(header.magic)) != 0) {
+        reason = "bad magic";
+    } else if (header.version != SIDECAR_VERSION ||
+               header.entry_size != sizeof(StreamingLayerEntry)) {
+        reason = "format version changed";
+    } else if (header.entry_count == 0 ||
+               file_size != sizeof(SidecarHeader) + table_bytes + header.path_length +
+                                header.color_length) {
+        reason = "truncated";
+    } else if (fnv1a(color, header.color_length,
+                     fnv1a(path, header.path_length, fnv1a(table, table_bytes))) !=
+               header.checksum) {
+        reason = "checksum mismatch";
+    } else if (std::string_view(path, header.path_length) != source_path ||
+               header.source_size != source_size || header.source_mtime != source_mtime) {
+        reason = "source file changed";
+    }
+
+    if (reason == nullptr) {
+        entries_.resize(header.entry_count);
+        std::memcpy(entries_.data(), table, table_bytes);
+        stats_.filament_color.assign(color, header.color_length);
+    }
+    ::munmap(map, file_size);
+
+    if (reason != nullptr) {
+        spdlog::debug("[LayerIndex] Ignoring index sidecar {}: {}", sidecar_path, reason);
+        return false;
+    }
+
+    source_path_ = source_path;
+    stats_.total_layers = entries_.size();
+    stats_.total_bytes = static_cast<size_t>(source_size);
+    stats_.total_lines = static_cast<size_t>(header.total_lines);
+    stats_.extrusion_moves = static_cast<size_t>(header.extrusion_moves);
+    stats_.travel_moves = static_cast<size_t>(header.travel_moves);
+    stats_.min_z = header.min_z;
+    stats_.max_z = header.max_z;
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    stats_.build_time_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+
+    spdlog::info("[LayerIndex] Loaded index from sidecar: {} layers, {:.1f}ms",
+                 stats_.total_layers, stats_.build_time_ms);
+    return true;
+}
+
+std::string GCodeLayerIndex::sidecar_path_for(const std::string& source_path,
+                                              const std::string& cache_dir) {
+    return cache_dir + "/" + std::to_string(std::hash<std::string>{}(source_path)) +
+           SIDECAR_EXTENSION;
+}
+
 StreamingLayerEntry GCodeLayerIndex::get_entry(size_t layer_index) const {
     if (layer_index < entries_.size()) {
         return entries_[layer_index];
@@ -0,0 +1,222 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_layer_prefetcher.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <system_error>
+
+namespace helix {
+namespace gcode {
+
+// =============================================================================
+// LatencyWindow
+// =============================================================================
+
+void LatencyWindow::record(double ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (samples_.size() < WINDOW) {
+        samples_.push_back(ms);
+    } else {
+        samples_[next_] = ms;
+    }
+    next_ = (next_ + 1) % WINDOW;
+}
+
+double LatencyWindow::percentile(double pct) const {
+    std::vector<double> sorted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sorted = samples_;
+    }
+    if (sorted.empty()) {
+        return 0.0;
+    }
+
+    // Nearest-rank percentile
+    pct = std::clamp(pct, 0.0, 100.0);
+    size_t rank = static_cast<size_t>(std::ceil(pct / 100.0 * static_cast<double>(sorted.size())));
+    size_t idx = rank > 0 ? rank - 1 : 0;
+    std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(idx),
+                     sorted.end());
+    return sorted[idx];
+}
+
+size_t LatencyWindow::sample_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return samples_.size();
+}
+
+void LatencyWindow::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    samples_.clear();
+    next_ = 0;
+}
+
+// =============================================================================
+// LayerPrefetcher
+// =============================================================================
+
+LayerPrefetcher::LayerPrefetcher(LoadFunction load, unsigned thread_count)
+    : load_(std::move(load)) {
+    if (thread_count == 0) {
+        thread_count = std::thread::hardware_concurrency() > 1 ? 2 : 1;
+    }
+
+    workers_.reserve(thread_count);
+    for (unsigned i = 0; i < thread_count; ++i) {
+        try {
+            workers_.emplace_back(&LayerPrefetcher::worker_loop, this);
+        } catch (const std::system_error& e) {
+            spdlog::warn("[LayerPrefetcher] Failed to start worker {}: {}", i, e.what());
+            break;
+        }
+    }
+    if (workers_.empty()) {
+        spdlog::error("[LayerPrefetcher] No worker threads - prefetching disabled");
+    }
+}
+
+LayerPrefetcher::~LayerPrefetcher() {
+    stop();
+}
+
+void LayerPrefetcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        stats_.cancelled += queue_.size();
+        queue_.clear();
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+}
+
+void LayerPrefetcher::schedule(size_t center_layer, size_t radius, size_t max_layer) {
+    if (workers_.empty() || center_layer > max_layer) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        bool scrubbing_down = have_center_ && center_layer < last_center_;
+        last_center_ = center_layer;
+        have_center_ = true;
+
+        // Nearest first, scrub direction before the other side
+        std::vector<size_t> window;
+        window.reserve(2 * radius + 1);
+        window.push_back(center_layer);
+        size_t above = std::min(radius, max_layer - center_layer);
+        size_t below = std::min(radius, center_layer);
+        auto push_above = [&] {
+            for (size_t d = 1; d <= above; ++d) {
+                window.push_back(center_layer + d);
+            }
+        };
+        auto push_below = [&] {
+            for (size_t d = 1; d <= below; ++d) {
+                window.push_back(center_layer - d);
+            }
+        };
+        if (scrubbing_down) {
+            push_below();
+            push_above();
+        } else {
+            push_above();
+            push_below();
+        }
+
+        // Pending layers outside the new window are stale
+        size_t kept = 0;
+        for (size_t layer : queue_) {
+            if (std::find(window.begin(), window.end(), layer) == window.end()) {
+                ++stats_.cancelled;
+            } else {
+                ++kept;
+            }
+        }
+        stats_.scheduled += window.size() - kept;
+        queue_.assign(window.begin(), window.end());
+    }
+    work_cv_.notify_all();
+}
+
+void LayerPrefetcher::request(size_t layer_index) {
+    if (workers_.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = std::find(queue_.begin(), queue_.end(), layer_index);
+        if (it != queue_.end()) {
+            queue_.erase(it);
+        } else {
+            ++stats_.scheduled;
+        }
+        queue_.push_front(layer_index);
+    }
+    work_cv_.notify_one();
+}
+
+void LayerPrefetcher::cancel() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stats_.cancelled += queue_.size();
+    queue_.clear();
+    have_center_ = false;
+    idle_cv_.wait(lock, [this] { return active_ == 0; });
+}
+
+bool LayerPrefetcher::wait_idle(std::chrono::milliseconds timeout) const {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return idle_cv_.wait_for(lock, timeout, [this] { return queue_.empty() && active_ == 0; });
+}
+
+size_t LayerPrefetcher::pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+LayerPrefetcher::Stats LayerPrefetcher::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void LayerPrefetcher::worker_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        work_cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+        if (stopping_) {
+            return;
+        }
+
+        size_t layer = queue_.front();
+        queue_.pop_front();
+        ++active_;
+        ++stats_.loaded;
+        lock.unlock();
+
+        try {
+            load_(layer);
+        } catch (const std::exception& e) {
+            spdlog::warn("[LayerPrefetcher] Prefetch of layer {} failed: {}", layer, e.what());
+        }
+
+        lock.lock();
+        --active_;
+        if (active_ == 0) {
+            idle_cv_.notify_all();
+        }
+    }
+}
+
+} // namespace gcode
+} // namespace helix
@@ -47,6 +47,8 @@ GCodeLayerRenderer::~GCodeLayerRenderer() {
 void GCodeLayerRenderer::set_gcode(const ParsedGCodeFile* gcode) {
     gcode_ = gcode;
     streaming_controller_ = nullptr; // Clear streaming mode
+    object_styles_.clear();
+    reset_current_layer_view();
     bounds_valid_ = false;
     current_layer_ = 0;
     warmup_frames_remaining_ = WARMUP_FRAMES; // Allow panel to render before heavy caching
@@ -61,6 +63,8 @@ void GCodeLayerRenderer::set_gcode(const ParsedGCodeFile* gcode) {
 void GCodeLayerRenderer::set_streaming_controller(GCodeStreamingController* controller) {
     streaming_controller_ = controller;
     gcode_ = nullptr; // Clear full-file mode
+    object_styles_.clear();
+    reset_current_layer_view();
     bounds_valid_ = false;
     current_layer_ = 0;
     warmup_frames_remaining_ = WARMUP_FRAMES; // Allow panel to render before heavy caching
@@ -74,6 +78,54 @@ void GCodeLayerRenderer::set_streaming_controller(GCodeStreamingController* cont
     }
 }
 
+void GCodeLayerRenderer::LayerView::bind_styles(ObjectStyleTable& styles) {
+    style_ids.clear();
+    if (packed) {
+        // A handful of names per layer, however many segments
+        style_ids.reserve(packed->names().size());
+        for (const auto& name : packed->names()) {
+            style_ids.push_back(styles.resolve(name));
+        }
+    } else if (layer) {
+        // Runs of the same object hit resolve()'s one-entry cache
+        style_ids.reserve(layer->segments.size());
+        for (const auto& seg : layer->segments) {
+            style_ids.push_back(styles.resolve(seg.object_name));
+        }
+    }
+}
+
+GCodeLayerRenderer::LayerView GCodeLayerRenderer::load_layer_view(
+    const ParsedGCodeFile* gcode, GCodeStreamingController* controller, int layer,
+    ObjectStyleTable& styles) {
+    LayerView view;
+    if (layer < 0)
+        return view;
+
+    if (controller) {
+        view.packed = controller->get_packed_layer(static_cast<size_t>(layer));
+    } else if (gcode && static_cast<size_t>(layer) < gcode->layers.size()) {
+        view.layer = &gcode->layers[static_cast<size_t>(layer)];
+    }
+    view.bind_styles(styles);
+    return view;
+}
+
+const GCodeLayerRenderer::LayerView& GCodeLayerRenderer::current_layer_view() const {
+    if (current_view_layer_ != current_layer_ || !current_view_) {
+        current_view_ =
+            load_layer_view(gcode_, streaming_controller_, current_layer_, object_styles_);
+        // Failed streaming loads are retried on the next call
+        current_view_layer_ = current_view_ ? current_layer_ : -1;
+    }
+    return current_view_;
+}
+
+void GCodeLayerRenderer::reset_current_layer_view() const {
+    current_view_ = LayerView{};
+    current_view_layer_ = -1;
+}
+
 // ============================================================================
 // Layer Selection
 // ============================================================================
@@ -147,15 +199,14 @@ void GCodeLayerRenderer::reset_colors() {
 }
 
 void GCodeLayerRenderer::set_excluded_objects(const std::unordered_set<std::string>& names) {
-    if (names == excluded_objects_) {
+    if (!object_styles_.set_excluded(names)) {
         return; // No change - skip expensive cache invalidation
     }
-    excluded_objects_ = names;
     invalidate_cache();
 }
 
 void GCodeLayerRenderer::set_highlighted_objects(const std::unordered_set<std::string>& names) {
-    if (names == highlighted_objects_) {
+    if (names == object_styles_.highlighted()) {
         return; // No change - skip expensive cache invalidation
     }
     if (names.empty()) {
@@ -165,7 +216,7 @@ void GCodeLayerRenderer::set_highlighted_objects(const std::unordered_set<std::s
             spdlog::debug("[GCodeLayerRenderer] Selection brackets active for '{}'", name);
         }
     }
-    highlighted_objects_ = names;
+    object_styles_.set_highlighted(names);
     invalidate_cache();
 }
 
@@ -210,15 +261,15 @@ void GCodeLayerRenderer::auto_fit() {
 
         bool found_bounds = false;
         for (size_t layer_idx : sample_layers) {
-            auto segments = streaming_controller_->get_layer_segments(layer_idx);
-            if (segments && !segments->empty()) {
-                for (const auto& seg : *segments) {
-                    bb.min.x = std::min(bb.min.x, std::min(seg.start.x, seg.end.x));
-                    bb.max.x = std::max(bb.max.x, std::max(seg.start.x, seg.end.x));
-                    bb.min.y = std::min(bb.min.y, std::min(seg.start.y, seg.end.y));
-                    bb.max.y = std::max(bb.max.y, std::max(seg.start.y, seg.end.y));
-                    found_bounds = true;
-                }
+            // Packed layers carry the bounds of their endpoints
+            auto packed = streaming_controller_->get_packed_layer(layer_idx);
+            if (packed && !packed->empty()) {
+                const AABB& layer_bb = packed->bounds();
+                bb.min.x = std::min(bb.min.x, layer_bb.min.x);
+                bb.max.x = std::max(bb.max.x, layer_bb.max.x);
+                bb.min.y = std::min(bb.min.y, layer_bb.min.y);
+                bb.max.y = std::max(bb.max.y, layer_bb.max.y);
+                found_bounds = true;
             }
         }
 
@@ -324,25 +375,23 @@ GCodeLayerRenderer::LayerInfo GCodeLayerRenderer::get_layer_info() const {
         info.z_height = streaming_controller_->get_layer_z(static_cast<size_t>(current_layer_));
 
         // Get segments to compute counts (this will cache the layer)
-        // Use shared_ptr to keep data alive during iteration
-        auto segments =
-            streaming_controller_->get_layer_segments(static_cast<size_t>(current_layer_));
-        if (segments) {
-            info.segment_count = segments->size();
+        const LayerView& view = current_layer_view();
+        if (view) {
+            info.segment_count = view.size();
             info.extrusion_count = 0;
             info.travel_count = 0;
             info.has_supports = false;
 
-            for (const auto& seg : *segments) {
+            view.for_each([&](const SegmentRef& seg) {
                 if (seg.is_extrusion) {
                     ++info.extrusion_count;
-                    if (!info.has_supports && is_support_segment(seg)) {
+                    if (!info.has_supports && object_styles_.style(seg.style_id).support) {
                         info.has_supports = true;
                     }
                 } else {
                     ++info.travel_count;
                 }
-            }
+            });
         }
     } else if (gcode_) {
         // Full file mode
@@ -354,12 +403,11 @@ GCodeLayerRenderer::LayerInfo GCodeLayerRenderer::get_layer_info() const {
 
         // Check for support segments in this layer
         info.has_supports = false;
-        for (const auto& seg : layer.segments) {
-            if (is_support_segment(seg)) {
+        current_layer_view().for_each([&](const SegmentRef& seg) {
+            if (object_styles_.style(seg.style_id).support) {
                 info.has_supports = true;
-                break;
             }
-        }
+        });
     }
 
     return info;
@@ -380,6 +428,8 @@ bool GCodeLayerRenderer::has_support_detection() const {
 // ============================================================================
 
 void GCodeLayerRenderer::destroy_cache() {
+    cancel_async_cache_render();
+
     if (cache_buf_) {
         if (lv_is_initialized()) {
             lv_draw_buf_destroy(cache_buf_);
@@ -392,6 +442,9 @@ void GCodeLayerRenderer::destroy_cache() {
 }
 
 void GCodeLayerRenderer::invalidate_cache() {
+    // Drop any background range (it was drawn with the old state)
+    cancel_async_cache_render();
+
     // Clear the cache buffer content but keep the buffer allocated
     if (cache_buf_) {
         lv_draw_buf_clear(cache_buf_, nullptr);
@@ -437,6 +490,71 @@ void GCodeLayerRenderer::ensure_cache(int width, int height) {
     }
 }
 
+GCodeLayerRenderer::SolidPassParams GCodeLayerRenderer::capture_solid_pass_params() const {
+    SolidPassParams params;
+
+    // Capture transform params for coordinate conversion
+    // This ensures consistent rendering with widget offset set to 0 for cache
+    params.transform = capture_transform_params();
+    params.transform.canvas_width = cached_width_;
+    params.transform.canvas_height = cached_height_;
+
+    // Base color once (full filament color with full alpha)
+    params.base_color = (255u << 24) | (color_extrusion_.red << 16) |
+                        (color_extrusion_.green << 8) | color_extrusion_.blue;
+    params.depth_shading = depth_shading_ && view_mode_ == ViewMode::FRONT;
+    params.z_min = bounds_min_z_;
+    params.z_max = bounds_max_z_;
+    params.y_min = bounds_min_y_;
+    params.y_max = bounds_max_y_;
+    params.show_extrusions = show_extrusions_;
+    params.show_supports = show_supports_;
+
+    // Extrusion line width in pixels (scale-dependent)
+    params.line_width = get_extrusion_pixel_width();
+    return params;
+}
+
+bool GCodeLayerRenderer::make_solid_line(const SolidPassParams& params,
+                                         const ObjectStyleTable& styles, const SegmentRef& seg,
+                                         RasterLine& line) {
+    // Skip non-extrusion moves for solid rendering (travels are subtle)
+    if (!seg.is_extrusion)
+        return false;
+
+    const ObjectStyle& style = styles.style(seg.style_id);
+    if (!(style.support ? params.show_supports : params.show_extrusions))
+        return false;
+
+    // Convert world coordinates to screen using cached transform
+    glm::ivec2 p1 = world_to_screen_raw(params.transform, seg.start.x, seg.start.y, seg.start.z);
+    glm::ivec2 p2 = world_to_screen_raw(params.transform, seg.end.x, seg.end.y, seg.end.z);
+
+    // Skip zero-length segments
+    if (p1.x == p2.x && p1.y == p2.y)
+        return false;
+
+    // Excluded/highlighted objects replace the color outright; everything
+    // else gets depth shading for a 3D-like appearance
+    uint32_t color = params.base_color;
+    if (style.has_color) {
+        color = style.color;
+    } else if (params.depth_shading) {
+        float avg_z = (seg.start.z + seg.end.z) * 0.5f;
+        float avg_y = (seg.start.y + seg.end.y) * 0.5f;
+        float brightness = compute_depth_brightness(avg_z, params.z_min, params.z_max, avg_y,
+                                                    params.y_min, params.y_max);
+
+        auto r = static_cast<uint8_t>(((params.base_color >> 16) & 0xFF) * brightness);
+        auto g = static_cast<uint8_t>(((params.base_color >> 8) & 0xFF) * brightness);
+        auto b = static_cast<uint8_t>((params.base_color & 0xFF) * brightness);
+        color = (255u << 24) | (r << 16) | (g << 8) | b;
+    }
+
+    line = RasterLine{p1.x, p1.y, p2.x, p2.y, color, params.line_width};
+    return true;
+}
+
 void GCodeLayerRenderer::render_layers_to_cache(int from_layer, int to_layer) {
     if (!cache_buf_)
         return;
@@ -445,107 +563,96 @@ void GCodeLayerRenderer::render_layers_to_cache(int from_layer, int to_layer) {
     if (!gcode_ && !streaming_controller_)
         return;
 
-    // Capture transform params for coordinate conversion
-    // This ensures consistent rendering with widget offset set to 0 for cache
-    TransformParams transform = capture_transform_params();
-    transform.canvas_width = cached_width_;
-    transform.canvas_height = cached_height_;
+    const SolidPassParams params = capture_solid_pass_params();
+    auto* pixels = reinterpret_cast<uint32_t*>(cache_buf_->data);
+    const int stride = static_cast<int>(cache_buf_->header.stride / 4); // ARGB8888
 
     int layer_count = get_layer_count();
     size_t segments_rendered = 0;
 
-    // Compute extrusion line width in pixels (scale-dependent)
-    int line_width = get_extrusion_pixel_width();
-
-    // Compute base color once (full filament color with full alpha)
-    uint8_t base_r = color_extrusion_.red;
-    uint8_t base_g = color_extrusion_.green;
-    uint8_t base_b = color_extrusion_.blue;
-
     for (int layer_idx = from_layer; layer_idx <= to_layer; ++layer_idx) {
         if (layer_idx < 0 || layer_idx >= layer_count)
             continue;
 
-        // Get segments from appropriate source
-        // For streaming mode, hold shared_ptr to keep data alive during iteration
-        std::shared_ptr<const std::vector<ToolpathSegment>> segments_holder;
-        const std::vector<ToolpathSegment>* segments = nullptr;
-
-        if (streaming_controller_) {
-            // Streaming mode: get segments from controller (returns shared_ptr)
-            segments_holder =
-                streaming_controller_->get_layer_segments(static_cast<size_t>(layer_idx));
-            segments = segments_holder.get();
-        } else if (gcode_) {
-            // Full file mode: get segments from parsed file
-            segments = &gcode_->layers[layer_idx].segments;
-        }
-
-        if (!segments)
+        // View holds the packed layer alive during iteration (streaming mode)
+        LayerView view = load_layer_view(gcode_, streaming_controller_, layer_idx, object_styles_);
+        if (!view)
             continue;
 
-        for (const auto& seg : *segments) {
-            if (!should_render_segment(seg))
-                continue;
+        RasterLine line;
+        view.for_each([&](const SegmentRef& seg) {
+            if (!make_solid_line(params, object_styles_, seg, line))
+                return;
 
-            // Skip non-extrusion moves for solid rendering (travels are subtle)
-            if (!seg.is_extrusion)
-                continue;
+            // Draw using software Bresenham - bypasses LVGL draw API for AD5M compatibility
+            draw_raster_line(pixels, stride, cached_width_, 0, cached_height_, line);
+            ++segments_rendered;
+        });
+    }
 
-            // Convert world coordinates to screen using cached transform
-            glm::ivec2 p1 = world_to_screen_raw(transform, seg.start.x, seg.start.y, seg.start.z);
-            glm::ivec2 p2 = world_to_screen_raw(transform, seg.end.x, seg.end.y, seg.end.z);
+    spdlog::trace("[GCodeLayerRenderer] Rendered layers {}-{}: {} segments to cache (direct), "
+                  "color=#{:06X}, buf={}x{} stride={}",
+                  from_layer, to_layer, segments_rendered, params.base_color & 0xFFFFFF,
+                  cached_width_, cached_height_, cache_buf_->header.stride);
+}
 
-            // Skip zero-length segments
-            if (p1.x == p2.x && p1.y == p2.y)
-                continue;
-
-            // Calculate color with depth shading for 3D-like appearance
-            uint8_t r = base_r, g = base_g, b = base_b;
-            if (depth_shading_ && view_mode_ == ViewMode::FRONT) {
-                float avg_z = (seg.start.z + seg.end.z) * 0.5f;
-                float avg_y = (seg.start.y + seg.end.y) * 0.5f;
-                float brightness = compute_depth_brightness(avg_z, bounds_min_z_, bounds_max_z_,
-                                                            avg_y, bounds_min_y_, bounds_max_y_);
-
-                r = static_cast<uint8_t>(base_r * brightness);
-                g = static_cast<uint8_t>(base_g * brightness);
-                b = static_cast<uint8_t>(base_b * brightness);
-            }
+bool GCodeLayerRenderer::start_async_cache_render(int from_layer, int to_layer) {
+    // Small catch-ups (normal print progress) are cheaper inline than a thread handoff
+    if (to_layer - from_layer + 1 <= layers_per_frame_ || !cache_buf_)
+        return false;
 
-            // Override color for excluded/highlighted objects
-            if (!seg.object_name.empty()) {
-                if (excluded_objects_.count(seg.object_name) > 0) {
-                    // Excluded: orange-red with reduced alpha
-                    r = 0xFF;
-                    g = 0x6B;
-                    b = 0x35;
-                    uint32_t color = (153u << 24) | (r << 16) | (g << 8) | b; // 60% alpha
-                    draw_thick_line_bresenham_solid(p1.x, p1.y, p2.x, p2.y, color, line_width);
-                    ++segments_rendered;
-                    continue;
-                }
-                if (highlighted_objects_.count(seg.object_name) > 0) {
-                    // Highlighted: selection blue, full alpha
-                    r = 0x42;
-                    g = 0xA5;
-                    b = 0xF5;
+    if (!cache_rasterizer_) {
+        cache_rasterizer_ = std::make_unique<BandLineRasterizer>();
+    }
+
+    // Each worker gets its own copy of the object styles; the source must not
+    // touch renderer members (the renderer keeps running on the UI thread)
+    auto make_source = [this, params = capture_solid_pass_params()] {
+        return [params, styles = object_styles_, gcode = gcode_,
+                controller = streaming_controller_](int layer,
+                                                    std::vector<RasterLine>& out) mutable {
+            LayerView view = load_layer_view(gcode, controller, layer, styles);
+            if (!view)
+                return;
+
+            RasterLine line;
+            view.for_each([&](const SegmentRef& seg) {
+                if (make_solid_line(params, styles, seg, line)) {
+                    out.push_back(line);
                 }
-            }
+            });
+        };
+    };
 
-            // Build ARGB8888 color (full alpha for solid layers)
-            uint32_t color = (255u << 24) | (r << 16) | (g << 8) | b;
+    if (!cache_rasterizer_->start(cached_width_, cached_height_, from_layer, to_layer,
+                                  make_source)) {
+        return false;
+    }
+    spdlog::debug("[GCodeLayerRenderer] Rendering layers {}-{} in background ({} threads)",
+                  from_layer, to_layer, cache_rasterizer_->thread_count());
+    return true;
+}
 
-            // Draw using software Bresenham - bypasses LVGL draw API for AD5M compatibility
-            draw_thick_line_bresenham_solid(p1.x, p1.y, p2.x, p2.y, color, line_width);
-            ++segments_rendered;
-        }
+void GCodeLayerRenderer::finish_async_cache_render() {
+    if (!cache_rasterizer_ || !cache_buf_)
+        return;
+
+    int to_layer = cache_rasterizer_->to_layer();
+    if (!cache_rasterizer_->composite_into(static_cast<uint8_t*>(cache_buf_->data),
+                                           cache_buf_->header.stride)) {
+        return;
     }
+    cached_up_to_layer_ = to_layer;
 
-    spdlog::trace("[GCodeLayerRenderer] Rendered layers {}-{}: {} segments to cache (direct), "
-                  "color=#{:02X}{:02X}{:02X}, buf={}x{} stride={}",
-                  from_layer, to_layer, segments_rendered, base_r, base_g, base_b, cached_width_,
-                  cached_height_, cache_buf_ ? cache_buf_->header.stride : 0);
+    auto stats = cache_rasterizer_->stats();
+    spdlog::debug("[GCodeLayerRenderer] Background render of {} layers done: {} lines in {:.0f}ms",
+                  stats.layers, stats.lines, stats.elapsed_ms);
+}
+
+void GCodeLayerRenderer::cancel_async_cache_render() {
+    if (cache_rasterizer_) {
+        cache_rasterizer_->cancel();
+    }
 }
 
 void GCodeLayerRenderer::blit_cache(lv_layer_t* target) {
@@ -628,14 +735,15 @@ void GCodeLayerRenderer::render_ghost_layers(int from_layer, int to_layer) {
         if (layer_idx < 0 || layer_idx >= static_cast<int>(gcode_->layers.size()))
             continue;
 
-        const Layer& layer_data = gcode_->layers[layer_idx];
-        for (const auto& seg : layer_data.segments) {
-            if (should_render_segment(seg)) {
+        LayerView view = load_layer_view(gcode_, nullptr, layer_idx, object_styles_);
+        view.for_each([&](const SegmentRef& seg) {
+            const ObjectStyle& style = object_styles_.style(seg.style_id);
+            if (should_render_segment(seg, style)) {
                 // Render with reduced opacity for ghost effect
-                render_segment(&ghost_layer, seg, true); // ghost=true
+                render_segment(&ghost_layer, seg, style, true); // ghost=true
                 ++segments_rendered;
             }
-        }
+        });
     }
 
     // Dispatch pending draw tasks (equivalent to lv_canvas_finish_layer)
@@ -743,8 +851,23 @@ void GCodeLayerRenderer::render(lv_layer_t* layer, const lv_area_t* widget_area)
         // SOLID CACHE: Progressive rendering up to current print layer
         // =====================================================================
         if (cache_buf_) {
+            // A deep range rendering in the background: composite it once finished,
+            // or drop it if the target moved below it
+            if (cache_rasterizer_ && (cache_rasterizer_->busy() || cache_rasterizer_->ready())) {
+                if (target_layer < cache_rasterizer_->to_layer()) {
+                    cancel_async_cache_render();
+                } else if (cache_rasterizer_->ready()) {
+                    finish_async_cache_render();
+                }
+            }
+
             // Check if we need to render new layers
-            if (target_layer > cached_up_to_layer_) {
+            if (cache_rasterizer_ && cache_rasterizer_->busy()) {
+                // Keep blitting the current cache; needs_more_frames() stays true
+            } else if (target_layer > cached_up_to_layer_ &&
+                       start_async_cache_render(cached_up_to_layer_ + 1, target_layer)) {
+                // Deep range handed to the band rasterizer
+            } else if (target_layer > cached_up_to_layer_) {
                 // Progressive rendering: only render up to layers_per_frame_ at a time
                 // This prevents UI freezing during initial load or big jumps
                 int from_layer = cached_up_to_layer_ + 1;
@@ -765,9 +888,11 @@ void GCodeLayerRenderer::render(lv_layer_t* layer, const lv_area_t* widget_area)
                 lv_draw_buf_clear(cache_buf_, nullptr);
                 cached_up_to_layer_ = -1;
 
-                int to_layer = std::min(layers_per_frame_ - 1, target_layer);
-                render_layers_to_cache(0, to_layer);
-                cached_up_to_layer_ = to_layer;
+                if (!start_async_cache_render(0, target_layer)) {
+                    int to_layer = std::min(layers_per_frame_ - 1, target_layer);
+                    render_layers_to_cache(0, to_layer);
+                    cached_up_to_layer_ = to_layer;
+                }
                 // Caller checks needs_more_frames() for continuation
             }
             // else: same layer, just blit cached image
@@ -783,34 +908,24 @@ void GCodeLayerRenderer::render(lv_layer_t* layer, const lv_area_t* widget_area)
         }
     } else {
         // TOP_DOWN or ISOMETRIC: render single layer directly (no caching needed)
-        // Get segments from appropriate source
-        // For streaming mode, hold shared_ptr to keep data alive during iteration
-        std::shared_ptr<const std::vector<ToolpathSegment>> segments_holder;
-        const std::vector<ToolpathSegment>* segments = nullptr;
-
-        if (streaming_controller_) {
-            // Streaming mode: get segments from controller (returns shared_ptr)
-            segments_holder =
-                streaming_controller_->get_layer_segments(static_cast<size_t>(current_layer_));
-            segments = segments_holder.get();
-            // Use default centering for streaming mode
-            // (Could be improved by computing bounds from segments if needed)
-        } else if (gcode_) {
-            // Full file mode: get segments and bounding box from parsed file
-            const auto& layer_bb = gcode_->layers[current_layer_].bounding_box;
+        // Memoized: redrawing the same layer doesn't refetch it
+        // Streaming mode uses default centering
+        // (Could be improved by centering on PackedLayer::bounds() if needed)
+        const LayerView& view = current_layer_view();
+        if (view.layer) {
+            // Full file mode: center on the layer's bounding box
+            const auto& layer_bb = view.layer->bounding_box;
             offset_x_ = (layer_bb.min.x + layer_bb.max.x) / 2.0f;
             offset_y_ = (layer_bb.min.y + layer_bb.max.y) / 2.0f;
-            segments = &gcode_->layers[current_layer_].segments;
         }
 
-        if (segments) {
-            for (const auto& seg : *segments) {
-                if (!should_render_segment(seg))
-                    continue;
-                render_segment(layer, seg);
-                ++segments_rendered;
-            }
-        }
+        view.for_each([&](const SegmentRef& seg) {
+            const ObjectStyle& style = object_styles_.style(seg.style_id);
+            if (!should_render_segment(seg, style))
+                return;
+            render_segment(layer, seg, style);
+            ++segments_rendered;
+        });
     }
 
     // Draw selection brackets on top of everything
@@ -847,10 +962,13 @@ bool GCodeLayerRenderer::needs_more_frames() const {
 
     int target_layer = std::min(current_layer_, layer_count - 1);
 
-    // Solid cache incomplete?
+    // Solid cache incomplete, or a background range waiting to be composited/dropped?
     if (cached_up_to_layer_ < target_layer) {
         return true;
     }
+    if (cache_rasterizer_ && (cache_rasterizer_->busy() || cache_rasterizer_->ready())) {
+        return true;
+    }
 
     // Ghost rendering in background?
     // Keep triggering frames while ghost is building so we can show progress
@@ -863,9 +981,10 @@ bool GCodeLayerRenderer::needs_more_frames() const {
     return false;
 }
 
-bool GCodeLayerRenderer::should_render_segment(const ToolpathSegment& seg) const {
+bool GCodeLayerRenderer::should_render_segment(const SegmentRef& seg,
+                                               const ObjectStyle& style) const {
     if (seg.is_extrusion) {
-        if (is_support_segment(seg)) {
+        if (style.support) {
             return show_supports_;
         }
         return show_extrusions_;
@@ -873,7 +992,8 @@ bool GCodeLayerRenderer::should_render_segment(const ToolpathSegment& seg) const
     return show_travels_;
 }
 
-void GCodeLayerRenderer::render_segment(lv_layer_t* layer, const ToolpathSegment& seg, bool ghost) {
+void GCodeLayerRenderer::render_segment(lv_layer_t* layer, const SegmentRef& seg,
+                                        const ObjectStyle& style, bool ghost) {
     // Convert world coordinates to screen (uses Z for FRONT view)
     glm::ivec2 p1 = world_to_screen(seg.start.x, seg.start.y, seg.start.z);
     glm::ivec2 p2 = world_to_screen(seg.end.x, seg.end.y, seg.end.z);
@@ -896,7 +1016,7 @@ void GCodeLayerRenderer::render_segment(lv_layer_t* layer, const ToolpathSegment
         base_color = lv_color_make(model_color.red * 40 / 100, model_color.green * 40 / 100,
                                    model_color.blue * 40 / 100);
     } else {
-        base_color = get_segment_color(seg);
+        base_color = get_segment_color(seg, style);
     }
 
     // Apply depth shading for 3D-like appearance
@@ -915,14 +1035,10 @@ void GCodeLayerRenderer::render_segment(lv_layer_t* layer, const ToolpathSegment
     }
 
     // Check excluded/highlighted state for width/opacity
-    bool is_excluded = !seg.object_name.empty() && excluded_objects_.count(seg.object_name) > 0;
-    bool is_highlighted =
-        !seg.object_name.empty() && highlighted_objects_.count(seg.object_name) > 0;
-
-    if (is_excluded) {
+    if (style.excluded) {
         dsc.width = 1;
         dsc.opa = LV_OPA_60;
-    } else if (is_highlighted) {
+    } else if (style.highlighted) {
         dsc.width = 3;
         dsc.opa = LV_OPA_COVER;
     } else if (seg.is_extrusion) {
@@ -968,25 +1084,6 @@ glm::ivec2 GCodeLayerRenderer::world_to_screen(float x, float y, float z) const
     return {raw.x + widget_offset_x_, raw.y + widget_offset_y_};
 }
 
-bool GCodeLayerRenderer::is_support_segment(const ToolpathSegment& seg) const {
-    // Support detection via object name (from EXCLUDE_OBJECT metadata)
-    if (seg.object_name.empty()) {
-        return false;
-    }
-
-    // Common patterns used by slicers for support structures:
-    // - OrcaSlicer/PrusaSlicer: "support_*", "*_support", "SUPPORT_*"
-    // - Cura: "support", "Support"
-    const std::string& name = seg.object_name;
-
-    // Case-insensitive check for "support" anywhere in the name
-    std::string lower_name = name;
-    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
-
-    return lower_name.find("support") != std::string::npos;
-}
-
 std::optional<std::string> GCodeLayerRenderer::pick_object_at(int screen_x, int screen_y) const {
     // Need data source
     if (!gcode_ && !streaming_controller_)
@@ -1004,28 +1101,18 @@ std::optional<std::string> GCodeLayerRenderer::pick_object_at(int screen_x, int
     std::optional<std::string> picked_object;
 
     // Get segments for current layer
-    std::shared_ptr<const std::vector<ToolpathSegment>> segments_holder;
-    const std::vector<ToolpathSegment>* segments = nullptr;
-
-    if (streaming_controller_) {
-        segments_holder =
-            streaming_controller_->get_layer_segments(static_cast<size_t>(current_layer_));
-        segments = segments_holder.get();
-    } else if (gcode_) {
-        segments = &gcode_->layers[static_cast<size_t>(current_layer_)].segments;
-    }
-
-    if (!segments)
+    const LayerView& view = current_layer_view();
+    if (!view)
         return std::nullopt;
 
     glm::vec2 click_pos(static_cast<float>(screen_x), static_cast<float>(screen_y));
 
-    for (const auto& seg : *segments) {
-        if (!should_render_segment(seg))
-            continue;
+    view.for_each([&](const SegmentRef& seg) {
+        if (seg.style_id == ObjectStyleTable::NO_OBJECT)
+            return;
 
-        if (seg.object_name.empty())
-            continue;
+        if (!should_render_segment(seg, object_styles_.style(seg.style_id)))
+            return;
 
         // Project segment endpoints to screen space
         glm::ivec2 p1 = world_to_screen_raw(transform, seg.start.x, seg.start.y, seg.start.z);
@@ -1046,29 +1133,24 @@ std::optional<std::string> GCodeLayerRenderer::pick_object_at(int screen_x, int
 
         if (dist < PICK_THRESHOLD && dist < closest_distance) {
             closest_distance = dist;
-            picked_object = seg.object_name;
+            picked_object = view.object_name(seg.index);
         }
-    }
+    });
 
     return picked_object;
 }
 
-lv_color_t GCodeLayerRenderer::get_segment_color(const ToolpathSegment& seg) const {
-    // Check excluded/highlighted state first
-    if (!seg.object_name.empty()) {
-        if (excluded_objects_.count(seg.object_name) > 0) {
-            return lv_color_hex(0xFF6B35); // Orange-red for excluded
-        }
-        if (highlighted_objects_.count(seg.object_name) > 0) {
-            return lv_color_hex(0x42A5F5); // Selection blue for highlighted
-        }
+lv_color_t GCodeLayerRenderer::get_segment_color(const SegmentRef& seg,
+                                                 const ObjectStyle& style) const {
+    // Excluded (orange-red) and highlighted (selection blue) objects first
+    if (style.has_color) {
+        return lv_color_hex(style.color & 0xFFFFFF);
     }
 
-    // Existing logic below
     if (!seg.is_extrusion) {
         return color_travel_;
     }
-    if (is_support_segment(seg)) {
+    if (style.support) {
         return color_support_;
     }
     return color_extrusion_;
@@ -1076,11 +1158,11 @@ lv_color_t GCodeLayerRenderer::get_segment_color(const ToolpathSegment& seg) con
 
 void GCodeLayerRenderer::render_selection_brackets(lv_layer_t* layer) {
     // Only render if we have highlighted objects and full gcode data
-    if (highlighted_objects_.empty() || !gcode_) {
+    if (object_styles_.highlighted().empty() || !gcode_) {
         return;
     }
 
-    for (const auto& object_name : highlighted_objects_) {
+    for (const auto& object_name : object_styles_.highlighted()) {
         auto it = gcode_->objects.find(object_name);
         if (it == gcode_->objects.end()) {
             continue;
@@ -1204,8 +1286,10 @@ void GCodeLayerRenderer::start_background_ghost_render() {
     ghost_thread_ready_.store(false);
     ghost_thread_running_.store(true);
 
-    // Launch background thread
-    ghost_thread_ = std::thread(&GCodeLayerRenderer::background_ghost_render_thread, this);
+    // Launch background thread with its own copy of the object styles (copied here,
+    // on the main thread, which keeps interning names into object_styles_)
+    ghost_thread_ =
+        std::thread(&GCodeLayerRenderer::background_ghost_render_thread, this, object_styles_);
 
     spdlog::debug("[GCodeLayerRenderer] Started background ghost render thread ({}x{})", width,
                   height);
@@ -1242,7 +1326,7 @@ bool GCodeLayerRenderer::is_ghost_build_running() const {
     return ghost_thread_running_.load();
 }
 
-void GCodeLayerRenderer::background_ghost_render_thread() {
+void GCodeLayerRenderer::background_ghost_render_thread(ObjectStyleTable local_styles) {
     // Works with both full-file mode (gcode_) and streaming mode (streaming_controller_)
     if (!ghost_raw_buffer_ || (!gcode_ && !streaming_controller_)) {
         ghost_thread_running_.store(false);
@@ -1278,13 +1362,10 @@ void GCodeLayerRenderer::background_ghost_render_thread() {
     // Capture extrusion pixel width (uses scale_ which may change on main thread)
     const int local_line_width = get_extrusion_pixel_width();
 
-    // Capture excluded objects for ghost rendering (thread-safe copy)
-    const auto local_excluded = excluded_objects_;
-
     // Local version of should_render_segment using captured flags
-    auto local_should_render = [&](const ToolpathSegment& seg) -> bool {
+    auto local_should_render = [&](const SegmentRef& seg, const ObjectStyle& style) -> bool {
         if (seg.is_extrusion) {
-            if (is_support_segment(seg)) // Only reads seg fields, safe
+            if (style.support)
                 return local_show_supports;
             return local_show_extrusions;
         }
@@ -1298,6 +1379,7 @@ void GCodeLayerRenderer::background_ghost_render_thread() {
     uint8_t ghost_b = local_color_extrusion.blue * 40 / 100;
     uint8_t ghost_a = 255; // Full alpha, we'll apply 40% when blitting
     uint32_t ghost_color = (ghost_a << 24) | (ghost_r << 16) | (ghost_g << 8) | ghost_b;
+    auto* ghost_pixels = reinterpret_cast<uint32_t*>(ghost_raw_buffer_.get());
 
     // Render all layers to raw buffer
     // Works with both full-file mode (gcode_) and streaming mode (streaming_controller_)
@@ -1310,27 +1392,16 @@ void GCodeLayerRenderer::background_ghost_render_thread() {
             return;
         }
 
-        // Get segments from appropriate source
-        // CRITICAL: For streaming mode, hold shared_ptr to keep data alive during iteration.
-        // This prevents use-after-free if cache evicts the layer while we're iterating.
-        std::shared_ptr<const std::vector<ToolpathSegment>> segments_holder;
-        const std::vector<ToolpathSegment>* segments = nullptr;
-
-        if (streaming_controller_) {
-            // Streaming mode: get segments from controller (returns shared_ptr)
-            segments_holder =
-                streaming_controller_->get_layer_segments(static_cast<size_t>(layer_idx));
-            segments = segments_holder.get();
-        } else if (gcode_) {
-            segments = &gcode_->layers[layer_idx].segments;
-        }
-
-        if (!segments)
+        // CRITICAL: For streaming mode, the view holds the packed layer alive during
+        // iteration. This prevents use-after-free if cache evicts the layer meanwhile.
+        LayerView view = load_layer_view(gcode_, streaming_controller_, layer_idx, local_styles);
+        if (!view)
             continue;
 
-        for (const auto& seg : *segments) {
-            if (!local_should_render(seg))
-                continue;
+        view.for_each([&](const SegmentRef& seg) {
+            const ObjectStyle& style = local_styles.style(seg.style_id);
+            if (!local_should_render(seg, style))
+                return;
 
             // Use unified world_to_screen_raw - includes content offset!
             glm::ivec2 p1 = world_to_screen_raw(transform, seg.start.x, seg.start.y, seg.start.z);
@@ -1338,11 +1409,11 @@ void GCodeLayerRenderer::background_ghost_render_thread() {
 
             // Skip zero-length segments
             if (p1.x == p2.x && p1.y == p2.y)
-                continue;
+                return;
 
             // Use excluded color for excluded objects even in ghost
             uint32_t seg_color = ghost_color;
-            if (!seg.object_name.empty() && local_excluded.count(seg.object_name) > 0) {
+            if (style.excluded) {
                 // Excluded: dim orange-red
                 uint8_t ex_r = 0xFF * 40 / 100;
                 uint8_t ex_g = 0x6B * 40 / 100;
@@ -1351,9 +1422,11 @@ void GCodeLayerRenderer::background_ghost_render_thread() {
             }
 
             // Draw line using Bresenham algorithm (width-aware)
-            draw_thick_line_bresenham(p1.x, p1.y, p2.x, p2.y, seg_color, local_line_width);
+            draw_raster_line(ghost_pixels, ghost_raw_stride_ / 4, ghost_raw_width_, 0,
+                             ghost_raw_height_,
+                             RasterLine{p1.x, p1.y, p2.x, p2.y, seg_color, local_line_width});
             ++segments_rendered;
-        }
+        });
     }
 
     // Mark as ready for main thread to copy
@@ -1413,42 +1486,6 @@ void GCodeLayerRenderer::copy_raw_to_ghost_buf() {
                   ghost_raw_height_);
 }
 
-void GCodeLayerRenderer::blend_pixel(int x, int y, uint32_t color) {
-    // Bounds check
-    if (x < 0 || x >= ghost_raw_width_ || y < 0 || y >= ghost_raw_height_) {
-        return;
-    }
-
-    // Calculate pixel offset (ARGB8888 = 4 bytes per pixel)
-    uint8_t* pixel = ghost_raw_buffer_.get() + y * ghost_raw_stride_ + x * 4;
-
-    // Simple overwrite for now (could add alpha blending later)
-    // LVGL uses ARGB8888: byte order is B, G, R, A on little-endian
-    pixel[0] = color & 0xFF;         // B
-    pixel[1] = (color >> 8) & 0xFF;  // G
-    pixel[2] = (color >> 16) & 0xFF; // R
-    pixel[3] = (color >> 24) & 0xFF; // A
-}
-
-void GCodeLayerRenderer::blend_pixel_solid(int x, int y, uint32_t color) {
-    // Bounds check using cached dimensions
-    if (x < 0 || x >= cached_width_ || y < 0 || y >= cached_height_ || !cache_buf_) {
-        return;
-    }
-
-    // Get stride from LVGL buffer (may differ from width * 4 due to alignment)
-    uint32_t stride = cache_buf_->header.stride;
-
-    // Calculate pixel offset (ARGB8888 = 4 bytes per pixel)
-    uint8_t* pixel = static_cast<uint8_t*>(cache_buf_->data) + y * stride + x * 4;
-
-    // LVGL uses ARGB8888: byte order is B, G, R, A on little-endian
-    pixel[0] = color & 0xFF;         // B
-    pixel[1] = (color >> 8) & 0xFF;  // G
-    pixel[2] = (color >> 16) & 0xFF; // R
-    pixel[3] = (color >> 24) & 0xFF; // A
-}
-
 int GCodeLayerRenderer::get_extrusion_pixel_width() const {
     float width_mm = 0.4f; // Default fallback
 
@@ -1466,131 +1503,6 @@ int GCodeLayerRenderer::get_extrusion_pixel_width() const {
     return std::clamp(pixel_width, 1, 8);
 }
 
-void GCodeLayerRenderer::draw_thick_line_bresenham(int x0, int y0, int x1, int y1, uint32_t color,
-                                                   int width) {
-    if (width <= 1) {
-        draw_line_bresenham(x0, y0, x1, y1, color);
-        return;
-    }
-
-    // Compute perpendicular direction to the line
-    float dx = static_cast<float>(x1 - x0);
-    float dy = static_cast<float>(y1 - y0);
-    float len = std::sqrt(dx * dx + dy * dy);
-
-    if (len < 0.001f) {
-        draw_line_bresenham(x0, y0, x1, y1, color);
-        return;
-    }
-
-    // Perpendicular unit vector (rotated 90 degrees)
-    float px = -dy / len;
-    float py = dx / len;
-
-    // Draw parallel lines offset by [-width/2, +width/2]
-    float half = static_cast<float>(width - 1) * 0.5f;
-    for (int i = 0; i < width; ++i) {
-        float offset = static_cast<float>(i) - half;
-        int ox = static_cast<int>(std::round(px * offset));
-        int oy = static_cast<int>(std::round(py * offset));
-        draw_line_bresenham(x0 + ox, y0 + oy, x1 + ox, y1 + oy, color);
-    }
-}
-
-void GCodeLayerRenderer::draw_thick_line_bresenham_solid(int x0, int y0, int x1, int y1,
-                                                         uint32_t color, int width) {
-    if (width <= 1) {
-        draw_line_bresenham_solid(x0, y0, x1, y1, color);
-        return;
-    }
-
-    // Compute perpendicular direction to the line
-    float dx = static_cast<float>(x1 - x0);
-    float dy = static_cast<float>(y1 - y0);
-    float len = std::sqrt(dx * dx + dy * dy);
-
-    if (len < 0.001f) {
-        draw_line_bresenham_solid(x0, y0, x1, y1, color);
-        return;
-    }
-
-    // Perpendicular unit vector (rotated 90 degrees)
-    float px = -dy / len;
-    float py = dx / len;
-
-    // Draw parallel lines offset by [-width/2, +width/2]
-    float half = static_cast<float>(width - 1) * 0.5f;
-    for (int i = 0; i < width; ++i) {
-        float offset = static_cast<float>(i) - half;
-        int ox = static_cast<int>(std::round(px * offset));
-        int oy = static_cast<int>(std::round(py * offset));
-        draw_line_bresenham_solid(x0 + ox, y0 + oy, x1 + ox, y1 + oy, color);
-    }
-}
-
-void GCodeLayerRenderer::draw_line_bresenham_solid(int x0, int y0, int x1, int y1, uint32_t color) {
-    // Bresenham's line algorithm for software line drawing to solid cache
-
-    int dx = std::abs(x1 - x0);
-    int dy = -std::abs(y1 - y0);
-    int sx = x0 < x1 ? 1 : -1;
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
-
-    while (true) {
-        blend_pixel_solid(x0, y0, color);
-
-        if (x0 == x1 && y0 == y1)
-            break;
-
-        int e2 = 2 * err;
-        if (e2 >= dy) {
-            if (x0 == x1)
-                break;
-            err += dy;
-            x0 += sx;
-        }
-        if (e2 <= dx) {
-            if (y0 == y1)
-                break;
-            err += dx;
-            y0 += sy;
-        }
-    }
-}
-
-void GCodeLayerRenderer::draw_line_bresenham(int x0, int y0, int x1, int y1, uint32_t color) {
-    // Bresenham's line algorithm for software line drawing
-    // This runs in the background thread where LVGL APIs are not available
-
-    int dx = std::abs(x1 - x0);
-    int dy = -std::abs(y1 - y0);
-    int sx = x0 < x1 ? 1 : -1;
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
-
-    while (true) {
-        blend_pixel(x0, y0, color);
-
-        if (x0 == x1 && y0 == y1)
-            break;
-
-        int e2 = 2 * err;
-        if (e2 >= dy) {
-            if (x0 == x1)
-                break;
-            err += dy;
-            x0 += sx;
-        }
-        if (e2 <= dx) {
-            if (y0 == y1)
-                break;
-            err += dx;
-            y0 += sy;
-        }
-    }
-}
-
 // ============================================================================
 // Configuration
 // ============================================================================
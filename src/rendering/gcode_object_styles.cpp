@@ -0,0 +1,103 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_object_styles.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+
+namespace helix {
+namespace gcode {
+
+ObjectStyleTable::ObjectStyleTable() {
+    clear();
+}
+
+uint16_t ObjectStyleTable::resolve(const std::string& name) {
+    if (name.empty()) {
+        return NO_OBJECT;
+    }
+    if (name == last_name_) {
+        return last_id_;
+    }
+
+    uint16_t id = NO_OBJECT;
+    auto it = ids_.find(name);
+    if (it != ids_.end()) {
+        id = it->second;
+    } else if (names_.size() <= std::numeric_limits<uint16_t>::max()) {
+        id = static_cast<uint16_t>(names_.size());
+        ids_.emplace(name, id);
+        names_.push_back(name);
+        styles_.push_back(make_style(name));
+    } else {
+        spdlog::warn("[ObjectStyleTable] Too many objects, '{}' drawn unstyled", name);
+    }
+
+    last_name_ = name;
+    last_id_ = id;
+    return id;
+}
+
+bool ObjectStyleTable::set_excluded(const std::unordered_set<std::string>& names) {
+    if (names == excluded_) {
+        return false;
+    }
+    excluded_ = names;
+    rebuild();
+    return true;
+}
+
+bool ObjectStyleTable::set_highlighted(const std::unordered_set<std::string>& names) {
+    if (names == highlighted_) {
+        return false;
+    }
+    highlighted_ = names;
+    rebuild();
+    return true;
+}
+
+void ObjectStyleTable::clear() {
+    ids_.clear();
+    names_.assign(1, std::string());
+    styles_.assign(1, ObjectStyle{});
+    last_name_.clear();
+    last_id_ = NO_OBJECT;
+}
+
+bool ObjectStyleTable::is_support_name(const std::string& name) {
+    // Case-insensitive check for "support" anywhere in the name
+    static constexpr char kSupport[] = "support";
+    auto equal_lower = [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == b;
+    };
+    return std::search(name.begin(), name.end(), kSupport, kSupport + sizeof(kSupport) - 1,
+                       equal_lower) != name.end();
+}
+
+ObjectStyle ObjectStyleTable::make_style(const std::string& name) const {
+    ObjectStyle style;
+    style.support = is_support_name(name);
+    if (excluded_.count(name) > 0) {
+        style.excluded = true;
+        style.has_color = true;
+        style.color = EXCLUDED_COLOR;
+    } else if (highlighted_.count(name) > 0) {
+        style.highlighted = true;
+        style.has_color = true;
+        style.color = HIGHLIGHTED_COLOR;
+    }
+    return style;
+}
+
+void ObjectStyleTable::rebuild() {
+    for (size_t id = 1; id < names_.size(); ++id) {
+        styles_[id] = make_style(names_[id]);
+    }
+}
+
+} // namespace gcode
+} // namespace helix
@@ -0,0 +1,158 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_packed_layer.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+constexpr float QUANT_MAX = static_cast<float>(std::numeric_limits<uint16_t>::max());
+
+inline uint16_t quantize(float value, float origin, float inv_step) {
+    float q = (value - origin) * inv_step;
+    return static_cast<uint16_t>(std::lround(std::clamp(q, 0.0f, QUANT_MAX)));
+}
+
+inline uint16_t width_to_um(float width_mm) {
+    float um = std::round(width_mm * 1000.0f);
+    return static_cast<uint16_t>(std::clamp(um, 0.0f, QUANT_MAX));
+}
+
+} // anonymous namespace
+
+PackedLayer::PackedLayer(const std::vector<ToolpathSegment>& segments) {
+    const size_t n = segments.size();
+    names_.emplace_back();
+
+    for (const auto& seg : segments) {
+        bounds_.expand(seg.start);
+        bounds_.expand(seg.end);
+    }
+
+    // Quantize each axis over the layer bounds; a flat axis (e.g. Z on most
+    // layers) has step 0 and decodes exactly
+    const float mins[3] = {bounds_.min.x, bounds_.min.y, bounds_.min.z};
+    const float maxs[3] = {bounds_.max.x, bounds_.max.y, bounds_.max.z};
+    float inv_step[3] = {0.0f, 0.0f, 0.0f};
+    for (int axis = 0; axis < 3 && n > 0; ++axis) {
+        origin_[axis] = mins[axis];
+        float range = maxs[axis] - mins[axis];
+        if (range > 0.0f) {
+            step_[axis] = range / QUANT_MAX;
+            inv_step[axis] = QUANT_MAX / range;
+        }
+    }
+
+    for (auto& plane : start_) {
+        plane.reserve(n);
+    }
+    for (auto& plane : end_) {
+        plane.reserve(n);
+    }
+    extrusion_.reserve(n);
+    width_um_.reserve(n);
+    object_.reserve(n);
+    flags_.reserve(n);
+
+    // Segments of one object are contiguous, so only look up name changes
+    std::unordered_map<std::string, uint16_t> name_index;
+    const std::string empty_name;
+    const std::string* last_name = &empty_name;
+    uint16_t last_index = NO_OBJECT;
+    bool warned_names = false;
+
+    for (const auto& seg : segments) {
+        const float s[3] = {seg.start.x, seg.start.y, seg.start.z};
+        const float e[3] = {seg.end.x, seg.end.y, seg.end.z};
+        for (int axis = 0; axis < 3; ++axis) {
+            start_[axis].push_back(quantize(s[axis], origin_[axis], inv_step[axis]));
+            end_[axis].push_back(quantize(e[axis], origin_[axis], inv_step[axis]));
+        }
+        extrusion_.push_back(seg.extrusion_amount);
+        width_um_.push_back(width_to_um(seg.width));
+
+        if (seg.object_name != *last_name) {
+            if (seg.object_name.empty()) {
+                last_index = NO_OBJECT;
+            } else if (auto it = name_index.find(seg.object_name); it != name_index.end()) {
+                last_index = it->second;
+            } else if (names_.size() <= std::numeric_limits<uint16_t>::max()) {
+                last_index = static_cast<uint16_t>(names_.size());
+                names_.push_back(seg.object_name);
+                name_index.emplace(seg.object_name, last_index);
+            } else {
+                if (!warned_names) {
+                    spdlog::warn("[PackedLayer] More than {} object names in one layer",
+                                 names_.size());
+                    warned_names = true;
+                }
+                last_index = NO_OBJECT;
+            }
+            last_name = &seg.object_name;
+        }
+        object_.push_back(last_index);
+
+        int tool = std::clamp(seg.tool_index, 0, MAX_TOOL_INDEX);
+        flags_.push_back(static_cast<uint8_t>((seg.is_extrusion ? FLAG_EXTRUSION : 0) | tool));
+    }
+
+    names_.shrink_to_fit();
+}
+
+float PackedLayer::max_position_error() const {
+    return std::max({step_[0], step_[1], step_[2]}) * 0.5f;
+}
+
+ToolpathSegment PackedLayer::segment(size_t i) const {
+    ToolpathSegment seg;
+    seg.start = start(i);
+    seg.end = end(i);
+    seg.is_extrusion = is_extrusion(i);
+    seg.object_name = object_name(i);
+    seg.extrusion_amount = extrusion_[i];
+    seg.width = width(i);
+    seg.tool_index = tool_index(i);
+    return seg;
+}
+
+std::vector<ToolpathSegment> PackedLayer::unpack() const {
+    std::vector<ToolpathSegment> segments;
+    segments.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        segments.push_back(segment(i));
+    }
+    return segments;
+}
+
+size_t PackedLayer::memory_bytes() const {
+    size_t bytes = sizeof(*this);
+    for (const auto& plane : start_) {
+        bytes += plane.capacity() * sizeof(uint16_t);
+    }
+    for (const auto& plane : end_) {
+        bytes += plane.capacity() * sizeof(uint16_t);
+    }
+    bytes += extrusion_.capacity() * sizeof(float);
+    bytes += width_um_.capacity() * sizeof(uint16_t);
+    bytes += object_.capacity() * sizeof(uint16_t);
+    bytes += flags_.capacity() * sizeof(uint8_t);
+    bytes += names_.capacity() * sizeof(std::string);
+    for (const auto& name : names_) {
+        if (name.capacity() > 15) { // Beyond SSO threshold
+            bytes += name.capacity() + 1;
+        }
+    }
+    return bytes;
+}
+
+} // namespace gcode
+} // namespace helix
@@ -80,31 +80,33 @@ void GCodeParser::reset() {
     // (see add_segment() which creates a layer if layers_ is empty)
 }
 
-void GCodeParser::parse_line(const std::string& line) {
+void GCodeParser::parse_line(std::string_view line) {
     lines_parsed_++;
 
-    // Extract and parse metadata comments before trimming
-    size_t comment_pos = line.find(';');
-    if (comment_pos != std::string::npos) {
-        std::string comment = line.substr(comment_pos);
+    // Split command and comment in one pass (no allocation)
+    GCodeTokens tokens = tokenize_gcode_line(line);
+
+    // Extract and parse metadata comments
+    if (!tokens.comment.empty()) {
+        std::string comment(tokens.comment);
         parse_metadata_comment(comment);
         parse_wipe_tower_marker(comment);
     }
 
-    std::string trimmed = trim_line(line);
+    std::string_view trimmed = tokens.code;
     if (trimmed.empty()) {
         return;
     }
 
     // Check for tool changes (T0, T1, T2, etc.)
-    if (!trimmed.empty() && trimmed[0] == 'T') {
-        parse_tool_change_command(trimmed);
+    if (trimmed[0] == 'T') {
+        parse_tool_change_command(std::string(trimmed));
         // Continue processing - some G-code files have commands after tool changes
     }
 
     // Check for EXCLUDE_OBJECT commands first
-    if (trimmed.find("EXCLUDE_OBJECT") == 0) {
-        parse_exclude_object_command(trimmed);
+    if (trimmed.compare(0, 14, "EXCLUDE_OBJECT") == 0) {
+        parse_exclude_object_command(std::string(trimmed));
         return;
     }
 
@@ -124,13 +126,14 @@ void GCodeParser::parse_line(const std::string& line) {
     }
 
     // Parse movement commands (G0, G1)
-    if (trimmed[0] == 'G' && (trimmed.find("G0 ") == 0 || trimmed.find("G1 ") == 0 ||
-                              trimmed == "G0" || trimmed == "G1")) {
-        parse_movement_command(trimmed);
+    if (trimmed[0] == 'G' && (trimmed.compare(0, 3, "G0 ") == 0 ||
+                              trimmed.compare(0, 3, "G1 ") == 0 || trimmed == "G0" ||
+                              trimmed == "G1")) {
+        parse_movement_command(tokens);
     }
 }
 
-bool GCodeParser::parse_movement_command(const std::string& line) {
+bool GCodeParser::parse_movement_command(const GCodeTokens& tokens) {
     glm::vec3 new_position = current_position_;
     float new_e = current_e_;
     bool has_movement = false;
@@ -138,15 +141,15 @@ bool GCodeParser::parse_movement_command(const std::string& line) {
 
     // Extract X, Y, Z parameters
     float value;
-    if (extract_param(line, 'X', value)) {
+    if (tokens.param(GCodeAxis::X, value)) {
         new_position.x = is_absolute_positioning_ ? value : current_position_.x + value;
         has_movement = true;
     }
-    if (extract_param(line, 'Y', value)) {
+    if (tokens.param(GCodeAxis::Y, value)) {
         new_position.y = is_absolute_positioning_ ? value : current_position_.y + value;
         has_movement = true;
     }
-    if (extract_param(line, 'Z', value)) {
+    if (tokens.param(GCodeAxis::Z, value)) {
         new_position.z = is_absolute_positioning_ ? value : current_position_.z + value;
         has_movement = true;
 
@@ -169,7 +172,7 @@ bool GCodeParser::parse_movement_command(const std::string& line) {
     }
 
     // Extract E (extrusion) parameter
-    if (extract_param(line, 'E', value)) {
+    if (tokens.param(GCodeAxis::E, value)) {
         new_e = is_absolute_extrusion_ ? value : current_e_ + value;
         has_extrusion = true;
     }
@@ -638,42 +641,6 @@ void GCodeParser::parse_wipe_tower_marker(const std::string& comment) {
     }
 }
 
-bool GCodeParser::extract_param(const std::string& line, char param, float& out_value) {
-    size_t pos = line.find(param);
-    if (pos == std::string::npos) {
-        return false;
-    }
-
-    // Make sure it's a parameter (preceded by space or at start after command)
-    if (pos > 0 && line[pos - 1] != ' ' && line[pos - 1] != '\t') {
-        return false;
-    }
-
-    // Extract number after parameter letter
-    size_t start = pos + 1;
-    if (start >= line.length()) {
-        return false;
-    }
-
-    // Find end of number (space, end of string, or another letter)
-    size_t end = start;
-    while (end < line.length() &&
-           (std::isdigit(line[end]) || line[end] == '.' || line[end] == '-' || line[end] == '+')) {
-        end++;
-    }
-
-    if (end == start) {
-        return false;
-    }
-
-    try {
-        out_value = std::stof(line.substr(start, end - start));
-        return true;
-    } catch (...) {
-        return false;
-    }
-}
-
 bool GCodeParser::extract_string_param(const std::string& line, const std::string& param,
                                        std::string& out_value) {
     size_t pos = line.find(param + "=");
@@ -802,34 +769,6 @@ void GCodeParser::start_new_layer(float z) {
     spdlog::trace("[GCode Parser] Started layer {} at Z={:.3f}", layers_.size() - 1, z);
 }
 
-std::string GCodeParser::trim_line(const std::string& line) {
-    if (line.empty()) {
-        return line;
-    }
-
-    // Remove comments (everything after ';')
-    size_t comment_pos = line.find(';');
-    std::string without_comment =
-        (comment_pos != std::string::npos) ? line.substr(0, comment_pos) : line;
-
-    // Trim leading/trailing whitespace
-    size_t start = 0;
-    while (start < without_comment.length() && std::isspace(without_comment[start])) {
-        start++;
-    }
-
-    if (start == without_comment.length()) {
-        return "";
-    }
-
-    size_t end = without_comment.length();
-    while (end > start && std::isspace(without_comment[end - 1])) {
-        end--;
-    }
-
-    return without_comment.substr(start, end - start);
-}
-
 ParsedGCodeFile GCodeParser::finalize() {
     ParsedGCodeFile result;
     result.filename = "";
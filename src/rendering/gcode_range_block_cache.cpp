@@ -0,0 +1,215 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_range_block_cache.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace helix {
+namespace gcode {
+
+RangeBlockCache::RangeBlockCache(uint64_t file_size, size_t budget_bytes, Fetcher fetcher,
+                                 uint32_t block_size, uint32_t readahead_blocks)
+    : file_size_(file_size),
+      budget_bytes_(std::max<size_t>(budget_bytes, 2 * static_cast<size_t>(block_size))),
+      fetcher_(std::move(fetcher)), block_size_(std::max<uint32_t>(block_size, 1)),
+      readahead_blocks_(readahead_blocks) {}
+
+std::vector<char> RangeBlockCache::read(uint64_t offset, uint32_t length) {
+    if (length == 0 || offset >= file_size_ || !fetcher_) {
+        return {};
+    }
+
+    uint64_t end = std::min<uint64_t>(offset + length, file_size_);
+    uint64_t first = offset / block_size_;
+    uint64_t last = (end - 1) / block_size_;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // Readahead follows the last read that actually moved
+    if (offset > last_offset_) {
+        direction_ = 1;
+    } else if (offset < last_offset_) {
+        direction_ = -1;
+    }
+    last_offset_ = offset;
+
+    bool counted = false;
+    while (true) {
+        std::vector<uint64_t> to_fetch;
+        bool waiting = false;
+        for (uint64_t b = first; b <= last; ++b) {
+            if (blocks_.count(b) != 0) {
+                continue;
+            }
+            if (in_flight_.count(b) != 0) {
+                waiting = true;
+            } else {
+                to_fetch.push_back(b);
+            }
+        }
+
+        if (!counted) {
+            counted = true;
+            uint64_t missing = 0;
+            for (uint64_t b = first; b <= last; ++b) {
+                missing += blocks_.count(b) == 0 ? 1 : 0;
+            }
+            stats_.block_misses += missing;
+            stats_.block_hits += (last - first + 1) - missing;
+        }
+
+        if (to_fetch.empty() && !waiting) {
+            break;
+        }
+
+        if (!to_fetch.empty()) {
+            // Ride the readahead on the same request as the miss
+            size_t requested = to_fetch.size();
+            for (uint32_t i = 1; i <= readahead_blocks_; ++i) {
+                uint64_t b;
+                if (direction_ > 0) {
+                    b = last + i;
+                    if (b >= block_count()) {
+                        break;
+                    }
+                } else {
+                    if (first < i) {
+                        break;
+                    }
+                    b = first - i;
+                }
+                if (blocks_.count(b) == 0 && in_flight_.count(b) == 0) {
+                    to_fetch.push_back(b);
+                }
+            }
+            stats_.prefetched += to_fetch.size() - requested;
+            std::sort(to_fetch.begin(), to_fetch.end());
+
+            std::vector<Run> runs;
+            for (uint64_t b : to_fetch) {
+                if (!runs.empty() && runs.back().first + runs.back().count == b &&
+                    runs.back().count < MAX_FETCH_BLOCKS) {
+                    ++runs.back().count;
+                } else {
+                    runs.push_back(Run{b, 1});
+                }
+                in_flight_.insert(b);
+            }
+
+            lock.unlock();
+            std::vector<std::pair<uint64_t, std::vector<char>>> fetched;
+            bool ok = fetch_runs(runs, fetched);
+            lock.lock();
+
+            for (auto& [index, data] : fetched) {
+                if (blocks_.count(index) != 0) {
+                    continue;
+                }
+                cached_bytes_ += data.size();
+                lru_.push_front(index);
+                blocks_.emplace(index, Block{std::move(data), lru_.begin()});
+            }
+            for (uint64_t b : to_fetch) {
+                in_flight_.erase(b);
+            }
+            fetched_cv_.notify_all();
+
+            if (!ok) {
+                return {};
+            }
+            continue;
+        }
+
+        // Another reader is fetching some of our blocks
+        fetched_cv_.wait(lock, [&] {
+            for (uint64_t b = first; b <= last; ++b) {
+                if (in_flight_.count(b) != 0) {
+                    return false;
+                }
+            }
+            return true;
+        });
+        // The other reader's fetch may have failed; the next pass fetches
+        // whatever is still missing itself
+    }
+
+    std::vector<char> out(static_cast<size_t>(end - offset));
+    for (uint64_t b = first; b <= last; ++b) {
+        Block& block = blocks_.at(b);
+        lru_.splice(lru_.begin(), lru_, block.lru);
+
+        uint64_t block_start = b * block_size_;
+        uint64_t copy_start = std::max(offset, block_start);
+        uint64_t copy_end = std::min<uint64_t>(end, block_start + block.data.size());
+        if (copy_end > copy_start) {
+            std::memcpy(out.data() + (copy_start - offset),
+                        block.data.data() + (copy_start - block_start),
+                        static_cast<size_t>(copy_end - copy_start));
+        }
+    }
+
+    evict_to_budget();
+    return out;
+}
+
+bool RangeBlockCache::fetch_runs(const std::vector<Run>& runs,
+                                 std::vector<std::pair<uint64_t, std::vector<char>>>& fetched) {
+    for (const Run& run : runs) {
+        uint64_t run_offset = run.first * block_size_;
+        uint64_t run_length = std::min<uint64_t>(static_cast<uint64_t>(run.count) * block_size_,
+                                                 file_size_ - run_offset);
+
+        std::vector<char> data;
+        bool ok = fetcher_(run_offset, static_cast<uint32_t>(run_length), data);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++stats_.fetches;
+            stats_.bytes_fetched += data.size();
+        }
+        if (!ok || data.size() != run_length) {
+            spdlog::warn("[RangeBlockCache] Fetch of {} bytes at {} failed (got {})", run_length,
+                         run_offset, data.size());
+            return false;
+        }
+
+        for (uint32_t i = 0; i < run.count; ++i) {
+            size_t start = static_cast<size_t>(i) * block_size_;
+            size_t stop = std::min<size_t>(start + block_size_, data.size());
+            fetched.emplace_back(run.first + i,
+                                 std::vector<char>(data.begin() + start, data.begin() + stop));
+        }
+    }
+    return true;
+}
+
+void RangeBlockCache::evict_to_budget() {
+    while (cached_bytes_ > budget_bytes_ && !lru_.empty()) {
+        uint64_t victim = lru_.back();
+        lru_.pop_back();
+        auto it = blocks_.find(victim);
+        cached_bytes_ -= it->second.data.size();
+        blocks_.erase(it);
+        ++stats_.evictions;
+    }
+}
+
+RangeBlockCache::Stats RangeBlockCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats s = stats_;
+    s.cached_bytes = cached_bytes_;
+    return s;
+}
+
+void RangeBlockCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    blocks_.clear();
+    lru_.clear();
+    cached_bytes_ = 0;
+}
+
+} // namespace gcode
+} // namespace helix
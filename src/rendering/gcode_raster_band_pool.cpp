@@ -0,0 +1,151 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_raster_band_pool.h"
+
+#ifdef ENABLE_TINYGL_3D
+
+#include "gcode_streaming_config.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <string>
+#include <system_error>
+
+// TinyGL headers
+#include <GL/gl.h>
+
+namespace helix {
+namespace gcode {
+
+namespace {
+constexpr unsigned MAX_AUTO_BANDS = 4;
+constexpr unsigned MAX_BANDS = 16;
+} // namespace
+
+RasterBandPool::RasterBandPool(unsigned band_count) {
+    band_count = std::clamp(band_count, 1u, MAX_BANDS);
+
+    workers_.reserve(band_count);
+    for (unsigned i = 0; i < band_count; ++i) {
+        try {
+            workers_.emplace_back(&RasterBandPool::worker_loop, this, i);
+        } catch (const std::system_error& e) {
+            spdlog::warn("[RasterBandPool] Failed to start worker {}: {}", i, e.what());
+            break;
+        }
+    }
+
+    // Bands are assigned by worker index, so a partial start must not leave
+    // the workers that did start splitting the frame by the wrong count
+    if (workers_.size() < band_count) {
+        stop();
+        spdlog::error("[RasterBandPool] Not all workers started - rasterizing serially");
+    }
+}
+
+RasterBandPool::~RasterBandPool() {
+    detach();
+    stop();
+}
+
+bool RasterBandPool::attach() {
+    if (workers_.empty()) {
+        return false;
+    }
+    glSetRasterBandHandler(&RasterBandPool::dispatch_thunk, &RasterBandPool::wait_thunk, this);
+    attached_ = true;
+    spdlog::debug("[RasterBandPool] Rasterizing in {} bands", workers_.size());
+    return true;
+}
+
+void RasterBandPool::detach() {
+    if (!attached_) {
+        return;
+    }
+    glSetRasterBandHandler(nullptr, nullptr, nullptr); // Waits for queued chunks
+    attached_ = false;
+}
+
+RasterBandPool::Stats RasterBandPool::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+unsigned RasterBandPool::configured_band_count() {
+    // 0 = auto
+    int threads = get_gcode_int_setting("HELIX_GCODE_RASTER_THREADS",
+                                        "/gcode_viewer/raster_threads", 0, 0,
+                                        static_cast<int>(MAX_BANDS));
+    if (threads > 0) {
+        return std::min(static_cast<unsigned>(threads), MAX_BANDS);
+    }
+    unsigned cores = std::thread::hardware_concurrency();
+    return std::clamp(cores, 1u, MAX_AUTO_BANDS);
+}
+
+void RasterBandPool::dispatch_thunk(void* user, const GLRasterChunk* chunk) {
+    static_cast<RasterBandPool*>(user)->dispatch(chunk);
+}
+
+void RasterBandPool::wait_thunk(void* user) {
+    static_cast<RasterBandPool*>(user)->wait();
+}
+
+void RasterBandPool::dispatch(const GLRasterChunk* chunk) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        chunk_ = chunk;
+        remaining_ = static_cast<unsigned>(workers_.size());
+        ++generation_;
+        ++stats_.chunks;
+    }
+    work_cv_.notify_all();
+}
+
+void RasterBandPool::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] { return remaining_ == 0; });
+}
+
+void RasterBandPool::worker_loop(unsigned band) {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        work_cv_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+        if (stopping_) {
+            return;
+        }
+        seen = generation_;
+        const GLRasterChunk* chunk = chunk_;
+        auto bands = static_cast<GLint>(workers_.size());
+
+        lock.unlock();
+        glRasterChunkBand(chunk, static_cast<GLint>(band), bands);
+        lock.lock();
+
+        if (--remaining_ == 0) {
+            done_cv_.notify_one();
+        }
+    }
+}
+
+void RasterBandPool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+}
+
+} // namespace gcode
+} // namespace helix
+
+#endif // ENABLE_TINYGL_3D
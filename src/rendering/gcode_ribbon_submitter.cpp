@@ -0,0 +1,92 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_ribbon_submitter.h"
+
+#ifdef ENABLE_TINYGL_3D
+
+#include <algorithm>
+
+// TinyGL headers
+#include <GL/gl.h>
+
+namespace helix {
+namespace gcode {
+
+void RibbonSubmitter::prepare(const RibbonGeometry& geometry, float dim_factor) {
+    geometry_ = &geometry;
+    last_normal_ = NO_INDEX;
+    last_color_ = NO_INDEX;
+
+    if (dim_factor == dim_factor_ && geometry.color_palette == source_palette_) {
+        return;
+    }
+
+    source_palette_ = geometry.color_palette;
+    dim_factor_ = dim_factor;
+    colors_.resize(source_palette_.size());
+    for (size_t i = 0; i < source_palette_.size(); ++i) {
+        uint32_t color_rgb = source_palette_[i];
+        uint8_t r = (color_rgb >> 16) & 0xFF;
+        uint8_t g = (color_rgb >> 8) & 0xFF;
+        uint8_t b = color_rgb & 0xFF;
+        // Same expression as the per-vertex path so output stays identical
+        colors_[i] = {(r / 255.0f) * dim_factor, (g / 255.0f) * dim_factor,
+                      (b / 255.0f) * dim_factor};
+    }
+    ++palette_rebuilds_;
+}
+
+void RibbonSubmitter::submit(size_t first_strip, size_t strip_count) {
+    if (!geometry_ || first_strip >= geometry_->strips.size()) {
+        return;
+    }
+    size_t end_strip = first_strip + std::min(strip_count, geometry_->strips.size() - first_strip);
+
+    const auto& strips = geometry_->strips;
+    const auto& vertices = geometry_->vertices;
+    const auto& normals = geometry_->normal_palette;
+    const float scale = geometry_->quantization.scale_factor;
+    const glm::vec3 min_bounds = geometry_->quantization.min_bounds;
+
+    for (size_t s = first_strip; s < end_strip; ++s) {
+        const auto& strip = strips[s];
+
+        glBegin(GL_TRIANGLE_STRIP);
+        for (uint32_t index : strip) {
+            const RibbonVertex& vertex = vertices[index];
+
+            if (vertex.normal_index != last_normal_) {
+                const glm::vec3& normal = normals[vertex.normal_index];
+                glNormal3f(normal.x, normal.y, normal.z);
+                last_normal_ = vertex.normal_index;
+            }
+
+            if (vertex.color_index != last_color_) {
+                const auto& rgb = colors_[vertex.color_index];
+                glColor3f(rgb[0], rgb[1], rgb[2]);
+                last_color_ = vertex.color_index;
+            }
+
+            // Same arithmetic as QuantizationParams::dequantize(), inlined
+            glVertex3f(static_cast<float>(vertex.position.x) / scale + min_bounds.x,
+                       static_cast<float>(vertex.position.y) / scale + min_bounds.y,
+                       static_cast<float>(vertex.position.z) / scale + min_bounds.z);
+        }
+        glEnd();
+    }
+}
+
+void RibbonSubmitter::invalidate() {
+    geometry_ = nullptr;
+    source_palette_.clear();
+    colors_.clear();
+    dim_factor_ = -1.0f;
+    last_normal_ = NO_INDEX;
+    last_color_ = NO_INDEX;
+}
+
+} // namespace gcode
+} // namespace helix
+
+#endif // ENABLE_TINYGL_3D
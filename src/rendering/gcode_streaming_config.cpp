@@ -4,11 +4,13 @@
 #include "gcode_streaming_config.h"
 
 #include "config.h"
+#include "environment_config.h"
 #include "memory_utils.h"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <cctype>
 #include <cstdlib>
 #include <cstring>
 
@@ -154,4 +156,76 @@ std::string get_streaming_config_description() {
     return "streaming=" + mode_str;
 }
 
+bool use_gcode_mmap() {
+    std::string mode = "auto";
+
+    const char* env = std::getenv("HELIX_GCODE_MMAP");
+    if (env != nullptr) {
+        mode = env;
+        std::transform(mode.begin(), mode.end(), mode.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    } else if (Config* config = Config::get_instance(); config != nullptr) {
+        mode = config->get<std::string>("/gcode_viewer/mmap", "auto");
+    }
+
+    if (mode == "on") {
+        return true;
+    }
+    if (mode == "off") {
+        return false;
+    }
+    if (mode != "auto") {
+        spdlog::warn("[GCodeStreaming] Unknown mmap mode '{}', using auto", mode);
+    }
+    return sizeof(void*) >= 8;
+}
+
+bool use_gcode_index_cache() {
+    const char* env = std::getenv("HELIX_GCODE_INDEX_CACHE");
+    if (env != nullptr) {
+        std::string mode = env;
+        std::transform(mode.begin(), mode.end(), mode.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (mode == "on" || mode == "1") {
+            return true;
+        }
+        if (mode == "off" || mode == "0") {
+            return false;
+        }
+        spdlog::warn("[GCodeStreaming] Unknown HELIX_GCODE_INDEX_CACHE value '{}', using config",
+                     env);
+    }
+    if (Config* config = Config::get_instance(); config != nullptr) {
+        return config->get<bool>("/gcode_viewer/index_cache", true);
+    }
+    return true;
+}
+
+int get_gcode_int_setting(const char* env_name, const char* config_key, int default_value,
+                          int min, int max) {
+    if (auto value = config::EnvironmentConfig::get_int(env_name, min, max)) {
+        return *value;
+    }
+    if (const char* env = std::getenv(env_name); env != nullptr) {
+        spdlog::warn("[GCodeStreaming] Invalid {} '{}' (expected {}-{}), using config", env_name,
+                     env, min, max);
+    }
+    if (Config* config = Config::get_instance(); config != nullptr) {
+        return std::clamp(config->get<int>(config_key, default_value), min, max);
+    }
+    return std::clamp(default_value, min, max);
+}
+
+size_t get_gcode_geometry_cache_bytes() {
+    int mb = get_gcode_int_setting("HELIX_GCODE_GEOMETRY_CACHE_MB",
+                                   "/gcode_viewer/geometry_cache_mb", 64, 0, 1024);
+    return static_cast<size_t>(mb) * 1024 * 1024;
+}
+
+size_t get_gcode_remote_cache_bytes() {
+    int mb = get_gcode_int_setting("HELIX_GCODE_REMOTE_CACHE_MB", "/gcode_viewer/remote_cache_mb",
+                                   8, 1, 256);
+    return static_cast<size_t>(mb) * 1024 * 1024;
+}
+
 } // namespace helix
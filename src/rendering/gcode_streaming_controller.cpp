@@ -3,13 +3,15 @@
 
 #include "gcode_streaming_controller.h"
 
+#include "app_globals.h"
+#include "gcode_streaming_config.h"
 #include "memory_monitor.h"
 #include "memory_utils.h"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
-#include <sstream>
+#include <chrono>
 #include <thread>
 
 namespace helix {
@@ -145,7 +147,8 @@ const LayerIndexStats GCodeStreamingController::empty_stats_{};
 // =============================================================================
 
 GCodeStreamingController::GCodeStreamingController()
-    : cache_(GCodeLayerCache::DEFAULT_BUDGET_NORMAL) {
+    : cache_(GCodeLayerCache::DEFAULT_BUDGET_NORMAL),
+      prefetcher_([this](size_t layer) { prefetch_layer(layer); }) {
     // Select cache budget tier based on total system RAM
     auto mem = get_system_memory_info();
     size_t budget;
@@ -163,6 +166,7 @@ GCodeStreamingController::GCodeStreamingController()
     }
 
     cache_.set_memory_budget(budget);
+    cache_.set_eviction_callback([this](size_t layer) { release_layer_bytes(layer); });
 
     // Enable adaptive mode on constrained/normal devices (not desktop)
     if (!mem.is_good_device()) {
@@ -176,12 +180,17 @@ GCodeStreamingController::GCodeStreamingController()
 }
 
 GCodeStreamingController::GCodeStreamingController(size_t cache_budget_bytes)
-    : cache_(std::max(cache_budget_bytes, MIN_CACHE_BUDGET)) {
+    : cache_(std::max(cache_budget_bytes, MIN_CACHE_BUDGET)),
+      prefetcher_([this](size_t layer) { prefetch_layer(layer); }) {
+    cache_.set_eviction_callback([this](size_t layer) { release_layer_bytes(layer); });
     spdlog::debug("[StreamingController] Created with {:.1f}MB cache budget",
                   static_cast<double>(cache_budget_bytes) / (1024 * 1024));
 }
 
 GCodeStreamingController::~GCodeStreamingController() {
+    // Stop background loads before the data source goes away
+    prefetcher_.cancel();
+
     // Wait for any async indexing to complete
     if (index_future_.valid()) {
         indexing_.store(false); // Signal cancellation
@@ -202,8 +211,9 @@ bool GCodeStreamingController::open_file(const std::string& filepath) {
 
     spdlog::info("[StreamingController] Opening file: {}", filepath);
 
-    // Create file data source
-    auto source = std::make_unique<FileDataSource>(filepath);
+    // Create file data source (memory-mapped where the address space allows)
+    auto source = std::make_unique<FileDataSource>(
+        filepath, use_gcode_mmap() ? FileDataSource::IoMode::MMAP : FileDataSource::IoMode::STDIO);
     if (!source->is_valid()) {
         spdlog::error("[StreamingController] Failed to open file: {}", filepath);
         return false;
@@ -233,8 +243,9 @@ void GCodeStreamingController::open_file_async(const std::string& filepath,
 
     spdlog::info("[StreamingController] Opening file async: {}", filepath);
 
-    // Create file data source
-    auto source = std::make_unique<FileDataSource>(filepath);
+    // Create file data source (memory-mapped where the address space allows)
+    auto source = std::make_unique<FileDataSource>(
+        filepath, use_gcode_mmap() ? FileDataSource::IoMode::MMAP : FileDataSource::IoMode::STDIO);
     if (!source->is_valid()) {
         spdlog::error("[StreamingController] Failed to open file: {}", filepath);
         if (on_complete) {
@@ -355,6 +366,9 @@ void GCodeStreamingController::close() {
         index_complete_callback_ = nullptr;
     }
 
+    // Drop queued prefetches and wait for running ones - they read data_source_
+    prefetcher_.cancel();
+
     cache_.clear();
     index_.clear();
     data_source_.reset();
@@ -397,12 +411,24 @@ std::string GCodeStreamingController::get_source_name() const {
 
 std::shared_ptr<const std::vector<ToolpathSegment>>
 GCodeStreamingController::get_layer_segments(size_t layer_index) {
+    auto packed = get_packed_layer(layer_index);
+    if (!packed) {
+        return nullptr;
+    }
+    return std::make_shared<const std::vector<ToolpathSegment>>(packed->unpack());
+}
+
+std::shared_ptr<const PackedLayer> GCodeStreamingController::get_packed_layer(size_t layer_index) {
     if (!is_open() || layer_index >= index_.get_layer_count()) {
         return nullptr;
     }
 
-    // Get from cache (loads if needed)
+    // Get from cache (loads if needed, or waits for a prefetch already loading it)
+    auto start = std::chrono::steady_clock::now();
     auto result = cache_.get_or_load(layer_index, make_loader());
+    layer_ready_latency_.record(
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count());
 
     if (result.load_failed) {
         spdlog::warn("[StreamingController] Failed to load layer {}", layer_index);
@@ -410,10 +436,10 @@ GCodeStreamingController::get_layer_segments(size_t layer_index) {
     }
 
     // Trigger prefetch for nearby layers
-    prefetch_around(layer_index, prefetch_radius_);
+    prefetch_around(layer_index, prefetch_radius_.load());
 
     // Return shared_ptr - data stays valid as long as caller holds the pointer
-    return result.segments;
+    return result.layer;
 }
 
 void GCodeStreamingController::request_layer(size_t layer_index) {
@@ -421,8 +447,9 @@ void GCodeStreamingController::request_layer(size_t layer_index) {
         return;
     }
 
-    // Just trigger the load (get_or_load handles caching)
-    cache_.get_or_load(layer_index, make_loader());
+    if (!cache_.is_cached(layer_index)) {
+        prefetcher_.request(layer_index);
+    }
 }
 
 bool GCodeStreamingController::is_layer_cached(size_t layer_index) const {
@@ -439,7 +466,33 @@ void GCodeStreamingController::prefetch_around(size_t center_layer, size_t radiu
         return; // Nothing to prefetch
     }
 
-    cache_.prefetch(center_layer, radius, make_loader(), layer_count - 1);
+    // Hint the whole window to the kernel first so its pages are read in the
+    // background while the layers below are parsed one by one
+    size_t first = (center_layer > radius) ? (center_layer - radius) : 0;
+    size_t last = std::min(center_layer + radius, layer_count - 1);
+    auto first_entry = index_.get_entry(first);
+    auto last_entry = index_.get_entry(last);
+    if (data_source_ && first_entry.is_valid() && last_entry.is_valid()) {
+        uint64_t window_end = last_entry.file_offset + last_entry.byte_length;
+        if (window_end > first_entry.file_offset) {
+            data_source_->advise_willneed(first_entry.file_offset,
+                                          window_end - first_entry.file_offset);
+        }
+    }
+
+    prefetcher_.schedule(center_layer, radius, layer_count - 1);
+}
+
+void GCodeStreamingController::set_prefetch_radius(size_t radius) {
+    prefetch_radius_.store(radius);
+}
+
+size_t GCodeStreamingController::get_prefetch_radius() const {
+    return prefetch_radius_.load();
+}
+
+bool GCodeStreamingController::wait_for_prefetch(std::chrono::milliseconds timeout) {
+    return prefetcher_.wait_idle(timeout);
 }
 
 // =============================================================================
@@ -477,6 +530,19 @@ float GCodeStreamingController::get_cache_hit_rate() const {
     return cache_.hit_rate();
 }
 
+GCodeStreamingController::StreamingStats GCodeStreamingController::get_streaming_stats() const {
+    StreamingStats stats;
+    stats.cache_hit_rate = cache_.hit_rate();
+    stats.p95_layer_ready_ms = layer_ready_latency_.percentile(95.0);
+    stats.latency_samples = layer_ready_latency_.sample_count();
+    auto prefetch = prefetcher_.stats();
+    stats.prefetch_scheduled = prefetch.scheduled;
+    stats.prefetch_loaded = prefetch.loaded;
+    stats.prefetch_cancelled = prefetch.cancelled;
+    stats.shared_loads = cache_.shared_load_count();
+    return stats;
+}
+
 size_t GCodeStreamingController::get_cache_memory_usage() const {
     return cache_.memory_usage_bytes();
 }
@@ -534,22 +600,37 @@ std::vector<ToolpathSegment> GCodeStreamingController::load_layer(size_t layer_i
         return segments;
     }
 
-    // Read layer bytes from source
-    auto bytes = data_source_->read_range(entry.file_offset, entry.byte_length);
-    if (bytes.empty()) {
+    // Memory-mapped sources hand out a view of the layer; others copy it out.
+    // Prefetch workers load concurrently, so reads are serialized.
+    std::vector<char> bytes;
+    std::string_view view;
+    {
+        std::lock_guard<std::mutex> lock(source_mutex_);
+        view = data_source_->view_range(entry.file_offset, entry.byte_length);
+        if (view.empty()) {
+            bytes = data_source_->read_range(entry.file_offset, entry.byte_length);
+            view = std::string_view(bytes.data(), bytes.size());
+        }
+    }
+    if (view.empty()) {
         spdlog::warn("[StreamingController] Failed to read bytes for layer {} "
                      "(offset={}, length={})",
                      layer_index, entry.file_offset, entry.byte_length);
         return segments;
     }
 
-    // Parse the bytes line by line
+    // Parse the bytes line by line (same splitting as std::getline)
     GCodeParser parser;
-    std::istringstream stream(std::string(bytes.begin(), bytes.end()));
     std::string line;
-
-    while (std::getline(stream, line)) {
+    size_t pos = 0;
+    while (pos < view.size()) {
+        size_t eol = view.find('\n', pos);
+        if (eol == std::string_view::npos) {
+            eol = view.size();
+        }
+        line.assign(view.data() + pos, eol - pos);
         parser.parse_line(line);
+        pos = eol + 1;
     }
 
     // Get parsed result
@@ -577,7 +658,7 @@ std::vector<ToolpathSegment> GCodeStreamingController::load_layer(size_t layer_i
     }
 
     spdlog::debug("[StreamingController] Loaded layer {} ({} segments, {} bytes)", layer_index,
-                  segments.size(), bytes.size());
+                  segments.size(), view.size());
 
     return segments;
 }
@@ -589,15 +670,21 @@ bool GCodeStreamingController::build_index() {
 
     // Use the virtual method to get an indexable file path
     // This works for FileDataSource (returns original filepath) and
-    // MoonrakerDataSource (returns temp file path after download)
+    // MoonrakerDataSource (returns temp file path after a fallback download)
     std::string file_path = data_source_->indexable_file_path();
 
     if (!file_path.empty()) {
-        return index_.build_from_file(file_path);
+        // Reopening an unchanged file loads the index sidecar instead of rescanning
+        std::string cache_dir = use_gcode_index_cache() ? get_helix_cache_dir("gcode_index") : "";
+        return index_.load_or_build(file_path, cache_dir);
+    }
+
+    // No local file (MoonrakerDataSource over range requests, MemoryDataSource):
+    // scan through read_range() instead of copying the file to flash
+    if (data_source_->supports_range_requests()) {
+        return index_.build_from_source(*data_source_);
     }
 
-    // Sources without file path (e.g., MemoryDataSource) cannot be indexed
-    // with the current file-based indexer
     spdlog::warn("[StreamingController] Data source has no indexable file path");
     return false;
 }
@@ -606,5 +693,24 @@ std::function<std::vector<ToolpathSegment>(size_t)> GCodeStreamingController::ma
     return [this](size_t layer_index) { return load_layer(layer_index); };
 }
 
+void GCodeStreamingController::prefetch_layer(size_t layer_index) {
+    // Runs on a prefetch worker; close() cancels and waits before teardown
+    if (!is_open() || layer_index >= index_.get_layer_count() || cache_.is_cached(layer_index)) {
+        return;
+    }
+    cache_.preload(layer_index, make_loader());
+}
+
+void GCodeStreamingController::release_layer_bytes(size_t layer_index) {
+    // Runs under the cache mutex - keep it to a single syscall
+    if (!data_source_) {
+        return;
+    }
+    auto entry = index_.get_entry(layer_index);
+    if (entry.is_valid()) {
+        data_source_->advise_dontneed(entry.file_offset, entry.byte_length);
+    }
+}
+
 } // namespace gcode
 } // namespace helix
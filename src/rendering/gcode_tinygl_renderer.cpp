@@ -6,6 +6,7 @@
 #ifdef ENABLE_TINYGL_3D
 
 #include "config.h"
+#include "frame_profiler.h"
 #include "memory_monitor.h"
 #include "runtime_config.h"
 
@@ -23,6 +24,40 @@ extern "C" {
 namespace helix {
 namespace gcode {
 
+namespace {
+
+/// Image format for draw_to_lvgl(): the display's own format when it is one we can
+/// produce, so LVGL blends the image without converting it again
+BlitFormat select_blit_format(bool native_color_format) {
+    lv_display_t* display = lv_display_get_default();
+    if (!native_color_format || !display) {
+        return BlitFormat::RGB888;
+    }
+    switch (lv_display_get_color_format(display)) {
+    case LV_COLOR_FORMAT_RGB565:
+        return BlitFormat::RGB565;
+    case LV_COLOR_FORMAT_XRGB8888:
+    case LV_COLOR_FORMAT_ARGB8888:
+        return BlitFormat::XRGB8888; // TinyGL's pixel layout - plain copy
+    default:
+        return BlitFormat::RGB888;
+    }
+}
+
+lv_color_format_t to_lv_color_format(BlitFormat format) {
+    switch (format) {
+    case BlitFormat::RGB565:
+        return LV_COLOR_FORMAT_RGB565;
+    case BlitFormat::XRGB8888:
+        return LV_COLOR_FORMAT_XRGB8888;
+    case BlitFormat::RGB888:
+    default:
+        return LV_COLOR_FORMAT_RGB888;
+    }
+}
+
+} // namespace
+
 GCodeTinyGLRenderer::GCodeTinyGLRenderer()
     : geometry_builder_(std::make_unique<GeometryBuilder>()) {
     // Set default configuration
@@ -217,6 +252,7 @@ void GCodeTinyGLRenderer::init_tinygl() {
 
     // Set shading model from config (default: phong)
     Config* cfg = Config::get_instance();
+    native_color_format_ = cfg->get<bool>("/gcode_viewer/native_color_format", true);
     std::string shading_model = cfg->get<std::string>("/gcode_viewer/shading_model", "phong");
 
     if (shading_model == "flat") {
@@ -250,10 +286,22 @@ void GCodeTinyGLRenderer::init_tinygl() {
 
     // Setup lighting with current material properties
     setup_lighting();
+
+    // Rasterize in horizontal bands on worker threads (1 = serial, on this thread)
+    unsigned bands = RasterBandPool::configured_band_count();
+    if (bands > 1) {
+        raster_pool_ = std::make_unique<RasterBandPool>(bands);
+        if (!raster_pool_->attach()) {
+            raster_pool_.reset();
+        }
+    }
+    spdlog::debug("[GCode TinyGL] Rasterizing in {} band(s)",
+                  raster_pool_ ? raster_pool_->band_count() : 1u);
 }
 
 void GCodeTinyGLRenderer::shutdown_tinygl() {
     if (zbuffer_) {
+        raster_pool_.reset(); // Detaches (waiting for queued triangles) before glClose
         glClose();
         ZB_close(static_cast<ZBuffer*>(zbuffer_));
         zbuffer_ = nullptr;
@@ -692,40 +740,13 @@ void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, flo
         return;
     }
 
-    // Helper lambda to render a single strip with given dim factor
-    auto render_strip = [this, dim_factor](size_t strip_idx) {
-        const auto& strip = active_geometry_->strips[strip_idx];
-
-        glBegin(GL_TRIANGLE_STRIP);
-        for (int j = 0; j < 4; j++) {
-            const auto& vertex = active_geometry_->vertices[strip[static_cast<size_t>(j)]];
-
-            // Lookup normal from palette
-            const glm::vec3& normal = active_geometry_->normal_palette[vertex.normal_index];
-            glNormal3f(normal.x, normal.y, normal.z);
-
-            // Lookup color from palette and apply dimming
-            uint32_t color_rgb = active_geometry_->color_palette[vertex.color_index];
-            uint8_t r = (color_rgb >> 16) & 0xFF;
-            uint8_t g = (color_rgb >> 8) & 0xFF;
-            uint8_t b = color_rgb & 0xFF;
-
-            glColor3f((r / 255.0f) * dim_factor, (g / 255.0f) * dim_factor,
-                      (b / 255.0f) * dim_factor);
-
-            // Dequantize position
-            glm::vec3 pos = active_geometry_->quantization.dequantize_vec3(vertex.position);
-            glVertex3f(pos.x, pos.y, pos.z);
-        }
-        glEnd();
-    };
+    // Palette is only rebuilt when colors or dim factor change
+    submitter_.prepare(*active_geometry_, dim_factor);
 
     // If we don't have layer tracking data, render all strips
     if (active_geometry_->strip_layer_index.empty()) {
         // Fallback: render all strips with the given dim factor
-        for (size_t i = 0; i < active_geometry_->strips.size(); ++i) {
-            render_strip(i);
-        }
+        submitter_.submit(0, active_geometry_->strips.size());
         return;
     }
 
@@ -774,9 +795,7 @@ void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, flo
 
             auto [first_strip, strip_count] =
                 active_geometry_->layer_strip_ranges[static_cast<size_t>(layer)];
-            for (size_t i = 0; i < strip_count; ++i) {
-                render_strip(first_strip + i);
-            }
+            submitter_.submit(first_strip, strip_count);
         }
         return;
     }
@@ -789,7 +808,7 @@ void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, flo
             static_cast<int>(strip_layer) > end_layer) {
             continue; // Skip strips outside the layer range
         }
-        render_strip(i);
+        submitter_.submit(i, 1);
     }
 }
 
@@ -804,52 +823,30 @@ void GCodeTinyGLRenderer::draw_to_lvgl(lv_layer_t* layer, const lv_area_t* widge
 
     // Create or recreate LVGL draw buffer at WIDGET size (not viewport size)
     // This allows us to upscale when in interaction mode
+    BlitFormat format = select_blit_format(native_color_format_);
+    lv_color_format_t color_format = to_lv_color_format(format);
     if (!draw_buf_ || draw_buf_->header.w != static_cast<uint32_t>(widget_width) ||
-        draw_buf_->header.h != static_cast<uint32_t>(widget_height)) {
+        draw_buf_->header.h != static_cast<uint32_t>(widget_height) ||
+        draw_buf_->header.cf != color_format) {
         if (draw_buf_) {
             lv_draw_buf_destroy(draw_buf_);
         }
 
-        draw_buf_ =
-            lv_draw_buf_create(static_cast<uint32_t>(widget_width),
-                               static_cast<uint32_t>(widget_height), LV_COLOR_FORMAT_RGB888, 0);
+        draw_buf_ = lv_draw_buf_create(static_cast<uint32_t>(widget_width),
+                                       static_cast<uint32_t>(widget_height), color_format, 0);
         if (!draw_buf_) {
             spdlog::error("[GCode TinyGL] Failed to create LVGL draw buffer");
             return;
         }
+        spdlog::debug("[GCode TinyGL] Draw buffer {}x{} ({})", widget_width, widget_height,
+                      blit_format_name(format));
     }
 
-    // Copy TinyGL framebuffer to LVGL draw buffer with scaling
-    // TinyGL ZB_MODE_RGBA is actually ABGR format (Alpha-Blue-Green-Red)
-    // LVGL uses RGB888, so we need to swap R and B
-    uint8_t* dest = (uint8_t*)draw_buf_->data;
-    unsigned int* src = framebuffer_;
-
-    // Check if we need to upscale (interaction mode renders at lower resolution)
-    bool needs_upscale = (viewport_width_ != widget_width || viewport_height_ != widget_height);
-
-    if (needs_upscale) {
-        // Nearest-neighbor upscaling from viewport to widget size
-        for (int dy = 0; dy < widget_height; dy++) {
-            int sy = dy * viewport_height_ / widget_height;
-            for (int dx = 0; dx < widget_width; dx++) {
-                int sx = dx * viewport_width_ / widget_width;
-                unsigned int pixel = src[sy * viewport_width_ + sx];
-                int dest_idx = (dy * widget_width + dx) * 3;
-                dest[dest_idx + 0] = pixel & 0xFF;         // R (from TinyGL B channel)
-                dest[dest_idx + 1] = (pixel >> 8) & 0xFF;  // G (stays the same)
-                dest[dest_idx + 2] = (pixel >> 16) & 0xFF; // B (from TinyGL R channel)
-            }
-        }
-    } else {
-        // Direct 1:1 copy (no scaling needed)
-        for (int i = 0; i < viewport_width_ * viewport_height_; i++) {
-            unsigned int pixel = src[i];
-            dest[i * 3 + 0] = pixel & 0xFF;         // R (from TinyGL B channel)
-            dest[i * 3 + 1] = (pixel >> 8) & 0xFF;  // G (stays the same)
-            dest[i * 3 + 2] = (pixel >> 16) & 0xFF; // B (from TinyGL R channel)
-        }
-    }
+    // Copy TinyGL framebuffer (0x00RRGGBB) to the draw buffer, upscaling with
+    // nearest-neighbor when interaction mode renders at lower resolution
+    blitter_.configure(viewport_width_, viewport_height_, widget_width, widget_height, format);
+    blitter_.blit(reinterpret_cast<const uint32_t*>(framebuffer_),
+                  static_cast<uint8_t*>(draw_buf_->data), draw_buf_->header.stride);
 
     // Draw image to layer at widget's screen position
     // IMPORTANT: lv_draw_image area must be in absolute screen coordinates!
@@ -867,6 +864,8 @@ void GCodeTinyGLRenderer::draw_to_lvgl(lv_layer_t* layer, const lv_area_t* widge
 
 void GCodeTinyGLRenderer::render(lv_layer_t* layer, const ParsedGCodeFile& gcode,
                                  const GCodeCamera& camera, const lv_area_t* widget_coords) {
+    HELIX_PROFILE_SCOPE("draw.gcode_tinygl");
+
     // Initialize TinyGL if needed
     if (!zbuffer_) {
         init_tinygl();
@@ -905,8 +904,9 @@ void GCodeTinyGLRenderer::render(lv_layer_t* layer, const ParsedGCodeFile& gcode
     // Time the rendering stages
     auto t0 = std::chrono::high_resolution_clock::now();
 
-    // Render 3D geometry
+    // Render 3D geometry, then join the band rasterizers so the framebuffer is complete
     render_geometry(camera);
+    glFinish();
 
     auto t1 = std::chrono::high_resolution_clock::now();
 
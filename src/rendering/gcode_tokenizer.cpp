@@ -0,0 +1,382 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_tokenizer.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HELIX_GCODE_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HELIX_GCODE_NEON 1
+#endif
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+// =============================================================================
+// 16-byte block matching
+// =============================================================================
+//
+// match() returns a bitmask of the bytes equal to a character. SSE2 produces
+// one bit per byte (movemask); NEON has no movemask, so it narrows the compare
+// result to one nibble per byte and keeps the top bit of each nibble.
+// MASK_STRIDE is the number of mask bits per byte.
+
+constexpr size_t BLOCK = 16;
+
+#if defined(HELIX_GCODE_SSE2)
+
+constexpr unsigned MASK_STRIDE = 1;
+using Block = __m128i;
+
+inline Block load_block(const char* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline Block fold_case(Block b) {
+    return _mm_or_si128(b, _mm_set1_epi8(0x20));
+}
+
+inline uint64_t match(Block b, char c) {
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(b, _mm_set1_epi8(c))));
+}
+
+#elif defined(HELIX_GCODE_NEON)
+
+constexpr unsigned MASK_STRIDE = 4;
+using Block = uint8x16_t;
+
+inline Block load_block(const char* p) {
+    return vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+}
+
+inline Block fold_case(Block b) {
+    return vorrq_u8(b, vdupq_n_u8(0x20));
+}
+
+inline uint64_t match(Block b, char c) {
+    uint8x16_t eq = vceqq_u8(b, vdupq_n_u8(static_cast<uint8_t>(c)));
+    uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ULL;
+}
+
+#endif
+
+#if defined(HELIX_GCODE_SSE2) || defined(HELIX_GCODE_NEON)
+
+inline size_t first_match(uint64_t mask) {
+    return static_cast<size_t>(__builtin_ctzll(mask)) / MASK_STRIDE;
+}
+
+/// Mask bits for the bytes before index n
+inline uint64_t bytes_below(size_t n) {
+    size_t bits = n * MASK_STRIDE;
+    return bits >= 64 ? ~0ULL : (1ULL << bits) - 1;
+}
+
+inline uint64_t match_axis_letters(Block b) {
+    Block folded = fold_case(b);
+    return match(folded, 'x') | match(folded, 'y') | match(folded, 'z') | match(folded, 'e') |
+           match(folded, 'f');
+}
+
+#endif
+
+/// Axis slot for a parameter letter, or -1
+inline int axis_index(char c) {
+    switch (c | 0x20) {
+    case 'x':
+        return static_cast<int>(GCodeAxis::X);
+    case 'y':
+        return static_cast<int>(GCodeAxis::Y);
+    case 'z':
+        return static_cast<int>(GCodeAxis::Z);
+    case 'e':
+        return static_cast<int>(GCodeAxis::E);
+    case 'f':
+        return static_cast<int>(GCodeAxis::F);
+    default:
+        return -1;
+    }
+}
+
+inline void record_axis(GCodeTokens& tokens, char c, size_t pos) {
+    int axis = axis_index(c);
+    if (axis >= 0 && tokens.axis_pos[axis] == GCodeTokens::NO_AXIS &&
+        pos < GCodeTokens::NO_AXIS) {
+        tokens.axis_pos[axis] = static_cast<uint16_t>(pos);
+    }
+}
+
+inline bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+
+constexpr double POW10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,
+                            1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+
+/// Significant digits that fit in the uint64_t mantissa without overflow
+constexpr int MAX_MANTISSA_DIGITS = 18;
+
+} // anonymous namespace
+
+// =============================================================================
+// Public API
+// =============================================================================
+
+const char* gcode_tokenizer_backend() {
+#if defined(HELIX_GCODE_SSE2)
+    return "sse2";
+#elif defined(HELIX_GCODE_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+const char* find_newline(const char* begin, const char* end) {
+    const char* p = begin;
+#if defined(HELIX_GCODE_SSE2) || defined(HELIX_GCODE_NEON)
+    for (; static_cast<size_t>(end - p) >= BLOCK; p += BLOCK) {
+        uint64_t mask = match(load_block(p), '\n');
+        if (mask != 0) {
+            return p + first_match(mask);
+        }
+    }
+#endif
+    for (; p < end; ++p) {
+        if (*p == '\n') {
+            return p;
+        }
+    }
+    return end;
+}
+
+GCodeTokens tokenize_gcode_line(std::string_view line) {
+    GCodeTokens tokens;
+    const char* data = line.data();
+    const size_t len = line.size();
+
+    // One pass: find the comment start and record the first occurrence of each
+    // parameter letter before it
+    size_t comment = len;
+    size_t i = 0;
+#if defined(HELIX_GCODE_SSE2) || defined(HELIX_GCODE_NEON)
+    for (; i + BLOCK <= len; i += BLOCK) {
+        Block block = load_block(data + i);
+        uint64_t letters = match_axis_letters(block);
+        uint64_t semicolons = match(block, ';');
+        if (semicolons != 0) {
+            size_t at = first_match(semicolons);
+            letters &= bytes_below(at);
+            comment = i + at;
+        }
+        for (; letters != 0; letters &= letters - 1) {
+            size_t pos = i + first_match(letters);
+            record_axis(tokens, data[pos], pos);
+        }
+        if (comment != len) {
+            break;
+        }
+    }
+#endif
+    if (comment == len) {
+        for (; i < len; ++i) {
+            if (data[i] == ';') {
+                comment = i;
+                break;
+            }
+            record_axis(tokens, data[i], i);
+        }
+    }
+
+    if (comment < len) {
+        tokens.comment = line.substr(comment);
+    }
+
+    // Trim whitespace around the command
+    size_t start = 0;
+    while (start < comment && is_space(data[start])) {
+        ++start;
+    }
+    size_t stop = comment;
+    while (stop > start && is_space(data[stop - 1])) {
+        --stop;
+    }
+    tokens.code = line.substr(start, stop - start);
+
+    // Letters can't sit in the trimmed whitespace, so offsets only shift
+    for (auto& pos : tokens.axis_pos) {
+        if (pos != GCodeTokens::NO_AXIS) {
+            pos = static_cast<uint16_t>(pos - start);
+        }
+    }
+
+    return tokens;
+}
+
+bool GCodeTokens::param(GCodeAxis axis, float& out_value, bool require_word_start) const {
+    uint16_t pos = axis_pos[static_cast<size_t>(axis)];
+    if (pos == NO_AXIS) {
+        return false;
+    }
+
+    // Make sure it's a parameter (preceded by space or at start after command)
+    if (require_word_start && pos > 0 && code[pos - 1] != ' ' && code[pos - 1] != '\t') {
+        return false;
+    }
+
+    return parse_gcode_float(code.data() + pos + 1, code.data() + code.size(), out_value);
+}
+
+bool parse_gcode_float(const char* begin, const char* end, float& out_value, const char** stop) {
+    const char* p = begin;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;      // Significant digits accumulated in mantissa
+    int frac_digits = 0; // Of which after the decimal point
+    bool any_digit = false;
+    bool overflow = false;
+
+    for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+        any_digit = true;
+        if (digits < MAX_MANTISSA_DIGITS) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+            digits += (mantissa != 0);
+        } else {
+            overflow = true; // Integer part too long for the fast path
+        }
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+            any_digit = true;
+            // Digits past the mantissa's precision can't change a float
+            if (digits < MAX_MANTISSA_DIGITS && frac_digits < MAX_MANTISSA_DIGITS) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                digits += (mantissa != 0);
+                ++frac_digits;
+            }
+        }
+    }
+
+    if (stop != nullptr) {
+        *stop = p;
+    }
+    if (!any_digit) {
+        return false;
+    }
+
+    if (overflow) {
+        // Absurdly long integer part: let strtod handle it
+        char buf[64];
+        size_t n = std::min(static_cast<size_t>(p - begin), sizeof(buf) - 1);
+        std::memcpy(buf, begin, n);
+        buf[n] = '\0';
+        out_value = static_cast<float>(std::strtod(buf, nullptr));
+        return true;
+    }
+
+    double value = static_cast<double>(mantissa) / POW10[frac_digits];
+    out_value = static_cast<float>(negative ? -value : value);
+    return true;
+}
+
+// =============================================================================
+// GCodeLineReader
+// =============================================================================
+
+GCodeLineReader::GCodeLineReader(const std::string& filepath, size_t chunk_size, uint64_t begin,
+                                 uint64_t end)
+    : buffer_(std::max<size_t>(chunk_size, 4096)), buffer_offset_(begin),
+      remaining_(end > begin ? end - begin : 0) {
+    file_ = std::fopen(filepath.c_str(), "rb");
+    if (!file_) {
+        spdlog::error("[GCodeLineReader] Failed to open '{}'", filepath);
+        return;
+    }
+    if (begin > 0 && fseeko(file_, static_cast<off_t>(begin), SEEK_SET) != 0) {
+        spdlog::error("[GCodeLineReader] Seek to {} failed in '{}'", begin, filepath);
+        eof_ = true;
+    }
+}
+
+GCodeLineReader::~GCodeLineReader() {
+    if (file_) {
+        std::fclose(file_);
+    }
+}
+
+bool GCodeLineReader::refill() {
+    if (eof_ || !file_) {
+        return false;
+    }
+
+    // Keep the partial line at the front; grow if it fills the whole buffer
+    size_t remaining = end_ - pos_;
+    if (pos_ > 0) {
+        std::memmove(buffer_.data(), buffer_.data() + pos_, remaining);
+        buffer_offset_ += pos_;
+        pos_ = 0;
+        end_ = remaining;
+    }
+    if (end_ == buffer_.size()) {
+        buffer_.resize(buffer_.size() * 2);
+    }
+
+    size_t want = static_cast<size_t>(std::min<uint64_t>(buffer_.size() - end_, remaining_));
+    size_t got = want > 0 ? std::fread(buffer_.data() + end_, 1, want, file_) : 0;
+    remaining_ -= got;
+    if (got == 0) {
+        eof_ = true;
+        return false;
+    }
+    end_ += got;
+    return true;
+}
+
+bool GCodeLineReader::next(std::string_view& line) {
+    size_t scanned = pos_;
+    for (;;) {
+        const char* base = buffer_.data();
+        const char* nl = find_newline(base + scanned, base + end_);
+        if (nl != base + end_) {
+            size_t nl_pos = static_cast<size_t>(nl - base);
+            line = std::string_view(base + pos_, nl_pos - pos_);
+            line_offset_ = buffer_offset_ + pos_;
+            pos_ = nl_pos + 1;
+            return true;
+        }
+
+        // No newline in what we have: read more (refill may move the data)
+        size_t partial = end_ - pos_;
+        if (!refill()) {
+            if (pos_ < end_) {
+                // Last line without a trailing newline
+                line = std::string_view(buffer_.data() + pos_, end_ - pos_);
+                line_offset_ = buffer_offset_ + pos_;
+                pos_ = end_;
+                return true;
+            }
+            return false;
+        }
+        scanned = pos_ + partial;
+    }
+}
+
+} // namespace gcode
+} // namespace helix
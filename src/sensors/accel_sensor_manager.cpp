@@ -152,6 +152,12 @@ void AccelSensorManager::update_from_status(const nlohmann::json& status) {
     }
 }
 
+bool AccelSensorManager::handles_status_object(const std::string& klipper_name) const {
+    std::string sensor_name;
+    AccelSensorType type{};
+    return parse_klipper_name(klipper_name, sensor_name, type);
+}
+
 void AccelSensorManager::inject_mock_sensors(std::vector<std::string>& /*objects*/,
                                              nlohmann::json& config_keys,
                                              nlohmann::json& /*moonraker_info*/) {
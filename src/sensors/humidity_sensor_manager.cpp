@@ -164,6 +164,12 @@ void HumiditySensorManager::update_from_status(const nlohmann::json& status) {
     }
 }
 
+bool HumiditySensorManager::handles_status_object(const std::string& klipper_name) const {
+    std::string sensor_name;
+    HumiditySensorType type{};
+    return parse_klipper_name(klipper_name, sensor_name, type);
+}
+
 void HumiditySensorManager::inject_mock_sensors(std::vector<std::string>& objects,
                                                 nlohmann::json& /*config_keys*/,
                                                 nlohmann::json& /*moonraker_info*/) {
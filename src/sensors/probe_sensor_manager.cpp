@@ -217,6 +217,12 @@ void ProbeSensorManager::update_from_status(const nlohmann::json& status) {
     }
 }
 
+bool ProbeSensorManager::handles_status_object(const std::string& klipper_name) const {
+    std::string sensor_name;
+    ProbeSensorType type{};
+    return parse_klipper_name(klipper_name, sensor_name, type);
+}
+
 /// Get the mock probe type from HELIX_MOCK_PROBE_TYPE env var.
 /// Valid values: cartographer, tap, bltouch, beacon, klicky, standard (default)
 static std::string get_mock_probe_type() {
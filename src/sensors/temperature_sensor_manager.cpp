@@ -215,6 +215,12 @@ void TemperatureSensorManager::update_from_status(const nlohmann::json& status)
     }
 }
 
+bool TemperatureSensorManager::handles_status_object(const std::string& klipper_name) const {
+    std::string sensor_name;
+    TemperatureSensorType type{};
+    return parse_klipper_name(klipper_name, sensor_name, type);
+}
+
 void TemperatureSensorManager::inject_mock_sensors(std::vector<std::string>& objects,
                                                    nlohmann::json& /*config_keys*/,
                                                    nlohmann::json& /*moonraker_info*/) {
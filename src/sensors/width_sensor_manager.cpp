@@ -155,6 +155,12 @@ void WidthSensorManager::update_from_status(const nlohmann::json& status) {
     }
 }
 
+bool WidthSensorManager::handles_status_object(const std::string& klipper_name) const {
+    std::string sensor_name;
+    WidthSensorType type{};
+    return parse_klipper_name(klipper_name, sensor_name, type);
+}
+
 void WidthSensorManager::inject_mock_sensors(std::vector<std::string>& objects,
                                              nlohmann::json& /*config_keys*/,
                                              nlohmann::json& /*moonraker_info*/) {
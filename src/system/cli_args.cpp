@@ -130,6 +130,8 @@ static void print_help(const char* program_name) {
     printf("  --log-file <path>    Log file path (when --log-dest=file)\n");
     printf("  -M, --memory-report  Log memory usage every 30 seconds (development)\n");
     printf("  --show-memory        Show memory stats overlay (press M to toggle)\n");
+    printf("  --profile-trace <f>  Profile frame phases; write Chrome trace JSON to <f> on exit\n");
+    printf("                       and on SIGUSR2 (development)\n");
     printf("  --release-notes      Fetch latest release notes and show in update modal\n");
     printf("  --debug-subjects     Enable verbose subject debugging with stack traces\n");
     printf("  --moonraker <url>    Override Moonraker URL (e.g., ws://192.168.1.112:7125)\n");
@@ -648,6 +650,16 @@ bool parse_cli_args(int argc, char** argv, CliArgs& args, int& screen_width, int
             args.memory_report = true;
         } else if (strcmp(argv[i], "--show-memory") == 0) {
             args.show_memory = true;
+        } else if (strcmp(argv[i], "--profile-trace") == 0 ||
+                   strncmp(argv[i], "--profile-trace=", 16) == 0) {
+            if (strncmp(argv[i], "--profile-trace=", 16) == 0) {
+                args.profile_trace_path = argv[i] + 16;
+            } else if (i + 1 < argc) {
+                args.profile_trace_path = argv[++i];
+            } else {
+                printf("Error: --profile-trace requires a file path\n");
+                return false;
+            }
         } else if (strcmp(argv[i], "--mock-crash") == 0) {
             config.mock_crash = true;
         } else if (strcmp(argv[i], "--release-notes") == 0) {
@@ -3,12 +3,13 @@
 
 #include "config.h"
 
+#include "config_save_coordinator.h"
+
 #include "ui_error_reporting.h"
 
 #include "runtime_config.h"
 
 #include <fstream>
-#include <iomanip>
 #include <sys/stat.h>
 // C++17 filesystem - use std::filesystem if available, fall back to experimental
 #if __cplusplus >= 201703L && __has_include(<filesystem>)
@@ -298,7 +299,9 @@ json get_default_config(const std::string& moonraker_host, bool include_user_pre
 
 } // namespace
 
-Config::Config() {}
+Config::Config() : saver_(std::make_unique<ConfigSaveCoordinator>()) {}
+
+Config::~Config() = default;
 
 Config* Config::get_instance() {
     if (instance == nullptr) {
@@ -308,6 +311,9 @@ Config* Config::get_instance() {
 }
 
 void Config::init(const std::string& config_path) {
+    // Finish any debounced save against the previous file first
+    flush();
+
     path = config_path;
     struct stat buffer;
 
@@ -542,9 +548,12 @@ void Config::init(const std::string& config_path) {
 
     // Save updated config with any new defaults or migrations
     if (config_modified) {
-        std::ofstream o(config_path);
-        o << std::setw(2) << data << std::endl;
-        spdlog::debug("[Config] Saved updated config to {}", config_path);
+        std::string error;
+        if (ConfigSaveCoordinator::write_file_atomic(config_path, data.dump(2) + "\n", error)) {
+            spdlog::debug("[Config] Saved updated config to {}", config_path);
+        } else {
+            spdlog::warn("[Config] Could not save updated config: {}", error);
+        }
     }
 
     spdlog::debug("[Config] initialized: moonraker={}:{}",
@@ -569,33 +578,54 @@ bool Config::save() {
         return true;
     }
 
-    spdlog::trace("[Config] Saving config to {}", path);
+    // Write failures happen on the writer thread; surface them here, on ours
+    bool ok = report_save_error();
 
-    try {
-        std::ofstream o(path);
-        if (!o.is_open()) {
-            NOTIFY_ERROR("Could not save configuration file");
-            LOG_ERROR_INTERNAL("Failed to open config file for writing: {}", path);
-            return false;
-        }
+    spdlog::trace("[Config] Queueing save to {}", path);
+    saver_->request(path, data);
+    return ok;
+}
 
-        o << std::setw(2) << data << std::endl;
+bool Config::flush() {
+    bool ok = saver_->flush();
 
-        if (!o.good()) {
-            NOTIFY_ERROR("Error writing configuration file");
-            LOG_ERROR_INTERNAL("Error writing to config file: {}", path);
-            return false;
-        }
+    std::string failed_path;
+    std::string message;
+    if (saver_->take_error(failed_path, message)) {
+        LOG_ERROR_INTERNAL("Config flush failed for {}: {}", failed_path, message);
+        ok = false;
+    }
 
-        o.close();
-        spdlog::trace("[Config] saved successfully to {}", path);
+    auto stats = saver_->stats();
+    if (stats.requested > 0) {
+        spdlog::debug("[Config] {} saves requested, {} writes performed", stats.requested,
+                      stats.written);
+    }
+    return ok;
+}
+
+void Config::get_save_stats(uint64_t& requested, uint64_t& written) const {
+    auto stats = saver_->stats();
+    requested = stats.requested;
+    written = stats.written;
+}
+
+bool Config::report_save_error() {
+    std::string failed_path;
+    std::string message;
+    if (!saver_->take_error(failed_path, message)) {
         return true;
+    }
 
-    } catch (const std::exception& e) {
-        NOTIFY_ERROR("Failed to save configuration: {}", e.what());
-        LOG_ERROR_INTERNAL("Exception while saving config to {}: {}", path, e.what());
-        return false;
+    // A failure for a file we no longer use (init() switched paths) is stale
+    if (failed_path != path) {
+        spdlog::debug("[Config] Ignoring write failure for previous file {}", failed_path);
+        return true;
     }
+
+    NOTIFY_ERROR("Could not save configuration file");
+    LOG_ERROR_INTERNAL("Error writing config file {}: {}", failed_path, message);
+    return false;
 }
 
 bool Config::is_wizard_required() {
@@ -0,0 +1,199 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "config_save_coordinator.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace helix {
+
+ConfigSaveCoordinator::ConfigSaveCoordinator(std::chrono::milliseconds debounce,
+                                             std::chrono::milliseconds max_delay)
+    : debounce_(debounce), max_delay_(std::max(max_delay, debounce)) {}
+
+ConfigSaveCoordinator::~ConfigSaveCoordinator() {
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+}
+
+void ConfigSaveCoordinator::request(const std::string& path, json snapshot) {
+    requested_.fetch_add(1, std::memory_order_relaxed);
+
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!pending_) {
+            first_request_ = now;
+        }
+        last_request_ = now;
+        pending_ = std::move(snapshot);
+        pending_path_ = path;
+
+        if (!writer_.joinable()) {
+            writer_ = std::thread([this]() { writer_loop(); });
+        }
+    }
+    cv_.notify_one();
+}
+
+bool ConfigSaveCoordinator::flush() {
+    return write_pending();
+}
+
+ConfigSaveCoordinator::Stats ConfigSaveCoordinator::stats() const {
+    Stats s;
+    s.requested = requested_.load(std::memory_order_relaxed);
+    s.written = written_.load(std::memory_order_relaxed);
+    s.failed = failed_.load(std::memory_order_relaxed);
+    return s;
+}
+
+bool ConfigSaveCoordinator::take_error(std::string& path, std::string& message) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (error_message_.empty()) {
+        return false;
+    }
+    path = std::move(error_path_);
+    message = std::move(error_message_);
+    error_path_.clear();
+    error_message_.clear();
+    return true;
+}
+
+void ConfigSaveCoordinator::writer_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return stop_ || pending_.has_value(); });
+        if (stop_) {
+            return;
+        }
+
+        // Trailing debounce, capped so a steady stream of changes still lands
+        while (pending_ && !stop_) {
+            auto due = std::min(last_request_ + debounce_, first_request_ + max_delay_);
+            if (std::chrono::steady_clock::now() >= due) {
+                break;
+            }
+            cv_.wait_until(lock, due);
+        }
+        if (stop_) {
+            return;
+        }
+
+        lock.unlock();
+        write_pending();
+        lock.lock();
+    }
+}
+
+bool ConfigSaveCoordinator::write_pending() {
+    std::lock_guard<std::mutex> write_lock(write_mutex_);
+
+    std::optional<json> snapshot;
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!pending_) {
+            return true;
+        }
+        snapshot = std::move(pending_);
+        pending_.reset();
+        path = std::move(pending_path_);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::string error;
+    bool ok = false;
+    try {
+        ok = write_file_atomic(path, snapshot->dump(2) + "\n", error);
+    } catch (const std::exception& e) {
+        error = e.what();
+    }
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+
+    if (!ok) {
+        failed_.fetch_add(1, std::memory_order_relaxed);
+        spdlog::error("[ConfigSave] Failed to write {}: {}", path, error);
+        std::lock_guard<std::mutex> lock(mutex_);
+        error_path_ = path;
+        error_message_ = error;
+        return false;
+    }
+
+    written_.fetch_add(1, std::memory_order_relaxed);
+    spdlog::trace("[ConfigSave] Wrote {} in {}ms ({} requests, {} writes)", path, elapsed_ms,
+                  requested_.load(std::memory_order_relaxed),
+                  written_.load(std::memory_order_relaxed));
+    return true;
+}
+
+bool ConfigSaveCoordinator::write_file_atomic(const std::string& path,
+                                              const std::string& contents, std::string& error) {
+    std::string temp_path = path + ".tmp";
+
+    int fd = ::open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    if (fd < 0) {
+        error = "open " + temp_path + ": " + std::strerror(errno);
+        return false;
+    }
+
+    const char* data = contents.data();
+    size_t remaining = contents.size();
+    while (remaining > 0) {
+        ssize_t n = ::write(fd, data, remaining);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            error = "write " + temp_path + ": " + std::strerror(errno);
+            ::close(fd);
+            ::unlink(temp_path.c_str());
+            return false;
+        }
+        data += n;
+        remaining -= static_cast<size_t>(n);
+    }
+
+    // Data must be durable before the rename makes it the live config
+    if (::fsync(fd) != 0) {
+        error = "fsync " + temp_path + ": " + std::strerror(errno);
+        ::close(fd);
+        ::unlink(temp_path.c_str());
+        return false;
+    }
+    ::close(fd);
+
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        error = "rename " + temp_path + ": " + std::strerror(errno);
+        ::unlink(temp_path.c_str());
+        return false;
+    }
+
+    // Persist the directory entry too (best effort)
+    size_t slash = path.find_last_of('/');
+    std::string dir = slash == std::string::npos ? "." : path.substr(0, std::max<size_t>(slash, 1));
+    int dir_fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir_fd >= 0) {
+        ::fsync(dir_fd);
+        ::close(dir_fd);
+    }
+    return true;
+}
+
+} // namespace helix
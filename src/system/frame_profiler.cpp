@@ -0,0 +1,303 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "frame_profiler.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+
+namespace helix::profiling {
+
+namespace {
+
+/// Set by SIGUSR2, taken by the main loop
+std::atomic<bool> g_export_requested{false};
+
+/// Next per-thread index handed out to a recording thread
+std::atomic<uint16_t> g_next_thread{1};
+
+uint16_t current_thread_index() {
+    thread_local uint16_t index = g_next_thread.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+size_t round_up_pow2(size_t n) {
+    size_t p = 1;
+    while (p < n) {
+        p <<= 1;
+    }
+    return p;
+}
+
+int floor_log2(uint64_t v) {
+    int n = 0;
+    while (v >>= 1) {
+        ++n;
+    }
+    return n;
+}
+
+void write_json_string(std::ostream& out, const char* s) {
+    out << '"';
+    for (; *s; ++s) {
+        if (*s == '"' || *s == '\\') {
+            out << '\\';
+        }
+        out << *s;
+    }
+    out << '"';
+}
+
+} // namespace
+
+FrameProfiler& FrameProfiler::instance() {
+    static FrameProfiler instance;
+    return instance;
+}
+
+void FrameProfiler::enable(size_t ring_capacity) {
+    if (!ring_) {
+        allocate_ring(ring_capacity);
+    }
+    enabled_.store(true, std::memory_order_release);
+    spdlog::info("[FrameProfiler] Enabled ({} trace events kept)", ring_mask_ + 1);
+}
+
+void FrameProfiler::allocate_ring(size_t ring_capacity) {
+    size_t capacity = round_up_pow2(std::max<size_t>(ring_capacity, 2));
+    ring_ = std::make_unique<Slot[]>(capacity);
+    ring_mask_ = capacity - 1;
+}
+
+void FrameProfiler::disable() {
+    enabled_.store(false, std::memory_order_release);
+}
+
+PhaseId FrameProfiler::register_phase(const char* name) {
+    std::lock_guard<std::mutex> lock(phases_mutex_);
+    size_t count = phase_count_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i) {
+        if (std::strcmp(names_[i].load(std::memory_order_relaxed), name) == 0) {
+            return static_cast<PhaseId>(i);
+        }
+    }
+    if (count == MAX_PHASES) {
+        spdlog::warn("[FrameProfiler] Phase limit reached, not profiling '{}'", name);
+        return INVALID_PHASE;
+    }
+    names_[count].store(name, std::memory_order_relaxed);
+    phase_count_.store(count + 1, std::memory_order_release);
+    return static_cast<PhaseId>(count);
+}
+
+const char* FrameProfiler::phase_name(PhaseId phase) const {
+    if (phase >= phase_count_.load(std::memory_order_acquire)) {
+        return "?";
+    }
+    return names_[phase].load(std::memory_order_relaxed);
+}
+
+size_t FrameProfiler::bucket_for(uint64_t us) {
+    if (us < LINEAR_BUCKETS) {
+        return static_cast<size_t>(us);
+    }
+    // 4 sub-buckets per power of two: the two bits below the leading one
+    int octave = floor_log2(us);
+    size_t sub = static_cast<size_t>(us >> (octave - 2)) & 3U;
+    size_t bucket = LINEAR_BUCKETS + static_cast<size_t>(octave - 4) * 4 + sub;
+    return std::min(bucket, HISTOGRAM_BUCKETS - 1);
+}
+
+uint64_t FrameProfiler::bucket_upper_bound(size_t bucket) {
+    if (bucket < LINEAR_BUCKETS) {
+        return bucket;
+    }
+    size_t octave = 4 + (bucket - LINEAR_BUCKETS) / 4;
+    size_t sub = (bucket - LINEAR_BUCKETS) % 4;
+    return ((5 + sub) << (octave - 2)) - 1;
+}
+
+void FrameProfiler::record(PhaseId phase, uint64_t start_us, uint64_t duration_us) {
+    if (!enabled_.load(std::memory_order_acquire) || phase >= MAX_PHASES) {
+        return;
+    }
+
+    PhaseStats& stats = stats_[phase];
+    stats.count.fetch_add(1, std::memory_order_relaxed);
+    stats.total_us.fetch_add(duration_us, std::memory_order_relaxed);
+    stats.buckets[bucket_for(duration_us)].fetch_add(1, std::memory_order_relaxed);
+    uint64_t prev_max = stats.max_us.load(std::memory_order_relaxed);
+    while (duration_us > prev_max &&
+           !stats.max_us.compare_exchange_weak(prev_max, duration_us, std::memory_order_relaxed)) {
+    }
+
+    // Overwrite ring: claim a position, mark the slot busy, fill it, publish
+    uint64_t pos = head_.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = ring_[pos & ring_mask_];
+    slot.seq.store(2 * pos + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.start_us.store(start_us, std::memory_order_relaxed);
+    slot.duration_us.store(
+        static_cast<uint32_t>(std::min<uint64_t>(duration_us, UINT32_MAX)),
+        std::memory_order_relaxed);
+    slot.phase_thread.store(static_cast<uint32_t>(phase) << 16 | current_thread_index(),
+                            std::memory_order_relaxed);
+    slot.seq.store(2 * pos + 2, std::memory_order_release);
+}
+
+uint64_t FrameProfiler::percentile(const PhaseStats& stats, uint64_t count, double fraction) {
+    auto target = static_cast<uint64_t>(fraction * static_cast<double>(count) + 0.5);
+    target = std::clamp<uint64_t>(target, 1, count);
+    uint64_t seen = 0;
+    for (size_t b = 0; b < HISTOGRAM_BUCKETS; ++b) {
+        seen += stats.buckets[b].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            // Bucket bound, but never above the largest value actually seen
+            return std::min(bucket_upper_bound(b), stats.max_us.load(std::memory_order_relaxed));
+        }
+    }
+    return stats.max_us.load(std::memory_order_relaxed);
+}
+
+std::vector<PhaseSummary> FrameProfiler::summarize() const {
+    std::vector<PhaseSummary> out;
+    size_t count = phase_count_.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i) {
+        const PhaseStats& stats = stats_[i];
+        uint64_t samples = stats.count.load(std::memory_order_relaxed);
+        if (samples == 0) {
+            continue;
+        }
+        PhaseSummary s;
+        s.name = names_[i].load(std::memory_order_relaxed);
+        s.count = samples;
+        s.total_us = stats.total_us.load(std::memory_order_relaxed);
+        s.p50_us = percentile(stats, samples, 0.50);
+        s.p95_us = percentile(stats, samples, 0.95);
+        s.p99_us = percentile(stats, samples, 0.99);
+        s.max_us = stats.max_us.load(std::memory_order_relaxed);
+        out.push_back(s);
+    }
+    std::sort(out.begin(), out.end(), [](const PhaseSummary& a, const PhaseSummary& b) {
+        return a.total_us > b.total_us;
+    });
+    return out;
+}
+
+void FrameProfiler::log_summary() const {
+    auto phases = summarize();
+    if (phases.empty()) {
+        spdlog::info("[FrameProfiler] No phases recorded");
+        return;
+    }
+    spdlog::info("[FrameProfiler] Phase durations (us, bucketed): count / total / p50 / p95 / "
+                 "p99 / max");
+    for (const auto& p : phases) {
+        spdlog::info("[FrameProfiler]   {:<24} {:>8} {:>10}ms {:>7} {:>7} {:>7} {:>7}", p.name,
+                     p.count, p.total_us / 1000, p.p50_us, p.p95_us, p.p99_us, p.max_us);
+    }
+}
+
+std::vector<TraceEvent> FrameProfiler::snapshot() const {
+    std::vector<TraceEvent> out;
+    if (!ring_) {
+        return out;
+    }
+    const uint64_t capacity = ring_mask_ + 1;
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    const uint64_t first = head > capacity ? head - capacity : 0;
+    out.reserve(static_cast<size_t>(head - first));
+
+    for (uint64_t pos = first; pos < head; ++pos) {
+        const Slot& slot = ring_[pos & ring_mask_];
+        uint64_t seq = slot.seq.load(std::memory_order_acquire);
+        if (seq != 2 * pos + 2) {
+            continue; // Still being written, or already overwritten
+        }
+        TraceEvent e;
+        e.start_us = slot.start_us.load(std::memory_order_relaxed);
+        e.duration_us = slot.duration_us.load(std::memory_order_relaxed);
+        uint32_t pt = slot.phase_thread.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) != seq) {
+            continue; // Overwritten while we read it
+        }
+        e.phase = static_cast<PhaseId>(pt >> 16);
+        e.thread = static_cast<uint16_t>(pt & 0xFFFF);
+        out.push_back(e);
+    }
+    return out;
+}
+
+uint64_t FrameProfiler::overwritten() const {
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    uint64_t capacity = ring_ ? ring_mask_ + 1 : 0;
+    return head > capacity ? head - capacity : 0;
+}
+
+void FrameProfiler::write_chrome_trace(std::ostream& out,
+                                       const std::vector<TraceEvent>& events) const {
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& e : events) {
+        out << (first ? "\n" : ",\n");
+        first = false;
+        out << "{\"name\":";
+        write_json_string(out, phase_name(e.phase));
+        out << ",\"cat\":\"helix\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.thread
+            << ",\"ts\":" << e.start_us << ",\"dur\":" << e.duration_us << '}';
+    }
+    out << "\n]}\n";
+}
+
+bool FrameProfiler::write_chrome_trace(const std::string& path, std::string& error) const {
+    auto events = snapshot();
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        error = "open " + path + ": " + std::strerror(errno);
+        return false;
+    }
+    write_chrome_trace(out, events);
+    out.flush();
+    if (!out) {
+        error = "write " + path + " failed";
+        return false;
+    }
+    spdlog::info("[FrameProfiler] Wrote {} trace events to {} ({} older events overwritten)",
+                 events.size(), path, overwritten());
+    return true;
+}
+
+void FrameProfiler::request_export() {
+    g_export_requested.store(true, std::memory_order_release);
+}
+
+bool FrameProfiler::take_export_request() {
+    return g_export_requested.exchange(false, std::memory_order_acq_rel);
+}
+
+void FrameProfiler::reset(size_t ring_capacity) {
+    for (auto& stats : stats_) {
+        stats.count.store(0, std::memory_order_relaxed);
+        stats.total_us.store(0, std::memory_order_relaxed);
+        stats.max_us.store(0, std::memory_order_relaxed);
+        for (auto& b : stats.buckets) {
+            b.store(0, std::memory_order_relaxed);
+        }
+    }
+    if (ring_capacity != 0) {
+        allocate_ring(ring_capacity);
+    } else if (ring_) {
+        for (size_t i = 0; i <= ring_mask_; ++i) {
+            ring_[i].seq.store(0, std::memory_order_relaxed);
+        }
+    }
+    head_.store(0, std::memory_order_release);
+    g_export_requested.store(false, std::memory_order_release);
+}
+
+} // namespace helix::profiling
@@ -0,0 +1,184 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "console_line_buffer.h"
+
+#include <algorithm>
+
+namespace helix {
+
+namespace {
+
+constexpr std::string_view SPAN_OPEN = "<span class=";
+constexpr std::string_view SPAN_CLOSE = "</span>";
+
+/// Map a span class attribute ("success--text", ...) to a color; base if unknown
+ConsoleColor color_for_class(std::string_view class_attr, ConsoleColor base) {
+    if (class_attr.find("success--text") != std::string_view::npos) {
+        return ConsoleColor::SUCCESS;
+    }
+    if (class_attr.find("info--text") != std::string_view::npos) {
+        return ConsoleColor::INFO;
+    }
+    if (class_attr.find("warning--text") != std::string_view::npos) {
+        return ConsoleColor::WARNING;
+    }
+    if (class_attr.find("error--text") != std::string_view::npos) {
+        return ConsoleColor::DANGER;
+    }
+    return base;
+}
+
+void append_run(ConsoleLine& line, std::string_view text, ConsoleColor color) {
+    if (text.empty()) {
+        return;
+    }
+    ConsoleSpan span;
+    span.start = static_cast<uint32_t>(line.text.size());
+    span.length = static_cast<uint32_t>(text.size());
+    span.color = color;
+    line.text.append(text.data(), text.size());
+    line.spans.push_back(span);
+}
+
+} // namespace
+
+ConsoleLineBuffer::ConsoleLineBuffer(size_t capacity)
+    : slots_(std::max<size_t>(capacity, 1)), tops_(slots_.size(), 0) {}
+
+bool ConsoleLineBuffer::contains_html_spans(std::string_view message) {
+    return message.find(SPAN_OPEN) != std::string_view::npos &&
+           (message.find("success--text") != std::string_view::npos ||
+            message.find("info--text") != std::string_view::npos ||
+            message.find("warning--text") != std::string_view::npos ||
+            message.find("error--text") != std::string_view::npos);
+}
+
+void ConsoleLineBuffer::parse_into(ConsoleLine& line, std::string_view message,
+                                   ConsoleColor base) {
+    if (!contains_html_spans(message)) {
+        append_run(line, message, base);
+        return;
+    }
+
+    // Mainsail-style spans: <span class=XXX--text>content</span>
+    size_t pos = 0;
+    while (pos < message.size()) {
+        size_t span_start = message.find(SPAN_OPEN, pos);
+        if (span_start == std::string_view::npos) {
+            append_run(line, message.substr(pos), base);
+            break;
+        }
+
+        // Text before the span
+        append_run(line, message.substr(pos, span_start - pos), base);
+
+        size_t class_start = span_start + SPAN_OPEN.size();
+        size_t class_end = message.find('>', class_start);
+        if (class_end == std::string_view::npos) {
+            // Malformed - keep the rest verbatim
+            append_run(line, message.substr(span_start), base);
+            break;
+        }
+
+        ConsoleColor color =
+            color_for_class(message.substr(class_start, class_end - class_start), base);
+
+        size_t content_start = class_end + 1;
+        size_t span_close = message.find(SPAN_CLOSE, content_start);
+        if (span_close == std::string_view::npos) {
+            // No closing tag - rest is the span's content
+            append_run(line, message.substr(content_start), color);
+            break;
+        }
+
+        append_run(line, message.substr(content_start, span_close - content_start), color);
+        pos = span_close + SPAN_CLOSE.size();
+    }
+}
+
+const ConsoleLine& ConsoleLineBuffer::push(std::string_view message, ConsoleLineKind kind,
+                                           bool is_error, double timestamp) {
+    size_t target;
+    if (size_ < slots_.size()) {
+        target = slot(size_);
+        ++size_;
+    } else {
+        // Full: the oldest slot becomes the newest
+        target = head_;
+        head_ = (head_ + 1) % slots_.size();
+    }
+    ++total_pushed_;
+
+    // clear() keeps capacity, so a warm ring appends without allocating
+    ConsoleLine& line = slots_[target];
+    line.text.clear();
+    line.spans.clear();
+    line.timestamp = timestamp;
+
+    ConsoleColor base = is_error                          ? ConsoleColor::DANGER
+                        : kind == ConsoleLineKind::RESPONSE ? ConsoleColor::SUCCESS
+                                                            : ConsoleColor::TEXT;
+    parse_into(line, message, base);
+
+    line.height = measure_ ? measure_(line) : 0;
+    tops_[target] = next_top_;
+    next_top_ += line.height;
+    return line;
+}
+
+void ConsoleLineBuffer::clear() {
+    head_ = 0;
+    size_ = 0;
+    next_top_ = 0;
+}
+
+void ConsoleLineBuffer::set_measure(Measure measure) {
+    measure_ = std::move(measure);
+    relayout();
+}
+
+void ConsoleLineBuffer::relayout() {
+    next_top_ = 0;
+    for (size_t i = 0; i < size_; ++i) {
+        size_t s = slot(i);
+        slots_[s].height = measure_ ? measure_(slots_[s]) : 0;
+        tops_[s] = next_top_;
+        next_top_ += slots_[s].height;
+    }
+}
+
+int64_t ConsoleLineBuffer::content_height() const {
+    return size_ == 0 ? 0 : next_top_ - tops_[head_];
+}
+
+int64_t ConsoleLineBuffer::y_of(size_t index) const {
+    if (size_ == 0) {
+        return 0;
+    }
+    if (index >= size_) {
+        return content_height();
+    }
+    return tops_[slot(index)] - tops_[head_];
+}
+
+size_t ConsoleLineBuffer::index_at(int64_t y) const {
+    if (size_ <= 1 || y <= 0) {
+        return 0;
+    }
+
+    // Last line whose top is <= y (tops increase with index)
+    size_t lo = 0;
+    size_t hi = size_ - 1;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo + 1) / 2;
+        if (y_of(mid) <= y) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
+} // namespace helix
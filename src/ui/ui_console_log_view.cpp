@@ -0,0 +1,246 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ui_console_log_view.h"
+
+#include "theme_manager.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace helix::ui {
+
+// ============================================================================
+// Destruction
+// ============================================================================
+
+ConsoleLogView::~ConsoleLogView() {
+    cleanup();
+}
+
+// ============================================================================
+// Setup / Cleanup
+// ============================================================================
+
+bool ConsoleLogView::setup(lv_obj_t* container, ConsoleLineBuffer* buffer) {
+    if (!container || !buffer) {
+        spdlog::error("[ConsoleLogView] Cannot setup - null container or buffer");
+        return false;
+    }
+
+    container_ = container;
+    buffer_ = buffer;
+
+    font_ = theme_manager_get_font("font_small");
+    if (!font_) {
+        font_ = LV_FONT_DEFAULT;
+    }
+    row_gap_ = lv_obj_get_style_pad_row(container_, LV_PART_MAIN);
+
+    colors_[static_cast<int>(ConsoleColor::TEXT)] = theme_manager_get_color("text");
+    colors_[static_cast<int>(ConsoleColor::SUCCESS)] = theme_manager_get_color("success");
+    colors_[static_cast<int>(ConsoleColor::INFO)] = theme_manager_get_color("info");
+    colors_[static_cast<int>(ConsoleColor::WARNING)] = theme_manager_get_color("warning");
+    colors_[static_cast<int>(ConsoleColor::DANGER)] = theme_manager_get_color("danger");
+
+    init_pool();
+    buffer_->set_measure([this](const ConsoleLine& line) { return measure(line); });
+
+    spdlog::trace("[ConsoleLogView] Setup complete");
+    return true;
+}
+
+void ConsoleLogView::cleanup() {
+    if (buffer_) {
+        buffer_->set_measure(nullptr);
+    }
+    pool_.clear();
+    pool_seq_.clear();
+    container_ = nullptr;
+    buffer_ = nullptr;
+    leading_spacer_ = nullptr;
+    trailing_spacer_ = nullptr;
+    visible_first_ = 0;
+    visible_count_ = 0;
+    measured_width_ = 0;
+    spdlog::debug("[ConsoleLogView] cleanup()");
+}
+
+// ============================================================================
+// Pool Initialization
+// ============================================================================
+
+void ConsoleLogView::init_pool() {
+    if (!container_ || !pool_.empty()) {
+        return;
+    }
+
+    spdlog::debug("[ConsoleLogView] Creating {} line widgets", POOL_SIZE);
+
+    // Children stay ordered: leading spacer, pool rows, trailing spacer
+    leading_spacer_ = lv_obj_create(container_);
+    lv_obj_remove_style_all(leading_spacer_);
+    lv_obj_remove_flag(leading_spacer_, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_width(leading_spacer_, lv_pct(100));
+    lv_obj_set_height(leading_spacer_, 0);
+
+    pool_.reserve(POOL_SIZE);
+    pool_seq_.assign(POOL_SIZE, NO_SEQ);
+    for (int i = 0; i < POOL_SIZE; i++) {
+        lv_obj_t* row = lv_spangroup_create(container_);
+        lv_obj_set_width(row, lv_pct(100));
+        lv_obj_set_style_text_font(row, font_, 0);
+        lv_obj_remove_flag(row, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        pool_.push_back(row);
+    }
+
+    trailing_spacer_ = lv_obj_create(container_);
+    lv_obj_remove_style_all(trailing_spacer_);
+    lv_obj_remove_flag(trailing_spacer_, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_width(trailing_spacer_, lv_pct(100));
+    lv_obj_set_height(trailing_spacer_, 0);
+
+    spdlog::debug("[ConsoleLogView] Pool initialized with {} rows", pool_.size());
+}
+
+// ============================================================================
+// Measurement / Row Configuration
+// ============================================================================
+
+int32_t ConsoleLogView::measure(const ConsoleLine& line) const {
+    // Until the container has been laid out, measure unwrapped; render() re-measures
+    // once the real width is known
+    int32_t max_width = measured_width_ > 0 ? measured_width_ : LV_COORD_MAX;
+
+    lv_point_t size;
+    lv_text_get_size(&size, line.text.c_str(), font_, 0, 0, max_width, LV_TEXT_FLAG_NONE);
+    return std::max<int32_t>(size.y, lv_font_get_line_height(font_)) + row_gap_;
+}
+
+void ConsoleLogView::configure_row(lv_obj_t* row, const ConsoleLine& line) {
+    // Reuse the row's spans; only add/remove the difference
+    uint32_t needed = static_cast<uint32_t>(line.spans.size());
+    uint32_t have = lv_spangroup_get_span_count(row);
+    while (have > needed) {
+        lv_spangroup_delete_span(row, lv_spangroup_get_child(row, static_cast<int32_t>(--have)));
+    }
+    while (have < needed) {
+        lv_spangroup_add_span(row);
+        ++have;
+    }
+
+    for (uint32_t i = 0; i < needed; i++) {
+        const ConsoleSpan& run = line.spans[i];
+        lv_span_t* span = lv_spangroup_get_child(row, static_cast<int32_t>(i));
+        scratch_.assign(line.text, run.start, run.length);
+        lv_span_set_text(span, scratch_.c_str());
+        lv_style_set_text_color(lv_span_get_style(span), colors_[static_cast<int>(run.color)]);
+    }
+
+    // Pin the row to its measured height so the spacer offsets match the layout
+    lv_obj_set_height(row, std::max<int32_t>(0, line.height - row_gap_));
+    lv_spangroup_refresh(row);
+    ++rows_configured_;
+}
+
+// ============================================================================
+// Rendering
+// ============================================================================
+
+void ConsoleLogView::invalidate() {
+    std::fill(pool_seq_.begin(), pool_seq_.end(), NO_SEQ);
+}
+
+void ConsoleLogView::render(bool follow_tail) {
+    if (!container_ || !buffer_ || pool_.empty()) {
+        return;
+    }
+
+    // Wrapped line heights depend on the width (rotation, first layout)
+    int32_t width = lv_obj_get_content_width(container_);
+    if (width > 0 && width != measured_width_) {
+        measured_width_ = width;
+        buffer_->relayout();
+        invalidate();
+    }
+
+    if (buffer_->empty()) {
+        apply_window(0, 0);
+        return;
+    }
+
+    int64_t content_height = buffer_->content_height();
+    int32_t viewport_height = lv_obj_get_height(container_);
+    int64_t top = follow_tail ? std::max<int64_t>(0, content_height - viewport_height)
+                              : lv_obj_get_scroll_y(container_);
+
+    size_t size = buffer_->size();
+    size_t first = buffer_->index_at(top);
+    size_t last = std::min(size, buffer_->index_at(top + viewport_height) + 1 + BUFFER_ROWS);
+    first = first > static_cast<size_t>(BUFFER_ROWS) ? first - BUFFER_ROWS : 0;
+
+    // Very short lines on a tall screen: keep the end the user is looking at
+    if (last - first > static_cast<size_t>(POOL_SIZE)) {
+        if (follow_tail) {
+            first = last - POOL_SIZE;
+        } else {
+            last = first + POOL_SIZE;
+        }
+    }
+
+    apply_window(first, last);
+
+    if (follow_tail) {
+        lv_obj_update_layout(container_);
+        lv_obj_scroll_to_y(container_, LV_COORD_MAX, LV_ANIM_OFF);
+    }
+}
+
+void ConsoleLogView::apply_window(size_t first, size_t last) {
+    size_t count = last - first;
+
+    int32_t leading = count > 0 ? static_cast<int32_t>(buffer_->y_of(first)) : 0;
+    int32_t trailing =
+        count > 0 ? static_cast<int32_t>(buffer_->content_height() - buffer_->y_of(last)) : 0;
+    if (lv_obj_get_height(leading_spacer_) != leading) {
+        lv_obj_set_height(leading_spacer_, leading);
+    }
+    if (lv_obj_get_height(trailing_spacer_) != trailing) {
+        lv_obj_set_height(trailing_spacer_, trailing);
+    }
+
+    // Rows are keyed by sequence number, so lines that stay in the window keep
+    // their row and content; only lines scrolling in are configured
+    uint64_t first_seq = count > 0 ? buffer_->seq(first) : 0;
+    for (size_t k = 0; k < count; k++) {
+        uint64_t seq = first_seq + k;
+        size_t slot = static_cast<size_t>(seq % POOL_SIZE);
+        lv_obj_t* row = pool_[slot];
+
+        if (pool_seq_[slot] != seq) {
+            configure_row(row, buffer_->at(first + k));
+            pool_seq_[slot] = seq;
+        }
+        if (lv_obj_has_flag(row, LV_OBJ_FLAG_HIDDEN)) {
+            lv_obj_remove_flag(row, LV_OBJ_FLAG_HIDDEN);
+        }
+        // Position after leading spacer
+        lv_obj_move_to_index(row, static_cast<int32_t>(k) + 1);
+    }
+
+    // Hide rows outside the window
+    for (size_t slot = 0; slot < pool_.size(); slot++) {
+        bool in_window = pool_seq_[slot] != NO_SEQ && pool_seq_[slot] >= first_seq &&
+                         pool_seq_[slot] < first_seq + count;
+        if (!in_window && !lv_obj_has_flag(pool_[slot], LV_OBJ_FLAG_HIDDEN)) {
+            lv_obj_add_flag(pool_[slot], LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+
+    visible_first_ = first;
+    visible_count_ = count;
+}
+
+} // namespace helix::ui
@@ -10,6 +10,7 @@
 
 #include "ams_types.h"
 #include "display_settings_manager.h"
+#include "frame_profiler.h"
 #include "lvgl/lvgl.h"
 #include "lvgl/src/xml/lv_xml.h"
 #include "lvgl/src/xml/lv_xml_parser.h"
@@ -1305,6 +1306,7 @@ static void draw_parallel_topology(lv_event_t* e, FilamentPathData* data) {
 // ============================================================================
 
 static void filament_path_draw_cb(lv_event_t* e) {
+    HELIX_PROFILE_SCOPE("draw.filament_path");
     lv_obj_t* obj = lv_event_get_target_obj(e);
     lv_layer_t* layer = lv_event_get_layer(e);
     FilamentPathData* data = get_data(obj);
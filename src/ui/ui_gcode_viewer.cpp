@@ -6,11 +6,14 @@
 #include "ui_update_queue.h"
 #include "ui_utils.h"
 
+#include "app_globals.h"
 #include "gcode_camera.h"
+#include "gcode_geometry_cache.h"
 #include "gcode_layer_renderer.h"
 #include "gcode_parser.h"
 #include "gcode_streaming_config.h"
 #include "gcode_streaming_controller.h"
+#include "gcode_tokenizer.h"
 #include "memory_utils.h"
 #include "theme_manager.h"
 
@@ -34,7 +37,6 @@ using namespace helix;
 #include <atomic>
 #include <cstdlib>
 #include <cstring>
-#include <fstream>
 #include <memory>
 #include <optional>
 #include <thread>
@@ -1124,21 +1126,22 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
         auto result = std::make_unique<AsyncBuildResult>();
 
         try {
+            // Identify the file before reading it: cached geometry is keyed on this
+            auto source_stamp = helix::gcode::GeometryCache::stamp(path);
+
             // PHASE 1: Parse G-code file (fast, ~100ms)
-            std::ifstream file(path);
-            if (!file.is_open()) {
+            helix::gcode::GCodeLineReader reader(path);
+            if (!reader.is_open()) {
                 result->success = false;
                 result->error_msg = "Failed to open file: " + path;
             } else {
                 helix::gcode::GCodeParser parser;
-                std::string line;
+                std::string_view line;
 
-                while (std::getline(file, line)) {
+                while (reader.next(line)) {
                     parser.parse_line(line);
                 }
 
-                file.close();
-
                 result->gcode_file =
                     std::make_unique<helix::gcode::ParsedGCodeFile>(parser.finalize());
                 result->gcode_file->filename = path;
@@ -1176,6 +1179,26 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
                         builder.set_layer_height(result->gcode_file->layer_height_mm);
                     };
 
+                    // Reopening an unchanged file loads the geometry instead of rebuilding it
+                    size_t cache_bytes = source_stamp ? helix::get_gcode_geometry_cache_bytes() : 0;
+                    helix::gcode::GeometryCache cache(
+                        cache_bytes > 0 ? get_helix_cache_dir("gcode_geometry") : "", cache_bytes);
+                    auto load_or_build = [&](helix::gcode::GeometryBuilder& builder,
+                                             const helix::gcode::SimplificationOptions& opts) {
+                        uint64_t key = builder.cache_key(opts);
+                        if (cache.enabled()) {
+                            if (auto cached = cache.load(path, *source_stamp, key)) {
+                                return cached;
+                            }
+                        }
+                        auto built = std::make_unique<helix::gcode::RibbonGeometry>(
+                            builder.build(*result->gcode_file, opts));
+                        if (cache.enabled()) {
+                            cache.save(path, *source_stamp, key, *built);
+                        }
+                        return built;
+                    };
+
                     // Build full geometry only on non-constrained systems
                     if (!memory_constrained) {
                         helix::gcode::GeometryBuilder builder;
@@ -1186,8 +1209,7 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
                         helix::gcode::SimplificationOptions opts{.tolerance_mm = 0.5f,
                                                                  .min_segment_length_mm = 0.05f};
 
-                        result->geometry = std::make_unique<helix::gcode::RibbonGeometry>(
-                            builder.build(*result->gcode_file, opts));
+                        result->geometry = load_or_build(builder, opts);
 
                         spdlog::info(
                             "[GCode Viewer] Built full geometry: {} vertices, {} triangles",
@@ -1206,8 +1228,7 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
                         helix::gcode::SimplificationOptions coarse_opts{
                             .tolerance_mm = 2.0f, .min_segment_length_mm = 0.5f};
 
-                        result->coarse_geometry = std::make_unique<helix::gcode::RibbonGeometry>(
-                            coarse_builder.build(*result->gcode_file, coarse_opts));
+                        result->coarse_geometry = load_or_build(coarse_builder, coarse_opts);
 
                         size_t coarse_tris = result->coarse_geometry->extrusion_triangle_count +
                                              result->coarse_geometry->travel_triangle_count;
@@ -0,0 +1,396 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ui_history_list_view.h"
+
+#include "theme_manager.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace helix::ui {
+
+// ============================================================================
+// Destruction
+// ============================================================================
+
+HistoryListView::~HistoryListView() {
+    cleanup();
+}
+
+// ============================================================================
+// Setup / Cleanup
+// ============================================================================
+
+bool HistoryListView::setup(lv_obj_t* container, lv_obj_t* scroll_container,
+                            HistoryRowClickCallback on_row_click) {
+    if (!container) {
+        spdlog::error("[HistoryListView] Cannot setup - null container");
+        return false;
+    }
+
+    container_ = container;
+    scroll_container_ = scroll_container ? scroll_container : container;
+    on_row_click_ = std::move(on_row_click);
+
+    spdlog::trace("[HistoryListView] Setup complete");
+    return true;
+}
+
+void HistoryListView::cleanup() {
+    pool_.clear();
+    pool_widgets_.clear();
+    pool_indices_.clear();
+    container_ = nullptr;
+    scroll_container_ = nullptr;
+    leading_spacer_ = nullptr;
+    trailing_spacer_ = nullptr;
+    visible_start_ = -1;
+    visible_end_ = -1;
+    total_items_ = 0;
+    cached_row_height_ = 0;
+    cached_row_gap_ = 0;
+    spdlog::debug("[HistoryListView] cleanup()");
+}
+
+// ============================================================================
+// Pool Initialization
+// ============================================================================
+
+void HistoryListView::init_pool() {
+    if (!container_ || !pool_.empty()) {
+        return;
+    }
+
+    spdlog::debug("[HistoryListView] Creating {} row widgets", POOL_SIZE);
+
+    pool_.reserve(POOL_SIZE);
+    pool_widgets_.reserve(POOL_SIZE);
+    pool_indices_.resize(POOL_SIZE, -1);
+
+    for (int i = 0; i < POOL_SIZE; i++) {
+        const char* attrs[] = {
+            "filename",      "",
+            "date",          "",
+            "duration",      "",
+            "filament_type", "",
+            "status",        "",
+            "status_color",  status_color(PrintJobStatus::UNKNOWN),
+            nullptr};
+
+        lv_obj_t* row =
+            static_cast<lv_obj_t*>(lv_xml_create(container_, "history_list_row", attrs));
+
+        if (row) {
+            lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+
+            // Attach click handler ONCE at pool creation
+            lv_obj_add_event_cb(row, on_row_clicked, LV_EVENT_CLICKED, this);
+
+            RowWidgets widgets;
+            widgets.status_bar = lv_obj_find_by_name(row, "status_bar");
+            widgets.filename = lv_obj_find_by_name(row, "row_filename");
+            widgets.date = lv_obj_find_by_name(row, "row_date");
+            widgets.duration = lv_obj_find_by_name(row, "row_duration");
+            widgets.filament = lv_obj_find_by_name(row, "row_filament");
+            widgets.status = lv_obj_find_by_name(row, "row_status");
+
+            pool_.push_back(row);
+            pool_widgets_.push_back(widgets);
+        }
+    }
+
+    spdlog::debug("[HistoryListView] Pool initialized with {} rows", pool_.size());
+}
+
+void HistoryListView::create_spacers() {
+    if (!container_) {
+        return;
+    }
+
+    if (!leading_spacer_) {
+        leading_spacer_ = lv_obj_create(container_);
+        lv_obj_remove_style_all(leading_spacer_);
+        lv_obj_remove_flag(leading_spacer_, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_width(leading_spacer_, lv_pct(100));
+        lv_obj_set_height(leading_spacer_, 0);
+    }
+
+    if (!trailing_spacer_) {
+        trailing_spacer_ = lv_obj_create(container_);
+        lv_obj_remove_style_all(trailing_spacer_);
+        lv_obj_remove_flag(trailing_spacer_, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_width(trailing_spacer_, lv_pct(100));
+        lv_obj_set_height(trailing_spacer_, 0);
+    }
+}
+
+// ============================================================================
+// Row Configuration
+// ============================================================================
+
+void HistoryListView::configure_row(size_t pool_index, size_t display_index,
+                                    const PrintHistoryJob& job) {
+    lv_obj_t* row = pool_[pool_index];
+    const RowWidgets& w = pool_widgets_[pool_index];
+
+    // Store display index in user_data for click handling
+    lv_obj_set_user_data(row, reinterpret_cast<void*>(display_index));
+
+    if (w.filename) {
+        lv_label_set_text(w.filename, job.filename.c_str());
+    }
+    if (w.date) {
+        lv_label_set_text(w.date, job.date_str.c_str());
+    }
+    if (w.duration) {
+        lv_label_set_text(w.duration, job.duration_str.c_str());
+    }
+    if (w.filament) {
+        lv_label_set_text(w.filament,
+                          job.filament_type.empty() ? "Unknown" : job.filament_type.c_str());
+    }
+
+    lv_color_t color = theme_manager_parse_hex_color(status_color(job.status));
+    if (w.status_bar) {
+        lv_obj_set_style_bg_color(w.status_bar, color, LV_PART_MAIN);
+    }
+    if (w.status) {
+        lv_label_set_text(w.status, status_text(job.status));
+        lv_obj_set_style_text_color(w.status, color, LV_PART_MAIN);
+    }
+
+    lv_obj_remove_flag(row, LV_OBJ_FLAG_HIDDEN);
+}
+
+// ============================================================================
+// Population / Visibility
+// ============================================================================
+
+void HistoryListView::populate(const std::vector<PrintHistoryJob>& jobs,
+                               const std::vector<size_t>& order, bool preserve_scroll) {
+    if (!container_) {
+        return;
+    }
+
+    spdlog::debug("[HistoryListView] Populating with {} of {} jobs (preserve_scroll={})",
+                  order.size(), jobs.size(), preserve_scroll);
+
+    // Save scroll position before any changes if preserving
+    int32_t saved_scroll = preserve_scroll ? lv_obj_get_scroll_y(scroll_container_) : 0;
+
+    // Initialize pool on first call
+    if (pool_.empty()) {
+        init_pool();
+    }
+
+    // Create spacers if needed
+    create_spacers();
+
+    // Cache row dimensions on first populate
+    if (cached_row_height_ == 0 && !pool_.empty() && !order.empty() && order[0] < jobs.size()) {
+        configure_row(0, 0, jobs[order[0]]);
+        lv_obj_update_layout(container_);
+
+        cached_row_height_ = lv_obj_get_height(pool_[0]);
+        cached_row_gap_ = lv_obj_get_style_pad_row(container_, LV_PART_MAIN);
+
+        spdlog::debug("[HistoryListView] Cached row dimensions: height={} gap={}",
+                      cached_row_height_, cached_row_gap_);
+    }
+
+    // Reset visible range tracking
+    visible_start_ = -1;
+    visible_end_ = -1;
+    total_items_ = 0;
+
+    if (!preserve_scroll) {
+        lv_obj_scroll_to_y(scroll_container_, 0, LV_ANIM_OFF);
+    }
+
+    // Update visible rows (this also updates spacer heights)
+    update_visible(jobs, order);
+
+    // Restore scroll position, clamped to the new content height
+    if (preserve_scroll && saved_scroll > 0) {
+        lv_obj_update_layout(scroll_container_);
+        int32_t max_scroll =
+            lv_obj_get_scroll_y(scroll_container_) + lv_obj_get_scroll_bottom(scroll_container_);
+        lv_obj_scroll_to_y(scroll_container_, std::min(saved_scroll, max_scroll), LV_ANIM_OFF);
+        update_visible(jobs, order);
+    }
+
+    spdlog::debug("[HistoryListView] Populated: {} rows, pool size {}", order.size(),
+                  pool_.size());
+}
+
+int32_t HistoryListView::rows_scroll_offset() const {
+    if (scroll_container_ == container_) {
+        return lv_obj_get_scroll_y(container_);
+    }
+
+    // Rows sit below other content (loading/empty states) in the scroll container:
+    // the distance from the rows' top edge to the viewport's top edge is how far
+    // into the rows we've scrolled
+    lv_area_t viewport;
+    lv_area_t rows;
+    lv_obj_get_coords(scroll_container_, &viewport);
+    lv_obj_get_coords(container_, &rows);
+    return std::max<int32_t>(0, viewport.y1 - rows.y1);
+}
+
+void HistoryListView::update_visible(const std::vector<PrintHistoryJob>& jobs,
+                                     const std::vector<size_t>& order) {
+    if (!container_ || pool_.empty() || order.empty()) {
+        for (auto* row : pool_) {
+            lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        }
+        if (leading_spacer_)
+            lv_obj_set_height(leading_spacer_, 0);
+        if (trailing_spacer_)
+            lv_obj_set_height(trailing_spacer_, 0);
+        std::fill(pool_indices_.begin(), pool_indices_.end(), static_cast<ssize_t>(-1));
+        visible_start_ = -1;
+        visible_end_ = -1;
+        total_items_ = 0;
+        return;
+    }
+
+    int32_t scroll_y = rows_scroll_offset();
+    int32_t viewport_height = lv_obj_get_height(scroll_container_);
+
+    int total_rows = static_cast<int>(order.size());
+
+    int row_height = cached_row_height_ > 0 ? cached_row_height_ : 56;
+    int row_gap = cached_row_gap_;
+    int row_stride = row_height + row_gap;
+
+    // Calculate visible range with buffer
+    int first_visible =
+        std::min(total_rows, std::max(0, static_cast<int>(scroll_y / row_stride) - BUFFER_ROWS));
+    int last_visible = std::min(
+        total_rows, static_cast<int>((scroll_y + viewport_height) / row_stride) + 1 + BUFFER_ROWS);
+
+    // Force re-render if total item count changed (e.g. filter applied)
+    bool data_changed = (total_rows != total_items_);
+
+    // Skip if unchanged (unless data set size changed)
+    if (!data_changed && first_visible == visible_start_ && last_visible == visible_end_) {
+        return;
+    }
+
+    total_items_ = total_rows;
+
+    spdlog::trace(
+        "[HistoryListView] Rendering rows {}-{} of {} (scroll_y={} viewport={} data_changed={})",
+        first_visible, last_visible, total_rows, scroll_y, viewport_height, data_changed);
+
+    // Update leading spacer
+    if (leading_spacer_) {
+        lv_obj_set_height(leading_spacer_, first_visible * row_stride);
+        lv_obj_move_to_index(leading_spacer_, 0);
+    }
+
+    // Update trailing spacer
+    if (trailing_spacer_) {
+        lv_obj_set_height(trailing_spacer_, std::max(0, (total_rows - last_visible) * row_stride));
+    }
+
+    // Mark all pool slots as available
+    std::fill(pool_indices_.begin(), pool_indices_.end(), static_cast<ssize_t>(-1));
+
+    // Assign pool rows to visible display indices
+    size_t pool_idx = 0;
+    for (int display_idx = first_visible; display_idx < last_visible && pool_idx < pool_.size();
+         display_idx++) {
+        size_t job_idx = order[display_idx];
+        if (job_idx >= jobs.size()) {
+            continue;
+        }
+
+        configure_row(pool_idx, static_cast<size_t>(display_idx), jobs[job_idx]);
+        pool_indices_[pool_idx] = display_idx;
+
+        // Position after leading spacer
+        lv_obj_move_to_index(pool_[pool_idx], static_cast<int>(pool_idx) + 1);
+        pool_idx++;
+    }
+
+    // Hide unused pool rows
+    for (; pool_idx < pool_.size(); pool_idx++) {
+        lv_obj_add_flag(pool_[pool_idx], LV_OBJ_FLAG_HIDDEN);
+        pool_indices_[pool_idx] = -1;
+    }
+
+    visible_start_ = first_visible;
+    visible_end_ = last_visible;
+}
+
+void HistoryListView::refresh_content(const std::vector<PrintHistoryJob>& jobs,
+                                      const std::vector<size_t>& order) {
+    if (!container_ || pool_.empty() || visible_start_ < 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < pool_.size(); i++) {
+        ssize_t display_idx = pool_indices_[i];
+        if (display_idx < 0 || static_cast<size_t>(display_idx) >= order.size()) {
+            continue;
+        }
+        size_t job_idx = order[display_idx];
+        if (job_idx < jobs.size()) {
+            configure_row(i, static_cast<size_t>(display_idx), jobs[job_idx]);
+        }
+    }
+}
+
+// ============================================================================
+// Status Presentation
+// ============================================================================
+
+const char* HistoryListView::status_color(PrintJobStatus status) {
+    switch (status) {
+    case PrintJobStatus::COMPLETED:
+        return "#00C853"; // Green
+    case PrintJobStatus::CANCELLED:
+        return "#FF9800"; // Orange
+    case PrintJobStatus::ERROR:
+        return "#F44336"; // Red
+    case PrintJobStatus::IN_PROGRESS:
+        return "#2196F3"; // Blue
+    default:
+        return "#9E9E9E"; // Gray
+    }
+}
+
+const char* HistoryListView::status_text(PrintJobStatus status) {
+    switch (status) {
+    case PrintJobStatus::COMPLETED:
+        return "Completed";
+    case PrintJobStatus::CANCELLED:
+        return "Cancelled";
+    case PrintJobStatus::ERROR:
+        return "Failed";
+    case PrintJobStatus::IN_PROGRESS:
+        return "In Progress";
+    default:
+        return "Unknown";
+    }
+}
+
+// ============================================================================
+// Static Callbacks
+// ============================================================================
+
+void HistoryListView::on_row_clicked(lv_event_t* e) {
+    auto* self = static_cast<HistoryListView*>(lv_event_get_user_data(e));
+    auto* row = static_cast<lv_obj_t*>(lv_event_get_current_target(e));
+
+    if (self && self->on_row_click_ && row) {
+        auto display_index = reinterpret_cast<size_t>(lv_obj_get_user_data(row));
+        self->on_row_click_(display_index);
+    }
+}
+
+} // namespace helix::ui
@@ -15,8 +15,10 @@
 #include "ui_utils.h"
 
 #include "app_globals.h"
+#include "environment_config.h"
 #include "moonraker_api.h"
 #include "theme_manager.h"
+#include "ui/ui_cleanup_helpers.h"
 
 #include <spdlog/spdlog.h>
 
@@ -32,126 +34,6 @@
 
 DEFINE_GLOBAL_PANEL(ConsolePanel, g_console_panel, get_global_console_panel)
 
-// ============================================================================
-// HTML Span Parsing (for AFC/Happy Hare colored output)
-// ============================================================================
-
-namespace {
-
-/**
- * @brief Parsed text segment with optional color class
- */
-struct TextSegment {
-    std::string text;
-    std::string color_class; // empty = default, "success", "info", "warning", "error"
-};
-
-/**
- * @brief Check if a message contains HTML spans we can parse
- *
- * Looks for Mainsail-style spans from AFC/Happy Hare plugins:
- * <span class=success--text>LOADED</span>
- */
-bool contains_html_spans(const std::string& message) {
-    return message.find("<span class=") != std::string::npos &&
-           (message.find("success--text") != std::string::npos ||
-            message.find("info--text") != std::string::npos ||
-            message.find("warning--text") != std::string::npos ||
-            message.find("error--text") != std::string::npos);
-}
-
-/**
- * @brief Parse HTML span tags into text segments with color classes
- *
- * Parses Mainsail-style spans: <span class=XXX--text>content</span>
- * Returns vector of segments, each with text and optional color class.
- */
-std::vector<TextSegment> parse_html_spans(const std::string& message) {
-    std::vector<TextSegment> segments;
-
-    size_t pos = 0;
-    const size_t len = message.size();
-
-    while (pos < len) {
-        // Look for next <span class=
-        size_t span_start = message.find("<span class=", pos);
-
-        if (span_start == std::string::npos) {
-            // No more spans - add remaining text as plain segment
-            if (pos < len) {
-                TextSegment seg;
-                seg.text = message.substr(pos);
-                if (!seg.text.empty()) {
-                    segments.push_back(seg);
-                }
-            }
-            break;
-        }
-
-        // Add any text before the span as a plain segment
-        if (span_start > pos) {
-            TextSegment seg;
-            seg.text = message.substr(pos, span_start - pos);
-            segments.push_back(seg);
-        }
-
-        // Parse the span: <span class=XXX--text>content</span>
-        // Find the class value (ends at >)
-        size_t class_start = span_start + 12; // strlen("<span class=")
-        size_t class_end = message.find('>', class_start);
-
-        if (class_end == std::string::npos) {
-            // Malformed - add rest as plain text
-            TextSegment seg;
-            seg.text = message.substr(span_start);
-            segments.push_back(seg);
-            break;
-        }
-
-        // Extract color class from "success--text", "info--text", etc.
-        std::string class_attr = message.substr(class_start, class_end - class_start);
-        std::string color_class;
-
-        if (class_attr.find("success--text") != std::string::npos) {
-            color_class = "success";
-        } else if (class_attr.find("info--text") != std::string::npos) {
-            color_class = "info";
-        } else if (class_attr.find("warning--text") != std::string::npos) {
-            color_class = "warning";
-        } else if (class_attr.find("error--text") != std::string::npos) {
-            color_class = "error";
-        }
-
-        // Find the closing </span>
-        size_t content_start = class_end + 1;
-        size_t span_close = message.find("</span>", content_start);
-
-        if (span_close == std::string::npos) {
-            // No closing tag - add rest as plain text
-            TextSegment seg;
-            seg.text = message.substr(content_start);
-            seg.color_class = color_class;
-            segments.push_back(seg);
-            break;
-        }
-
-        // Extract content between > and </span>
-        TextSegment seg;
-        seg.text = message.substr(content_start, span_close - content_start);
-        seg.color_class = color_class;
-        if (!seg.text.empty()) {
-            segments.push_back(seg);
-        }
-
-        // Move past </span>
-        pos = span_close + 7; // strlen("</span>")
-    }
-
-    return segments;
-}
-
-} // namespace
-
 // ============================================================================
 // Constructor
 // ============================================================================
@@ -162,6 +44,7 @@ ConsolePanel::ConsolePanel() {
 }
 
 ConsolePanel::~ConsolePanel() {
+    helix::ui::safe_delete_timer(stress_.timer);
     deinit_subjects();
 }
 
@@ -253,6 +136,9 @@ lv_obj_t* ConsolePanel::create(lv_obj_t* parent) {
         spdlog::warn("[{}] gcode_input not found - input disabled", get_name());
     }
 
+    log_view_.setup(console_container_, &lines_);
+    lv_obj_add_event_cb(console_container_, on_console_scroll_static, LV_EVENT_SCROLL, this);
+
     spdlog::info("[{}] Overlay created successfully", get_name());
     return overlay_root_;
 }
@@ -273,6 +159,10 @@ void ConsolePanel::on_activate() {
     subscribe_to_gcode_responses();
     // Reset scroll tracking
     user_scrolled_up_ = false;
+
+    if (auto rate = helix::config::EnvironmentConfig::get_console_stress_rate()) {
+        start_stress(*rate);
+    }
 }
 
 void ConsolePanel::on_deactivate() {
@@ -280,6 +170,7 @@ void ConsolePanel::on_deactivate() {
 
     // Unsubscribe from real-time updates
     unsubscribe_from_gcode_responses();
+    stop_stress();
 
     // Call base class
     OverlayBase::on_deactivate();
@@ -336,97 +227,28 @@ void ConsolePanel::fetch_history() {
 void ConsolePanel::populate_entries(const std::vector<GcodeEntry>& entries) {
     clear_entries();
 
-    // Store entries (already oldest-first from API)
+    // Entries are already oldest-first from the API; the ring drops any overflow
     for (const auto& entry : entries) {
-        entries_.push_back(entry);
-
-        // Enforce max size (remove oldest)
-        if (entries_.size() > MAX_ENTRIES) {
-            entries_.pop_front();
-        }
-    }
-
-    // Create widgets for each entry
-    for (const auto& entry : entries_) {
-        create_entry_widget(entry);
+        push_entry(entry);
     }
 
     // Update visibility and scroll to bottom
     update_visibility();
-    scroll_to_bottom();
+    user_scrolled_up_ = false;
+    log_view_.render(true);
 }
 
-void ConsolePanel::create_entry_widget(const GcodeEntry& entry) {
-    if (!console_container_) {
-        return;
-    }
-
-    const lv_font_t* font = theme_manager_get_font("font_small");
-
-    if (contains_html_spans(entry.message)) {
-        // Create spangroup for rich text with colored segments
-        lv_obj_t* spangroup = lv_spangroup_create(console_container_);
-        lv_obj_set_width(spangroup, LV_PCT(100));
-        lv_obj_set_style_text_font(spangroup, font, 0);
-
-        auto segments = parse_html_spans(entry.message);
-        for (const auto& seg : segments) {
-            lv_span_t* span = lv_spangroup_add_span(spangroup);
-            lv_span_set_text(span, seg.text.c_str());
-
-            // Determine color based on segment's color class
-            lv_color_t color;
-            if (seg.color_class == "success") {
-                color = theme_manager_get_color("success");
-            } else if (seg.color_class == "info") {
-                color = theme_manager_get_color("info");
-            } else if (seg.color_class == "warning") {
-                color = theme_manager_get_color("warning");
-            } else if (seg.color_class == "error") {
-                color = theme_manager_get_color("danger");
-            } else {
-                // Default color based on entry type
-                color = entry.is_error ? theme_manager_get_color("danger")
-                        : entry.type == GcodeEntry::Type::RESPONSE
-                            ? theme_manager_get_color("success")
-                            : theme_manager_get_color("text");
-            }
-            lv_style_set_text_color(lv_span_get_style(span), color);
-        }
-        lv_spangroup_refresh(spangroup);
-    } else {
-        // Plain label for non-HTML messages (faster, simpler)
-        lv_obj_t* label = lv_label_create(console_container_);
-        lv_label_set_text(label, entry.message.c_str());
-        lv_obj_set_width(label, LV_PCT(100));
-
-        // Apply color based on entry type
-        lv_color_t color;
-        if (entry.is_error) {
-            color = theme_manager_get_color("danger");
-        } else if (entry.type == GcodeEntry::Type::RESPONSE) {
-            color = theme_manager_get_color("success");
-        } else {
-            // Commands use primary text color
-            color = theme_manager_get_color("text");
-        }
-        lv_obj_set_style_text_color(label, color, 0);
-        lv_obj_set_style_text_font(label, font, 0);
-    }
+void ConsolePanel::push_entry(const GcodeEntry& entry) {
+    lines_.push(entry.message,
+                entry.type == GcodeEntry::Type::RESPONSE ? helix::ConsoleLineKind::RESPONSE
+                                                         : helix::ConsoleLineKind::COMMAND,
+                entry.is_error, entry.timestamp);
 }
 
 void ConsolePanel::clear_entries() {
-    entries_.clear();
-
-    if (console_container_) {
-        lv_obj_clean(console_container_);
-    }
-}
-
-void ConsolePanel::scroll_to_bottom() {
-    if (console_container_) {
-        lv_obj_scroll_to_y(console_container_, LV_COORD_MAX, LV_ANIM_OFF);
-    }
+    lines_.clear();
+    log_view_.invalidate();
+    log_view_.render(false);
 }
 
 bool ConsolePanel::is_error_message(const std::string& message) {
@@ -480,14 +302,14 @@ bool ConsolePanel::is_temp_message(const std::string& message) {
 }
 
 void ConsolePanel::update_visibility() {
-    bool has_entries = !entries_.empty();
+    bool has_entries = !lines_.empty();
 
     // Toggle visibility: show console OR empty state
     helix::ui::toggle_list_empty_state(console_container_, empty_state_, has_entries);
 
     // Update status message
     if (has_entries) {
-        std::snprintf(status_buf_, sizeof(status_buf_), "%zu entries", entries_.size());
+        std::snprintf(status_buf_, sizeof(status_buf_), "%zu entries", lines_.size());
     } else {
         status_buf_[0] = '\0'; // Clear status text
     }
@@ -564,36 +386,53 @@ void ConsolePanel::on_gcode_response(const nlohmann::json& msg) {
     entry.is_error = is_error_message(line);
 
     // CRITICAL: Defer LVGL operations to main thread via ui_queue_update [L012]
-    // WebSocket callbacks run on libhv thread - direct LVGL calls cause crashes
-    struct Ctx {
-        ConsolePanel* panel;
-        GcodeEntry entry;
-    };
-    auto ctx = std::make_unique<Ctx>(Ctx{this, std::move(entry)});
-    helix::ui::queue_update<Ctx>(std::move(ctx), [](Ctx* c) { c->panel->add_entry(c->entry); });
+    // WebSocket callbacks run on libhv thread - direct LVGL calls cause crashes.
+    // Bursts (macros, AFC status dumps) are batched into a single drain and render.
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        pending_responses_.push_back(std::move(entry));
+    }
+    helix::ui::queue_update_coalesced("console_gcode_responses",
+                                      [this]() { drain_pending_responses(); });
 }
 
-void ConsolePanel::add_entry(const GcodeEntry& entry) {
-    // Add to deque
-    entries_.push_back(entry);
+void ConsolePanel::drain_pending_responses() {
+    std::vector<GcodeEntry> batch;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        batch.swap(pending_responses_);
+    }
+    if (batch.empty()) {
+        return;
+    }
 
-    // Enforce max size (remove oldest)
-    while (entries_.size() > MAX_ENTRIES && console_container_) {
-        entries_.pop_front();
-        // Remove oldest widget (first child)
-        lv_obj_t* first_child = lv_obj_get_child(console_container_, 0);
-        helix::ui::safe_delete(first_child);
+    for (const auto& entry : batch) {
+        push_entry(entry);
     }
+    commit_appends();
+}
 
-    // Create widget for new entry
-    create_entry_widget(entry);
+void ConsolePanel::add_entry(const GcodeEntry& entry) {
+    push_entry(entry);
+    commit_appends();
+}
 
-    // Update visibility state
+void ConsolePanel::commit_appends() {
     update_visibility();
 
-    // Smart auto-scroll: only scroll if user hasn't scrolled up manually
-    if (!user_scrolled_up_) {
-        scroll_to_bottom();
+    // Smart auto-scroll: only follow the tail if user hasn't scrolled up manually
+    log_view_.render(!user_scrolled_up_);
+}
+
+void ConsolePanel::on_console_scroll() {
+    log_view_.render(false);
+    user_scrolled_up_ = lv_obj_get_scroll_bottom(console_container_) > SCROLL_FOLLOW_THRESHOLD;
+}
+
+void ConsolePanel::on_console_scroll_static(lv_event_t* e) {
+    auto* panel = static_cast<ConsolePanel*>(lv_event_get_user_data(e));
+    if (panel && panel->console_container_) {
+        panel->on_console_scroll();
     }
 }
 
@@ -638,3 +477,88 @@ void ConsolePanel::clear_display() {
     clear_entries();
     update_visibility();
 }
+
+// ============================================================================
+// Stress Mode (HELIX_CONSOLE_STRESS)
+// ============================================================================
+
+void ConsolePanel::start_stress(int lines_per_sec) {
+    if (stress_.timer) {
+        return;
+    }
+
+    stress_ = StressState{};
+    stress_.rate = lines_per_sec;
+    stress_.last_tick_ms = lv_tick_get();
+    stress_.window_start_ms = stress_.last_tick_ms;
+    stress_.rows_at_start = log_view_.rows_configured();
+    stress_.timer = lv_timer_create(
+        [](lv_timer_t* t) {
+            static_cast<ConsolePanel*>(lv_timer_get_user_data(t))->stress_tick();
+        },
+        STRESS_TICK_MS, this);
+
+    spdlog::info("[{}] Stress mode: feeding {} lines/s", get_name(), lines_per_sec);
+}
+
+void ConsolePanel::stop_stress() {
+    if (stress_.timer) {
+        helix::ui::safe_delete_timer(stress_.timer);
+        spdlog::info("[{}] Stress mode stopped", get_name());
+    }
+}
+
+void ConsolePanel::stress_tick() {
+    uint32_t now = lv_tick_get();
+    uint32_t gap = now - stress_.last_tick_ms;
+    stress_.last_tick_ms = now;
+
+    // The timer only runs between frames, so a gap well past the period means
+    // rendering (or the drain) stalled the UI loop
+    if (gap > 2 * STRESS_TICK_MS) {
+        ++stress_.late_ticks;
+    }
+    stress_.max_gap_ms = std::max(stress_.max_gap_ms, gap);
+
+    stress_.owed += stress_.rate * (gap / 1000.0);
+    auto count = static_cast<uint64_t>(stress_.owed);
+    stress_.owed -= static_cast<double>(count);
+
+    char buf[96];
+    for (uint64_t i = 0; i < count; ++i) {
+        uint64_t n = lines_.total_pushed();
+        GcodeEntry entry;
+        entry.type = GcodeEntry::Type::RESPONSE;
+        if (n % 50 == 0) {
+            std::snprintf(buf, sizeof(buf), "!! Stress error %llu",
+                          static_cast<unsigned long long>(n));
+            entry.is_error = true;
+        } else if (n % 10 == 0) {
+            std::snprintf(buf, sizeof(buf),
+                          "AFC: lane %llu <span class=success--text>LOADED</span>",
+                          static_cast<unsigned long long>(n % 8));
+        } else {
+            std::snprintf(buf, sizeof(buf), "// probe at %llu.000,120.000 is z=1.234567",
+                          static_cast<unsigned long long>(n % 240));
+        }
+        entry.message = buf;
+        push_entry(entry);
+    }
+    if (count > 0) {
+        commit_appends();
+    }
+    stress_.window_lines += count;
+
+    uint32_t elapsed = now - stress_.window_start_ms;
+    if (elapsed >= STRESS_REPORT_MS) {
+        spdlog::info("[{}] Stress: {:.0f} lines/s sustained, {} late ticks (max gap {} ms), "
+                     "{} rows configured",
+                     get_name(), stress_.window_lines * 1000.0 / elapsed, stress_.late_ticks,
+                     stress_.max_gap_ms, log_view_.rows_configured() - stress_.rows_at_start);
+        stress_.window_start_ms = now;
+        stress_.window_lines = 0;
+        stress_.late_ticks = 0;
+        stress_.max_gap_ms = 0;
+        stress_.rows_at_start = log_view_.rows_configured();
+    }
+}
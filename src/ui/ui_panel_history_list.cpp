@@ -212,8 +212,15 @@ lv_obj_t* HistoryListPanel::create(lv_obj_t* parent) {
         lv_obj_set_style_text_font(sort_dropdown_, icon_font, LV_PART_INDICATOR);
     }
 
-    // Attach scroll event handler for infinite scroll
+    // Rows are a fixed pool recycled as list_content scrolls
+    if (list_rows_) {
+        list_view_.setup(list_rows_, list_content_,
+                         [this](size_t index) { handle_row_click(index); });
+    }
+
+    // Attach scroll event handlers: row recycling and infinite scroll
     if (list_content_) {
+        lv_obj_add_event_cb(list_content_, on_list_scroll_static, LV_EVENT_SCROLL, this);
         lv_obj_add_event_cb(list_content_, on_scroll_static, LV_EVENT_SCROLL_END, this);
     }
 
@@ -283,7 +290,7 @@ void HistoryListPanel::on_activate() {
             // Get fresh data from manager and re-apply filters
             if (history_manager_->is_loaded()) {
                 jobs_ = history_manager_->get_jobs();
-                apply_filters_and_sort();
+                apply_filters_and_sort(true);
             }
         };
         history_manager_->add_observer(&history_observer_);
@@ -457,11 +464,8 @@ void HistoryListPanel::load_more() {
             // Check if we've loaded everything
             has_more_data_ = (jobs_.size() < total);
 
-            // Re-apply filters to the full job list
-            apply_filters_and_sort();
-
-            // Note: apply_filters_and_sort calls populate_list which rebuilds UI
-            // For smoother infinite scroll, we could optimize this to only append
+            // Re-apply filters to the full job list, keeping the user's place
+            apply_filters_and_sort(true);
         },
         [this](const MoonrakerError& error) {
             is_loading_more_ = false;
@@ -562,72 +566,26 @@ void HistoryListPanel::associate_timelapse_files(const std::vector<FileInfo>& ti
 // Internal Methods
 // ============================================================================
 
-void HistoryListPanel::populate_list() {
+void HistoryListPanel::populate_list(bool preserve_scroll) {
     if (!list_rows_) {
         spdlog::error("[{}] Cannot populate: list_rows container is null", get_name());
         return;
     }
 
-    // Clear existing rows
-    clear_list();
-
-    // Update empty state
+    // Update empty state first: list_rows is hidden unless there are jobs, and the
+    // view measures its first row on initial populate
     update_empty_state();
 
-    if (filtered_jobs_.empty()) {
-        spdlog::debug("[{}] No jobs to display after filtering", get_name());
-        return;
-    }
-
-    spdlog::debug("[{}] Populating list with {} filtered jobs", get_name(), filtered_jobs_.size());
+    list_view_.populate(jobs_, filtered_indices_, preserve_scroll);
 
-    for (size_t i = 0; i < filtered_jobs_.size(); ++i) {
-        const auto& job = filtered_jobs_[i];
-
-        // Get status info
-        const char* status_color = get_status_color(job.status);
-        const char* status_text = get_status_text(job.status);
-
-        // Build attrs for row creation
-        const char* attrs[] = {
-            "filename",      job.filename.c_str(),
-            "date",          job.date_str.c_str(),
-            "duration",      job.duration_str.c_str(),
-            "filament_type", job.filament_type.empty() ? "Unknown" : job.filament_type.c_str(),
-            "status",        status_text,
-            "status_color",  status_color,
-            nullptr};
-
-        lv_obj_t* row =
-            static_cast<lv_obj_t*>(lv_xml_create(list_rows_, "history_list_row", attrs));
-
-        if (row) {
-            attach_row_click_handler(row, i);
-        } else {
-            spdlog::warn("[{}] Failed to create row for job {}", get_name(), i);
-        }
-    }
-
-    spdlog::debug("[{}] List populated with {} rows", get_name(), filtered_jobs_.size());
-}
-
-void HistoryListPanel::clear_list() {
-    if (!list_rows_)
-        return;
-
-    // Remove all children from the list container
-    uint32_t child_count = lv_obj_get_child_count(list_rows_);
-    for (int32_t i = child_count - 1; i >= 0; --i) {
-        lv_obj_t* child = lv_obj_get_child(list_rows_, i);
-        helix::ui::safe_delete(child);
-    }
+    spdlog::debug("[{}] List populated with {} rows", get_name(), filtered_indices_.size());
 }
 
 void HistoryListPanel::update_empty_state() {
     // Determine panel state and update subject declaratively
     // State values: 0=LOADING, 1=EMPTY, 2=HAS_JOBS
     int state;
-    bool has_filtered_jobs = !filtered_jobs_.empty();
+    bool has_filtered_jobs = !filtered_indices_.empty();
 
     if (has_filtered_jobs) {
         state = 2; // HAS_JOBS
@@ -656,71 +614,20 @@ void HistoryListPanel::update_empty_state() {
                   get_name(), state, has_filtered_jobs, jobs_.size());
 }
 
-const char* HistoryListPanel::get_status_color(PrintJobStatus status) {
-    switch (status) {
-    case PrintJobStatus::COMPLETED:
-        return "#00C853"; // Green
-    case PrintJobStatus::CANCELLED:
-        return "#FF9800"; // Orange
-    case PrintJobStatus::ERROR:
-        return "#F44336"; // Red
-    case PrintJobStatus::IN_PROGRESS:
-        return "#2196F3"; // Blue
-    default:
-        return "#9E9E9E"; // Gray
-    }
-}
-
-const char* HistoryListPanel::get_status_text(PrintJobStatus status) {
-    switch (status) {
-    case PrintJobStatus::COMPLETED:
-        return "Completed";
-    case PrintJobStatus::CANCELLED:
-        return "Cancelled";
-    case PrintJobStatus::ERROR:
-        return "Failed";
-    case PrintJobStatus::IN_PROGRESS:
-        return "In Progress";
-    default:
-        return "Unknown";
-    }
-}
-
 // ============================================================================
 // Click Handlers
 // ============================================================================
 
-void HistoryListPanel::attach_row_click_handler(lv_obj_t* row, size_t index) {
-    // Store index in user data (cast to void* for LVGL)
-    // This matches the pattern used by PrintSelectPanel
-    lv_obj_set_user_data(row, reinterpret_cast<void*>(index));
-    lv_obj_add_event_cb(row, on_row_clicked_static, LV_EVENT_CLICKED, this);
-}
-
-void HistoryListPanel::on_row_clicked_static(lv_event_t* e) {
-    // Get panel instance from event user data
-    HistoryListPanel* panel = static_cast<HistoryListPanel*>(lv_event_get_user_data(e));
-    // Get the row that was clicked (target of the event)
-    lv_obj_t* row = static_cast<lv_obj_t*>(lv_event_get_target(e));
-
-    if (!panel || !row)
-        return;
-
-    // Get the index stored in the row's user data
-    size_t index = reinterpret_cast<size_t>(lv_obj_get_user_data(row));
-    panel->handle_row_click(index);
-}
-
 void HistoryListPanel::handle_row_click(size_t index) {
-    if (index >= filtered_jobs_.size()) {
+    if (index >= filtered_indices_.size() || filtered_indices_[index] >= jobs_.size()) {
         spdlog::warn("[{}] Invalid row index: {}", get_name(), index);
         return;
     }
 
-    selected_job_index_ = index;
-    const auto& job = filtered_jobs_[index];
+    selected_job_index_ = filtered_indices_[index];
+    const auto& job = jobs_[selected_job_index_];
     spdlog::info("[{}] Row clicked: {} ({})", get_name(), job.filename,
-                 get_status_text(job.status));
+                 helix::ui::HistoryListView::status_text(job.status));
 
     show_detail_overlay(job);
 }
@@ -729,26 +636,29 @@ void HistoryListPanel::handle_row_click(size_t index) {
 // Filter/Sort Implementation
 // ============================================================================
 
-void HistoryListPanel::apply_filters_and_sort() {
+void HistoryListPanel::apply_filters_and_sort(bool preserve_scroll) {
     spdlog::debug("[{}] Applying filters - search: '{}', status: {}, sort: {} {}", get_name(),
                   search_query_, static_cast<int>(status_filter_), static_cast<int>(sort_column_),
                   sort_direction_ == HistorySortDirection::DESC ? "DESC" : "ASC");
 
-    // Chain: search -> status -> sort
-    auto result = apply_search_filter(jobs_);
+    // Chain: search -> status -> sort, over indices so jobs are never copied
+    std::vector<size_t> result(jobs_.size());
+    for (size_t i = 0; i < jobs_.size(); ++i) {
+        result[i] = i;
+    }
+    result = apply_search_filter(result);
     result = apply_status_filter(result);
     apply_sort(result);
 
-    filtered_jobs_ = std::move(result);
+    filtered_indices_ = std::move(result);
 
     spdlog::debug("[{}] Filter result: {} jobs -> {} filtered", get_name(), jobs_.size(),
-                  filtered_jobs_.size());
+                  filtered_indices_.size());
 
-    populate_list();
+    populate_list(preserve_scroll);
 }
 
-std::vector<PrintHistoryJob>
-HistoryListPanel::apply_search_filter(const std::vector<PrintHistoryJob>& source) {
+std::vector<size_t> HistoryListPanel::apply_search_filter(const std::vector<size_t>& source) const {
     if (search_query_.empty()) {
         return source;
     }
@@ -758,32 +668,34 @@ HistoryListPanel::apply_search_filter(const std::vector<PrintHistoryJob>& source
     std::transform(query_lower.begin(), query_lower.end(), query_lower.begin(),
                    [](unsigned char c) { return std::tolower(c); });
 
-    std::vector<PrintHistoryJob> result;
+    std::vector<size_t> result;
     result.reserve(source.size());
 
-    for (const auto& job : source) {
-        std::string filename_lower = job.filename;
-        std::transform(filename_lower.begin(), filename_lower.end(), filename_lower.begin(),
+    std::string filename_lower;
+    for (size_t index : source) {
+        const auto& job = jobs_[index];
+        filename_lower.resize(job.filename.size());
+        std::transform(job.filename.begin(), job.filename.end(), filename_lower.begin(),
                        [](unsigned char c) { return std::tolower(c); });
 
         if (filename_lower.find(query_lower) != std::string::npos) {
-            result.push_back(job);
+            result.push_back(index);
         }
     }
 
     return result;
 }
 
-std::vector<PrintHistoryJob>
-HistoryListPanel::apply_status_filter(const std::vector<PrintHistoryJob>& source) {
+std::vector<size_t> HistoryListPanel::apply_status_filter(const std::vector<size_t>& source) const {
     if (status_filter_ == HistoryStatusFilter::ALL) {
         return source;
     }
 
-    std::vector<PrintHistoryJob> result;
+    std::vector<size_t> result;
     result.reserve(source.size());
 
-    for (const auto& job : source) {
+    for (size_t index : source) {
+        const auto& job = jobs_[index];
         bool include = false;
 
         switch (status_filter_) {
@@ -802,40 +714,52 @@ HistoryListPanel::apply_status_filter(const std::vector<PrintHistoryJob>& source
         }
 
         if (include) {
-            result.push_back(job);
+            result.push_back(index);
         }
     }
 
     return result;
 }
 
-void HistoryListPanel::apply_sort(std::vector<PrintHistoryJob>& jobs) {
+void HistoryListPanel::apply_sort(std::vector<size_t>& indices) const {
     auto sort_col = sort_column_;
     auto sort_dir = sort_direction_;
+    const auto& jobs = jobs_;
+
+    // Must be a strict weak ordering: equal keys (a file printed twice, equal
+    // durations) compare false both ways, then fall back to the job index so
+    // rows keep their order as the virtualized pool recycles them
+    auto key_less = [sort_col](const PrintHistoryJob& a, const PrintHistoryJob& b) {
+        switch (sort_col) {
+        case HistorySortColumn::DATE:
+            return a.start_time < b.start_time;
+        case HistorySortColumn::DURATION:
+            return a.total_duration < b.total_duration;
+        case HistorySortColumn::FILENAME:
+            return a.filename < b.filename;
+        }
+        return false;
+    };
+
+    std::sort(indices.begin(), indices.end(), [&](size_t ia, size_t ib) {
+        const PrintHistoryJob& a = jobs[ia];
+        const PrintHistoryJob& b = jobs[ib];
+
+        // For DESC, compare the other way round (not !less, which is true for ties)
+        bool before = sort_dir == HistorySortDirection::DESC ? key_less(b, a) : key_less(a, b);
+        bool after = sort_dir == HistorySortDirection::DESC ? key_less(a, b) : key_less(b, a);
+        if (before != after) {
+            return before;
+        }
+        return ia < ib;
+    });
+}
 
-    std::sort(jobs.begin(), jobs.end(),
-              [sort_col, sort_dir](const PrintHistoryJob& a, const PrintHistoryJob& b) {
-                  bool result = false;
-
-                  switch (sort_col) {
-                  case HistorySortColumn::DATE:
-                      result = a.start_time < b.start_time;
-                      break;
-                  case HistorySortColumn::DURATION:
-                      result = a.total_duration < b.total_duration;
-                      break;
-                  case HistorySortColumn::FILENAME:
-                      result = a.filename < b.filename;
-                      break;
-                  }
-
-                  // For DESC, invert the result
-                  if (sort_dir == HistorySortDirection::DESC) {
-                      result = !result;
-                  }
-
-                  return result;
-              });
+const PrintHistoryJob* HistoryListPanel::selected_job() const {
+    if (selected_job_index_ >= jobs_.size()) {
+        return nullptr;
+    }
+    return &jobs_[selected_job_index_];
 }
 
 // ============================================================================
@@ -1059,7 +983,7 @@ void HistoryListPanel::show_detail_overlay(const PrintHistoryJob& job) {
 void HistoryListPanel::update_detail_subjects(const PrintHistoryJob& job) {
     // Update string subjects using lv_subject_copy_string (LVGL 9.4 API)
     lv_subject_copy_string(&detail_filename_, job.filename.c_str());
-    lv_subject_copy_string(&detail_status_, get_status_text(job.status));
+    lv_subject_copy_string(&detail_status_, helix::ui::HistoryListView::status_text(job.status));
     lv_subject_copy_string(&detail_status_icon_, status_to_icon(job.status));
     lv_subject_copy_string(&detail_status_variant_, status_to_variant(job.status));
 
@@ -1163,12 +1087,13 @@ void HistoryListPanel::update_detail_subjects(const PrintHistoryJob& job) {
 }
 
 void HistoryListPanel::handle_reprint() {
-    if (selected_job_index_ >= filtered_jobs_.size()) {
+    const PrintHistoryJob* selected = selected_job();
+    if (!selected) {
         spdlog::warn("[{}] Invalid selected job index for reprint", get_name());
         return;
     }
 
-    const auto& job = filtered_jobs_[selected_job_index_];
+    const auto& job = *selected;
 
     if (!job.exists) {
         spdlog::warn("[{}] Cannot reprint - file no longer exists: {}", get_name(), job.filename);
@@ -1205,12 +1130,13 @@ void HistoryListPanel::handle_reprint() {
 }
 
 void HistoryListPanel::handle_delete() {
-    if (selected_job_index_ >= filtered_jobs_.size()) {
+    const PrintHistoryJob* selected = selected_job();
+    if (!selected) {
         spdlog::warn("[{}] Invalid selected job index for delete", get_name());
         return;
     }
 
-    const auto& job = filtered_jobs_[selected_job_index_];
+    const auto& job = *selected;
     spdlog::info("[{}] Delete requested for: {} (job_id: {})", get_name(), job.filename,
                  job.job_id);
 
@@ -1220,12 +1146,13 @@ void HistoryListPanel::handle_delete() {
 }
 
 void HistoryListPanel::confirm_delete() {
-    if (selected_job_index_ >= filtered_jobs_.size()) {
+    const PrintHistoryJob* selected = selected_job();
+    if (!selected) {
         spdlog::warn("[{}] Invalid selected job index for confirm delete", get_name());
         return;
     }
 
-    const auto& job = filtered_jobs_[selected_job_index_];
+    const auto& job = *selected;
     std::string job_id = job.job_id;
     std::string filename = job.filename;
 
@@ -1238,7 +1165,7 @@ void HistoryListPanel::confirm_delete() {
             [this, job_id, filename]() {
                 spdlog::info("[{}] Job deleted: {} ({})", get_name(), filename, job_id);
 
-                // Remove from jobs_ and filtered_jobs_
+                // Remove from jobs_ (filtered_indices_ is rebuilt below)
                 jobs_.erase(std::remove_if(
                                 jobs_.begin(), jobs_.end(),
                                 [&job_id](const PrintHistoryJob& j) { return j.job_id == job_id; }),
@@ -1259,12 +1186,13 @@ void HistoryListPanel::confirm_delete() {
 }
 
 void HistoryListPanel::handle_view_timelapse() {
-    if (selected_job_index_ >= filtered_jobs_.size()) {
+    const PrintHistoryJob* selected = selected_job();
+    if (!selected) {
         spdlog::warn("[{}] Invalid selected job index for view timelapse", get_name());
         return;
     }
 
-    const auto& job = filtered_jobs_[selected_job_index_];
+    const auto& job = *selected;
 
     if (!job.has_timelapse || job.timelapse_filename.empty()) {
         spdlog::warn("[{}] No timelapse available for: {}", get_name(), job.filename);
@@ -1292,6 +1220,13 @@ void HistoryListPanel::on_scroll_static(lv_event_t* e) {
     }
 }
 
+void HistoryListPanel::on_list_scroll_static(lv_event_t* e) {
+    auto* panel = static_cast<HistoryListPanel*>(lv_event_get_user_data(e));
+    if (panel) {
+        panel->list_view_.update_visible(panel->jobs_, panel->filtered_indices_);
+    }
+}
+
 void HistoryListPanel::check_scroll_position() {
     if (!list_content_ || !has_more_data_ || is_loading_more_) {
         return;
@@ -1310,39 +1245,3 @@ void HistoryListPanel::check_scroll_position() {
         load_more();
     }
 }
-
-void HistoryListPanel::append_rows(size_t start_index) {
-    if (!list_rows_ || start_index >= filtered_jobs_.size()) {
-        return;
-    }
-
-    spdlog::debug("[{}] Appending rows from index {} to {}", get_name(), start_index,
-                  filtered_jobs_.size() - 1);
-
-    for (size_t i = start_index; i < filtered_jobs_.size(); ++i) {
-        const auto& job = filtered_jobs_[i];
-
-        // Get status info
-        const char* status_color = get_status_color(job.status);
-        const char* status_text = get_status_text(job.status);
-
-        // Build attrs for row creation
-        const char* attrs[] = {
-            "filename",      job.filename.c_str(),
-            "date",          job.date_str.c_str(),
-            "duration",      job.duration_str.c_str(),
-            "filament_type", job.filament_type.empty() ? "Unknown" : job.filament_type.c_str(),
-            "status",        status_text,
-            "status_color",  status_color,
-            nullptr};
-
-        lv_obj_t* row =
-            static_cast<lv_obj_t*>(lv_xml_create(list_rows_, "history_list_row", attrs));
-
-        if (row) {
-            attach_row_click_handler(row, i);
-        } else {
-            spdlog::warn("[{}] Failed to create row for job {}", get_name(), i);
-        }
-    }
-}
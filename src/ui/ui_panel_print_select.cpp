@@ -786,7 +786,7 @@ void PrintSelectPanel::fetch_metadata_range(size_t start, size_t end) {
     size_t fetch_count = 0;
 
     // Capture current navigation generation to detect directory changes during async ops
-    uint32_t captured_gen = nav_generation_.load();
+    uint32_t captured_gen = nav_generation_->load();
 
     // Fetch metadata for files in range only (not directories, not already fetched)
     for (size_t i = start; i < end; i++) {
@@ -815,10 +815,10 @@ void PrintSelectPanel::fetch_metadata_range(size_t start, size_t end) {
                     return;
                 }
                 // Discard if user navigated to a different directory since this request
-                if (self->nav_generation_.load() != captured_gen) {
+                if (self->nav_generation_->load() != captured_gen) {
                     spdlog::debug("[{}] Discarding stale metadata for {} (gen {} != {})",
                                   self->get_name(), filename, captured_gen,
-                                  self->nav_generation_.load());
+                                  self->nav_generation_->load());
                     return;
                 }
 
@@ -837,7 +837,7 @@ void PrintSelectPanel::fetch_metadata_range(size_t start, size_t end) {
                                 return;
                             }
                             // Discard if directory changed during metascan
-                            if (self->nav_generation_.load() != captured_gen) {
+                            if (self->nav_generation_->load() != captured_gen) {
                                 return;
                             }
                             // Metascan succeeded - process the fresh metadata
@@ -864,7 +864,7 @@ void PrintSelectPanel::fetch_metadata_range(size_t start, size_t end) {
                     return;
                 }
                 // Discard if user navigated to a different directory since this request
-                if (self->nav_generation_.load() != captured_gen) {
+                if (self->nav_generation_->load() != captured_gen) {
                     return;
                 }
 
@@ -882,7 +882,7 @@ void PrintSelectPanel::fetch_metadata_range(size_t start, size_t end) {
                                 return;
                             }
                             // Discard if directory changed during metascan
-                            if (self->nav_generation_.load() != captured_gen) {
+                            if (self->nav_generation_->load() != captured_gen) {
                                 return;
                             }
                             self->process_metadata_result(i, filename, scanned);
@@ -1041,8 +1041,8 @@ void PrintSelectPanel::process_metadata_result(size_t i, const std::string& file
                     // Create context with alive flag and nav generation for safety
                     ThumbnailLoadContext ctx;
                     ctx.alive = self->alive_;
-                    ctx.generation = &self->nav_generation_;
-                    ctx.captured_gen = self->nav_generation_.load();
+                    ctx.generation = self->nav_generation_;
+                    ctx.captured_gen = self->nav_generation_->load();
 
                     get_thumbnail_cache().fetch_for_card_view(
                         self->api_, d->thumb_path, ctx,
@@ -1374,7 +1374,7 @@ void PrintSelectPanel::on_deactivate() {
 
 void PrintSelectPanel::navigate_to_directory(const std::string& dirname) {
     // Increment generation counter to invalidate in-flight metadata callbacks
-    uint32_t gen = ++nav_generation_;
+    uint32_t gen = ++*nav_generation_;
     spdlog::debug("[{}] Navigation generation incremented to {} (entering {})", get_name(), gen,
                   dirname);
 
@@ -1392,7 +1392,7 @@ void PrintSelectPanel::navigate_up() {
     }
 
     // Increment generation counter to invalidate in-flight metadata callbacks
-    uint32_t gen = ++nav_generation_;
+    uint32_t gen = ++*nav_generation_;
     spdlog::debug("[{}] Navigation generation incremented to {} (going up)", get_name(), gen);
 
     path_navigator_.navigate_up();
@@ -0,0 +1,250 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ui_update_queue.h"
+
+#include "frame_profiler.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace helix::ui {
+
+namespace {
+
+template <typename E> bool by_order(const E& a, const E& b) {
+    return a.order < b.order;
+}
+
+uint64_t micros_since(std::chrono::steady_clock::time_point start,
+                      std::chrono::steady_clock::time_point now) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - start).count());
+}
+
+} // namespace
+
+void UpdateQueue::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& lane : pending_) {
+            lane.clear(); // Clear pending queue
+        }
+        coalesce_slots_.clear();
+    }
+    // Drop anything producers pushed to the ring
+    RingItem discard;
+    while (ring_.try_pop(discard)) {
+        discard.callback.reset();
+    }
+    timer_ = nullptr;
+    idle_paused_ = false;
+    initialized_ = false;
+}
+
+void UpdateQueue::collect_ring(Lane& normal, Lane& waiting) {
+    // Collect lock-free updates AFTER taking the lanes: anything a producer spilled to
+    // its lane was queued after its earlier ring pushes, which are therefore visible
+    // here. Stop at the slots claimed so far so busy producers can't keep us spinning.
+    const size_t lane_count = normal.size();
+    const uint64_t ring_limit = ring_.producer_position();
+    RingItem item;
+    for (;;) {
+        const uint64_t pos = ring_.consumer_position();
+        if (pos >= ring_limit || !ring_.try_pop(item)) {
+            break;
+        }
+        normal.push_back(Entry{std::move(item.callback), nullptr, item.enqueued, 2 * pos + 1});
+    }
+    if (lane_count == 0) {
+        return; // Ring entries are already in order
+    }
+
+    // A lane entry stamped past the consumer position may have ring predecessors not
+    // yet published (producer preempted mid-push), so it waits for a later drain
+    const uint64_t ready_limit = 2 * ring_.consumer_position();
+    auto lane_end = normal.begin() + static_cast<std::ptrdiff_t>(lane_count);
+    auto first_waiting = std::find_if(normal.begin(), lane_end, [ready_limit](const Entry& e) {
+        return e.order > ready_limit;
+    });
+    const auto ready_count = first_waiting - normal.begin();
+    if (first_waiting != lane_end) {
+        waiting.insert(waiting.end(), std::make_move_iterator(first_waiting),
+                       std::make_move_iterator(lane_end));
+        normal.erase(first_waiting, lane_end);
+    }
+    if (ready_count > 0 && normal.size() > static_cast<size_t>(ready_count)) {
+        std::inplace_merge(normal.begin(), normal.begin() + ready_count, normal.end(),
+                           by_order<Entry>);
+    }
+}
+
+void UpdateQueue::run_entry(Entry& entry) {
+    if (entry.slot) {
+        // Take the latest closure; later queue_coalesced() calls start a new entry
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = coalesce_slots_.find(entry.slot->key);
+        if (it != coalesce_slots_.end() && it->second == entry.slot) {
+            coalesce_slots_.erase(it);
+        }
+        entry.callback = std::move(entry.slot->callback);
+        entry.slot.reset();
+    }
+
+    try {
+        if (entry.callback) {
+            entry.callback();
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("[UpdateQueue] Exception in queued callback: {}", e.what());
+    } catch (...) {
+        spdlog::error("[UpdateQueue] Unknown exception in queued callback");
+    }
+
+    // Release captures now rather than at the end of the drain
+    entry.callback.reset();
+}
+
+void UpdateQueue::requeue_normal_locked(Lane& waiting, Lane& carried, size_t carried_from) {
+    const size_t carried_count = carried.size() - carried_from;
+    if (waiting.empty() && carried_count == 0) {
+        return;
+    }
+
+    auto& lane = pending_[NORMAL_LANE];
+    Lane merged;
+    merged.reserve(lane.size() + waiting.size() + carried_count);
+    auto carried_begin = carried.begin() + static_cast<std::ptrdiff_t>(carried_from);
+    std::merge(std::make_move_iterator(carried_begin), std::make_move_iterator(carried.end()),
+               std::make_move_iterator(waiting.begin()), std::make_move_iterator(waiting.end()),
+               std::back_inserter(merged), by_order<Entry>);
+    const auto older = static_cast<std::ptrdiff_t>(merged.size());
+    merged.insert(merged.end(), std::make_move_iterator(lane.begin()),
+                  std::make_move_iterator(lane.end()));
+    std::inplace_merge(merged.begin(), merged.begin() + older, merged.end(), by_order<Entry>);
+    lane.swap(merged);
+}
+
+void UpdateQueue::process_pending(bool budgeted) {
+    if (draining_) {
+        return; // Nested drain from inside a callback: the outer drain continues
+    }
+    draining_ = true;
+    // Anything queued from here on signals again (and is picked up by the next drain)
+    has_work_.store(false, std::memory_order_release);
+    const auto start = Clock::now();
+#ifdef HELIX_FRAME_PROFILER_ENABLED
+    const uint64_t profile_start_us = helix::timing::get_micros();
+#endif
+
+    // Move pending updates to the drain lanes to minimize lock time
+    auto& lanes = drain_lanes_;
+    std::chrono::microseconds budget{0};
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t p = 0; p < PRIORITY_COUNT; ++p) {
+            lanes[p].swap(pending_[p]);
+        }
+        budget = budgeted ? drain_budget_ : std::chrono::microseconds{0};
+    }
+    collect_ring(lanes[NORMAL_LANE], waiting_);
+
+    size_t total = 0;
+    for (const auto& lane : lanes) {
+        total += lane.size();
+    }
+
+    // Execute pending updates - safe because render hasn't started yet
+    std::array<size_t, PRIORITY_COUNT> done{};
+    size_t ran = 0;
+    uint64_t max_wait_us = 0;
+    bool deferred = false;
+    for (size_t p = 0; p < PRIORITY_COUNT && !deferred; ++p) {
+        auto& lane = lanes[p];
+        if (lane.empty()) {
+            continue;
+        }
+        // Lanes run oldest first, so the front entry waited longest
+        max_wait_us = std::max(max_wait_us, micros_since(lane.front().enqueued, Clock::now()));
+
+        const bool lane_budgeted = budget.count() > 0 && p != 0;
+        size_t& i = done[p];
+        for (; i < lane.size(); ++i) {
+            if (lane_budgeted && ran > 0 && Clock::now() - start >= budget) {
+                deferred = true;
+                break;
+            }
+            run_entry(lane[i]);
+            ++ran;
+        }
+    }
+
+    const uint64_t drain_us = micros_since(start, Clock::now());
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t carried = 0;
+        if (deferred) {
+            // Carried-over work runs before anything queued since the drain started
+            for (size_t p = 0; p < PRIORITY_COUNT; ++p) {
+                carried += lanes[p].size() - done[p];
+                if (p == NORMAL_LANE) {
+                    continue;
+                }
+                auto from = lanes[p].begin() + static_cast<std::ptrdiff_t>(done[p]);
+                pending_[p].insert(pending_[p].begin(), std::make_move_iterator(from),
+                                   std::make_move_iterator(lanes[p].end()));
+            }
+            ++stats_.deferred_drains;
+        }
+        requeue_normal_locked(waiting_, lanes[NORMAL_LANE], done[NORMAL_LANE]);
+
+        if (total > 0) {
+            stats_.peak_depth = std::max(stats_.peak_depth, total + waiting_.size());
+            stats_.executed += ran;
+            ++stats_.drains;
+            stats_.last_drain_us = drain_us;
+            stats_.max_drain_us = std::max(stats_.max_drain_us, drain_us);
+            stats_.max_wait_us = std::max(stats_.max_wait_us, max_wait_us);
+        }
+        if (deferred) {
+            spdlog::trace("[UpdateQueue] Drain budget hit after {} callbacks ({} us), {} deferred",
+                          ran, drain_us, carried);
+        }
+    }
+
+#ifdef HELIX_FRAME_PROFILER_ENABLED
+    // Only drains that ran something; empty ticks would flood the trace
+    if (total > 0) {
+        static const auto phase =
+            helix::profiling::FrameProfiler::instance().register_phase("update_queue.drain");
+        helix::profiling::FrameProfiler::instance().record(
+            phase, profile_start_us, helix::timing::get_micros() - profile_start_us);
+    }
+#endif
+
+    // Keep buffer capacity for the next drain
+    for (auto& lane : lanes) {
+        lane.clear();
+    }
+    waiting_.clear();
+    draining_ = false;
+}
+
+void UpdateQueue::pause_if_idle() {
+    if (!timer_ || !wake_fn_.load(std::memory_order_acquire) ||
+        has_work_.load(std::memory_order_acquire)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (depth_locked() > 0 || ring_.size_approx() > 0) {
+            return; // Carried-over or waiting work drains on the next tick
+        }
+    }
+    // A producer racing past the checks above sets has_work_ and wakes the loop,
+    // which resumes the timer in resume_if_pending()
+    lv_timer_pause(timer_);
+    idle_paused_ = true;
+}
+
+} // namespace helix::ui
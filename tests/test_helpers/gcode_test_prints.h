@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+#pragma once
+
+#include "gcode_geometry_builder.h"
+#include "gcode_parser.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace helix::test {
+
+/// Layered print: perimeter loops (no merging), straight infill split into
+/// collinear pieces (merges), travels between infill lines. Layers listed in
+/// `empty_layers` only travel.
+inline gcode::ParsedGCodeFile make_layered_print(int layers, int loops, int infill_lines,
+                                                 const std::vector<int>& empty_layers = {}) {
+    using namespace helix::gcode;
+    constexpr int kLoopSegments = 90;
+    constexpr int kInfillPieces = 10;
+    constexpr float kLayerHeight = 0.2f;
+
+    ParsedGCodeFile gcode;
+    gcode.global_bounding_box.min = glm::vec3(0, 0, 0);
+    gcode.global_bounding_box.max = glm::vec3(100, 100, layers * kLayerHeight);
+
+    auto extrude = [](Layer& layer, glm::vec3 a, glm::vec3 b) {
+        ToolpathSegment seg;
+        seg.start = a;
+        seg.end = b;
+        seg.is_extrusion = true;
+        seg.extrusion_amount = 0.05f;
+        seg.width = 0.45f;
+        seg.object_name = "Cube.stl_id_0_copy_0"; // Long enough to live on the heap
+        layer.segments.push_back(seg);
+    };
+
+    for (int l = 0; l < layers; ++l) {
+        Layer layer;
+        layer.z_height = (l + 1) * kLayerHeight;
+        const float z = layer.z_height;
+
+        if (std::find(empty_layers.begin(), empty_layers.end(), l) != empty_layers.end()) {
+            ToolpathSegment travel;
+            travel.start = glm::vec3(10, 10, z);
+            travel.end = glm::vec3(90, 90, z);
+            layer.segments.push_back(travel);
+            gcode.layers.push_back(std::move(layer));
+            continue;
+        }
+
+        for (int loop = 0; loop < loops; ++loop) {
+            float r = 30.0f - loop * 0.45f;
+            for (int i = 0; i < kLoopSegments; ++i) {
+                float a0 = 6.2831853f * i / kLoopSegments;
+                float a1 = 6.2831853f * (i + 1) / kLoopSegments;
+                extrude(layer, glm::vec3(50 + r * std::cos(a0), 50 + r * std::sin(a0), z),
+                        glm::vec3(50 + r * std::cos(a1), 50 + r * std::sin(a1), z));
+            }
+        }
+        for (int line = 0; line < infill_lines; ++line) {
+            float y = 25.0f + line * (50.0f / infill_lines);
+            ToolpathSegment travel;
+            travel.start = glm::vec3(75, y - 1.0f, z);
+            travel.end = glm::vec3(25, y, z);
+            layer.segments.push_back(travel);
+            for (int piece = 0; piece < kInfillPieces; ++piece) {
+                extrude(layer, glm::vec3(25 + piece * 5.0f, y, z),
+                        glm::vec3(25 + (piece + 1) * 5.0f, y, z));
+            }
+        }
+        gcode.layers.push_back(std::move(layer));
+    }
+    return gcode;
+}
+
+inline bool same_vertex(const gcode::RibbonVertex& a, const gcode::RibbonVertex& b) {
+    return a.position.x == b.position.x && a.position.y == b.position.y &&
+           a.position.z == b.position.z && a.normal_index == b.normal_index &&
+           a.color_index == b.color_index;
+}
+
+inline bool same_vertices(const gcode::RibbonGeometry& a, const gcode::RibbonGeometry& b) {
+    return std::equal(a.vertices.begin(), a.vertices.end(), b.vertices.begin(), b.vertices.end(),
+                      same_vertex);
+}
+
+} // namespace helix::test
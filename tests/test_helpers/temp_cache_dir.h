@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+#pragma once
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace helix::test {
+
+/// Scratch cache directory under /tmp, removed with everything in it on destruction
+class TempCacheDir {
+  public:
+    explicit TempCacheDir(const std::string& prefix)
+        : path_("/tmp/" + prefix + "_" + std::to_string(rand())) {
+        std::filesystem::create_directories(path_);
+    }
+    ~TempCacheDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+    }
+
+    TempCacheDir(const TempCacheDir&) = delete;
+    TempCacheDir& operator=(const TempCacheDir&) = delete;
+
+    const std::string& path() const {
+        return path_;
+    }
+
+    /// Write @p size bytes to @p name, as a download would
+    void write(const std::string& name, size_t size) const {
+        std::ofstream(path_ + "/" + name, std::ios::binary) << std::string(size, 'x');
+    }
+
+    bool exists(const std::string& name) const {
+        return std::filesystem::exists(path_ + "/" + name);
+    }
+
+    /// Number of files whose extension is @p extension (e.g. ".lidx")
+    size_t count_with_extension(const std::string& extension) const {
+        size_t count = 0;
+        for (const auto& item : std::filesystem::directory_iterator(path_)) {
+            count += item.path().extension() == extension;
+        }
+        return count;
+    }
+
+  private:
+    std::string path_;
+};
+
+} // namespace helix::test
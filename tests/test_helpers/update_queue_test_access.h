@@ -7,8 +7,14 @@ namespace helix::ui {
 
 class UpdateQueueTestAccess {
   public:
+    /// Run everything pending, ignoring the drain budget
     static void drain(UpdateQueue& q) {
-        q.process_pending();
+        q.process_pending(/*budgeted=*/false);
+    }
+
+    /// Run one timer-style drain pass (respects the drain budget)
+    static void drain_budgeted(UpdateQueue& q) {
+        q.process_pending(/*budgeted=*/true);
     }
 };
 
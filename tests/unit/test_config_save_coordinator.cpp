@@ -0,0 +1,132 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "config_save_coordinator.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct TempDir {
+    std::string path;
+
+    TempDir() {
+        path = std::filesystem::temp_directory_path().string() + "/helix_config_save_test_" +
+               std::to_string(rand());
+        std::filesystem::create_directories(path);
+    }
+
+    ~TempDir() {
+        std::filesystem::remove_all(path);
+    }
+};
+
+json read_json(const std::string& path) {
+    std::ifstream in(path);
+    return json::parse(in);
+}
+
+} // namespace
+
+TEST_CASE("ConfigSaveCoordinator: write_file_atomic replaces the file", "[config][save]") {
+    TempDir dir;
+    std::string file = dir.path + "/helixconfig.json";
+    std::string error;
+
+    REQUIRE(ConfigSaveCoordinator::write_file_atomic(file, "{\"a\": 1}\n", error));
+    REQUIRE(ConfigSaveCoordinator::write_file_atomic(file, "{\"a\": 2}\n", error));
+    REQUIRE(read_json(file)["a"] == 2);
+    REQUIRE_FALSE(std::filesystem::exists(file + ".tmp"));
+
+    SECTION("missing directory fails without touching anything") {
+        std::string missing = dir.path + "/nope/helixconfig.json";
+        REQUIRE_FALSE(ConfigSaveCoordinator::write_file_atomic(missing, "{}", error));
+        REQUIRE_FALSE(error.empty());
+    }
+}
+
+TEST_CASE("ConfigSaveCoordinator: a burst of saves becomes one write", "[config][save]") {
+    TempDir dir;
+    std::string file = dir.path + "/helixconfig.json";
+    ConfigSaveCoordinator saver(50ms, 5000ms);
+
+    for (int i = 0; i < 20; ++i) {
+        saver.request(file, json{{"brightness", i}});
+    }
+    REQUIRE_FALSE(std::filesystem::exists(file)); // Nothing written on the caller's thread
+
+    for (int i = 0; i < 100 && saver.stats().written == 0; ++i) {
+        std::this_thread::sleep_for(10ms);
+    }
+
+    auto stats = saver.stats();
+    REQUIRE(stats.requested == 20);
+    REQUIRE(stats.written == 1);
+    REQUIRE(read_json(file)["brightness"] == 19);
+}
+
+TEST_CASE("ConfigSaveCoordinator: flush writes immediately", "[config][save]") {
+    TempDir dir;
+    std::string file = dir.path + "/helixconfig.json";
+    ConfigSaveCoordinator saver(10000ms, 10000ms);
+
+    REQUIRE(saver.flush()); // Nothing pending
+
+    saver.request(file, json{{"language", "de"}});
+    REQUIRE(saver.flush());
+    REQUIRE(read_json(file)["language"] == "de");
+    REQUIRE(saver.stats().written == 1);
+
+    SECTION("destructor flushes too") {
+        std::string other = dir.path + "/other.json";
+        {
+            ConfigSaveCoordinator scoped(10000ms, 10000ms);
+            scoped.request(other, json{{"x", true}});
+        }
+        REQUIRE(read_json(other)["x"] == true);
+    }
+}
+
+TEST_CASE("ConfigSaveCoordinator: continuous changes still reach disk", "[config][save][slow]") {
+    TempDir dir;
+    std::string file = dir.path + "/helixconfig.json";
+    ConfigSaveCoordinator saver(100ms, 150ms);
+
+    // A new request every 20ms never leaves a quiet 100ms window
+    for (int i = 0; i < 25; ++i) {
+        saver.request(file, json{{"value", i}});
+        std::this_thread::sleep_for(20ms);
+    }
+
+    REQUIRE(saver.stats().written >= 1);
+    REQUIRE(saver.flush());
+    REQUIRE(read_json(file)["value"] == 24);
+}
+
+TEST_CASE("ConfigSaveCoordinator: failures are reported to the owner", "[config][save]") {
+    TempDir dir;
+    std::string missing = dir.path + "/nope/helixconfig.json";
+    ConfigSaveCoordinator saver(10000ms, 10000ms);
+
+    std::string path;
+    std::string message;
+    REQUIRE_FALSE(saver.take_error(path, message));
+
+    saver.request(missing, json::object());
+    REQUIRE_FALSE(saver.flush());
+    REQUIRE(saver.stats().failed == 1);
+
+    REQUIRE(saver.take_error(path, message));
+    REQUIRE(path == missing);
+    REQUIRE_FALSE(message.empty());
+    REQUIRE_FALSE(saver.take_error(path, message)); // Taken once
+}
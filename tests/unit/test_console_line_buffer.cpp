@@ -0,0 +1,147 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "console_line_buffer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix;
+
+namespace {
+
+/// 10px per text line plus a 2px gap
+int32_t fake_measure(const ConsoleLine& line) {
+    int32_t lines = 1;
+    for (char c : line.text) {
+        lines += c == '\n' ? 1 : 0;
+    }
+    return lines * 10 + 2;
+}
+
+std::string span_text(const ConsoleLine& line, size_t i) {
+    return line.text.substr(line.spans[i].start, line.spans[i].length);
+}
+
+} // namespace
+
+TEST_CASE("ConsoleLineBuffer: plain lines get one span in the kind's color", "[ui][console]") {
+    ConsoleLineBuffer buffer(8);
+
+    const auto& cmd = buffer.push("G28", ConsoleLineKind::COMMAND, false);
+    REQUIRE(cmd.text == "G28");
+    REQUIRE(cmd.spans.size() == 1);
+    REQUIRE(cmd.spans[0].color == ConsoleColor::TEXT);
+
+    REQUIRE(buffer.push("// ok", ConsoleLineKind::RESPONSE, false).spans[0].color ==
+            ConsoleColor::SUCCESS);
+    REQUIRE(buffer.push("!! Error", ConsoleLineKind::RESPONSE, true).spans[0].color ==
+            ConsoleColor::DANGER);
+    REQUIRE(buffer.push("", ConsoleLineKind::RESPONSE, false).spans.empty());
+}
+
+TEST_CASE("ConsoleLineBuffer: HTML spans are parsed once on push", "[ui][console]") {
+    ConsoleLineBuffer buffer(8);
+    const auto& line =
+        buffer.push("Lane 1: <span class=success--text>LOADED</span> - "
+                    "<span class=warning--text>LOW</span><span class=foo>x</span>",
+                    ConsoleLineKind::RESPONSE, false);
+
+    REQUIRE(line.text == "Lane 1: LOADED - LOWx");
+    REQUIRE(line.spans.size() == 5);
+    REQUIRE(span_text(line, 0) == "Lane 1: ");
+    REQUIRE(line.spans[0].color == ConsoleColor::SUCCESS); // Response default
+    REQUIRE(span_text(line, 1) == "LOADED");
+    REQUIRE(line.spans[1].color == ConsoleColor::SUCCESS);
+    REQUIRE(span_text(line, 3) == "LOW");
+    REQUIRE(line.spans[3].color == ConsoleColor::WARNING);
+    REQUIRE(span_text(line, 4) == "x"); // Unknown class inside a span-bearing line
+    REQUIRE(line.spans[4].color == ConsoleColor::SUCCESS);
+
+    SECTION("malformed markup keeps the text") {
+        const auto& open = buffer.push("<span class=error--text>Jam", ConsoleLineKind::RESPONSE,
+                                       false);
+        REQUIRE(open.text == "Jam");
+        REQUIRE(open.spans[0].color == ConsoleColor::DANGER);
+
+        const auto& broken = buffer.push("a <span class=info--text", ConsoleLineKind::COMMAND,
+                                         false);
+        REQUIRE(broken.text == "a <span class=info--text");
+    }
+}
+
+TEST_CASE("ConsoleLineBuffer: ring drops the oldest line when full", "[ui][console]") {
+    ConsoleLineBuffer buffer(3);
+    for (int i = 0; i < 5; ++i) {
+        buffer.push("line " + std::to_string(i), ConsoleLineKind::RESPONSE, false);
+    }
+
+    REQUIRE(buffer.size() == 3);
+    REQUIRE(buffer.capacity() == 3);
+    REQUIRE(buffer.total_pushed() == 5);
+    REQUIRE(buffer.at(0).text == "line 2");
+    REQUIRE(buffer.at(2).text == "line 4");
+    REQUIRE(buffer.seq(0) == 2);
+    REQUIRE(buffer.seq(2) == 4);
+
+    buffer.clear();
+    REQUIRE(buffer.empty());
+    REQUIRE(buffer.content_height() == 0);
+    buffer.push("after", ConsoleLineKind::COMMAND, false);
+    REQUIRE(buffer.seq(0) == 5); // Sequence numbers never repeat
+}
+
+TEST_CASE("ConsoleLineBuffer: offsets follow measured heights across wraparound",
+          "[ui][console]") {
+    ConsoleLineBuffer buffer(4);
+    buffer.set_measure(fake_measure);
+
+    buffer.push("a", ConsoleLineKind::RESPONSE, false);       // 12
+    buffer.push("b\nb", ConsoleLineKind::RESPONSE, false);    // 22
+    buffer.push("c", ConsoleLineKind::RESPONSE, false);       // 12
+    buffer.push("d\nd\nd", ConsoleLineKind::RESPONSE, false); // 32
+    buffer.push("e", ConsoleLineKind::RESPONSE, false);       // 12, drops "a"
+
+    REQUIRE(buffer.at(0).text == "b\nb");
+    REQUIRE(buffer.content_height() == 22 + 12 + 32 + 12);
+    REQUIRE(buffer.y_of(0) == 0);
+    REQUIRE(buffer.y_of(1) == 22);
+    REQUIRE(buffer.y_of(3) == 66);
+    REQUIRE(buffer.y_of(4) == buffer.content_height());
+
+    REQUIRE(buffer.index_at(-5) == 0);
+    REQUIRE(buffer.index_at(0) == 0);
+    REQUIRE(buffer.index_at(21) == 0);
+    REQUIRE(buffer.index_at(22) == 1);
+    REQUIRE(buffer.index_at(40) == 2);
+    REQUIRE(buffer.index_at(1000) == 3);
+
+    // A width change re-measures everything
+    buffer.set_measure([](const ConsoleLine&) { return 5; });
+    REQUIRE(buffer.content_height() == 20);
+    REQUIRE(buffer.index_at(12) == 2);
+}
+
+TEST_CASE("ConsoleLineBuffer: sustained append throughput", "[ui][console][slow]") {
+    ConsoleLineBuffer buffer(1000);
+    buffer.set_measure(fake_measure);
+
+    constexpr int LINES = 200000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < LINES; ++i) {
+        buffer.push(i % 10 == 0 ? "AFC: <span class=success--text>lane ready</span>"
+                                : "// probe at 120.000,120.000 is z=1.234567",
+                    ConsoleLineKind::RESPONSE, false);
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    double lines_per_sec = LINES / std::max(elapsed.count(), 1e-9);
+    INFO("console buffer: " << static_cast<long>(lines_per_sec) << " lines/s");
+    REQUIRE(buffer.size() == 1000);
+    // A print start produces hundreds of lines per minute; the ring must not
+    // be the bottleneck by orders of magnitude
+    REQUIRE(lines_per_sec > 100000);
+}
@@ -329,3 +329,27 @@ TEST_CASE("EnvironmentConfig::get_benchmark_mode", "[environment][config][helix]
         REQUIRE(EnvironmentConfig::get_benchmark_mode() == false);
     }
 }
+
+TEST_CASE("EnvironmentConfig::get_console_stress_rate", "[environment][config][helix]") {
+    SECTION("Returns valid rate") {
+        EnvGuard guard("HELIX_CONSOLE_STRESS", "2000");
+        auto result = EnvironmentConfig::get_console_stress_rate();
+        REQUIRE(result.has_value());
+        REQUIRE(*result == 2000);
+    }
+
+    SECTION("Rejects 0") {
+        EnvGuard guard("HELIX_CONSOLE_STRESS", "0");
+        REQUIRE_FALSE(EnvironmentConfig::get_console_stress_rate().has_value());
+    }
+
+    SECTION("Rejects > 100000") {
+        EnvGuard guard("HELIX_CONSOLE_STRESS", "100001");
+        REQUIRE_FALSE(EnvironmentConfig::get_console_stress_rate().has_value());
+    }
+
+    SECTION("Returns nullopt when not set") {
+        EnvGuard guard("HELIX_CONSOLE_STRESS"); // unset
+        REQUIRE_FALSE(EnvironmentConfig::get_console_stress_rate().has_value());
+    }
+}
@@ -0,0 +1,171 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "frame_profiler.h"
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+#include "hv/json.hpp"
+
+using namespace helix::profiling;
+
+namespace {
+
+/// Enabled profiler with a small ring, reset before and disabled after each test
+struct ProfilerReset {
+    FrameProfiler& p = FrameProfiler::instance();
+
+    ProfilerReset() {
+        p.reset(64); // Replaces whatever ring an earlier enable() allocated
+        p.enable();
+    }
+    ~ProfilerReset() {
+        p.disable();
+        p.reset();
+    }
+};
+
+const PhaseSummary* find_phase(const std::vector<PhaseSummary>& phases, const std::string& name) {
+    for (const auto& s : phases) {
+        if (name == s.name) {
+            return &s;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST_CASE("FrameProfiler: phases register once by name", "[profiler]") {
+    auto& p = FrameProfiler::instance();
+    PhaseId a = p.register_phase("test.register_a");
+    PhaseId b = p.register_phase("test.register_b");
+    std::string same = "test.register_a"; // Different pointer, same text
+
+    REQUIRE(a != INVALID_PHASE);
+    REQUIRE(a != b);
+    REQUIRE(p.register_phase(same.c_str()) == a);
+    REQUIRE(std::string(p.phase_name(a)) == "test.register_a");
+}
+
+TEST_CASE("FrameProfiler: percentiles per phase", "[profiler]") {
+    ProfilerReset reset;
+    PhaseId phase = reset.p.register_phase("test.percentiles");
+
+    // 90 fast samples (5us), 9 medium (1000us), 1 slow (40000us)
+    for (int i = 0; i < 90; ++i) {
+        reset.p.record(phase, 0, 5);
+    }
+    for (int i = 0; i < 9; ++i) {
+        reset.p.record(phase, 0, 1000);
+    }
+    reset.p.record(phase, 0, 40000);
+
+    auto phases = reset.p.summarize();
+    const auto* s = find_phase(phases, "test.percentiles");
+    REQUIRE(s != nullptr);
+    REQUIRE(s->count == 100);
+    REQUIRE(s->total_us == 90 * 5 + 9 * 1000 + 40000);
+    REQUIRE(s->p50_us == 5); // Exact below 16us
+    REQUIRE(s->p95_us >= 1000);
+    REQUIRE(s->p95_us < 1250); // Within one sub-bucket (~25%)
+    REQUIRE(s->p99_us >= 1000);
+    REQUIRE(s->max_us == 40000);
+}
+
+TEST_CASE("FrameProfiler: disabled profiler records nothing", "[profiler]") {
+    ProfilerReset reset;
+    PhaseId phase = reset.p.register_phase("test.disabled");
+    reset.p.disable();
+
+    reset.p.record(phase, 0, 100);
+    {
+        HELIX_PROFILE_SCOPE("test.disabled");
+    }
+    auto phases = reset.p.summarize();
+    REQUIRE(find_phase(phases, "test.disabled") == nullptr);
+    REQUIRE(reset.p.snapshot().empty());
+}
+
+TEST_CASE("FrameProfiler: scope macro records the enclosing scope", "[profiler]") {
+    ProfilerReset reset;
+    for (int i = 0; i < 3; ++i) {
+        HELIX_PROFILE_SCOPE("test.scope");
+    }
+    auto phases = reset.p.summarize();
+    const auto* s = find_phase(phases, "test.scope");
+    REQUIRE(s != nullptr);
+    REQUIRE(s->count == 3);
+}
+
+TEST_CASE("FrameProfiler: ring keeps the most recent events", "[profiler]") {
+    ProfilerReset reset; // 64-event ring
+    PhaseId phase = reset.p.register_phase("test.ring");
+
+    for (uint64_t i = 0; i < 100; ++i) {
+        reset.p.record(phase, 1000 + i, i);
+    }
+
+    auto events = reset.p.snapshot();
+    REQUIRE(events.size() == 64);
+    REQUIRE(events.front().start_us == 1000 + 36);
+    REQUIRE(events.back().start_us == 1000 + 99);
+    REQUIRE(reset.p.overwritten() == 36);
+    REQUIRE(reset.p.summarize().front().count == 100); // Histograms cover the whole run
+}
+
+TEST_CASE("FrameProfiler: concurrent recorders", "[profiler]") {
+    ProfilerReset reset;
+    PhaseId phase = reset.p.register_phase("test.threads");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&reset, phase]() {
+            for (int i = 0; i < 1000; ++i) {
+                reset.p.record(phase, static_cast<uint64_t>(i), 10);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto phases = reset.p.summarize();
+    REQUIRE(find_phase(phases, "test.threads")->count == 4000);
+    auto events = reset.p.snapshot();
+    REQUIRE(events.size() <= 64);
+    for (const auto& e : events) {
+        REQUIRE(e.phase == phase);
+        REQUIRE(e.duration_us == 10);
+    }
+}
+
+TEST_CASE("FrameProfiler: Chrome trace export", "[profiler]") {
+    ProfilerReset reset;
+    PhaseId draw = reset.p.register_phase("test.trace_draw");
+    PhaseId flush = reset.p.register_phase("test.trace_flush");
+    reset.p.record(draw, 500, 1200);
+    reset.p.record(flush, 1700, 300);
+
+    std::ostringstream out;
+    reset.p.write_chrome_trace(out, reset.p.snapshot());
+    auto trace = nlohmann::json::parse(out.str());
+
+    auto& events = trace["traceEvents"];
+    REQUIRE(events.size() == 2);
+    REQUIRE(events[0]["name"] == "test.trace_draw");
+    REQUIRE(events[0]["ph"] == "X");
+    REQUIRE(events[0]["ts"] == 500);
+    REQUIRE(events[0]["dur"] == 1200);
+    REQUIRE(events[1]["name"] == "test.trace_flush");
+
+    SECTION("export request is taken once") {
+        REQUIRE_FALSE(FrameProfiler::take_export_request());
+        FrameProfiler::request_export();
+        REQUIRE(FrameProfiler::take_export_request());
+        REQUIRE_FALSE(FrameProfiler::take_export_request());
+    }
+}
@@ -0,0 +1,245 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_band_line_rasterizer.h"
+
+#include "../catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace helix::gcode;
+
+namespace {
+
+constexpr int kWidth = 480;
+constexpr int kHeight = 320;
+
+/// Deterministic lines for a layer: short perimeter-like strokes plus a few
+/// long and partly off-screen lines, widths 1-5, overlapping colors
+std::vector<RasterLine> layer_lines(int layer, int count) {
+    std::mt19937 rng(static_cast<uint32_t>(layer) * 2654435761u);
+    std::uniform_int_distribution<int> x(-20, kWidth + 20);
+    std::uniform_int_distribution<int> y(-20, kHeight + 20);
+    std::uniform_int_distribution<int> step(-12, 12);
+    std::uniform_int_distribution<int> width(1, 5);
+
+    std::vector<RasterLine> lines;
+    int cx = x(rng), cy = y(rng);
+    for (int i = 0; i < count; ++i) {
+        RasterLine line;
+        if (i % 50 == 0) {
+            line = {x(rng), y(rng), x(rng), y(rng), 0, width(rng)};
+        } else {
+            int nx = cx + step(rng), ny = cy + step(rng);
+            line = {cx, cy, nx, ny, 0, width(rng)};
+            cx = nx;
+            cy = ny;
+        }
+        line.color = 0xFF000000u | (static_cast<uint32_t>(layer * 37 + i) & 0xFFFFFF);
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+/// Serial reference: every line drawn in order over the whole buffer
+std::vector<uint32_t> draw_serial(const std::vector<uint32_t>& initial, int from, int to,
+                                  int lines_per_layer) {
+    std::vector<uint32_t> pixels = initial;
+    for (int layer = from; layer <= to; ++layer) {
+        for (const RasterLine& line : layer_lines(layer, lines_per_layer)) {
+            draw_raster_line(pixels.data(), kWidth, kWidth, 0, kHeight, line);
+        }
+    }
+    return pixels;
+}
+
+BandLineRasterizer::LineSourceFactory source_factory(int lines_per_layer) {
+    return [lines_per_layer] {
+        return [lines_per_layer](int layer, std::vector<RasterLine>& out) {
+            auto lines = layer_lines(layer, lines_per_layer);
+            out.insert(out.end(), lines.begin(), lines.end());
+        };
+    };
+}
+
+bool wait_ready(const BandLineRasterizer& rasterizer) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (!rasterizer.ready()) {
+        if (!rasterizer.busy() || std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+size_t count_differences(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+    size_t diff = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        diff += a[i] != b[i];
+    }
+    return diff;
+}
+
+} // namespace
+
+TEST_CASE("draw_raster_line: band clipping covers the full line", "[gcode][band_raster]") {
+    RasterLine line{10, 5, 300, 290, 0xFF123456, 4};
+
+    std::vector<uint32_t> full(static_cast<size_t>(kWidth) * kHeight, 0);
+    draw_raster_line(full.data(), kWidth, kWidth, 0, kHeight, line);
+
+    std::vector<uint32_t> banded(full.size(), 0);
+    for (int row = 0; row < kHeight; row += 7) {
+        draw_raster_line(banded.data(), kWidth, kWidth, row, std::min(row + 7, kHeight), line);
+    }
+    REQUIRE(count_differences(full, banded) == 0);
+    REQUIRE(std::count(full.begin(), full.end(), 0xFF123456u) > 500);
+}
+
+TEST_CASE("BandLineRasterizer: output matches serial drawing", "[gcode][band_raster]") {
+    unsigned threads = GENERATE(1u, 2u, 3u, 4u);
+    CAPTURE(threads);
+
+    // Previously cached layers underneath the new range
+    std::vector<uint32_t> cache =
+        draw_serial(std::vector<uint32_t>(static_cast<size_t>(kWidth) * kHeight, 0), 0, 9, 400);
+    auto expected = draw_serial(cache, 10, 60, 400);
+
+    BandLineRasterizer rasterizer(threads);
+    REQUIRE(rasterizer.thread_count() == threads);
+    REQUIRE(rasterizer.start(kWidth, kHeight, 10, 60, source_factory(400)));
+    REQUIRE(wait_ready(rasterizer));
+    REQUIRE(rasterizer.composite_into(reinterpret_cast<uint8_t*>(cache.data()), kWidth * 4));
+    REQUIRE(count_differences(expected, cache) == 0);
+
+    auto stats = rasterizer.stats();
+    REQUIRE(stats.layers == 51);
+    REQUIRE(stats.lines == 51 * 400);
+    REQUIRE(stats.band_lines >= stats.lines / 2); // Off-screen lines are dropped
+    REQUIRE_FALSE(rasterizer.ready());
+    REQUIRE_FALSE(rasterizer.composite_into(reinterpret_cast<uint8_t*>(cache.data()), kWidth * 4));
+}
+
+TEST_CASE("BandLineRasterizer: padded destination stride", "[gcode][band_raster]") {
+    constexpr int kStride = kWidth + 16;
+    std::vector<uint32_t> dest(static_cast<size_t>(kStride) * kHeight, 0xEEEEEEEE);
+
+    BandLineRasterizer rasterizer(2);
+    REQUIRE(rasterizer.start(kWidth, kHeight, 0, 5, source_factory(300)));
+    REQUIRE(wait_ready(rasterizer));
+    REQUIRE(rasterizer.composite_into(reinterpret_cast<uint8_t*>(dest.data()), kStride * 4));
+
+    auto expected =
+        draw_serial(std::vector<uint32_t>(static_cast<size_t>(kWidth) * kHeight, 0), 0, 5, 300);
+    size_t mismatches = 0;
+    size_t padding_touched = 0;
+    for (int y = 0; y < kHeight; ++y) {
+        for (int x = 0; x < kStride; ++x) {
+            uint32_t actual = dest[static_cast<size_t>(y) * kStride + x];
+            if (x >= kWidth) {
+                padding_touched += actual != 0xEEEEEEEE;
+                continue;
+            }
+            uint32_t want = expected[static_cast<size_t>(y) * kWidth + x];
+            mismatches += actual != (want != 0 ? want : 0xEEEEEEEE);
+        }
+    }
+    REQUIRE(mismatches == 0);
+    REQUIRE(padding_touched == 0);
+}
+
+TEST_CASE("BandLineRasterizer: cancel discards the job", "[gcode][band_raster]") {
+    BandLineRasterizer rasterizer(2);
+    REQUIRE(rasterizer.start(kWidth, kHeight, 0, 400, source_factory(2000)));
+    REQUIRE_FALSE(rasterizer.start(kWidth, kHeight, 0, 1, source_factory(1))); // One at a time
+    rasterizer.cancel();
+    REQUIRE_FALSE(rasterizer.busy());
+    REQUIRE_FALSE(rasterizer.ready());
+
+    std::vector<uint32_t> dest(static_cast<size_t>(kWidth) * kHeight, 0);
+    REQUIRE_FALSE(rasterizer.composite_into(reinterpret_cast<uint8_t*>(dest.data()), kWidth * 4));
+
+    // Usable again after cancel
+    REQUIRE(rasterizer.start(kWidth, kHeight, 0, 2, source_factory(100)));
+    REQUIRE(wait_ready(rasterizer));
+    REQUIRE(rasterizer.composite_into(reinterpret_cast<uint8_t*>(dest.data()), kWidth * 4));
+}
+
+TEST_CASE("BandLineRasterizer: rejects empty jobs", "[gcode][band_raster]") {
+    BandLineRasterizer rasterizer(1);
+    REQUIRE_FALSE(rasterizer.start(0, kHeight, 0, 5, source_factory(1)));
+    REQUIRE_FALSE(rasterizer.start(kWidth, kHeight, 5, 4, source_factory(1)));
+    REQUIRE_FALSE(rasterizer.busy());
+}
+
+TEST_CASE("BandLineRasterizer: thread count from environment", "[gcode][band_raster]") {
+    setenv("HELIX_GCODE_LAYER_CACHE_THREADS", "3", 1);
+    REQUIRE(BandLineRasterizer::configured_thread_count() == 3);
+
+    setenv("HELIX_GCODE_LAYER_CACHE_THREADS", "0", 1); // Auto
+    unsigned automatic = BandLineRasterizer::configured_thread_count();
+    REQUIRE(automatic >= 1);
+    REQUIRE(automatic <= 4);
+
+    setenv("HELIX_GCODE_LAYER_CACHE_THREADS", "many", 1); // Invalid - auto
+    REQUIRE(BandLineRasterizer::configured_thread_count() == automatic);
+
+    unsetenv("HELIX_GCODE_LAYER_CACHE_THREADS");
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+// Run with: ./build/bin/helix-tests "[band_raster][.benchmark]" -s
+
+TEST_CASE("BandLineRasterizer: 300-layer catch-up", "[gcode][band_raster][.benchmark]") {
+    constexpr int kLayers = 300;
+    constexpr int kLinesPerLayer = 3000;
+    using Clock = std::chrono::steady_clock;
+
+    // Pre-generate so both sides time only rasterization
+    std::vector<std::vector<RasterLine>> layers;
+    for (int i = 0; i < kLayers; ++i) {
+        layers.push_back(layer_lines(i, kLinesPerLayer));
+    }
+
+    std::vector<uint32_t> serial(static_cast<size_t>(kWidth) * kHeight, 0);
+    auto t0 = Clock::now();
+    for (const auto& lines : layers) {
+        for (const RasterLine& line : lines) {
+            draw_raster_line(serial.data(), kWidth, kWidth, 0, kHeight, line);
+        }
+    }
+    double serial_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    std::printf("%d layers x %d lines at %dx%d (%u cores): serial %.1f ms on the UI thread\n",
+                kLayers, kLinesPerLayer, kWidth, kHeight, std::thread::hardware_concurrency(),
+                serial_ms);
+
+    for (unsigned threads : {1u, 2u, 4u}) {
+        BandLineRasterizer rasterizer(threads);
+        auto factory = [&layers] {
+            return [&layers](int layer, std::vector<RasterLine>& out) {
+                const auto& lines = layers[static_cast<size_t>(layer)];
+                out.insert(out.end(), lines.begin(), lines.end());
+            };
+        };
+        std::vector<uint32_t> banded(serial.size(), 0);
+        auto t1 = Clock::now();
+        REQUIRE(rasterizer.start(kWidth, kHeight, 0, kLayers - 1, factory));
+        REQUIRE(wait_ready(rasterizer));
+        auto t2 = Clock::now();
+        rasterizer.composite_into(reinterpret_cast<uint8_t*>(banded.data()), kWidth * 4);
+        double job_ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+        double composite_ms = std::chrono::duration<double, std::milli>(Clock::now() - t2).count();
+        std::printf("  %u threads: %.1f ms in background (%.2fx), composite %.2f ms on UI thread\n",
+                    threads, job_ms, serial_ms / job_ms, composite_ms);
+        CHECK(count_differences(serial, banded) == 0);
+    }
+}
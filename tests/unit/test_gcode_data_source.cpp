@@ -151,6 +151,68 @@ TEST_CASE("FileDataSource move semantics", "[gcode][datasource]") {
     REQUIRE(data.size() == 10);
 }
 
+TEST_CASE("FileDataSource mmap mode", "[gcode][datasource]") {
+    TempFile temp(SAMPLE_GCODE);
+    FileDataSource source(temp.path(), FileDataSource::IoMode::MMAP);
+
+    REQUIRE(source.is_valid());
+    REQUIRE(source.is_memory_mapped());
+    REQUIRE(source.file_size() == SAMPLE_GCODE.size());
+
+    SECTION("read_range matches file contents") {
+        auto data = source.read_range(10, 15);
+        REQUIRE(std::string(data.begin(), data.end()) == SAMPLE_GCODE.substr(10, 15));
+        REQUIRE(source.read_all().size() == SAMPLE_GCODE.size());
+    }
+
+    SECTION("view_range returns zero-copy views") {
+        REQUIRE(source.view_range(10, 15) == SAMPLE_GCODE.substr(10, 15));
+
+        // Clamped at end of file, empty past it
+        size_t offset = SAMPLE_GCODE.size() - 10;
+        REQUIRE(source.view_range(offset, 100).size() == 10);
+        REQUIRE(source.view_range(SAMPLE_GCODE.size() + 1, 10).empty());
+    }
+
+    SECTION("advice hints leave contents intact") {
+        source.advise_willneed(5, 50);
+        source.advise_dontneed(0, SAMPLE_GCODE.size());
+        source.advise_dontneed(SAMPLE_GCODE.size() + 100, 10);
+        REQUIRE(source.view_range(0, 20) == SAMPLE_GCODE.substr(0, 20));
+    }
+
+    SECTION("move keeps the mapping") {
+        FileDataSource moved(std::move(source));
+        REQUIRE(moved.is_memory_mapped());
+        REQUIRE_FALSE(source.is_memory_mapped()); // NOLINT - testing moved-from state
+        REQUIRE(moved.view_range(0, 20) == SAMPLE_GCODE.substr(0, 20));
+    }
+}
+
+TEST_CASE("FileDataSource mmap fallback", "[gcode][datasource]") {
+    SECTION("stdio mode has no views") {
+        TempFile temp(SAMPLE_GCODE);
+        FileDataSource source(temp.path(), FileDataSource::IoMode::STDIO);
+        REQUIRE_FALSE(source.is_memory_mapped());
+        REQUIRE(source.view_range(0, 10).empty());
+        REQUIRE(source.read_range(0, 10).size() == 10);
+    }
+
+    SECTION("empty file falls back to stdio") {
+        TempFile temp("");
+        FileDataSource source(temp.path(), FileDataSource::IoMode::MMAP);
+        REQUIRE(source.is_valid());
+        REQUIRE_FALSE(source.is_memory_mapped());
+        REQUIRE(source.read_range(0, 10).empty());
+    }
+
+    SECTION("missing file is invalid") {
+        FileDataSource source("/nonexistent/path/file.gcode", FileDataSource::IoMode::MMAP);
+        REQUIRE_FALSE(source.is_valid());
+        REQUIRE_FALSE(source.is_memory_mapped());
+    }
+}
+
 TEST_CASE("MemoryDataSource from string", "[gcode][datasource]") {
     MemoryDataSource source(SAMPLE_GCODE, "test-gcode");
 
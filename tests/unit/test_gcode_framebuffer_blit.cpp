@@ -0,0 +1,185 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_framebuffer_blit.h"
+
+#include "../catch_amalgamated.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace helix::gcode;
+
+namespace {
+
+std::vector<uint32_t> random_framebuffer(int width, int height) {
+    std::mt19937 rng(static_cast<uint32_t>(width * 7919 + height));
+    std::vector<uint32_t> pixels(static_cast<size_t>(width) * height);
+    for (auto& p : pixels) {
+        p = rng() & 0x00FFFFFF;
+    }
+    return pixels;
+}
+
+/// The per-pixel loop draw_to_lvgl() used before FramebufferBlitter (RGB888 only)
+void legacy_blit(const std::vector<uint32_t>& src, int src_w, int src_h, int dst_w, int dst_h,
+                 uint8_t* dest) {
+    for (int dy = 0; dy < dst_h; dy++) {
+        int sy = dy * src_h / dst_h;
+        for (int dx = 0; dx < dst_w; dx++) {
+            int sx = dx * src_w / dst_w;
+            unsigned int pixel = src[sy * src_w + sx];
+            int dest_idx = (dy * dst_w + dx) * 3;
+            dest[dest_idx + 0] = pixel & 0xFF;
+            dest[dest_idx + 1] = (pixel >> 8) & 0xFF;
+            dest[dest_idx + 2] = (pixel >> 16) & 0xFF;
+        }
+    }
+}
+
+std::vector<uint8_t> legacy_blit(const std::vector<uint32_t>& src, int src_w, int src_h, int dst_w,
+                                 int dst_h) {
+    std::vector<uint8_t> dest(static_cast<size_t>(dst_w) * dst_h * 3);
+    legacy_blit(src, src_w, src_h, dst_w, dst_h, dest.data());
+    return dest;
+}
+
+/// Reference conversion of one pixel, as LVGL would convert RGB888 for the display
+void reference_pixel(uint32_t p, BlitFormat format, uint8_t* out) {
+    uint8_t r = (p >> 16) & 0xFF, g = (p >> 8) & 0xFF, b = p & 0xFF;
+    switch (format) {
+    case BlitFormat::RGB888:
+        out[0] = b;
+        out[1] = g;
+        out[2] = r;
+        break;
+    case BlitFormat::XRGB8888:
+        std::memcpy(out, &p, 4);
+        break;
+    case BlitFormat::RGB565: {
+        auto v = static_cast<uint16_t>(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+        std::memcpy(out, &v, 2);
+        break;
+    }
+    }
+}
+
+} // namespace
+
+TEST_CASE("FramebufferBlitter: RGB888 matches the per-pixel loop", "[gcode][blit]") {
+    // 1x, 2x, fractional up, odd widths (SIMD tails) and downscale
+    auto [src_w, src_h, dst_w, dst_h] = GENERATE(table<int, int, int, int>({
+        {800, 480, 800, 480},
+        {400, 240, 800, 480},
+        {512, 300, 1024, 600},
+        {640, 384, 1024, 600},
+        {37, 11, 37, 11},
+        {37, 11, 74, 23},
+        {101, 53, 150, 97},
+        {300, 200, 120, 80},
+    }));
+    CAPTURE(src_w, src_h, dst_w, dst_h);
+
+    auto src = random_framebuffer(src_w, src_h);
+    FramebufferBlitter blitter;
+    blitter.configure(src_w, src_h, dst_w, dst_h, BlitFormat::RGB888);
+    std::vector<uint8_t> actual(static_cast<size_t>(dst_w) * dst_h * 3);
+    blitter.blit(src.data(), actual.data(), static_cast<size_t>(dst_w) * 3);
+
+    REQUIRE(actual == legacy_blit(src, src_w, src_h, dst_w, dst_h));
+}
+
+TEST_CASE("FramebufferBlitter: native formats match per-pixel conversion", "[gcode][blit]") {
+    BlitFormat format = GENERATE(BlitFormat::XRGB8888, BlitFormat::RGB565);
+    auto [src_w, src_h, dst_w, dst_h] = GENERATE(table<int, int, int, int>({
+        {800, 480, 800, 480},
+        {19, 7, 38, 14},
+        {101, 53, 150, 97},
+    }));
+    CAPTURE(blit_format_name(format), src_w, src_h, dst_w, dst_h);
+
+    const size_t bpp = blit_format_size(format);
+    const size_t stride = static_cast<size_t>(dst_w) * bpp + 12; // Padded rows
+    auto src = random_framebuffer(src_w, src_h);
+    FramebufferBlitter blitter;
+    blitter.configure(src_w, src_h, dst_w, dst_h, format);
+    std::vector<uint8_t> actual(stride * dst_h, 0xEE);
+    blitter.blit(src.data(), actual.data(), stride);
+
+    size_t mismatches = 0;
+    size_t padding_touched = 0;
+    for (int dy = 0; dy < dst_h; ++dy) {
+        const uint8_t* row = actual.data() + dy * stride;
+        for (int dx = 0; dx < dst_w; ++dx) {
+            uint32_t p = src[(dy * src_h / dst_h) * src_w + dx * src_w / dst_w];
+            uint8_t expected[4];
+            reference_pixel(p, format, expected);
+            mismatches += std::memcmp(row + dx * bpp, expected, bpp) != 0;
+        }
+        for (size_t i = dst_w * bpp; i < stride; ++i) {
+            padding_touched += row[i] != 0xEE;
+        }
+    }
+    REQUIRE(mismatches == 0);
+    REQUIRE(padding_touched == 0);
+}
+
+TEST_CASE("FramebufferBlitter: reconfigure switches format and size", "[gcode][blit]") {
+    auto src = random_framebuffer(64, 32);
+    FramebufferBlitter blitter;
+
+    blitter.configure(64, 32, 128, 64, BlitFormat::RGB565);
+    std::vector<uint8_t> rgb565(128 * 64 * 2);
+    blitter.blit(src.data(), rgb565.data(), 128 * 2);
+    REQUIRE(blitter.format() == BlitFormat::RGB565);
+
+    blitter.configure(64, 32, 64, 32, BlitFormat::RGB888);
+    std::vector<uint8_t> rgb888(64 * 32 * 3);
+    blitter.blit(src.data(), rgb888.data(), 64 * 3);
+    REQUIRE(rgb888 == legacy_blit(src, 64, 32, 64, 32));
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+// Run with: ./build/bin/helix-tests "[blit][.benchmark]" -s
+
+TEST_CASE("FramebufferBlitter: frame time", "[gcode][blit][.benchmark]") {
+    constexpr int kDstW = 1024;
+    constexpr int kDstH = 600;
+    constexpr int kIterations = 50;
+    using Clock = std::chrono::steady_clock;
+
+    std::printf("Framebuffer -> %dx%d draw buffer (ms/frame):\n", kDstW, kDstH);
+    for (int divisor : {1, 2}) {
+        int src_w = kDstW / divisor, src_h = kDstH / divisor;
+        auto src = random_framebuffer(src_w, src_h);
+
+        std::vector<uint8_t> legacy(static_cast<size_t>(kDstW) * kDstH * 3);
+        auto t0 = Clock::now();
+        for (int i = 0; i < kIterations; ++i) {
+            legacy_blit(src, src_w, src_h, kDstW, kDstH, legacy.data());
+        }
+        double legacy_ms =
+            std::chrono::duration<double, std::milli>(Clock::now() - t0).count() / kIterations;
+        std::printf("  %dx%d source: per-pixel rgb888 %.2f", src_w, src_h, legacy_ms);
+
+        for (BlitFormat format : {BlitFormat::RGB888, BlitFormat::XRGB8888, BlitFormat::RGB565}) {
+            std::vector<uint8_t> dst(static_cast<size_t>(kDstW) * kDstH * 4);
+            FramebufferBlitter blitter;
+            blitter.configure(src_w, src_h, kDstW, kDstH, format);
+            auto t1 = Clock::now();
+            for (int i = 0; i < kIterations; ++i) {
+                blitter.blit(src.data(), dst.data(), kDstW * blit_format_size(format));
+            }
+            double ms =
+                std::chrono::duration<double, std::milli>(Clock::now() - t1).count() / kIterations;
+            std::printf(", %s %.2f", blit_format_name(format), ms);
+            CHECK(ms > 0.0);
+        }
+        std::printf("\n");
+    }
+}
@@ -5,9 +5,40 @@
 #include "gcode_parser.h"
 
 #include "../catch_amalgamated.hpp"
+#include "../test_helpers/gcode_test_prints.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
 
 using namespace helix::gcode;
 using Catch::Approx;
+using helix::test::make_layered_print;
+using helix::test::same_vertex;
+
+namespace {
+
+/// A /proc/self/status field in KB (0 if unavailable)
+size_t read_status_kb(const char* key) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind(key, 0) == 0) {
+            return std::stoul(line.substr(std::string(key).size()));
+        }
+    }
+    return 0;
+}
+
+void reset_peak_rss() {
+    std::ofstream("/proc/self/clear_refs") << "5"; // Linux: reset VmHWM to current RSS
+}
+
+} // namespace
 
 // ============================================================================
 // QuantizationParams Tests
@@ -883,3 +914,121 @@ TEST_CASE("Geometry Builder: BuildStats - statistics tracking", "[gcode][geometr
     REQUIRE(stats.simplification_ratio >= 0.0f);
     REQUIRE(stats.simplification_ratio <= 1.0f);
 }
+
+// ============================================================================
+// Per-Layer Parallel Build
+// ============================================================================
+
+TEST_CASE("Geometry Builder: Parallel build matches single-threaded build",
+          "[gcode][geometry][parallel]") {
+    ParsedGCodeFile gcode = make_layered_print(24, 2, 6, {5});
+    SimplificationOptions options;
+
+    GeometryBuilder serial_builder;
+    serial_builder.set_worker_threads(1);
+    RibbonGeometry serial = serial_builder.build(gcode, options);
+
+    GeometryBuilder parallel_builder;
+    parallel_builder.set_worker_threads(4);
+    RibbonGeometry parallel = parallel_builder.build(gcode, options);
+
+    REQUIRE(serial.vertices.size() > 0);
+    REQUIRE(parallel.vertices.size() == serial.vertices.size());
+    REQUIRE(parallel.strips == serial.strips);
+    REQUIRE(parallel.strip_layer_index == serial.strip_layer_index);
+    REQUIRE(parallel.layer_strip_ranges == serial.layer_strip_ranges);
+    REQUIRE(parallel.color_palette == serial.color_palette);
+    REQUIRE(parallel.normal_palette.size() == serial.normal_palette.size());
+    REQUIRE(parallel.extrusion_triangle_count == serial.extrusion_triangle_count);
+
+    size_t mismatched = 0;
+    for (size_t i = 0; i < serial.vertices.size(); ++i) {
+        if (!same_vertex(serial.vertices[i], parallel.vertices[i])) {
+            mismatched++;
+        }
+    }
+    REQUIRE(mismatched == 0);
+
+    const auto& a = serial_builder.last_stats();
+    const auto& b = parallel_builder.last_stats();
+    REQUIRE(a.input_segments == b.input_segments);
+    REQUIRE(a.output_segments == b.output_segments);
+    REQUIRE(a.output_segments < a.input_segments); // Infill pieces merged per layer
+}
+
+TEST_CASE("Geometry Builder: Layer strip ranges are contiguous per layer",
+          "[gcode][geometry][parallel]") {
+    ParsedGCodeFile gcode = make_layered_print(12, 1, 4, {3, 7});
+    GeometryBuilder builder;
+    builder.set_worker_threads(3);
+    RibbonGeometry geometry = builder.build(gcode, SimplificationOptions{});
+
+    REQUIRE(geometry.layer_strip_ranges.size() == 12);
+    REQUIRE(geometry.layer_bboxes.size() == 12);
+    REQUIRE(geometry.max_layer_index == 11);
+    REQUIRE(geometry.strip_layer_index.size() == geometry.strips.size());
+
+    size_t expected_first = 0;
+    for (size_t layer = 0; layer < geometry.layer_strip_ranges.size(); ++layer) {
+        auto [first, count] = geometry.layer_strip_ranges[layer];
+        if (layer == 3 || layer == 7) {
+            REQUIRE(count == 0); // Travel-only layers have no geometry
+            continue;
+        }
+        REQUIRE(count > 0);
+        REQUIRE(first == expected_first);
+        size_t mislabeled = 0;
+        for (size_t s = first; s < first + count; ++s) {
+            if (geometry.strip_layer_index[s] != layer) {
+                mislabeled++;
+            }
+        }
+        REQUIRE(mislabeled == 0);
+        REQUIRE(geometry.layer_bboxes[layer].min.z == Approx(gcode.layers[layer].z_height));
+        expected_first = first + count;
+    }
+    REQUIRE(expected_first == geometry.strips.size());
+
+    // Every strip index stays inside the vertex buffer after rebasing
+    uint32_t max_index = 0;
+    for (const auto& strip : geometry.strips) {
+        for (uint32_t idx : strip) {
+            max_index = std::max(max_index, idx);
+        }
+    }
+    REQUIRE(max_index < geometry.vertices.size());
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+// Run with: ./build/bin/helix-tests "[geometry][.benchmark]" -s
+
+TEST_CASE("Geometry Builder: build time and peak memory", "[gcode][geometry][.benchmark]") {
+    ParsedGCodeFile gcode = make_layered_print(150, 4, 40);
+    size_t segments = 0;
+    for (const auto& layer : gcode.layers) {
+        segments += layer.segments.size();
+    }
+    std::printf("%zu layers, %zu segments (%u cores)\n", gcode.layers.size(), segments,
+                std::thread::hardware_concurrency());
+
+    for (unsigned threads : {1u, 2u, 4u}) {
+        GeometryBuilder builder;
+        builder.set_worker_threads(threads);
+
+        size_t rss_before_kb = read_status_kb("VmRSS:");
+        reset_peak_rss();
+        auto t0 = std::chrono::steady_clock::now();
+        RibbonGeometry geometry = builder.build(gcode, SimplificationOptions{});
+        double ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0)
+                .count();
+        size_t peak_kb = read_status_kb("VmHWM:");
+
+        std::printf("  %u threads: %.1f ms, result %.1f MB, peak RSS +%.1f MB\n", threads, ms,
+                    geometry.memory_usage() / (1024.0 * 1024.0),
+                    peak_kb > rss_before_kb ? (peak_kb - rss_before_kb) / 1024.0 : 0.0);
+        CHECK(geometry.strips.size() > 0);
+    }
+}
@@ -0,0 +1,282 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_geometry_cache.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../catch_amalgamated.hpp"
+#include "../test_helpers/gcode_test_prints.h"
+#include "../test_helpers/temp_cache_dir.h"
+
+using namespace helix::gcode;
+using helix::test::make_layered_print;
+using helix::test::same_vertices;
+using helix::test::TempCacheDir;
+
+namespace {
+
+/// Stand-in G-code file: the cache only looks at its path, size and mtime
+class TempSource {
+  public:
+    TempSource() : path_("/tmp/test_geometry_cache_" + std::to_string(rand()) + ".gcode") {
+        std::ofstream(path_) << "G1 X10 Y10 E1\n";
+    }
+    ~TempSource() {
+        std::remove(path_.c_str());
+    }
+    const std::string& path() const {
+        return path_;
+    }
+
+  private:
+    std::string path_;
+};
+
+void require_same_geometry(const RibbonGeometry& built, const RibbonGeometry& loaded) {
+    REQUIRE(same_vertices(built, loaded));
+    REQUIRE(loaded.strips == built.strips);
+    REQUIRE(loaded.indices == built.indices);
+    REQUIRE(loaded.color_palette == built.color_palette);
+    REQUIRE(loaded.normal_palette.size() == built.normal_palette.size());
+    REQUIRE(loaded.strip_layer_index == built.strip_layer_index);
+    REQUIRE(loaded.layer_strip_ranges == built.layer_strip_ranges);
+    REQUIRE(loaded.layer_bboxes.size() == built.layer_bboxes.size());
+    REQUIRE(loaded.max_layer_index == built.max_layer_index);
+    REQUIRE(loaded.extrusion_triangle_count == built.extrusion_triangle_count);
+    REQUIRE(loaded.travel_triangle_count == built.travel_triangle_count);
+    REQUIRE(loaded.quantization.scale_factor == built.quantization.scale_factor);
+    REQUIRE(loaded.quantization.min_bounds == built.quantization.min_bounds);
+    REQUIRE(loaded.layer_height_mm == built.layer_height_mm);
+}
+
+} // namespace
+
+TEST_CASE("GeometryCache: round trip", "[gcode][geometry_cache]") {
+    TempSource source;
+    TempCacheDir dir("test_geometry_cache_dir");
+    GeometryCache cache(dir.path());
+    auto stamp = GeometryCache::stamp(source.path());
+    REQUIRE(stamp.has_value());
+
+    GeometryBuilder builder;
+    SimplificationOptions opts;
+    RibbonGeometry built = builder.build(make_layered_print(6, 2, 0), opts);
+    uint64_t key = builder.cache_key(opts);
+
+    REQUIRE(cache.load(source.path(), *stamp, key) == nullptr); // Miss before save
+    REQUIRE(cache.save(source.path(), *stamp, key, built));
+    REQUIRE(std::filesystem::exists(cache.entry_path(source.path(), key)));
+
+    auto loaded = cache.load(source.path(), *stamp, key);
+    REQUIRE(loaded != nullptr);
+    require_same_geometry(built, *loaded);
+
+    SECTION("Disabled cache never saves") {
+        GeometryCache off(dir.path(), 0);
+        REQUIRE_FALSE(off.enabled());
+        REQUIRE_FALSE(off.save(source.path(), *stamp, key, built));
+        REQUIRE(off.load(source.path(), *stamp, key) == nullptr);
+    }
+}
+
+TEST_CASE("GeometryCache: build key covers settings", "[gcode][geometry_cache]") {
+    GeometryBuilder a;
+    GeometryBuilder b;
+    SimplificationOptions fine{.tolerance_mm = 0.5f, .min_segment_length_mm = 0.05f};
+    SimplificationOptions coarse{.tolerance_mm = 2.0f, .min_segment_length_mm = 0.5f};
+
+    REQUIRE(a.cache_key(fine) == b.cache_key(fine));
+    REQUIRE(a.cache_key(fine) != a.cache_key(coarse));
+
+    b.set_worker_threads(3); // Doesn't change the output
+    REQUIRE(a.cache_key(fine) == b.cache_key(fine));
+
+    b.set_extrusion_width(0.5f);
+    REQUIRE(a.cache_key(fine) != b.cache_key(fine));
+
+    GeometryBuilder c;
+    c.set_tool_color_palette({"#FF0000", "#00FF00"});
+    GeometryBuilder d;
+    d.set_tool_color_palette({"#FF0000#00FF00"});
+    REQUIRE(c.cache_key(fine) != d.cache_key(fine));
+
+    GeometryBuilder e;
+    e.set_highlighted_objects({"part_a", "part_b", "part_c"});
+    GeometryBuilder f;
+    f.set_highlighted_objects({"part_c", "part_a", "part_b"});
+    REQUIRE(e.cache_key(fine) == f.cache_key(fine));
+}
+
+TEST_CASE("GeometryCache: invalidation", "[gcode][geometry_cache]") {
+    TempSource source;
+    TempCacheDir dir("test_geometry_cache_dir");
+    GeometryCache cache(dir.path());
+    auto stamp = GeometryCache::stamp(source.path());
+    REQUIRE(stamp.has_value());
+
+    GeometryBuilder builder;
+    SimplificationOptions opts;
+    RibbonGeometry built = builder.build(make_layered_print(4, 1, 0), opts);
+    uint64_t key = builder.cache_key(opts);
+    REQUIRE(cache.save(source.path(), *stamp, key, built));
+    const std::string entry = cache.entry_path(source.path(), key);
+
+    SECTION("Source file modified") {
+        std::ofstream(source.path(), std::ios::app) << "G1 X20 Y20 E2\n";
+        auto changed = GeometryCache::stamp(source.path());
+        REQUIRE(*changed != *stamp);
+        REQUIRE(cache.load(source.path(), *changed, key) == nullptr);
+
+        // Geometry built from the old contents is not stored under the new identity
+        REQUIRE_FALSE(cache.save(source.path(), *stamp, key, built));
+    }
+
+    SECTION("Source mtime changed") {
+        auto mtime = std::filesystem::last_write_time(source.path());
+        std::filesystem::last_write_time(source.path(), mtime + std::chrono::seconds(5));
+        REQUIRE(cache.load(source.path(), *GeometryCache::stamp(source.path()), key) == nullptr);
+    }
+
+    SECTION("Different build key") {
+        REQUIRE(cache.load(source.path(), *stamp, key + 1) == nullptr);
+    }
+
+    SECTION("Format version mismatch") {
+        std::fstream out(entry, std::ios::in | std::ios::out | std::ios::binary);
+        out.seekp(8); // Version follows the 8-byte magic
+        out.put(static_cast<char>(GeometryCache::FORMAT_VERSION + 1));
+        out.close();
+        REQUIRE(cache.load(source.path(), *stamp, key) == nullptr);
+    }
+
+    SECTION("Corrupted payload") {
+        auto size = std::filesystem::file_size(entry);
+        std::fstream out(entry, std::ios::in | std::ios::out | std::ios::binary);
+        out.seekg(static_cast<std::streamoff>(size - 1));
+        char last = static_cast<char>(out.get());
+        out.seekp(static_cast<std::streamoff>(size - 1));
+        out.put(static_cast<char>(last ^ 0x5A));
+        out.close();
+        REQUIRE(cache.load(source.path(), *stamp, key) == nullptr);
+    }
+
+    SECTION("Truncated") {
+        std::filesystem::resize_file(entry, std::filesystem::file_size(entry) - 4);
+        REQUIRE(cache.load(source.path(), *stamp, key) == nullptr);
+    }
+}
+
+TEST_CASE("GeometryCache: evicts least recently used entries", "[gcode][geometry_cache]") {
+    TempCacheDir dir("test_geometry_cache_dir");
+    TempSource first;
+    TempSource second;
+    TempSource third;
+
+    GeometryBuilder builder;
+    SimplificationOptions opts;
+    RibbonGeometry built = builder.build(make_layered_print(6, 2, 0), opts);
+    uint64_t key = builder.cache_key(opts);
+
+    // Measure one entry, then allow two
+    size_t entry_bytes = 0;
+    {
+        GeometryCache probe(dir.path());
+        REQUIRE(probe.save(first.path(), *GeometryCache::stamp(first.path()), key, built));
+        entry_bytes = probe.total_bytes();
+        std::filesystem::remove(probe.entry_path(first.path(), key));
+    }
+    GeometryCache cache(dir.path(), entry_bytes * 2 + entry_bytes / 2);
+
+    auto save = [&](const TempSource& source) {
+        REQUIRE(cache.save(source.path(), *GeometryCache::stamp(source.path()), key, built));
+    };
+    auto age = [&](const TempSource& source, int seconds_ago) {
+        std::filesystem::last_write_time(cache.entry_path(source.path(), key),
+                                         std::filesystem::file_time_type::clock::now() -
+                                             std::chrono::seconds(seconds_ago));
+    };
+
+    save(first);
+    age(first, 20);
+    save(second);
+    age(second, 10);
+
+    // Viewing the first file again makes it the most recently used
+    REQUIRE(cache.load(first.path(), *GeometryCache::stamp(first.path()), key) != nullptr);
+
+    save(third);
+    REQUIRE(cache.total_bytes() <= entry_bytes * 2 + entry_bytes / 2);
+    REQUIRE(std::filesystem::exists(cache.entry_path(first.path(), key)));
+    REQUIRE_FALSE(std::filesystem::exists(cache.entry_path(second.path(), key)));
+    REQUIRE(std::filesystem::exists(cache.entry_path(third.path(), key)));
+
+    SECTION("Entries larger than the budget are not saved") {
+        GeometryCache tiny(dir.path(), entry_bytes / 2);
+        REQUIRE_FALSE(tiny.save(first.path(), *GeometryCache::stamp(first.path()), key + 1, built));
+    }
+}
+
+TEST_CASE("GeometryCache: sweeps temp files orphaned mid-save", "[gcode][geometry_cache]") {
+    TempCacheDir dir("test_geometry_cache_dir");
+    TempSource source;
+    GeometryCache cache(dir.path());
+
+    GeometryBuilder builder;
+    SimplificationOptions opts;
+    RibbonGeometry built = builder.build(make_layered_print(6, 2, 0), opts);
+    uint64_t key = builder.cache_key(opts);
+
+    // As left by a process killed while writing, and by a save still in progress
+    const std::string orphan = cache.entry_path(source.path(), key + 1) + ".tmp999-0";
+    const std::string in_progress = cache.entry_path(source.path(), key + 2) + ".tmp999-1";
+    std::ofstream(orphan, std::ios::binary) << std::string(1000, 'x');
+    std::ofstream(in_progress, std::ios::binary) << std::string(500, 'x');
+    std::filesystem::last_write_time(orphan, std::filesystem::file_time_type::clock::now() -
+                                                 std::chrono::hours(1));
+    REQUIRE(cache.total_bytes() == 1500); // Counted even though they're not entries
+
+    REQUIRE(cache.save(source.path(), *GeometryCache::stamp(source.path()), key, built));
+
+    REQUIRE_FALSE(std::filesystem::exists(orphan));
+    REQUIRE(std::filesystem::exists(in_progress));
+    REQUIRE(cache.total_bytes() ==
+            std::filesystem::file_size(cache.entry_path(source.path(), key)) + 500);
+}
+
+// Run with: ./build/bin/helix-tests "[geometry_cache][.benchmark]" -s
+TEST_CASE("GeometryCache: load vs build time", "[gcode][geometry_cache][.benchmark]") {
+    TempSource source;
+    TempCacheDir dir("test_geometry_cache_dir");
+    GeometryCache cache(dir.path(), 512 * 1024 * 1024);
+    auto stamp = GeometryCache::stamp(source.path());
+    ParsedGCodeFile gcode = make_layered_print(300, 6, 0);
+
+    for (const auto& opts : {SimplificationOptions{.tolerance_mm = 0.5f,
+                                                   .min_segment_length_mm = 0.05f},
+                             SimplificationOptions{.tolerance_mm = 2.0f,
+                                                   .min_segment_length_mm = 0.5f}}) {
+        GeometryBuilder builder;
+        auto t0 = std::chrono::steady_clock::now();
+        RibbonGeometry built = builder.build(gcode, opts);
+        auto t1 = std::chrono::steady_clock::now();
+        REQUIRE(cache.save(source.path(), *stamp, builder.cache_key(opts), built));
+        auto t2 = std::chrono::steady_clock::now();
+        auto loaded = cache.load(source.path(), *stamp, builder.cache_key(opts));
+        auto t3 = std::chrono::steady_clock::now();
+        REQUIRE(loaded != nullptr);
+
+        auto ms = [](auto a, auto b) {
+            return std::chrono::duration<double, std::milli>(b - a).count();
+        };
+        printf("tolerance %.1fmm: %zu vertices, %zu KB cached so far\n", opts.tolerance_mm,
+               built.vertices.size(), cache.total_bytes() / 1024);
+        printf("  build %.1fms, save %.1fms, load %.1fms\n", ms(t0, t1), ms(t1, t2), ms(t2, t3));
+    }
+}
@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <stdexcept>
 #include <thread>
 
 #include "../catch_amalgamated.hpp"
@@ -14,6 +15,9 @@ using Catch::Approx;
 
 namespace {
 
+// Segments per layer for a ~4KB packed layer (2 fit in a 10KB budget)
+constexpr size_t SEGMENTS_4KB = 4 * 1024 / GCodeLayerCache::BYTES_PER_SEGMENT;
+
 // Helper to create test segments
 std::vector<ToolpathSegment> make_test_segments(size_t count) {
     std::vector<ToolpathSegment> segs;
@@ -57,10 +61,10 @@ TEST_CASE("GCodeLayerCache basic operations", "[gcode][cache]") {
     SECTION("get_or_load caches and returns data") {
         auto result = cache.get_or_load(0, test_loader(10));
 
-        REQUIRE(result.segments != nullptr);
+        REQUIRE(result.layer != nullptr);
         REQUIRE(result.was_hit == false); // First access is a miss
         REQUIRE(result.load_failed == false);
-        REQUIRE(result.segments->size() == 10);
+        REQUIRE(result.layer->size() == 10);
         REQUIRE(cache.is_cached(0));
         REQUIRE(cache.cached_layer_count() == 1);
     }
@@ -70,7 +74,7 @@ TEST_CASE("GCodeLayerCache basic operations", "[gcode][cache]") {
         auto result = cache.get_or_load(0, test_loader(10));
 
         REQUIRE(result.was_hit == true);
-        REQUIRE(result.segments != nullptr);
+        REQUIRE(result.layer != nullptr);
     }
 
     SECTION("hit rate tracking works") {
@@ -90,18 +94,16 @@ TEST_CASE("GCodeLayerCache basic operations", "[gcode][cache]") {
 }
 
 TEST_CASE("GCodeLayerCache LRU eviction", "[gcode][cache]") {
-    // Budget that fits ~2 layers of 50 segments each
-    // 50 segments * 80 bytes = 4KB per layer + overhead
-    // Budget of 10KB should fit ~2 layers
+    // Budget that fits ~2 layers of ~4KB each
     GCodeLayerCache cache(10 * 1024);
 
     std::vector<size_t> loaded;
 
     SECTION("evicts oldest layer when over budget") {
         // Load layers 0, 1, 2 - should evict 0 to make room for 2
-        cache.get_or_load(0, tracking_loader(loaded, 50));
-        cache.get_or_load(1, tracking_loader(loaded, 50));
-        cache.get_or_load(2, tracking_loader(loaded, 50));
+        cache.get_or_load(0, tracking_loader(loaded, SEGMENTS_4KB));
+        cache.get_or_load(1, tracking_loader(loaded, SEGMENTS_4KB));
+        cache.get_or_load(2, tracking_loader(loaded, SEGMENTS_4KB));
 
         // Layer 0 should have been evicted
         REQUIRE_FALSE(cache.is_cached(0));
@@ -111,14 +113,14 @@ TEST_CASE("GCodeLayerCache LRU eviction", "[gcode][cache]") {
     }
 
     SECTION("touching a layer prevents eviction") {
-        cache.get_or_load(0, tracking_loader(loaded, 50));
-        cache.get_or_load(1, tracking_loader(loaded, 50));
+        cache.get_or_load(0, tracking_loader(loaded, SEGMENTS_4KB));
+        cache.get_or_load(1, tracking_loader(loaded, SEGMENTS_4KB));
 
         // Touch layer 0 (makes it most recent)
-        cache.get_or_load(0, tracking_loader(loaded, 50));
+        cache.get_or_load(0, tracking_loader(loaded, SEGMENTS_4KB));
 
         // Now add layer 2 - should evict 1, not 0
-        cache.get_or_load(2, tracking_loader(loaded, 50));
+        cache.get_or_load(2, tracking_loader(loaded, SEGMENTS_4KB));
 
         REQUIRE(cache.is_cached(0));       // Was touched, kept
         REQUIRE_FALSE(cache.is_cached(1)); // Oldest, evicted
@@ -126,7 +128,7 @@ TEST_CASE("GCodeLayerCache LRU eviction", "[gcode][cache]") {
     }
 
     SECTION("explicit eviction works") {
-        cache.get_or_load(0, tracking_loader(loaded, 50));
+        cache.get_or_load(0, tracking_loader(loaded, SEGMENTS_4KB));
         REQUIRE(cache.is_cached(0));
 
         bool evicted = cache.evict(0);
@@ -138,6 +140,39 @@ TEST_CASE("GCodeLayerCache LRU eviction", "[gcode][cache]") {
     }
 }
 
+TEST_CASE("GCodeLayerCache eviction callback", "[gcode][cache]") {
+    GCodeLayerCache cache(10 * 1024);
+
+    std::vector<size_t> loaded;
+    std::vector<size_t> evicted;
+    cache.set_eviction_callback([&evicted](size_t layer) { evicted.push_back(layer); });
+
+    SECTION("reports LRU evictions") {
+        cache.get_or_load(0, tracking_loader(loaded, SEGMENTS_4KB));
+        cache.get_or_load(1, tracking_loader(loaded, SEGMENTS_4KB));
+        cache.get_or_load(2, tracking_loader(loaded, SEGMENTS_4KB));
+
+        REQUIRE(evicted == std::vector<size_t>{0});
+    }
+
+    SECTION("reports explicit and budget evictions") {
+        cache.get_or_load(0, tracking_loader(loaded, SEGMENTS_4KB));
+        cache.get_or_load(1, tracking_loader(loaded, SEGMENTS_4KB));
+
+        cache.evict(1);
+        REQUIRE(evicted == std::vector<size_t>{1});
+
+        cache.set_memory_budget(0);
+        REQUIRE(evicted == std::vector<size_t>{1, 0});
+    }
+
+    SECTION("clear does not report evictions") {
+        cache.get_or_load(0, tracking_loader(loaded, SEGMENTS_4KB));
+        cache.clear();
+        REQUIRE(evicted.empty());
+    }
+}
+
 TEST_CASE("GCodeLayerCache memory tracking", "[gcode][cache]") {
     GCodeLayerCache cache(100 * 1024); // 100KB
 
@@ -145,18 +180,18 @@ TEST_CASE("GCodeLayerCache memory tracking", "[gcode][cache]") {
         size_t initial = cache.memory_usage_bytes();
         REQUIRE(initial == 0);
 
-        cache.get_or_load(0, test_loader(100));
+        cache.get_or_load(0, test_loader(SEGMENTS_4KB));
         size_t after_one = cache.memory_usage_bytes();
         REQUIRE(after_one > initial);
 
-        cache.get_or_load(1, test_loader(100));
+        cache.get_or_load(1, test_loader(SEGMENTS_4KB));
         size_t after_two = cache.memory_usage_bytes();
         REQUIRE(after_two > after_one);
     }
 
     SECTION("clear resets memory usage") {
-        cache.get_or_load(0, test_loader(100));
-        cache.get_or_load(1, test_loader(100));
+        cache.get_or_load(0, test_loader(SEGMENTS_4KB));
+        cache.get_or_load(1, test_loader(SEGMENTS_4KB));
         REQUIRE(cache.memory_usage_bytes() > 0);
 
         cache.clear();
@@ -166,9 +201,9 @@ TEST_CASE("GCodeLayerCache memory tracking", "[gcode][cache]") {
 
     SECTION("set_memory_budget evicts excess") {
         // Start with generous budget
-        cache.get_or_load(0, test_loader(100));
-        cache.get_or_load(1, test_loader(100));
-        cache.get_or_load(2, test_loader(100));
+        cache.get_or_load(0, test_loader(SEGMENTS_4KB));
+        cache.get_or_load(1, test_loader(SEGMENTS_4KB));
+        cache.get_or_load(2, test_loader(SEGMENTS_4KB));
         REQUIRE(cache.cached_layer_count() == 3);
 
         // Reduce budget to fit only 1 layer
@@ -192,7 +227,7 @@ TEST_CASE("GCodeLayerCache insert", "[gcode][cache]") {
 
         auto result = cache.get_or_load(5, test_loader(0));
         REQUIRE(result.was_hit == true);
-        REQUIRE(result.segments->size() == 20);
+        REQUIRE(result.layer->size() == 20);
     }
 
     SECTION("insert rejects oversized layer") {
@@ -297,7 +332,7 @@ TEST_CASE("GCodeLayerCache thread safety", "[gcode][cache][thread]") {
             threads.emplace_back([&cache]() {
                 for (int j = 0; j < 100; ++j) {
                     auto result = cache.get_or_load(0, test_loader(50));
-                    REQUIRE(result.segments != nullptr);
+                    REQUIRE(result.layer != nullptr);
                 }
             });
         }
@@ -339,3 +374,47 @@ TEST_CASE("GCodeLayerCache thread safety", "[gcode][cache][thread]") {
         }
     }
 }
+
+TEST_CASE("GCodeLayerCache clear during an in-flight load", "[gcode][cache][thread]") {
+    GCodeLayerCache cache(100 * 1024);
+    std::atomic<bool> loading{false};
+    std::atomic<bool> release{false};
+
+    // A slow load of layer 0 from the file that is about to be closed
+    std::thread old_load([&] {
+        auto result = cache.get_or_load(0, [&](size_t) {
+            loading = true;
+            while (!release.load()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return make_test_segments(10);
+        });
+        REQUIRE(result.load_failed); // Stale: dropped, not cached
+    });
+    while (!loading.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    cache.clear(); // File closed and reopened
+
+    // The reopened file loads its own layer 0 instead of waiting on the old load
+    auto fresh = cache.get_or_load(0, test_loader(20));
+    REQUIRE_FALSE(fresh.load_failed);
+    REQUIRE_FALSE(fresh.was_shared);
+    REQUIRE(fresh.layer->size() == 20);
+
+    release = true;
+    old_load.join();
+    REQUIRE(cache.get_or_load(0, test_loader(20)).was_hit);
+}
+
+TEST_CASE("GCodeLayerCache loader exceptions reach waiters as failures", "[gcode][cache]") {
+    GCodeLayerCache cache(100 * 1024);
+    auto result = cache.get_or_load(3, [](size_t) -> std::vector<ToolpathSegment> {
+        throw std::runtime_error("truncated file");
+    });
+    REQUIRE(result.load_failed);
+
+    // Not stuck in flight: the next request loads again
+    REQUIRE_FALSE(cache.get_or_load(3, test_loader(5)).load_failed);
+}
@@ -3,13 +3,21 @@
 
 #include "gcode_layer_index.h"
 
+#include "gcode_data_source.h"
+
+#include <chrono>
+#include <filesystem>
 #include <fstream>
+#include <memory>
 #include <sstream>
+#include <vector>
 
 #include "../catch_amalgamated.hpp"
+#include "../test_helpers/temp_cache_dir.h"
 
 using namespace helix::gcode;
 using Catch::Approx;
+using helix::test::TempCacheDir;
 
 // Helper to create a temporary G-code file
 class TempGCodeFile {
@@ -229,3 +237,328 @@ TEST_CASE("GCodeLayerIndex - Invalid file", "[gcode][layer_index]") {
         REQUIRE(!index.is_valid());
     }
 }
+
+// =============================================================================
+// Parallel build
+// =============================================================================
+
+namespace {
+
+void require_same_index(const GCodeLayerIndex& serial, const GCodeLayerIndex& parallel) {
+    const auto& a = serial.get_stats();
+    const auto& b = parallel.get_stats();
+    REQUIRE(b.total_layers == a.total_layers);
+    REQUIRE(b.total_lines == a.total_lines);
+    REQUIRE(b.total_bytes == a.total_bytes);
+    REQUIRE(b.min_z == a.min_z);
+    REQUIRE(b.max_z == a.max_z);
+    REQUIRE(b.extrusion_moves == a.extrusion_moves);
+    REQUIRE(b.travel_moves == a.travel_moves);
+    REQUIRE(b.filament_color == a.filament_color);
+
+    REQUIRE(parallel.get_layer_count() == serial.get_layer_count());
+    for (size_t i = 0; i < serial.get_layer_count(); ++i) {
+        auto x = serial.get_entry(i);
+        auto y = parallel.get_entry(i);
+        INFO("layer " << i);
+        REQUIRE(y.file_offset == x.file_offset);
+        REQUIRE(y.byte_length == x.byte_length);
+        REQUIRE(y.z_height == x.z_height);
+        REQUIRE(y.line_count == x.line_count);
+        REQUIRE(y.flags == x.flags);
+    }
+}
+
+void require_parallel_matches_serial(const std::string& path) {
+    GCodeLayerIndex serial;
+    bool serial_ok = serial.build_from_file(path, 1);
+
+    for (unsigned threads : {2u, 3u, 4u, 7u, 16u}) {
+        INFO(path << " with " << threads << " chunks");
+        GCodeLayerIndex parallel;
+        REQUIRE(parallel.build_from_file(path, threads) == serial_ok);
+        require_same_index(serial, parallel);
+    }
+}
+
+} // namespace
+
+TEST_CASE("GCodeLayerIndex - Parallel build matches serial", "[gcode][layer_index]") {
+    SECTION("Z-change detection with state carried across chunks") {
+        // Z hops and lower Z moves must compare against the layer Z set in an
+        // earlier chunk
+        std::ostringstream gcode;
+        gcode << "; filament_colour = #26A69A\n";
+        for (int layer = 1; layer <= 40; ++layer) {
+            gcode << "G1 Z" << layer * 0.2 << " F600\n";
+            for (int i = 0; i < 5; ++i) {
+                gcode << "G1 X" << i << " Y" << layer << " E0." << i + 1 << "\r\n";
+            }
+            gcode << "G1 Z" << layer * 0.2 + 0.4 << " ; hop\n";
+            gcode << "G0 X0 Y0\n\n";
+            gcode << "G1 Z" << layer * 0.2 << "\n";
+        }
+        gcode << "G1 X1 Y1 E1"; // No trailing newline
+        TempGCodeFile file(gcode.str());
+        require_parallel_matches_serial(file.path());
+    }
+
+    SECTION("LAYER_CHANGE markers pending across chunks") {
+        std::ostringstream gcode;
+        for (int layer = 1; layer <= 40; ++layer) {
+            gcode << (layer % 2 ? ";LAYER_CHANGE\n" : "; layer_change\n");
+            gcode << ";Z:" << layer * 0.3 << "\n";
+            for (int i = 0; i < 8; ++i) {
+                gcode << "; filler comment " << i << "\n";
+            }
+            gcode << "G1 Z" << layer * 0.3 << "\n";
+            gcode << "G1 X" << layer << " E" << layer << "\n";
+            gcode << "G1 Z" << layer * 0.3 + 0.2 << "\n"; // Ignored: no pending marker
+        }
+        TempGCodeFile file(gcode.str());
+        require_parallel_matches_serial(file.path());
+    }
+
+    SECTION("Single line and empty files") {
+        TempGCodeFile one("G1 Z0.2 E1");
+        require_parallel_matches_serial(one.path());
+        TempGCodeFile empty("");
+        require_parallel_matches_serial(empty.path());
+    }
+
+    SECTION("Real files") {
+        for (const char* path :
+             {"assets/test_gcodes/3DBenchy.gcode", "assets/test_gcodes/exclude_object_test.gcode",
+              "assets/test_gcodes/xyz-10mm-calibration-cube.gcode"}) {
+            if (!std::ifstream(path).good()) {
+                SKIP("Test G-code file not found (run from project root)");
+            }
+            require_parallel_matches_serial(path);
+        }
+    }
+}
+
+TEST_CASE("GCodeLayerIndex - Z on every move", "[gcode][layer_index]") {
+    // Chunks skip Z moves that can't start a layer; the layers must not change
+
+    SECTION("Z-change detection with Z repeated and dipped within each layer") {
+        std::ostringstream gcode;
+        for (int layer = 1; layer <= 30; ++layer) {
+            double z = layer * 0.25;
+            gcode << "G1 Z" << z << "\n";
+            for (int i = 0; i < 5; ++i) {
+                gcode << "G1 X" << i << " Y" << layer << " Z" << z << " E1\n";
+            }
+            gcode << "G1 Z" << z - 0.125 << " ; wipe dip\n";
+            gcode << "G1 Z" << z << "\n";
+        }
+        TempGCodeFile file(gcode.str());
+
+        GCodeLayerIndex index;
+        REQUIRE(index.build_from_file(file.path()));
+        REQUIRE(index.get_layer_count() == 30);
+        for (size_t i = 0; i < 30; ++i) {
+            INFO("layer " << i);
+            REQUIRE(index.get_entry(i).z_height == Approx((i + 1) * 0.25));
+            REQUIRE(index.get_entry(i).line_count == 8);
+        }
+        require_parallel_matches_serial(file.path());
+    }
+
+    SECTION("Markers with a spiral (vase mode) and z-hop travels") {
+        std::ostringstream gcode;
+        for (int layer = 1; layer <= 30; ++layer) {
+            gcode << ";LAYER_CHANGE\n";
+            for (int i = 0; i < 10; ++i) {
+                gcode << "G1 X" << i << " Y" << layer << " Z" << layer * 0.25 + i * 0.02
+                      << " E1\n";
+            }
+            gcode << "G1 Z" << layer * 0.25 + 0.4 << " ; hop\n";
+            gcode << "G0 X0 Y0 Z" << layer * 0.25 + 0.4 << "\n";
+        }
+        TempGCodeFile file(gcode.str());
+
+        GCodeLayerIndex index;
+        REQUIRE(index.build_from_file(file.path()));
+        REQUIRE(index.get_layer_count() == 30);
+        for (size_t i = 0; i < 30; ++i) {
+            INFO("layer " << i);
+            REQUIRE(index.get_entry(i).z_height == Approx((i + 1) * 0.25));
+        }
+        require_parallel_matches_serial(file.path());
+    }
+}
+
+namespace {
+
+std::string make_sidecar_gcode(int layers) {
+    std::ostringstream gcode;
+    gcode << "; filament_colour = #FF5722\n";
+    for (int layer = 1; layer <= layers; ++layer) {
+        gcode << ";LAYER_CHANGE\n";
+        gcode << "G1 Z" << layer * 0.2 << "\n";
+        gcode << "G1 X" << layer << " Y" << layer << " E0.5\n";
+        gcode << "G0 X0 Y0\n";
+    }
+    return gcode.str();
+}
+
+} // namespace
+
+TEST_CASE("GCodeLayerIndex - Sidecar round trip", "[gcode][layer_index]") {
+    TempGCodeFile file(make_sidecar_gcode(25));
+    TempCacheDir cache("test_layer_index_cache");
+    std::string sidecar = GCodeLayerIndex::sidecar_path_for(file.path(), cache.path());
+
+    GCodeLayerIndex built;
+    REQUIRE(built.build_from_file(file.path()));
+    REQUIRE(built.save_sidecar(sidecar));
+
+    GCodeLayerIndex loaded;
+    REQUIRE(loaded.load_sidecar(sidecar, file.path()));
+    require_same_index(built, loaded);
+    REQUIRE(loaded.get_source_path() == file.path());
+    REQUIRE(loaded.get_stats().filament_color == "#FF5722");
+
+    SECTION("load_or_build writes the sidecar once, then loads it") {
+        std::filesystem::remove(sidecar);
+
+        GCodeLayerIndex first;
+        REQUIRE(first.load_or_build(file.path(), cache.path()));
+        REQUIRE(std::filesystem::exists(sidecar));
+        require_same_index(built, first);
+
+        GCodeLayerIndex second;
+        REQUIRE(second.load_or_build(file.path(), cache.path()));
+        require_same_index(built, second);
+    }
+
+    SECTION("No cache dir always builds") {
+        GCodeLayerIndex index;
+        REQUIRE(index.load_or_build(file.path(), ""));
+        require_same_index(built, index);
+    }
+
+    SECTION("Missing sidecar") {
+        GCodeLayerIndex index;
+        REQUIRE_FALSE(index.load_sidecar(cache.path() + "/missing.lidx", file.path()));
+        REQUIRE_FALSE(index.is_valid());
+    }
+
+    SECTION("Empty index is not saved") {
+        GCodeLayerIndex empty;
+        REQUIRE_FALSE(empty.save_sidecar(cache.path() + "/empty.lidx"));
+    }
+}
+
+TEST_CASE("GCodeLayerIndex - Sidecar invalidation", "[gcode][layer_index]") {
+    TempGCodeFile file(make_sidecar_gcode(10));
+    TempCacheDir cache("test_layer_index_cache");
+    std::string sidecar = GCodeLayerIndex::sidecar_path_for(file.path(), cache.path());
+
+    GCodeLayerIndex built;
+    REQUIRE(built.build_from_file(file.path()));
+    REQUIRE(built.save_sidecar(sidecar));
+
+    auto rewrite_sidecar = [&](size_t offset, char value) {
+        std::fstream out(sidecar, std::ios::in | std::ios::out | std::ios::binary);
+        out.seekp(static_cast<std::streamoff>(offset));
+        out.put(value);
+    };
+
+    SECTION("Source file modified") {
+        {
+            std::ofstream append(file.path(), std::ios::app);
+            append << ";LAYER_CHANGE\nG1 Z5.0\nG1 X1 E1\n";
+        }
+        GCodeLayerIndex index;
+        REQUIRE_FALSE(index.load_sidecar(sidecar, file.path()));
+        REQUIRE_FALSE(index.is_valid());
+
+        // load_or_build rescans and replaces the stale sidecar
+        REQUIRE(index.load_or_build(file.path(), cache.path()));
+        REQUIRE(index.get_layer_count() == built.get_layer_count() + 1);
+        GCodeLayerIndex reloaded;
+        REQUIRE(reloaded.load_sidecar(sidecar, file.path()));
+        require_same_index(index, reloaded);
+    }
+
+    SECTION("Source mtime changed") {
+        auto mtime = std::filesystem::last_write_time(file.path());
+        std::filesystem::last_write_time(file.path(), mtime + std::chrono::seconds(5));
+        GCodeLayerIndex index;
+        REQUIRE_FALSE(index.load_sidecar(sidecar, file.path()));
+    }
+
+    SECTION("Different source path") {
+        TempGCodeFile other(make_sidecar_gcode(10));
+        GCodeLayerIndex index;
+        REQUIRE_FALSE(index.load_sidecar(sidecar, other.path()));
+    }
+
+    SECTION("Format version mismatch") {
+        rewrite_sidecar(8, static_cast<char>(GCodeLayerIndex::SIDECAR_VERSION + 1));
+        GCodeLayerIndex index;
+        REQUIRE_FALSE(index.load_sidecar(sidecar, file.path()));
+    }
+
+    SECTION("Corrupted entry table") {
+        // First byte of the first entry's file_offset, just past the header
+        auto size = std::filesystem::file_size(sidecar);
+        size_t table_offset = size - file.path().size() - built.get_stats().filament_color.size() -
+                              built.get_layer_count() * sizeof(StreamingLayerEntry);
+        rewrite_sidecar(table_offset, 0x7f);
+        GCodeLayerIndex index;
+        REQUIRE_FALSE(index.load_sidecar(sidecar, file.path()));
+    }
+
+    SECTION("Truncated") {
+        std::filesystem::resize_file(sidecar, std::filesystem::file_size(sidecar) - 1);
+        GCodeLayerIndex index;
+        REQUIRE_FALSE(index.load_sidecar(sidecar, file.path()));
+    }
+}
+
+TEST_CASE("GCodeLayerIndex - Sidecar pruning", "[gcode][layer_index]") {
+    TempCacheDir cache("test_layer_index_cache");
+    std::vector<std::unique_ptr<TempGCodeFile>> files;
+    for (size_t i = 0; i < GCodeLayerIndex::MAX_SIDECARS + 3; ++i) {
+        files.push_back(std::make_unique<TempGCodeFile>(make_sidecar_gcode(3)));
+        GCodeLayerIndex index;
+        REQUIRE(index.load_or_build(files.back()->path(), cache.path()));
+    }
+    REQUIRE(cache.count_with_extension(".lidx") == GCodeLayerIndex::MAX_SIDECARS);
+}
+
+TEST_CASE("GCodeLayerIndex - Build from data source matches file", "[gcode][layer_index]") {
+    // Over 1MB so lines straddle the source reads; color only in the footer
+    std::ostringstream gcode;
+    for (int layer = 1; layer <= 200; ++layer) {
+        gcode << ";LAYER_CHANGE\n;Z:" << layer * 0.2 << "\n";
+        gcode << "G1 Z" << layer * 0.2 << "\n";
+        for (int i = 0; i < 400; ++i) {
+            gcode << "G1 X" << i << " Y" << layer << " E0.0" << i % 10 << "\n";
+        }
+    }
+    gcode << "; filament_colour = #E53935\n";
+    gcode << "G1 X1 Y1 E1"; // No trailing newline
+    std::string content = gcode.str();
+    REQUIRE(content.size() > 1024 * 1024);
+
+    TempGCodeFile file(content);
+    GCodeLayerIndex from_file;
+    REQUIRE(from_file.build_from_file(file.path(), 1));
+
+    MemoryDataSource source(content, "remote.gcode");
+    GCodeLayerIndex from_source;
+    REQUIRE(from_source.build_from_source(source));
+    require_same_index(from_file, from_source);
+    REQUIRE(from_source.get_stats().filament_color == "#E53935");
+    REQUIRE(from_source.get_source_path() == "remote.gcode");
+
+    SECTION("Empty source") {
+        MemoryDataSource empty("");
+        GCodeLayerIndex index;
+        REQUIRE_FALSE(index.build_from_source(empty));
+    }
+}
@@ -0,0 +1,271 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_layer_cache.h"
+#include "gcode_layer_prefetcher.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+using namespace std::chrono_literals;
+
+namespace {
+
+/// Records the order layers are loaded in; optionally blocks until released
+class RecordingLoader {
+  public:
+    void operator()(size_t layer) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        order_.push_back(layer);
+        cv_.notify_all();
+        cv_.wait(lock, [this] { return !blocked_; });
+    }
+
+    void block() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        blocked_ = true;
+    }
+
+    void release() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            blocked_ = false;
+        }
+        cv_.notify_all();
+    }
+
+    /// Wait until at least count loads have started
+    bool wait_for(size_t count) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, 5s, [&] { return order_.size() >= count; });
+    }
+
+    std::vector<size_t> order() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return order_;
+    }
+
+  private:
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<size_t> order_;
+    bool blocked_{false};
+};
+
+std::vector<ToolpathSegment> make_segments(size_t layer) {
+    std::vector<ToolpathSegment> segments(10);
+    for (size_t i = 0; i < segments.size(); ++i) {
+        segments[i].start = glm::vec3(static_cast<float>(i), 0.0f, static_cast<float>(layer));
+        segments[i].end = glm::vec3(static_cast<float>(i + 1), 0.0f, static_cast<float>(layer));
+        segments[i].is_extrusion = true;
+    }
+    return segments;
+}
+
+} // namespace
+
+TEST_CASE("LayerPrefetcher: queue order follows scrub direction", "[gcode][prefetch]") {
+    RecordingLoader loader;
+    LayerPrefetcher prefetcher([&](size_t layer) { loader(layer); }, 1);
+    REQUIRE(prefetcher.thread_count() == 1);
+
+    SECTION("first schedule loads center, then above, then below") {
+        prefetcher.schedule(10, 2, 100);
+        REQUIRE(prefetcher.wait_idle(5s));
+        REQUIRE(loader.order() == std::vector<size_t>{10, 11, 12, 9, 8});
+    }
+
+    SECTION("scrubbing down loads layers below first") {
+        prefetcher.schedule(10, 0, 100);
+        REQUIRE(prefetcher.wait_idle(5s));
+        prefetcher.schedule(8, 2, 100);
+        REQUIRE(prefetcher.wait_idle(5s));
+        REQUIRE(loader.order() == std::vector<size_t>{10, 8, 7, 6, 9, 10});
+    }
+
+    SECTION("window is clamped to valid layers") {
+        prefetcher.schedule(1, 3, 2);
+        REQUIRE(prefetcher.wait_idle(5s));
+        REQUIRE(loader.order() == std::vector<size_t>{1, 2, 0});
+    }
+
+    SECTION("center past max_layer is ignored") {
+        prefetcher.schedule(5, 1, 4);
+        REQUIRE(prefetcher.wait_idle(5s));
+        REQUIRE(loader.order().empty());
+    }
+}
+
+TEST_CASE("LayerPrefetcher: layer jump cancels stale work", "[gcode][prefetch]") {
+    RecordingLoader loader;
+    LayerPrefetcher prefetcher([&](size_t layer) { loader(layer); }, 1);
+
+    // Hold the worker on layer 10 while the rest of its window is queued
+    loader.block();
+    prefetcher.schedule(10, 3, 100);
+    REQUIRE(loader.wait_for(1));
+    REQUIRE(prefetcher.pending() == 6);
+
+    // Jump far away: the old window is dropped, not loaded
+    prefetcher.schedule(50, 1, 100);
+    REQUIRE(prefetcher.pending() == 3);
+    loader.release();
+    REQUIRE(prefetcher.wait_idle(5s));
+
+    REQUIRE(loader.order() == std::vector<size_t>{10, 50, 51, 49});
+    auto stats = prefetcher.stats();
+    REQUIRE(stats.scheduled == 10);
+    REQUIRE(stats.loaded == 4);
+    REQUIRE(stats.cancelled == 6);
+}
+
+TEST_CASE("LayerPrefetcher: overlapping windows keep pending layers", "[gcode][prefetch]") {
+    RecordingLoader loader;
+    LayerPrefetcher prefetcher([&](size_t layer) { loader(layer); }, 1);
+
+    loader.block();
+    prefetcher.schedule(10, 2, 100); // 10 running; 11, 12, 9, 8 pending
+    REQUIRE(loader.wait_for(1));
+    prefetcher.schedule(11, 2, 100); // 11, 12, 13, 10, 9 - only 8 is stale
+    loader.release();
+    REQUIRE(prefetcher.wait_idle(5s));
+
+    auto stats = prefetcher.stats();
+    REQUIRE(stats.cancelled == 1);
+    REQUIRE(stats.scheduled == 5 + 2); // 13 and 10 are new in the second window
+    REQUIRE(loader.order() == std::vector<size_t>{10, 11, 12, 13, 10, 9});
+}
+
+TEST_CASE("LayerPrefetcher: request and cancel", "[gcode][prefetch]") {
+    RecordingLoader loader;
+    LayerPrefetcher prefetcher([&](size_t layer) { loader(layer); }, 1);
+
+    loader.block();
+    prefetcher.schedule(10, 1, 100);
+    REQUIRE(loader.wait_for(1));
+
+    SECTION("request jumps the queue") {
+        prefetcher.request(40);
+        prefetcher.request(9); // Already pending - moved to the front, not duplicated
+        REQUIRE(prefetcher.pending() == 3);
+        loader.release();
+        REQUIRE(prefetcher.wait_idle(5s));
+        REQUIRE(loader.order() == std::vector<size_t>{10, 9, 40, 11});
+    }
+
+    SECTION("cancel drops pending work and waits for the running load") {
+        std::atomic<bool> cancelled{false};
+        std::thread canceller([&] {
+            prefetcher.cancel();
+            cancelled.store(true);
+        });
+        std::this_thread::sleep_for(20ms);
+        REQUIRE_FALSE(cancelled.load()); // Still waiting on layer 10
+        loader.release();
+        canceller.join();
+
+        REQUIRE(cancelled.load());
+        REQUIRE(prefetcher.pending() == 0);
+        REQUIRE(loader.order() == std::vector<size_t>{10});
+        REQUIRE(prefetcher.stats().cancelled == 2);
+    }
+}
+
+TEST_CASE("LayerPrefetcher: loads through the cache are deduplicated", "[gcode][prefetch]") {
+    GCodeLayerCache cache(4 * 1024 * 1024);
+    std::atomic<int> load_calls{0};
+    std::atomic<bool> release{false};
+
+    auto slow_loader = [&](size_t layer) {
+        load_calls++;
+        while (!release.load()) {
+            std::this_thread::sleep_for(1ms);
+        }
+        return make_segments(layer);
+    };
+
+    // A prefetch worker starts loading layer 7...
+    LayerPrefetcher prefetcher([&](size_t layer) { cache.preload(layer, slow_loader); }, 1);
+    prefetcher.request(7);
+    while (load_calls.load() == 0) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    // ...and the viewer asks for the same layer before it finishes
+    GCodeLayerCache::CacheResult viewer_result;
+    std::thread viewer([&] { viewer_result = cache.get_or_load(7, slow_loader); });
+    while (cache.shared_load_count() == 0) {
+        std::this_thread::sleep_for(1ms);
+    }
+    release.store(true);
+    viewer.join();
+    REQUIRE(prefetcher.wait_idle(5s));
+
+    REQUIRE(load_calls.load() == 1);
+    REQUIRE(viewer_result.layer != nullptr);
+    REQUIRE(viewer_result.layer->size() == 10);
+    REQUIRE(viewer_result.was_shared);
+    REQUIRE(cache.is_cached(7));
+
+    // Background preloads don't count as viewer lookups
+    auto [hits, misses] = cache.hit_stats();
+    REQUIRE(hits == 0);
+    REQUIRE(misses == 0);
+}
+
+TEST_CASE("GCodeLayerCache: clear() during a load discards the result", "[gcode][prefetch]") {
+    GCodeLayerCache cache(4 * 1024 * 1024);
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+
+    GCodeLayerCache::CacheResult result;
+    std::thread loader_thread([&] {
+        result = cache.get_or_load(3, [&](size_t layer) {
+            started.store(true);
+            while (!release.load()) {
+                std::this_thread::sleep_for(1ms);
+            }
+            return make_segments(layer);
+        });
+    });
+    while (!started.load()) {
+        std::this_thread::sleep_for(1ms);
+    }
+    cache.clear();
+    release.store(true);
+    loader_thread.join();
+
+    REQUIRE(result.load_failed);
+    REQUIRE_FALSE(cache.is_cached(3));
+    REQUIRE(cache.memory_usage_bytes() == 0);
+}
+
+TEST_CASE("LatencyWindow: percentiles", "[gcode][prefetch]") {
+    LatencyWindow window;
+    REQUIRE(window.percentile(95.0) == 0.0);
+
+    for (int i = 1; i <= 100; ++i) {
+        window.record(static_cast<double>(i));
+    }
+    REQUIRE(window.sample_count() == 100);
+    REQUIRE(window.percentile(50.0) == 50.0);
+    REQUIRE(window.percentile(95.0) == 95.0);
+    REQUIRE(window.percentile(100.0) == 100.0);
+
+    SECTION("old samples roll out of the window") {
+        for (size_t i = 0; i < LatencyWindow::WINDOW; ++i) {
+            window.record(1.0);
+        }
+        REQUIRE(window.sample_count() == LatencyWindow::WINDOW);
+        REQUIRE(window.percentile(95.0) == 1.0);
+    }
+
+    SECTION("reset") {
+        window.reset();
+        REQUIRE(window.sample_count() == 0);
+    }
+}
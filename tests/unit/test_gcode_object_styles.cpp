@@ -0,0 +1,201 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_object_styles.h"
+#include "gcode_packed_layer.h"
+#include "gcode_parser.h"
+
+#include "../catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace helix::gcode;
+
+TEST_CASE("ObjectStyleTable: resolve interns names to stable IDs", "[gcode][object_styles]") {
+    ObjectStyleTable styles;
+    REQUIRE(styles.size() == 1); // NO_OBJECT entry
+
+    REQUIRE(styles.resolve("") == ObjectStyleTable::NO_OBJECT);
+    uint16_t cube = styles.resolve("cube");
+    uint16_t cone = styles.resolve("cone");
+    REQUIRE(cube != ObjectStyleTable::NO_OBJECT);
+    REQUIRE(cone != ObjectStyleTable::NO_OBJECT);
+    REQUIRE(cube != cone);
+    REQUIRE(styles.resolve("cube") == cube);
+    REQUIRE(styles.resolve("cone") == cone);
+    REQUIRE(styles.size() == 3);
+
+    styles.clear();
+    REQUIRE(styles.size() == 1);
+    REQUIRE(styles.resolve("cone") == 1);
+}
+
+TEST_CASE("ObjectStyleTable: excluded and highlighted styles", "[gcode][object_styles]") {
+    ObjectStyleTable styles;
+    uint16_t a = styles.resolve("part_a");
+    uint16_t b = styles.resolve("part_b");
+
+    REQUIRE_FALSE(styles.style(a).has_color);
+    REQUIRE_FALSE(styles.style(ObjectStyleTable::NO_OBJECT).has_color);
+
+    SECTION("changing a set rebuilds existing IDs") {
+        REQUIRE(styles.set_excluded({"part_a"}));
+        REQUIRE(styles.style(a).excluded);
+        REQUIRE(styles.style(a).color == ObjectStyleTable::EXCLUDED_COLOR);
+        REQUIRE_FALSE(styles.style(b).has_color);
+
+        REQUIRE(styles.set_highlighted({"part_b"}));
+        REQUIRE(styles.style(b).highlighted);
+        REQUIRE(styles.style(b).color == ObjectStyleTable::HIGHLIGHTED_COLOR);
+
+        REQUIRE(styles.set_excluded({}));
+        REQUIRE_FALSE(styles.style(a).has_color);
+        REQUIRE(styles.style(b).highlighted);
+    }
+
+    SECTION("setting the same set is a no-op") {
+        REQUIRE(styles.set_excluded({"part_a"}));
+        REQUIRE_FALSE(styles.set_excluded({"part_a"}));
+        REQUIRE_FALSE(styles.set_highlighted({}));
+    }
+
+    SECTION("exclusion wins over highlight") {
+        styles.set_excluded({"part_a"});
+        styles.set_highlighted({"part_a"});
+        REQUIRE(styles.style(a).excluded);
+        REQUIRE_FALSE(styles.style(a).highlighted);
+    }
+
+    SECTION("names interned after a set change get the current style") {
+        styles.set_excluded({"part_c"});
+        REQUIRE(styles.style_for("part_c").excluded);
+        styles.clear();
+        REQUIRE(styles.style_for("part_c").excluded); // Sets survive clear()
+    }
+}
+
+TEST_CASE("ObjectStyleTable: support detection", "[gcode][object_styles]") {
+    REQUIRE(ObjectStyleTable::is_support_name("support_1"));
+    REQUIRE(ObjectStyleTable::is_support_name("tree_SUPPORT"));
+    REQUIRE(ObjectStyleTable::is_support_name("Support"));
+    REQUIRE_FALSE(ObjectStyleTable::is_support_name("supp"));
+    REQUIRE_FALSE(ObjectStyleTable::is_support_name("cube"));
+    REQUIRE_FALSE(ObjectStyleTable::is_support_name(""));
+
+    ObjectStyleTable styles;
+    REQUIRE(styles.style_for("Support_Blocker").support);
+    REQUIRE_FALSE(styles.style_for("benchy").support);
+    REQUIRE_FALSE(styles.style(ObjectStyleTable::NO_OBJECT).support);
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+// Run with: ./build/bin/helix-tests "[object_styles][.benchmark]" -s
+
+namespace {
+
+/// 200-object plate: each layer prints every object in turn, 250 segments each
+std::vector<std::vector<ToolpathSegment>> make_plate(int layers) {
+    constexpr int kObjects = 200;
+    constexpr int kSegmentsPerObject = 250;
+    std::vector<std::vector<ToolpathSegment>> plate(static_cast<size_t>(layers));
+    for (int l = 0; l < layers; ++l) {
+        auto& segments = plate[static_cast<size_t>(l)];
+        segments.reserve(kObjects * kSegmentsPerObject);
+        for (int o = 0; o < kObjects; ++o) {
+            ToolpathSegment seg;
+            seg.is_extrusion = true;
+            seg.object_name = (o % 20 == 19 ? "support_" : "part_") + std::to_string(o);
+            for (int s = 0; s < kSegmentsPerObject; ++s) {
+                segments.push_back(seg);
+            }
+        }
+    }
+    return plate;
+}
+
+/// Per-segment color decision as GCodeLayerRenderer made it before ObjectStyleTable
+uint32_t legacy_color(const ToolpathSegment& seg, const std::unordered_set<std::string>& excluded,
+                      const std::unordered_set<std::string>& highlighted) {
+    if (!seg.object_name.empty()) {
+        std::string lower_name = seg.object_name;
+        std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(),
+                       [](unsigned char c) { return std::tolower(c); });
+        if (lower_name.find("support") != std::string::npos) {
+            return 0;
+        }
+        if (excluded.count(seg.object_name) > 0) {
+            return ObjectStyleTable::EXCLUDED_COLOR;
+        }
+        if (highlighted.count(seg.object_name) > 0) {
+            return ObjectStyleTable::HIGHLIGHTED_COLOR;
+        }
+    }
+    return 0xFF2196F3;
+}
+
+} // namespace
+
+TEST_CASE("ObjectStyleTable: 200-object plate redraw", "[gcode][object_styles][.benchmark]") {
+    constexpr int kLayers = 20;
+    auto plate = make_plate(kLayers);
+    std::unordered_set<std::string> excluded = {"part_3", "part_77", "part_150"};
+    std::unordered_set<std::string> highlighted = {"part_42"};
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t legacy_sum = 0;
+    auto t0 = Clock::now();
+    for (const auto& layer : plate) {
+        for (const auto& seg : layer) {
+            legacy_sum += legacy_color(seg, excluded, highlighted);
+        }
+    }
+    double legacy_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+    ObjectStyleTable styles;
+    styles.set_excluded(excluded);
+    styles.set_highlighted(highlighted);
+    uint64_t table_sum = 0;
+    auto t1 = Clock::now();
+    for (const auto& layer : plate) {
+        for (const auto& seg : layer) {
+            const ObjectStyle& style = styles.style_for(seg.object_name);
+            table_sum += style.support ? 0 : (style.has_color ? style.color : 0xFF2196F3);
+        }
+    }
+    double table_ms = std::chrono::duration<double, std::milli>(Clock::now() - t1).count();
+
+    // What the renderer does: resolve a packed layer's names once, then index by ID
+    std::vector<PackedLayer> packed;
+    for (const auto& layer : plate) {
+        packed.emplace_back(layer);
+    }
+    uint64_t ids_sum = 0;
+    std::vector<uint16_t> style_ids;
+    auto t2 = Clock::now();
+    for (const auto& layer : packed) {
+        style_ids.clear();
+        for (const auto& name : layer.names()) {
+            style_ids.push_back(styles.resolve(name));
+        }
+        for (size_t i = 0; i < layer.size(); ++i) {
+            const ObjectStyle& style = styles.style(style_ids[layer.object_index(i)]);
+            ids_sum += style.support ? 0 : (style.has_color ? style.color : 0xFF2196F3);
+        }
+    }
+    double ids_ms = std::chrono::duration<double, std::milli>(Clock::now() - t2).count();
+
+    std::printf("Style lookup, 200 objects x %d layers (%zu segments): per-segment sets %.2f ms, "
+                "style table by name %.2f ms (%.1fx), per-layer IDs %.2f ms (%.1fx)\n",
+                kLayers, plate.size() * plate[0].size(), legacy_ms, table_ms,
+                legacy_ms / table_ms, ids_ms, legacy_ms / ids_ms);
+    REQUIRE(table_sum == legacy_sum);
+    REQUIRE(ids_sum == legacy_sum);
+}
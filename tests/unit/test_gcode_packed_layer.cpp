@@ -0,0 +1,147 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_packed_layer.h"
+
+#include <cmath>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+using Catch::Approx;
+
+namespace {
+
+ToolpathSegment make_segment(glm::vec3 start, glm::vec3 end, const std::string& object,
+                             bool extrusion = true, int tool = 0) {
+    ToolpathSegment seg;
+    seg.start = start;
+    seg.end = end;
+    seg.object_name = object;
+    seg.is_extrusion = extrusion;
+    seg.extrusion_amount = extrusion ? 0.0421f : 0.0f;
+    seg.width = extrusion ? 0.45f : 0.0f;
+    seg.tool_index = tool;
+    return seg;
+}
+
+/// A chained perimeter walk over a 250mm bed with a few objects and a Z hop
+std::vector<ToolpathSegment> make_layer(size_t count) {
+    std::vector<ToolpathSegment> segments;
+    glm::vec3 pos(12.5f, 7.25f, 0.2f);
+    for (size_t i = 0; i < count; ++i) {
+        glm::vec3 next(std::fmod(pos.x + 17.31f, 250.0f), std::fmod(pos.y + 9.87f, 250.0f),
+                       (i % 50 == 49) ? 0.6f : 0.2f);
+        std::string object = "Shape-Box_id_" + std::to_string((i / 100) % 3) + "_copy_0";
+        segments.push_back(make_segment(pos, next, object, i % 7 != 0, static_cast<int>(i % 4)));
+        pos = next;
+    }
+    return segments;
+}
+
+} // namespace
+
+TEST_CASE("PackedLayer: round trip", "[gcode][packed_layer]") {
+    auto segments = make_layer(1000);
+    PackedLayer packed(segments);
+
+    REQUIRE(packed.size() == segments.size());
+    REQUIRE_FALSE(packed.empty());
+
+    // 250mm / 65535 steps: well under 5um
+    const float tolerance = packed.max_position_error() * 1.01f;
+    REQUIRE(tolerance < 0.005f);
+
+    auto unpacked = packed.unpack();
+    REQUIRE(unpacked.size() == segments.size());
+    for (size_t i = 0; i < segments.size(); ++i) {
+        INFO("segment " << i);
+        const auto& a = segments[i];
+        const auto& b = unpacked[i];
+        REQUIRE(std::abs(b.start.x - a.start.x) <= tolerance);
+        REQUIRE(std::abs(b.start.y - a.start.y) <= tolerance);
+        REQUIRE(std::abs(b.start.z - a.start.z) <= tolerance);
+        REQUIRE(std::abs(b.end.x - a.end.x) <= tolerance);
+        REQUIRE(std::abs(b.end.y - a.end.y) <= tolerance);
+        REQUIRE(std::abs(b.end.z - a.end.z) <= tolerance);
+        REQUIRE(b.is_extrusion == a.is_extrusion);
+        REQUIRE(b.tool_index == a.tool_index);
+        REQUIRE(b.object_name == a.object_name);
+        REQUIRE(b.extrusion_amount == a.extrusion_amount);
+        REQUIRE(b.width == Approx(a.width).margin(0.0005f));
+
+        // Chained segments stay chained
+        if (i > 0) {
+            REQUIRE(b.start == unpacked[i - 1].end);
+        }
+    }
+
+    SECTION("accessors match unpack") {
+        for (size_t i : {0u, 1u, 499u, 999u}) {
+            REQUIRE(packed.start(i) == unpacked[i].start);
+            REQUIRE(packed.end(i) == unpacked[i].end);
+            REQUIRE(packed.object_name(i) == unpacked[i].object_name);
+            REQUIRE(packed.segment(i).tool_index == unpacked[i].tool_index);
+        }
+    }
+}
+
+TEST_CASE("PackedLayer: interned object names", "[gcode][packed_layer]") {
+    std::vector<ToolpathSegment> segments = {
+        make_segment({0, 0, 1}, {1, 0, 1}, "part_a"),
+        make_segment({1, 0, 1}, {2, 0, 1}, "part_a"),
+        make_segment({2, 0, 1}, {3, 0, 1}, ""),
+        make_segment({3, 0, 1}, {4, 0, 1}, "part_b"),
+        make_segment({4, 0, 1}, {5, 0, 1}, "part_a"),
+    };
+    PackedLayer packed(segments);
+
+    REQUIRE(packed.names().size() == 3);
+    REQUIRE(packed.names()[PackedLayer::NO_OBJECT].empty());
+    REQUIRE(packed.object_index(0) == packed.object_index(1));
+    REQUIRE(packed.object_index(0) == packed.object_index(4));
+    REQUIRE(packed.object_index(2) == PackedLayer::NO_OBJECT);
+    REQUIRE(packed.object_name(3) == "part_b");
+
+    // Flat Z decodes exactly
+    for (size_t i = 0; i < packed.size(); ++i) {
+        REQUIRE(packed.start(i).z == 1.0f);
+        REQUIRE(packed.end(i).z == 1.0f);
+    }
+}
+
+TEST_CASE("PackedLayer: edge cases", "[gcode][packed_layer]") {
+    SECTION("empty layer") {
+        PackedLayer packed(std::vector<ToolpathSegment>{});
+        REQUIRE(packed.empty());
+        REQUIRE(packed.unpack().empty());
+        REQUIRE(packed.memory_bytes() > 0);
+    }
+
+    SECTION("single point segment decodes exactly") {
+        PackedLayer packed({make_segment({5.5f, 6.5f, 0.3f}, {5.5f, 6.5f, 0.3f}, "x")});
+        REQUIRE(packed.start(0) == glm::vec3(5.5f, 6.5f, 0.3f));
+        REQUIRE(packed.end(0) == glm::vec3(5.5f, 6.5f, 0.3f));
+    }
+
+    SECTION("tool index and width are clamped to their packed range") {
+        PackedLayer packed({make_segment({0, 0, 0}, {1, 1, 0}, "", true, 500),
+                            make_segment({1, 1, 0}, {2, 2, 0}, "", false, -1)});
+        REQUIRE(packed.tool_index(0) == PackedLayer::MAX_TOOL_INDEX);
+        REQUIRE(packed.tool_index(1) == 0);
+        REQUIRE(packed.is_extrusion(0));
+        REQUIRE_FALSE(packed.is_extrusion(1));
+        REQUIRE(packed.width(1) == 0.0f);
+    }
+}
+
+TEST_CASE("PackedLayer: memory footprint", "[gcode][packed_layer]") {
+    auto segments = make_layer(10000);
+    PackedLayer packed(segments);
+
+    // ToolpathSegment storage: ~80 bytes per segment plus long object names
+    size_t unpacked_bytes = segments.size() * 80;
+    REQUIRE(PackedLayer::BYTES_PER_SEGMENT == 21);
+    REQUIRE(packed.memory_bytes() < segments.size() * 22);
+    REQUIRE(packed.memory_bytes() * 3 < unpacked_bytes);
+}
@@ -0,0 +1,199 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_range_block_cache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+
+namespace {
+
+constexpr uint32_t BLOCK = 1024;
+
+using Request = std::pair<uint64_t, uint32_t>; ///< (offset, length)
+
+/// In-memory "remote file" that records every range request
+struct FakeRemote {
+    std::vector<char> data;
+    std::mutex mutex;
+    std::vector<Request> requests;
+    std::atomic<bool> fail{false};
+
+    explicit FakeRemote(size_t size) : data(size) {
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<char>(i * 7 + i / 251);
+        }
+    }
+
+    RangeBlockCache::Fetcher fetcher() {
+        return [this](uint64_t offset, uint32_t length, std::vector<char>& out) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                requests.emplace_back(offset, length);
+            }
+            if (fail) {
+                return false;
+            }
+            size_t end = std::min<size_t>(data.size(), offset + length);
+            out.assign(data.begin() + offset, data.begin() + end);
+            return true;
+        };
+    }
+
+    std::vector<char> expected(uint64_t offset, uint32_t length) const {
+        size_t end = std::min<size_t>(data.size(), offset + length);
+        return std::vector<char>(data.begin() + offset, data.begin() + end);
+    }
+};
+
+} // namespace
+
+TEST_CASE("RangeBlockCache: coalesces a multi-block miss into one request",
+          "[gcode][range_cache]") {
+    FakeRemote remote(64 * BLOCK);
+    RangeBlockCache cache(remote.data.size(), 32 * BLOCK, remote.fetcher(), BLOCK, 0);
+
+    // Unaligned read spanning blocks 1..4
+    auto bytes = cache.read(BLOCK + 100, 3 * BLOCK + 50);
+    REQUIRE(bytes == remote.expected(BLOCK + 100, 3 * BLOCK + 50));
+    REQUIRE(remote.requests.size() == 1);
+    REQUIRE(remote.requests[0] == Request(BLOCK, 4 * BLOCK));
+
+    // Served entirely from cache
+    REQUIRE(cache.read(2 * BLOCK, 10) == remote.expected(2 * BLOCK, 10));
+    REQUIRE(remote.requests.size() == 1);
+
+    auto stats = cache.stats();
+    REQUIRE(stats.block_misses == 4);
+    REQUIRE(stats.block_hits == 1);
+    REQUIRE(stats.fetches == 1);
+    REQUIRE(stats.cached_bytes == 4 * BLOCK);
+}
+
+TEST_CASE("RangeBlockCache: only missing blocks are fetched", "[gcode][range_cache]") {
+    FakeRemote remote(64 * BLOCK);
+    RangeBlockCache cache(remote.data.size(), 32 * BLOCK, remote.fetcher(), BLOCK, 0);
+
+    cache.read(2 * BLOCK, BLOCK); // Block 2
+    remote.requests.clear();
+
+    // Blocks 0..4 with 2 cached: two runs, 0-1 and 3-4
+    REQUIRE(cache.read(0, 5 * BLOCK) == remote.expected(0, 5 * BLOCK));
+    REQUIRE(remote.requests.size() == 2);
+    REQUIRE(remote.requests[0] == Request(0, 2 * BLOCK));
+    REQUIRE(remote.requests[1] == Request(3 * BLOCK, 2 * BLOCK));
+}
+
+TEST_CASE("RangeBlockCache: readahead follows the read direction", "[gcode][range_cache]") {
+    FakeRemote remote(64 * BLOCK);
+    RangeBlockCache cache(remote.data.size(), 32 * BLOCK, remote.fetcher(), BLOCK, 2);
+
+    SECTION("forward") {
+        cache.read(10 * BLOCK, 10);
+        cache.read(20 * BLOCK, 10);
+        REQUIRE(remote.requests.back() == Request(20 * BLOCK, 3 * BLOCK));
+
+        // The next two layers are already here
+        size_t before = remote.requests.size();
+        cache.read(21 * BLOCK, 10);
+        cache.read(22 * BLOCK, 10);
+        REQUIRE(remote.requests.size() == before);
+        REQUIRE(cache.stats().prefetched >= 2);
+    }
+
+    SECTION("backward (scrubbing down)") {
+        cache.read(30 * BLOCK, 10);
+        cache.read(20 * BLOCK, 10);
+        REQUIRE(remote.requests.back() == Request(18 * BLOCK, 3 * BLOCK));
+
+        size_t before = remote.requests.size();
+        cache.read(19 * BLOCK, 10);
+        cache.read(18 * BLOCK, 10);
+        REQUIRE(remote.requests.size() == before);
+    }
+
+    SECTION("clamped at the file edges") {
+        cache.read(63 * BLOCK, 10);
+        REQUIRE(remote.requests.back() == Request(63 * BLOCK, BLOCK));
+        cache.read(0, 10);
+        REQUIRE(remote.requests.back() == Request(0, BLOCK));
+    }
+}
+
+TEST_CASE("RangeBlockCache: LRU eviction keeps the budget", "[gcode][range_cache]") {
+    FakeRemote remote(64 * BLOCK);
+    RangeBlockCache cache(remote.data.size(), 4 * BLOCK, remote.fetcher(), BLOCK, 0);
+
+    for (uint64_t b = 0; b < 4; ++b) {
+        cache.read(b * BLOCK, 10);
+    }
+    cache.read(0, 10); // Touch block 0 so block 1 is the oldest
+    cache.read(10 * BLOCK, 10);
+
+    auto stats = cache.stats();
+    REQUIRE(stats.cached_bytes == 4 * BLOCK);
+    REQUIRE(stats.evictions == 1);
+
+    size_t before = remote.requests.size();
+    cache.read(0, 10);
+    REQUIRE(remote.requests.size() == before); // Block 0 survived
+    cache.read(BLOCK, 10);
+    REQUIRE(remote.requests.size() == before + 1); // Block 1 was evicted
+}
+
+TEST_CASE("RangeBlockCache: short final block and out-of-range reads", "[gcode][range_cache]") {
+    FakeRemote remote(10 * BLOCK + 123);
+    RangeBlockCache cache(remote.data.size(), 32 * BLOCK, remote.fetcher(), BLOCK, 0);
+
+    auto tail = cache.read(10 * BLOCK, BLOCK);
+    REQUIRE(tail.size() == 123);
+    REQUIRE(tail == remote.expected(10 * BLOCK, 123));
+    REQUIRE(remote.requests.back() == Request(10 * BLOCK, 123));
+
+    REQUIRE(cache.read(remote.data.size(), 10).empty());
+    REQUIRE(cache.read(0, 0).empty());
+}
+
+TEST_CASE("RangeBlockCache: a failed fetch caches nothing", "[gcode][range_cache]") {
+    FakeRemote remote(16 * BLOCK);
+    RangeBlockCache cache(remote.data.size(), 32 * BLOCK, remote.fetcher(), BLOCK, 0);
+
+    remote.fail = true;
+    REQUIRE(cache.read(0, 2 * BLOCK).empty());
+    REQUIRE(cache.stats().cached_bytes == 0);
+
+    remote.fail = false;
+    REQUIRE(cache.read(0, 2 * BLOCK) == remote.expected(0, 2 * BLOCK));
+}
+
+TEST_CASE("RangeBlockCache: concurrent readers share fetches", "[gcode][range_cache]") {
+    FakeRemote remote(64 * BLOCK);
+    RangeBlockCache cache(remote.data.size(), 64 * BLOCK, remote.fetcher(), BLOCK, 0);
+
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (uint64_t b = 0; b < 32; ++b) {
+                if (cache.read(b * BLOCK + 10, BLOCK) != remote.expected(b * BLOCK + 10, BLOCK)) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    REQUIRE(mismatches == 0);
+    // Each of blocks 0..32 fetched exactly once regardless of interleaving
+    REQUIRE(cache.stats().bytes_fetched == 33 * BLOCK);
+}
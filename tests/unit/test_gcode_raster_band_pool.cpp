@@ -0,0 +1,264 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_raster_band_pool.h"
+
+#include "../catch_amalgamated.hpp"
+
+#ifdef ENABLE_TINYGL_3D
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// TinyGL headers
+#include <GL/gl.h>
+extern "C" {
+#include <zbuffer.h>
+}
+
+using namespace helix::gcode;
+
+namespace {
+
+constexpr int kWidth = 800;
+constexpr int kHeight = 480;
+
+/// Lit, tessellated sphere - one color per latitude band, face normals
+void draw_sphere(float cx, float cy, float cz, float radius, int slices, int stacks) {
+    const float pi = 3.14159265f;
+    static const float colors[4][3] = {
+        {0.15f, 0.65f, 0.6f}, {1.0f, 0.53f, 0.0f}, {0.2f, 0.4f, 1.0f}, {0.93f, 0.93f, 0.93f}};
+
+    auto point = [&](int i, int j, float out[3]) {
+        float theta = pi * static_cast<float>(j) / static_cast<float>(stacks);
+        float phi = 2.0f * pi * static_cast<float>(i) / static_cast<float>(slices);
+        out[0] = cx + radius * std::sin(theta) * std::cos(phi);
+        out[1] = cy + radius * std::sin(theta) * std::sin(phi);
+        out[2] = cz + radius * std::cos(theta);
+    };
+
+    glBegin(GL_TRIANGLES);
+    for (int j = 0; j < stacks; ++j) {
+        const float* rgb = colors[(j / 3) % 4];
+        glColor3f(rgb[0], rgb[1], rgb[2]);
+        for (int i = 0; i < slices; ++i) {
+            float a[3], b[3], c[3], d[3];
+            point(i, j, a);
+            point(i + 1, j, b);
+            point(i, j + 1, c);
+            point(i + 1, j + 1, d);
+            float n[3] = {(a[0] + d[0]) * 0.5f - cx, (a[1] + d[1]) * 0.5f - cy,
+                          (a[2] + d[2]) * 0.5f - cz};
+            float len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            glNormal3f(n[0] / len, n[1] / len, n[2] / len);
+            for (const float* v : {a, c, b, b, c, d}) {
+                glVertex3f(v[0], v[1], v[2]);
+            }
+        }
+    }
+    glEnd();
+}
+
+/**
+ * @brief Solid pass, stippled ghost pass, blended pass, then lines on top
+ *
+ * Exercises every state change the band path snapshots (color/material,
+ * stipple, depth mask, blend) and the ones that force a flush (lines).
+ */
+void draw_scene() {
+    draw_sphere(-20.0f, 0.0f, 10.0f, 25.0f, 96, 48);
+
+    GLubyte stipple[128];
+    for (int i = 0; i < 128; ++i) {
+        stipple[i] = (i / 4) % 2 ? 0xAA : 0x55;
+    }
+    glPolygonStipple(stipple);
+    glEnable(GL_POLYGON_STIPPLE);
+    glDepthMask(GL_FALSE);
+    draw_sphere(20.0f, 10.0f, 15.0f, 22.0f, 64, 32);
+    glDepthMask(GL_TRUE);
+    glDisable(GL_POLYGON_STIPPLE);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    draw_sphere(0.0f, -30.0f, 5.0f, 15.0f, 48, 24);
+    glDisable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ZERO); // GL_PHONG fills apply the blend func even when disabled
+
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_LIGHTING);
+    glColor3f(1.0f, 1.0f, 0.0f);
+    glBegin(GL_LINES);
+    glVertex3f(-50.0f, -50.0f, 0.0f);
+    glVertex3f(50.0f, 50.0f, 40.0f);
+    glEnd();
+    glEnable(GL_LIGHTING);
+    glEnable(GL_DEPTH_TEST);
+}
+
+/// TinyGL context with the G-code renderer's lighting/material setup
+class TinyGLContext {
+  public:
+    explicit TinyGLContext(GLenum shade_model) {
+        zb_ = ZB_open(kWidth, kHeight, ZB_MODE_RGBA, 0);
+        glInit(zb_);
+        glViewport(0, 0, kWidth, kHeight);
+        glEnable(GL_DEPTH_TEST);
+        glEnable(GL_LIGHTING);
+        glEnable(GL_COLOR_MATERIAL);
+        glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
+        glShadeModel(shade_model);
+        glEnable(GL_CULL_FACE);
+        glCullFace(GL_BACK);
+        glSetEnableSpecular(1);
+
+        GLfloat specular[] = {0.1f, 0.1f, 0.1f, 1.0f};
+        glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, specular);
+        glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 20.0f);
+
+        GLfloat top_dir[] = {-0.45f, 0.45f, 0.76f, 0.0f};
+        GLfloat front_dir[] = {0.7f, 0.14f, 0.7f, 0.0f};
+        glEnable(GL_LIGHT0);
+        glLightfv(GL_LIGHT0, GL_POSITION, top_dir);
+        glEnable(GL_LIGHT1);
+        glLightfv(GL_LIGHT1, GL_POSITION, front_dir);
+
+        glMatrixMode(GL_PROJECTION);
+        glLoadIdentity();
+        glFrustum(-1.6, 1.6, -1.0, 1.0, 2.0, 1000.0);
+        glMatrixMode(GL_MODELVIEW);
+        glLoadIdentity();
+        glTranslatef(0.0f, 0.0f, -120.0f);
+        glRotatef(-60.0f, 1.0f, 0.0f, 0.0f);
+    }
+
+    ~TinyGLContext() {
+        glClose();
+        ZB_close(zb_);
+    }
+
+    TinyGLContext(const TinyGLContext&) = delete;
+    TinyGLContext& operator=(const TinyGLContext&) = delete;
+
+    template <typename Fn> std::vector<unsigned int> render(Fn&& draw) {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        draw();
+        glFinish();
+        return std::vector<unsigned int>(zb_->pbuf, zb_->pbuf + kWidth * kHeight);
+    }
+
+  private:
+    ZBuffer* zb_{nullptr};
+};
+
+size_t count_differences(const std::vector<unsigned int>& a, const std::vector<unsigned int>& b) {
+    size_t diff = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        diff += a[i] != b[i];
+    }
+    return diff;
+}
+
+} // namespace
+
+TEST_CASE("RasterBandPool: banded output matches serial rasterization", "[gcode][tinygl]") {
+    GLenum shade_model = GENERATE(GLenum(GL_PHONG), GLenum(GL_SMOOTH), GLenum(GL_FLAT));
+    unsigned bands = GENERATE(2u, 3u, 4u, 7u);
+    CAPTURE(shade_model, bands);
+
+    TinyGLContext context(shade_model);
+    auto expected = context.render(draw_scene);
+    size_t lit = 0;
+    for (unsigned int px : expected) {
+        lit += px != 0;
+    }
+    REQUIRE(lit > 10000);
+
+    RasterBandPool pool(bands);
+    REQUIRE(pool.band_count() == bands);
+    REQUIRE(pool.attach());
+    auto actual = context.render(draw_scene);
+    REQUIRE(count_differences(expected, actual) == 0);
+    REQUIRE(pool.stats().chunks > 1); // Scene is larger than one chunk
+
+    // Detaching returns to the serial path with the same result
+    pool.detach();
+    auto serial_again = context.render(draw_scene);
+    REQUIRE(count_differences(expected, serial_again) == 0);
+}
+
+TEST_CASE("RasterBandPool: reattaching after a frame keeps output identical", "[gcode][tinygl]") {
+    TinyGLContext context(GL_PHONG);
+    auto expected = context.render(draw_scene);
+
+    RasterBandPool pool(4);
+    REQUIRE(pool.attach());
+    for (int frame = 0; frame < 3; ++frame) {
+        REQUIRE(count_differences(expected, context.render(draw_scene)) == 0);
+    }
+    pool.detach();
+    REQUIRE(pool.attach());
+    REQUIRE(count_differences(expected, context.render(draw_scene)) == 0);
+}
+
+TEST_CASE("RasterBandPool: band count from environment", "[gcode][tinygl]") {
+    setenv("HELIX_GCODE_RASTER_THREADS", "3", 1);
+    REQUIRE(RasterBandPool::configured_band_count() == 3);
+
+    setenv("HELIX_GCODE_RASTER_THREADS", "1", 1);
+    REQUIRE(RasterBandPool::configured_band_count() == 1);
+
+    setenv("HELIX_GCODE_RASTER_THREADS", "0", 1); // Auto
+    unsigned automatic = RasterBandPool::configured_band_count();
+    REQUIRE(automatic >= 1);
+    REQUIRE(automatic <= 4);
+
+    setenv("HELIX_GCODE_RASTER_THREADS", "lots", 1); // Invalid - auto
+    REQUIRE(RasterBandPool::configured_band_count() == automatic);
+
+    unsetenv("HELIX_GCODE_RASTER_THREADS");
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+// Run with: ./build/bin/helix-tests "[tinygl][.benchmark]" -s
+
+TEST_CASE("RasterBandPool: frame time", "[gcode][tinygl][.benchmark]") {
+    TinyGLContext context(GL_PHONG);
+    auto draw = [] {
+        for (int i = 0; i < 8; ++i) {
+            draw_sphere(-30.0f + 8.0f * static_cast<float>(i), 0.0f, 10.0f, 30.0f, 160, 80);
+        }
+    };
+
+    using Clock = std::chrono::steady_clock;
+    constexpr int kFrames = 5;
+    auto time_frames = [&] {
+        context.render(draw); // Warm-up
+        auto t0 = Clock::now();
+        for (int i = 0; i < kFrames; ++i) {
+            context.render(draw);
+        }
+        return std::chrono::duration<double, std::milli>(Clock::now() - t0).count() / kFrames;
+    };
+
+    double serial_ms = time_frames();
+    std::printf("TinyGL phong rasterization at %dx%d (%u cores):\n", kWidth, kHeight,
+                std::thread::hardware_concurrency());
+    std::printf("  serial: %.1f ms/frame\n", serial_ms);
+    for (unsigned bands : {2u, 4u}) {
+        RasterBandPool pool(bands);
+        pool.attach();
+        double banded_ms = time_frames();
+        pool.detach();
+        std::printf("  %u bands: %.1f ms/frame (%.2fx)\n", bands, banded_ms,
+                    serial_ms / banded_ms);
+        CHECK(banded_ms > 0.0);
+    }
+}
+
+#endif // ENABLE_TINYGL_3D
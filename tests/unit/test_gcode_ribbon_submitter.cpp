@@ -0,0 +1,273 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_ribbon_submitter.h"
+
+#include "../catch_amalgamated.hpp"
+
+#ifdef ENABLE_TINYGL_3D
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// TinyGL headers
+#include <GL/gl.h>
+extern "C" {
+#include <zbuffer.h>
+}
+
+using namespace helix::gcode;
+
+namespace {
+
+constexpr int kWidth = 800;
+constexpr int kHeight = 480;
+
+/**
+ * @brief Synthetic print: rings of 4-sided ribbon segments, one ring per layer
+ *
+ * Each segment is four strips (top, bottom, outer, inner) with per-face normals
+ * and a color that changes every 50 segments, like the geometry builder emits.
+ */
+void build_rings(RibbonGeometry& geometry, int layers, int segments_per_layer) {
+    geometry.quantization.min_bounds = glm::vec3(-100.0f, -100.0f, 0.0f);
+    geometry.quantization.max_bounds = glm::vec3(100.0f, 100.0f, 100.0f);
+    geometry.quantization.scale_factor = 100.0f;
+    geometry.normal_palette = {{0, 0, 1}, {0, 0, -1}, {1, 0, 0}, {-1, 0, 0}};
+    geometry.color_palette = {0x26A69A, 0xFF8800, 0x3366FF, 0xEEEEEE};
+
+    const auto& quant = geometry.quantization;
+    auto add = [&](const glm::vec3 (&corners)[4], uint16_t normal, uint8_t color) {
+        uint32_t base = static_cast<uint32_t>(geometry.vertices.size());
+        for (const auto& c : corners) {
+            geometry.vertices.push_back({quant.quantize_vec3(c), normal, color});
+        }
+        geometry.strips.push_back({base, base + 1, base + 2, base + 3});
+    };
+
+    const float pi = 3.14159265f;
+    for (int layer = 0; layer < layers; ++layer) {
+        size_t first = geometry.strips.size();
+        float z = 0.2f * static_cast<float>(layer);
+        float h = 0.2f;
+        for (int s = 0; s < segments_per_layer; ++s) {
+            float step = 2.0f * pi / static_cast<float>(segments_per_layer);
+            float a0 = step * static_cast<float>(s);
+            float a1 = step * static_cast<float>(s + 1);
+            float r = 40.0f + static_cast<float>(s % 7);
+            glm::vec3 d0(std::cos(a0) * 0.2f, std::sin(a0) * 0.2f, 0.0f);
+            glm::vec3 d1(std::cos(a1) * 0.2f, std::sin(a1) * 0.2f, 0.0f);
+            glm::vec3 p0(r * std::cos(a0), r * std::sin(a0), z);
+            glm::vec3 p1(r * std::cos(a1), r * std::sin(a1), z);
+            glm::vec3 up(0.0f, 0.0f, h);
+            auto color = static_cast<uint8_t>((s / 50) % 4);
+
+            add({p0 - d0 + up, p1 - d1 + up, p0 + d0 + up, p1 + d1 + up}, 0, color);
+            add({p0 + d0, p1 + d1, p0 - d0, p1 - d1}, 1, color);
+            add({p0 + d0, p0 + d0 + up, p1 + d1, p1 + d1 + up}, 2, color);
+            add({p1 - d1, p1 - d1 + up, p0 - d0, p0 - d0 + up}, 3, color);
+        }
+        geometry.layer_strip_ranges.emplace_back(first, geometry.strips.size() - first);
+        geometry.strip_layer_index.insert(geometry.strip_layer_index.end(),
+                                          geometry.strips.size() - first,
+                                          static_cast<uint16_t>(layer));
+    }
+    geometry.max_layer_index = static_cast<uint16_t>(layers - 1);
+    geometry.extrusion_triangle_count = geometry.strips.size() * 2;
+    geometry.travel_triangle_count = 0;
+}
+
+/// The per-vertex submission loop GCodeTinyGLRenderer used before RibbonSubmitter
+void legacy_submit(const RibbonGeometry& geometry, float dim_factor) {
+    for (const auto& strip : geometry.strips) {
+        glBegin(GL_TRIANGLE_STRIP);
+        for (uint32_t index : strip) {
+            const auto& vertex = geometry.vertices[index];
+            const glm::vec3& normal = geometry.normal_palette[vertex.normal_index];
+            glNormal3f(normal.x, normal.y, normal.z);
+
+            uint32_t color_rgb = geometry.color_palette[vertex.color_index];
+            uint8_t r = (color_rgb >> 16) & 0xFF;
+            uint8_t g = (color_rgb >> 8) & 0xFF;
+            uint8_t b = color_rgb & 0xFF;
+            glColor3f((r / 255.0f) * dim_factor, (g / 255.0f) * dim_factor,
+                      (b / 255.0f) * dim_factor);
+
+            glm::vec3 pos = geometry.quantization.dequantize_vec3(vertex.position);
+            glVertex3f(pos.x, pos.y, pos.z);
+        }
+        glEnd();
+    }
+}
+
+/// TinyGL context with the renderer's lighting/material setup
+class TinyGLContext {
+  public:
+    TinyGLContext() {
+        zb_ = ZB_open(kWidth, kHeight, ZB_MODE_RGBA, 0);
+        glInit(zb_);
+        glViewport(0, 0, kWidth, kHeight);
+        glEnable(GL_DEPTH_TEST);
+        glEnable(GL_LIGHTING);
+        glEnable(GL_COLOR_MATERIAL);
+        glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
+        glShadeModel(GL_PHONG);
+        glEnable(GL_CULL_FACE);
+        glCullFace(GL_BACK);
+        glSetEnableSpecular(1);
+
+        GLfloat top_dir[] = {-0.45f, 0.45f, 0.76f, 0.0f};
+        GLfloat front_dir[] = {0.7f, 0.14f, 0.7f, 0.0f};
+        glEnable(GL_LIGHT0);
+        glLightfv(GL_LIGHT0, GL_POSITION, top_dir);
+        glEnable(GL_LIGHT1);
+        glLightfv(GL_LIGHT1, GL_POSITION, front_dir);
+
+        glMatrixMode(GL_PROJECTION);
+        glLoadIdentity();
+        glFrustum(-1.6, 1.6, -1.0, 1.0, 2.0, 1000.0);
+        glMatrixMode(GL_MODELVIEW);
+        glLoadIdentity();
+        glTranslatef(0.0f, -10.0f, -160.0f);
+        glRotatef(-60.0f, 1.0f, 0.0f, 0.0f);
+    }
+
+    ~TinyGLContext() {
+        glClose();
+        ZB_close(zb_);
+    }
+
+    TinyGLContext(const TinyGLContext&) = delete;
+    TinyGLContext& operator=(const TinyGLContext&) = delete;
+
+    template <typename Fn> std::vector<unsigned int> render(Fn&& draw) {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        draw();
+        return std::vector<unsigned int>(zb_->pbuf, zb_->pbuf + kWidth * kHeight);
+    }
+
+  private:
+    ZBuffer* zb_{nullptr};
+};
+
+size_t count_differences(const std::vector<unsigned int>& a, const std::vector<unsigned int>& b) {
+    size_t diff = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        diff += a[i] != b[i];
+    }
+    return diff;
+}
+
+} // namespace
+
+TEST_CASE("RibbonSubmitter: output matches per-vertex submission", "[gcode][tinygl]") {
+    RibbonGeometry geometry;
+    build_rings(geometry, 20, 200);
+    TinyGLContext context;
+    RibbonSubmitter submitter;
+    float dim = GENERATE(1.0f, 0.4f); // Solid and ghost passes
+
+    auto expected = context.render([&] { legacy_submit(geometry, dim); });
+    size_t lit = 0;
+    for (unsigned int px : expected) {
+        lit += px != 0;
+    }
+    REQUIRE(lit > 1000);
+
+    SECTION("whole geometry in one call") {
+        auto actual = context.render([&] {
+            submitter.prepare(geometry, dim);
+            submitter.submit(0, geometry.strips.size());
+        });
+        REQUIRE(count_differences(expected, actual) == 0);
+    }
+
+    SECTION("per-layer ranges") {
+        auto actual = context.render([&] {
+            submitter.prepare(geometry, dim);
+            for (auto [first, count] : geometry.layer_strip_ranges) {
+                submitter.submit(first, count);
+            }
+        });
+        REQUIRE(count_differences(expected, actual) == 0);
+    }
+}
+
+TEST_CASE("RibbonSubmitter: palette rebuilt only on change", "[gcode][tinygl]") {
+    RibbonGeometry geometry;
+    build_rings(geometry, 2, 10);
+    TinyGLContext context;
+    RibbonSubmitter submitter;
+
+    submitter.prepare(geometry, 1.0f);
+    submitter.prepare(geometry, 1.0f);
+    REQUIRE(submitter.palette_rebuilds() == 1);
+
+    submitter.prepare(geometry, 0.4f); // Ghost pass
+    REQUIRE(submitter.palette_rebuilds() == 2);
+
+    geometry.color_palette[1] = 0x00FF00; // Recolored (e.g. new filament color)
+    submitter.prepare(geometry, 0.4f);
+    REQUIRE(submitter.palette_rebuilds() == 3);
+
+    submitter.invalidate();
+    submitter.prepare(geometry, 0.4f);
+    REQUIRE(submitter.palette_rebuilds() == 4);
+}
+
+TEST_CASE("RibbonSubmitter: out-of-range submits are clamped", "[gcode][tinygl]") {
+    RibbonGeometry geometry;
+    build_rings(geometry, 2, 10);
+    TinyGLContext context;
+    RibbonSubmitter submitter;
+
+    auto expected = context.render([&] { legacy_submit(geometry, 1.0f); });
+    auto actual = context.render([&] {
+        submitter.prepare(geometry, 1.0f);
+        submitter.submit(0, geometry.strips.size() + 100);
+        submitter.submit(geometry.strips.size(), 10);
+    });
+    REQUIRE(count_differences(expected, actual) == 0);
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+// Run with: ./build/bin/helix-tests "[tinygl][.benchmark]" -s
+// 1M triangles (250 layers x 500 segments x 4 strips) at 800x480.
+
+TEST_CASE("RibbonSubmitter: frame time", "[gcode][tinygl][.benchmark]") {
+    RibbonGeometry geometry;
+    build_rings(geometry, 250, 500);
+    TinyGLContext context;
+    RibbonSubmitter submitter;
+
+    using Clock = std::chrono::steady_clock;
+    constexpr int kFrames = 5;
+    auto time_frames = [&](auto&& draw) {
+        context.render(draw); // Warm-up
+        auto t0 = Clock::now();
+        for (int i = 0; i < kFrames; ++i) {
+            context.render(draw);
+        }
+        return std::chrono::duration<double, std::milli>(Clock::now() - t0).count() / kFrames;
+    };
+
+    double legacy_ms = time_frames([&] { legacy_submit(geometry, 1.0f); });
+    double submitter_ms = time_frames([&] {
+        submitter.prepare(geometry, 1.0f);
+        for (auto [first, count] : geometry.layer_strip_ranges) {
+            submitter.submit(first, count);
+        }
+    });
+
+    std::printf("TinyGL ribbon submission, %zu triangles at %dx%d:\n",
+                geometry.extrusion_triangle_count, kWidth, kHeight);
+    std::printf("  per-vertex: %.1f ms/frame, RibbonSubmitter: %.1f ms/frame (%.0f%% faster)\n",
+                legacy_ms, submitter_ms, 100.0 * (legacy_ms - submitter_ms) / legacy_ms);
+    CHECK(submitter_ms > 0.0);
+}
+
+#endif // ENABLE_TINYGL_3D
@@ -245,6 +245,7 @@ TEST_CASE("GCodeStreamingController prefetch", "[gcode][streaming]") {
 
         // Access layer 10, which should prefetch layers 7-13
         controller.get_layer_segments(10);
+        REQUIRE(controller.wait_for_prefetch(std::chrono::seconds(5)));
 
         // Nearby layers should be cached
         REQUIRE(controller.is_layer_cached(10));
@@ -259,6 +260,7 @@ TEST_CASE("GCodeStreamingController prefetch", "[gcode][streaming]") {
     SECTION("explicit prefetch works") {
         controller.clear_cache();
         controller.prefetch_around(5, 2);
+        REQUIRE(controller.wait_for_prefetch(std::chrono::seconds(5)));
 
         // Layers 3-7 should be cached
         for (size_t i = 3; i <= 7; ++i) {
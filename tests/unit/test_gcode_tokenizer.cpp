@@ -0,0 +1,334 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_layer_index.h"
+#include "gcode_parser.h"
+#include "gcode_tokenizer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+using Catch::Approx;
+
+namespace {
+
+class TempFile {
+  public:
+    explicit TempFile(const std::string& content) {
+        path_ = "/tmp/test_tokenizer_" + std::to_string(rand()) + ".gcode";
+        std::ofstream file(path_, std::ios::binary);
+        file << content;
+    }
+
+    ~TempFile() {
+        std::remove(path_.c_str());
+    }
+
+    const std::string& path() const {
+        return path_;
+    }
+
+  private:
+    std::string path_;
+};
+
+std::vector<std::string> read_all_lines(const std::string& path, size_t chunk_size) {
+    GCodeLineReader reader(path, chunk_size);
+    std::vector<std::string> lines;
+    std::string_view line;
+    while (reader.next(line)) {
+        lines.emplace_back(line);
+    }
+    return lines;
+}
+
+} // namespace
+
+TEST_CASE("GCode tokenizer: command and comment split", "[gcode][tokenizer]") {
+    SECTION("plain command") {
+        auto t = tokenize_gcode_line("G1 X10 Y20");
+        REQUIRE(t.code == "G1 X10 Y20");
+        REQUIRE(t.comment.empty());
+    }
+
+    SECTION("comment is stripped from code and kept with its ';'") {
+        auto t = tokenize_gcode_line("  G1 X10 ; move X\r");
+        REQUIRE(t.code == "G1 X10");
+        REQUIRE(t.comment == "; move X\r");
+        REQUIRE(t.has(GCodeAxis::X));
+    }
+
+    SECTION("comment-only and blank lines have no code") {
+        REQUIRE(tokenize_gcode_line(";LAYER_CHANGE").code.empty());
+        REQUIRE(tokenize_gcode_line(" \t\r").code.empty());
+        REQUIRE(tokenize_gcode_line("").code.empty());
+    }
+
+    SECTION("letters in the comment are ignored") {
+        // Long enough to cross a 16-byte SIMD block
+        auto t = tokenize_gcode_line("G1 Y5.5 F1200 ; extrude X and Z here please");
+        REQUIRE(t.has(GCodeAxis::Y));
+        REQUIRE(t.has(GCodeAxis::F));
+        REQUIRE_FALSE(t.has(GCodeAxis::X));
+        REQUIRE_FALSE(t.has(GCodeAxis::Z));
+        REQUIRE_FALSE(t.has(GCodeAxis::E));
+    }
+}
+
+TEST_CASE("GCode tokenizer: parameters", "[gcode][tokenizer]") {
+    float v = 0.0f;
+
+    SECTION("finds all axes on a long line") {
+        auto t = tokenize_gcode_line("G1 X123.456 Y-78.9 Z0.2 E.03512 F7800");
+        REQUIRE(t.param(GCodeAxis::X, v));
+        REQUIRE(v == Approx(123.456f));
+        REQUIRE(t.param(GCodeAxis::Y, v));
+        REQUIRE(v == Approx(-78.9f));
+        REQUIRE(t.param(GCodeAxis::Z, v));
+        REQUIRE(v == Approx(0.2f));
+        REQUIRE(t.param(GCodeAxis::E, v));
+        REQUIRE(v == Approx(0.03512f));
+        REQUIRE(t.param(GCodeAxis::F, v));
+        REQUIRE(v == Approx(7800.0f));
+    }
+
+    SECTION("first occurrence wins") {
+        auto t = tokenize_gcode_line("G1 X1 X2");
+        REQUIRE(t.param(GCodeAxis::X, v));
+        REQUIRE(v == Approx(1.0f));
+    }
+
+    SECTION("word start is required by default") {
+        auto t = tokenize_gcode_line("G1X10 Z5");
+        REQUIRE_FALSE(t.param(GCodeAxis::X, v));
+        REQUIRE(t.param(GCodeAxis::X, v, false));
+        REQUIRE(v == Approx(10.0f));
+    }
+
+    SECTION("letter without a number") {
+        auto t = tokenize_gcode_line("G1 X Y-");
+        REQUIRE(t.has(GCodeAxis::X));
+        REQUIRE_FALSE(t.param(GCodeAxis::X, v));
+        REQUIRE_FALSE(t.param(GCodeAxis::Y, v));
+    }
+}
+
+TEST_CASE("GCode tokenizer: parse_gcode_float", "[gcode][tokenizer]") {
+    auto parse = [](const std::string& text, float& out) {
+        return parse_gcode_float(text.data(), text.data() + text.size(), out);
+    };
+    float v = 0.0f;
+
+    REQUIRE(parse("42", v));
+    REQUIRE(v == 42.0f);
+    REQUIRE(parse("-0.5", v));
+    REQUIRE(v == -0.5f);
+    REQUIRE(parse("+.25", v));
+    REQUIRE(v == 0.25f);
+    REQUIRE(parse("7.", v));
+    REQUIRE(v == 7.0f);
+    REQUIRE(parse("0.000000000000000000001", v));
+    REQUIRE(v == Approx(0.0f).margin(1e-18));
+    REQUIRE(parse("123456789012345678901234", v));
+    REQUIRE(v == Approx(1.2345678901e23f));
+
+    // Stops at the first character that can't continue the number
+    const std::string text = "1.5.3";
+    const char* stop = nullptr;
+    REQUIRE(parse_gcode_float(text.data(), text.data() + text.size(), v, &stop));
+    REQUIRE(v == 1.5f);
+    REQUIRE(stop == text.data() + 3);
+
+    REQUIRE_FALSE(parse("", v));
+    REQUIRE_FALSE(parse("-", v));
+    REQUIRE_FALSE(parse(".", v));
+    REQUIRE_FALSE(parse("+-1", v));
+}
+
+TEST_CASE("GCode tokenizer: find_newline", "[gcode][tokenizer]") {
+    std::string text(100, 'x');
+    for (size_t pos : {0u, 5u, 15u, 16u, 17u, 31u, 64u, 99u}) {
+        std::string copy = text;
+        copy[pos] = '\n';
+        REQUIRE(find_newline(copy.data(), copy.data() + copy.size()) == copy.data() + pos);
+    }
+    REQUIRE(find_newline(text.data(), text.data() + text.size()) == text.data() + text.size());
+}
+
+TEST_CASE("GCodeLineReader matches std::getline", "[gcode][tokenizer]") {
+    std::string content;
+    for (int i = 0; i < 500; ++i) {
+        content += "G1 X" + std::to_string(i) + " Y" + std::to_string(i * 2) + " E0.1\n";
+        if (i % 7 == 0) {
+            content += "\n;comment line " + std::to_string(i) + "\r\n";
+        }
+    }
+    content += "G1 X1 ; no trailing newline";
+    TempFile temp(content);
+
+    std::vector<std::string> expected;
+    std::istringstream stream(content);
+    std::string line;
+    while (std::getline(stream, line)) {
+        expected.push_back(line);
+    }
+
+    // Tiny chunks force lines to straddle refills
+    REQUIRE(read_all_lines(temp.path(), 16) == expected);
+    REQUIRE(read_all_lines(temp.path(), GCodeLineReader::DEFAULT_CHUNK_SIZE) == expected);
+
+    SECTION("reports line offsets") {
+        GCodeLineReader reader(temp.path(), 64);
+        std::string_view view;
+        uint64_t offset = 0;
+        while (reader.next(view)) {
+            REQUIRE(reader.line_offset() == offset);
+            offset += view.size() + 1;
+        }
+    }
+
+    SECTION("missing file") {
+        GCodeLineReader reader("/nonexistent/path/file.gcode");
+        std::string_view view;
+        REQUIRE_FALSE(reader.is_open());
+        REQUIRE_FALSE(reader.next(view));
+    }
+}
+
+// =============================================================================
+// Benchmark
+// =============================================================================
+//
+// Run with: ./build/bin/helix-tests "[tokenizer][.benchmark]" -s
+// Uses HELIX_BENCH_GCODE if set, otherwise 3DBenchy repeated to ~100 MB.
+
+namespace {
+
+/// The tokenizing done per line before the shared tokenizer existed
+struct LegacyTokenizer {
+    static bool extract_param(const std::string& line, char param, float& out_value) {
+        size_t pos = line.find(param);
+        if (pos == std::string::npos || (pos > 0 && line[pos - 1] != ' ')) {
+            return false;
+        }
+        size_t end = pos + 1;
+        while (end < line.length() && (std::isdigit(line[end]) || line[end] == '.' ||
+                                       line[end] == '-' || line[end] == '+')) {
+            end++;
+        }
+        try {
+            out_value = std::stof(line.substr(pos + 1, end - pos - 1));
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }
+
+    static std::string trim_line(const std::string& line) {
+        size_t comment_pos = line.find(';');
+        std::string code = comment_pos != std::string::npos ? line.substr(0, comment_pos) : line;
+        size_t start = code.find_first_not_of(" \t\r\n");
+        if (start == std::string::npos) {
+            return "";
+        }
+        return code.substr(start, code.find_last_not_of(" \t\r\n") - start + 1);
+    }
+};
+
+double mb_per_sec(size_t bytes, std::chrono::steady_clock::duration elapsed) {
+    return static_cast<double>(bytes) / 1e6 / std::chrono::duration<double>(elapsed).count();
+}
+
+} // namespace
+
+TEST_CASE("GCode tokenizer: throughput", "[gcode][tokenizer][.benchmark]") {
+    std::string path;
+    std::unique_ptr<TempFile> generated;
+    if (const char* env = std::getenv("HELIX_BENCH_GCODE")) {
+        path = env;
+    } else {
+        std::ifstream src("assets/test_gcodes/3DBenchy.gcode", std::ios::binary);
+        if (!src.good()) {
+            SKIP("Test G-code file not found (run from project root)");
+        }
+        std::stringstream buffer;
+        buffer << src.rdbuf();
+        std::string one = buffer.str();
+        std::string big;
+        big.reserve(100 * 1000 * 1000 + one.size());
+        while (big.size() < 100 * 1000 * 1000) {
+            big += one;
+        }
+        generated = std::make_unique<TempFile>(big);
+        path = generated->path();
+    }
+
+    using Clock = std::chrono::steady_clock;
+    size_t bytes = 0;
+    size_t params_before = 0;
+    size_t params_after = 0;
+    float v = 0.0f;
+
+    // Before: std::getline + std::string trim + find/stof per parameter
+    auto t0 = Clock::now();
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::string line;
+        while (std::getline(file, line)) {
+            bytes += line.size() + 1;
+            std::string code = LegacyTokenizer::trim_line(line);
+            for (char axis : {'X', 'Y', 'Z', 'E'}) {
+                params_before += LegacyTokenizer::extract_param(code, axis, v);
+            }
+        }
+    }
+    auto before = Clock::now() - t0;
+
+    // After: GCodeLineReader + one-pass tokenizer
+    t0 = Clock::now();
+    {
+        GCodeLineReader reader(path);
+        std::string_view line;
+        while (reader.next(line)) {
+            GCodeTokens tokens = tokenize_gcode_line(line);
+            for (auto axis : {GCodeAxis::X, GCodeAxis::Y, GCodeAxis::Z, GCodeAxis::E}) {
+                params_after += tokens.param(axis, v);
+            }
+        }
+    }
+    auto after = Clock::now() - t0;
+
+    t0 = Clock::now();
+    GCodeLayerIndex index;
+    REQUIRE(index.build_from_file(path));
+    auto index_time = Clock::now() - t0;
+
+    t0 = Clock::now();
+    {
+        GCodeParser parser;
+        GCodeLineReader reader(path);
+        std::string_view line;
+        while (reader.next(line)) {
+            parser.parse_line(line);
+        }
+        auto result = parser.finalize();
+        CHECK(!result.layers.empty());
+    }
+    auto parse_time = Clock::now() - t0;
+
+    std::printf("G-code tokenizer (%s), %.1f MB:\n", gcode_tokenizer_backend(),
+                static_cast<double>(bytes) / 1e6);
+    std::printf("  tokenize: getline+stof %.0f MB/s, tokenizer %.0f MB/s\n",
+                mb_per_sec(bytes, before), mb_per_sec(bytes, after));
+    std::printf("  layer index: %.0f MB/s (%zu layers)\n", mb_per_sec(bytes, index_time),
+                index.get_layer_count());
+    std::printf("  full parse: %.0f MB/s\n", mb_per_sec(bytes, parse_time));
+
+    CHECK(params_after == params_before);
+}
@@ -0,0 +1,160 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ui_history_list_view.h"
+
+#include "../lvgl_test_fixture.h"
+#include "../lvgl_ui_test_fixture.h"
+
+#include <cstdint>
+#include <string>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::ui;
+
+// ============================================================================
+// Unit Tests (LVGLTestFixture - minimal LVGL, no XML)
+// ============================================================================
+
+TEST_CASE_METHOD(LVGLTestFixture, "HistoryListView - setup with null container",
+                 "[history_list_view]") {
+    HistoryListView view;
+    REQUIRE(view.setup(nullptr, nullptr, nullptr) == false);
+    REQUIRE(view.is_initialized() == false);
+}
+
+TEST_CASE_METHOD(LVGLTestFixture, "HistoryListView - setup with valid container",
+                 "[history_list_view]") {
+    HistoryListView view;
+    lv_obj_t* container = lv_obj_create(test_screen());
+    REQUIRE(view.setup(container, nullptr, nullptr) == true);
+    REQUIRE(view.container() == container);
+}
+
+TEST_CASE_METHOD(LVGLTestFixture, "HistoryListView - cleanup is safe to call twice",
+                 "[history_list_view]") {
+    HistoryListView view;
+    lv_obj_t* container = lv_obj_create(test_screen());
+    view.setup(container, nullptr, nullptr);
+    view.cleanup();
+    view.cleanup(); // Should not crash
+    REQUIRE(view.is_initialized() == false);
+    REQUIRE(view.container() == nullptr);
+}
+
+TEST_CASE_METHOD(LVGLTestFixture, "HistoryListView - constants are reasonable",
+                 "[history_list_view]") {
+    REQUIRE(HistoryListView::BUFFER_ROWS == 2);
+    REQUIRE(HistoryListView::POOL_SIZE > HistoryListView::BUFFER_ROWS * 2);
+}
+
+TEST_CASE_METHOD(LVGLTestFixture, "HistoryListView - update/refresh with no data",
+                 "[history_list_view]") {
+    HistoryListView view;
+    lv_obj_t* container = lv_obj_create(test_screen());
+    view.setup(container, nullptr, nullptr);
+
+    std::vector<PrintHistoryJob> jobs;
+    std::vector<size_t> order;
+    view.update_visible(jobs, order);  // Should not crash
+    view.refresh_content(jobs, order); // Should not crash
+}
+
+TEST_CASE("HistoryListView - status presentation", "[history_list_view]") {
+    REQUIRE(std::string(HistoryListView::status_text(PrintJobStatus::ERROR)) == "Failed");
+    REQUIRE(std::string(HistoryListView::status_text(PrintJobStatus::UNKNOWN)) == "Unknown");
+    REQUIRE(std::string(HistoryListView::status_color(PrintJobStatus::COMPLETED)) == "#00C853");
+    REQUIRE(std::string(HistoryListView::status_color(PrintJobStatus::UNKNOWN)) == "#9E9E9E");
+}
+
+// ============================================================================
+// Integration Tests (LVGLUITestFixture - full XML component registration)
+// ============================================================================
+
+static std::vector<PrintHistoryJob> make_test_jobs(int count) {
+    std::vector<PrintHistoryJob> jobs;
+    jobs.reserve(count);
+    for (int i = 0; i < count; i++) {
+        PrintHistoryJob job;
+        job.job_id = std::to_string(i);
+        job.filename = "job_" + std::to_string(i) + ".gcode";
+        job.status = (i % 3 == 0) ? PrintJobStatus::ERROR : PrintJobStatus::COMPLETED;
+        job.date_str = "Jan 1, 12:00";
+        job.duration_str = "1h 0m";
+        jobs.push_back(job);
+    }
+    return jobs;
+}
+
+static lv_obj_t* make_scroll_container(lv_obj_t* parent) {
+    lv_obj_t* container = lv_obj_create(parent);
+    lv_obj_set_size(container, 400, 300);
+    lv_obj_add_flag(container, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_flex_flow(container, LV_FLEX_FLOW_COLUMN);
+    return container;
+}
+
+TEST_CASE_METHOD(LVGLUITestFixture, "HistoryListView - 500 jobs use a fixed row pool",
+                 "[history_list_view][ui_integration]") {
+    HistoryListView view;
+    lv_obj_t* container = make_scroll_container(test_screen());
+    view.setup(container, container, nullptr);
+
+    auto jobs = make_test_jobs(500);
+    std::vector<size_t> order(jobs.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    view.populate(jobs, order);
+    process_lvgl(50);
+
+    REQUIRE(view.is_initialized() == true);
+    // Pool rows plus leading/trailing spacers, not one widget per job
+    REQUIRE(lv_obj_get_child_count(container) ==
+            static_cast<uint32_t>(HistoryListView::POOL_SIZE + 2));
+
+    // Scrolling to the end recycles rows instead of creating more
+    lv_obj_scroll_to_y(container, lv_obj_get_scroll_bottom(container), LV_ANIM_OFF);
+    view.update_visible(jobs, order);
+    process_lvgl(50);
+
+    int start = -1;
+    int end = -1;
+    view.get_visible_range(start, end);
+    REQUIRE(end == 500);
+    REQUIRE(start > 0);
+    REQUIRE(lv_obj_get_child_count(container) ==
+            static_cast<uint32_t>(HistoryListView::POOL_SIZE + 2));
+}
+
+TEST_CASE_METHOD(LVGLUITestFixture, "HistoryListView - rows bind through the display order",
+                 "[history_list_view][ui_integration]") {
+    lv_obj_t* container = make_scroll_container(test_screen());
+    size_t clicked = SIZE_MAX;
+    HistoryListView view;
+    view.setup(container, container, [&clicked](size_t index) { clicked = index; });
+
+    auto jobs = make_test_jobs(20);
+    std::vector<size_t> order = {7, 3, 12};
+    view.populate(jobs, order);
+    process_lvgl(50);
+
+    // Child 0 is the leading spacer; the first pooled row shows order[0]
+    lv_obj_t* first_row = lv_obj_get_child(container, 1);
+    REQUIRE(first_row != nullptr);
+    lv_obj_t* filename = lv_obj_find_by_name(first_row, "row_filename");
+    REQUIRE(filename != nullptr);
+    REQUIRE(std::string(lv_label_get_text(filename)) == "job_7.gcode");
+
+    lv_obj_t* second_row = lv_obj_get_child(container, 2);
+    lv_obj_send_event(second_row, LV_EVENT_CLICKED, nullptr);
+    REQUIRE(clicked == 1);
+
+    // Re-filtering rebinds the same widgets
+    order = {12};
+    view.populate(jobs, order);
+    process_lvgl(50);
+    REQUIRE(std::string(lv_label_get_text(filename)) == "job_12.gcode");
+    REQUIRE(lv_obj_has_flag(second_row, LV_OBJ_FLAG_HIDDEN));
+}
@@ -0,0 +1,225 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "http_executor.h"
+
+#include "../catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace helix;
+
+namespace {
+
+/// One-shot gate that jobs can block on
+class Gate {
+  public:
+    void open() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open_ = true;
+        cv_.notify_all();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return open_; });
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool open_{false};
+};
+
+/// Poll until pred() or a 5s deadline
+template <typename Pred> bool eventually(Pred pred) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+/// Records the order jobs ran in
+struct RunLog {
+    std::mutex mutex;
+    std::vector<std::string> order;
+
+    HttpExecutor::Job job(std::string name) {
+        return [this, name](HttpSession&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(name);
+        };
+    }
+};
+
+} // namespace
+
+TEST_CASE("HttpExecutor: runs by priority, FIFO within a priority", "[api][http_executor]") {
+    HttpExecutor executor(1);
+    Gate gate;
+    std::atomic<bool> blocker_running{false};
+    executor.submit([&](HttpSession&) {
+        blocker_running = true;
+        gate.wait();
+    });
+    REQUIRE(eventually([&] { return blocker_running.load(); }));
+
+    RunLog log;
+    executor.submit(log.job("bulk"), {HttpPriority::BULK, nullptr});
+    executor.submit(log.job("normal1"));
+    executor.submit(log.job("visible1"), {HttpPriority::VISIBLE, nullptr});
+    executor.submit(log.job("normal2"));
+    executor.submit(log.job("visible2"), {HttpPriority::VISIBLE, nullptr});
+    REQUIRE(executor.metrics().queue_depth == 5);
+
+    gate.open();
+    REQUIRE(eventually([&] { return executor.metrics().completed == 6; }));
+    REQUIRE(log.order ==
+            std::vector<std::string>{"visible1", "visible2", "normal1", "normal2", "bulk"});
+    REQUIRE(executor.metrics().peak_queue_depth == 5);
+}
+
+TEST_CASE("HttpExecutor: still_wanted drops queued jobs", "[api][http_executor]") {
+    HttpExecutor executor(1);
+    Gate gate;
+    std::atomic<bool> blocker_running{false};
+    executor.submit([&](HttpSession&) {
+        blocker_running = true;
+        gate.wait();
+    });
+    REQUIRE(eventually([&] { return blocker_running.load(); }));
+
+    RunLog log;
+    // Decided when the job is picked, not when it is queued
+    std::atomic<bool> wanted{true};
+    executor.submit(log.job("unwanted"), {HttpPriority::VISIBLE, [] { return false; }});
+    executor.submit(log.job("abandoned"), {HttpPriority::NORMAL, [&] { return wanted.load(); }});
+    executor.submit(log.job("kept"));
+    REQUIRE_FALSE(executor.submit(nullptr));
+    wanted = false;
+
+    gate.open();
+    REQUIRE(eventually([&] { return executor.metrics().queue_depth == 0; }));
+    REQUIRE(eventually([&] { return executor.metrics().active == 0; }));
+
+    auto metrics = executor.metrics();
+    REQUIRE(log.order == std::vector<std::string>{"kept"});
+    REQUIRE(metrics.submitted == 4);
+    REQUIRE(metrics.completed == 2);
+    REQUIRE(metrics.dropped == 2);
+}
+
+TEST_CASE("HttpExecutor: worker and BULK caps", "[api][http_executor]") {
+    HttpExecutor executor(3);
+    REQUIRE(executor.max_workers() == 3);
+    REQUIRE(executor.max_bulk() == 2);
+
+    Gate gate;
+    std::atomic<int> running{0};
+    std::atomic<int> bulk_running{0};
+    std::atomic<int> peak{0};
+    std::atomic<int> bulk_peak{0};
+    auto track = [](std::atomic<int>& now, std::atomic<int>& high) {
+        int value = ++now;
+        int prev = high.load();
+        while (value > prev && !high.compare_exchange_weak(prev, value)) {
+        }
+    };
+
+    for (int i = 0; i < 4; ++i) {
+        executor.submit(
+            [&](HttpSession&) {
+                track(running, peak);
+                track(bulk_running, bulk_peak);
+                gate.wait();
+                --bulk_running;
+                --running;
+            },
+            {HttpPriority::BULK, nullptr});
+    }
+    REQUIRE(eventually([&] { return bulk_running.load() == 2; }));
+
+    // The third worker stays free for interactive requests
+    std::atomic<bool> visible_ran{false};
+    executor.submit([&](HttpSession&) { visible_ran = true; }, {HttpPriority::VISIBLE, nullptr});
+    REQUIRE(eventually([&] { return visible_ran.load(); }));
+
+    gate.open();
+    REQUIRE(eventually([&] { return executor.metrics().completed == 5; }));
+    REQUIRE(bulk_peak.load() == 2);
+    REQUIRE(peak.load() <= 3);
+    REQUIRE(executor.metrics().workers <= 3);
+}
+
+TEST_CASE("HttpExecutor: workers start lazily", "[api][http_executor]") {
+    HttpExecutor executor(4);
+    REQUIRE(executor.metrics().workers == 0);
+
+    std::atomic<int> ran{0};
+    executor.submit([&](HttpSession&) { ++ran; });
+    REQUIRE(eventually([&] { return ran.load() == 1; }));
+    REQUIRE(executor.metrics().workers == 1);
+}
+
+TEST_CASE("HttpExecutor: shutdown drops the queue and bounds the wait",
+          "[api][http_executor][slow]") {
+    HttpExecutor executor(1);
+    auto release = std::make_shared<std::atomic<bool>>(false);
+    std::atomic<bool> started{false};
+    executor.submit([release, &started](HttpSession&) {
+        started = true;
+        // Simulates a stuck transfer; polls so the detached thread exits at test end
+        while (!release->load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    });
+    REQUIRE(eventually([&] { return started.load(); }));
+
+    RunLog log;
+    executor.submit(log.job("queued"));
+
+    auto start = std::chrono::steady_clock::now();
+    REQUIRE_FALSE(executor.shutdown(std::chrono::milliseconds(100)));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    REQUIRE(elapsed < std::chrono::seconds(2));
+
+    REQUIRE_FALSE(executor.submit(log.job("late")));
+    REQUIRE(executor.metrics().dropped == 1);
+    release->store(true);
+    REQUIRE(log.order.empty());
+}
+
+TEST_CASE("HttpExecutor: idle shutdown joins cleanly", "[api][http_executor]") {
+    HttpExecutor executor(2);
+    std::atomic<int> ran{0};
+    for (int i = 0; i < 8; ++i) {
+        executor.submit([&](HttpSession&) { ++ran; });
+    }
+    REQUIRE(eventually([&] { return ran.load() == 8; }));
+    REQUIRE(executor.shutdown(std::chrono::seconds(2)));
+    REQUIRE(executor.shutdown(std::chrono::seconds(2))); // Idempotent
+}
+
+TEST_CASE("HttpSession: connection key per scheme, host and port", "[api][http_executor]") {
+    REQUIRE(HttpSession::host_key("http://192.168.1.10:7125/server/files/gcodes/a.png") ==
+            "http://192.168.1.10:7125");
+    REQUIRE(HttpSession::host_key("http://printer.local/machine/update") ==
+            "http://printer.local:80");
+    REQUIRE(HttpSession::host_key("http://printer.local:80?x=1") == "http://printer.local:80");
+    REQUIRE(HttpSession::host_key("HTTPS://example.com/") == "https://example.com:443");
+    REQUIRE(HttpSession::host_key("http://[fe80::1]:7125/x") == "http://[fe80::1]:7125");
+    REQUIRE(HttpSession::host_key("http://[fe80::1]/x") == "http://[fe80::1]:80");
+    REQUIRE(HttpSession::host_key("printer.local/x").empty());
+    REQUIRE(HttpSession::host_key("http:///x").empty());
+}
@@ -0,0 +1,173 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "main_loop_waiter.h"
+
+#include <chrono>
+#include <fcntl.h>
+#include <thread>
+#include <unistd.h>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::application;
+using namespace std::chrono_literals;
+
+namespace {
+
+uint32_t elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     std::chrono::steady_clock::now() - start)
+                                     .count());
+}
+
+LoopWakeResult input_wakeup() {
+    LoopWakeResult r;
+    r.input = true;
+    return r;
+}
+
+LoopWakeResult work_wakeup() {
+    LoopWakeResult r;
+    r.woken = true;
+    return r;
+}
+
+} // namespace
+
+// ============================================================================
+// LoopWaiter
+// ============================================================================
+
+TEST_CASE("LoopWaiter: times out with nothing to do", "[application][main_loop]") {
+    LoopWaiter waiter;
+    REQUIRE(waiter.init());
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = waiter.wait(30);
+    REQUIRE(result.timed_out());
+    REQUIRE(elapsed_ms(start) >= 25);
+}
+
+TEST_CASE("LoopWaiter: wake() from another thread cuts the wait short",
+          "[application][main_loop]") {
+    LoopWaiter waiter;
+    REQUIRE(waiter.init());
+
+    std::thread producer([&waiter]() {
+        std::this_thread::sleep_for(20ms);
+        waiter.wake();
+    });
+    auto start = std::chrono::steady_clock::now();
+    auto result = waiter.wait(5000);
+    producer.join();
+
+    REQUIRE(result.woken);
+    REQUIRE_FALSE(result.input);
+    REQUIRE(elapsed_ms(start) < 2000);
+
+    SECTION("repeated wakes collapse and are drained") {
+        waiter.wake();
+        waiter.wake();
+        waiter.wake();
+        REQUIRE(waiter.wait(0).woken);
+        REQUIRE(waiter.wait(0).timed_out());
+    }
+}
+
+TEST_CASE("LoopWaiter: readable input wakes and is drained", "[application][main_loop]") {
+    LoopWaiter waiter;
+    REQUIRE(waiter.init());
+
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    ::fcntl(fds[0], F_SETFL, O_NONBLOCK);
+    REQUIRE(waiter.watch_input_fd(fds[0]));
+    REQUIRE(waiter.input_count() == 1);
+
+    char event[24] = {};
+    REQUIRE(::write(fds[1], event, sizeof(event)) == sizeof(event));
+
+    auto result = waiter.wait(1000);
+    REQUIRE(result.input);
+    REQUIRE_FALSE(result.woken);
+    REQUIRE(waiter.wait(0).timed_out()); // Our copy was consumed
+
+    SECTION("a vanished device stops being watched") {
+        ::close(fds[1]);
+        waiter.wait(0);
+        REQUIRE(waiter.input_count() == 0);
+    }
+    SECTION("open writer keeps the fd watched") {
+        REQUIRE(waiter.input_count() == 1);
+        ::close(fds[1]);
+    }
+}
+
+TEST_CASE("LoopWaiter: missing device is not watched", "[application][main_loop]") {
+    LoopWaiter waiter;
+    REQUIRE(waiter.init());
+    REQUIRE_FALSE(waiter.watch_input("/dev/input/helix-no-such-device"));
+    REQUIRE_FALSE(waiter.watch_input(""));
+    REQUIRE(waiter.input_count() == 0);
+}
+
+// ============================================================================
+// LoopStats
+// ============================================================================
+
+TEST_CASE("LoopStats: wakeups without a frame count as idle", "[application][main_loop]") {
+    LoopStats stats;
+    stats.start(0);
+
+    stats.record_wakeup(LoopWakeResult{}, 100); // Timer, nothing drawn
+    stats.record_wakeup(work_wakeup(), 200);    // Work, drew a frame
+    stats.record_frame(205);
+    stats.record_wakeup(input_wakeup(), 300); // Input never counts as idle
+    stats.record_wakeup(LoopWakeResult{}, 400);
+
+    auto report = stats.take_report(1000);
+    REQUIRE(report.elapsed_ms == 1000);
+    REQUIRE(report.wakeups == 4);
+    REQUIRE(report.timer_wakeups == 2);
+    REQUIRE(report.work_wakeups == 1);
+    REQUIRE(report.input_wakeups == 1);
+    REQUIRE(report.frames == 1);
+    REQUIRE(report.idle_wakeups == 1);
+    REQUIRE(report.wakeups_per_sec() == Catch::Approx(4.0));
+
+    // The last timer wakeup is settled in the next window
+    stats.record_wakeup(LoopWakeResult{}, 1100);
+    REQUIRE(stats.current().idle_wakeups == 1);
+}
+
+TEST_CASE("LoopStats: input-to-frame latency histogram", "[application][main_loop]") {
+    LoopStats stats;
+    stats.start(0);
+
+    // 5ms, 20ms, 120ms
+    stats.record_wakeup(input_wakeup(), 100);
+    stats.record_frame(105);
+    stats.record_wakeup(input_wakeup(), 200);
+    stats.record_wakeup(input_wakeup(), 210); // Still the same unanswered input
+    stats.record_frame(220);
+    stats.record_wakeup(input_wakeup(), 300);
+    stats.record_frame(420);
+
+    // Input that never drew anything is dropped
+    stats.record_wakeup(input_wakeup(), 1000);
+    stats.record_wakeup(input_wakeup(), 2500);
+    stats.record_frame(2504);
+
+    auto report = stats.take_report(3000);
+    REQUIRE(report.latency_samples == 4);
+    REQUIRE(report.latency_histogram[0] == 2); // <8ms
+    REQUIRE(report.latency_histogram[2] == 1); // 16-33ms
+    REQUIRE(report.latency_histogram[5] == 1); // 100-250ms
+    REQUIRE(report.latency_max_ms == 120);
+    REQUIRE(report.latency_percentile_ms(0.5) == 8);
+    REQUIRE(report.latency_percentile_ms(0.95) == 250);
+    REQUIRE(report.to_string().find("input->frame n=4") != std::string::npos);
+
+    REQUIRE(stats.take_report(4000).latency_samples == 0);
+}
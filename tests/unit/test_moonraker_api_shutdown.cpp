@@ -28,13 +28,13 @@
 
 using namespace helix;
 // ============================================================================
-// Test Fixture - Exposes launch_http_thread for testing
+// Test Fixture - Exposes launch_http_request for testing
 // ============================================================================
 
 /**
  * @brief Test-specific MoonrakerAPI subclass that exposes protected methods
  *
- * The launch_http_thread method is private, so we use a friend-like pattern
+ * The launch_http_request method is private, so we use a friend-like pattern
  * by adding a public test-only method that mimics the behavior.
  */
 class TestableMoonrakerAPI : public MoonrakerAPI {
@@ -63,7 +63,7 @@ class TestableMoonrakerAPI : public MoonrakerAPI {
             }
         });
 
-        // Track the thread using the same mechanism as launch_http_thread
+        // Track the thread using the same timed-join shutdown as the HTTP executor
         // We can't call the private method directly, so we store in our own list
         blocking_threads_.push_back(std::move(blocking_thread));
     }
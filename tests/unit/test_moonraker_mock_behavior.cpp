@@ -3240,3 +3240,47 @@ TEST_CASE("MoonrakerClientMock gcode_script returns non-zero on error", "[mock][
 }
 
 #pragma GCC diagnostic pop
+
+// ============================================================================
+// Status Fan-out Tests
+// ============================================================================
+
+TEST_CASE("MoonrakerClientMock status fan-out shares one notification", "[mock][fanout]") {
+    TestableMoonrakerMock mock(MoonrakerClientMock::PrinterType::VORON_24);
+
+    std::vector<const json*> seen;
+    mock.register_status_delta([&seen](const StatusDelta& delta) { seen.push_back(delta.get()); });
+    mock.register_status_delta([&seen](const StatusDelta& delta) { seen.push_back(delta.get()); });
+
+    int legacy_calls = 0;
+    double legacy_temp = 0.0;
+    mock.register_notify_update([&](json notification) {
+        legacy_calls++;
+        legacy_temp = notification["params"][0]["extruder"]["temperature"].get<double>();
+    });
+
+    auto before = mock.get_status_fanout_stats();
+    mock.dispatch_status_update({{"extruder", {{"temperature", 215.0}}}});
+    auto after = mock.get_status_fanout_stats();
+
+    SECTION("zero-copy subscribers receive the same instance") {
+        REQUIRE(seen.size() == 2);
+        REQUIRE(seen[0] == seen[1]);
+    }
+
+    SECTION("legacy subscribers still receive a full copy") {
+        REQUIRE(legacy_calls == 1);
+        REQUIRE(legacy_temp == Catch::Approx(215.0));
+    }
+
+    SECTION("counters report legacy copies only") {
+        REQUIRE(after.notifications - before.notifications == 1);
+        REQUIRE(after.deliveries - before.deliveries == 3);
+        REQUIRE(after.legacy_deliveries - before.legacy_deliveries == 1);
+    }
+
+    SECTION("locally built updates add no payload bytes") {
+        REQUIRE(after.bytes_delivered == before.bytes_delivered);
+        REQUIRE(after.bytes_copied == before.bytes_copied);
+    }
+}
@@ -0,0 +1,164 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+/**
+ * @file test_mpsc_ring.cpp
+ * @brief Unit tests for MpscRing and SmallCallback
+ */
+
+#include "mpsc_ring.h"
+#include "small_callback.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix;
+
+// ============================================================================
+// SmallCallback
+// ============================================================================
+
+TEST_CASE("SmallCallback: small captures are stored inline", "[mpsc_ring][small_callback]") {
+    int hits = 0;
+    SmallCallback<> cb([&hits] { ++hits; });
+    REQUIRE(cb);
+    REQUIRE(cb.is_inline());
+    cb();
+    REQUIRE(hits == 1);
+
+    SmallCallback<> moved(std::move(cb));
+    REQUIRE_FALSE(cb);
+    moved();
+    REQUIRE(hits == 2);
+}
+
+TEST_CASE("SmallCallback: large captures fall back to the heap", "[mpsc_ring][small_callback]") {
+    std::array<char, 128> big{};
+    big[0] = 'x';
+    char seen = 0;
+    SmallCallback<> cb([big, &seen] { seen = big[0]; });
+    REQUIRE_FALSE(cb.is_inline());
+
+    SmallCallback<> moved;
+    moved = std::move(cb);
+    moved();
+    REQUIRE(seen == 'x');
+}
+
+TEST_CASE("SmallCallback: captured state is destroyed exactly once",
+          "[mpsc_ring][small_callback]") {
+    auto token = std::make_shared<int>(7);
+    std::weak_ptr<int> watch = token;
+    {
+        SmallCallback<> cb([t = std::move(token)] { (void)t; });
+        SmallCallback<> other(std::move(cb));
+        SmallCallback<> third;
+        third = std::move(other);
+        REQUIRE_FALSE(watch.expired());
+    }
+    REQUIRE(watch.expired());
+}
+
+TEST_CASE("SmallCallback: move-only captures", "[mpsc_ring][small_callback]") {
+    auto value = std::make_unique<int>(42);
+    int out = 0;
+    SmallCallback<> cb([v = std::move(value), &out] { out = *v; });
+    REQUIRE(cb.is_inline());
+    cb();
+    REQUIRE(out == 42);
+}
+
+// ============================================================================
+// MpscRing
+// ============================================================================
+
+TEST_CASE("MpscRing: FIFO and capacity", "[mpsc_ring]") {
+    MpscRing<int> ring(5);
+    REQUIRE(ring.capacity() == 8);
+
+    for (int i = 0; i < 8; ++i) {
+        int v = i;
+        REQUIRE(ring.try_push(std::move(v)));
+    }
+    int overflow = 99;
+    REQUIRE_FALSE(ring.try_push(std::move(overflow)));
+    REQUIRE(ring.size_approx() == 8);
+
+    int out = -1;
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(ring.try_pop(out));
+        REQUIRE(out == i);
+    }
+    REQUIRE_FALSE(ring.try_pop(out));
+
+    // Wraps around after draining
+    int again = 8;
+    REQUIRE(ring.try_push(std::move(again)));
+    REQUIRE(ring.try_pop(out));
+    REQUIRE(out == 8);
+}
+
+TEST_CASE("MpscRing: destroys items left in the ring", "[mpsc_ring]") {
+    auto token = std::make_shared<int>(1);
+    std::weak_ptr<int> watch = token;
+    {
+        MpscRing<std::shared_ptr<int>> ring(4);
+        REQUIRE(ring.try_push(std::move(token)));
+    }
+    REQUIRE(watch.expired());
+}
+
+TEST_CASE("MpscRing: concurrent producers keep per-producer order", "[mpsc_ring][stress]") {
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 50000;
+
+    struct Item {
+        int producer = 0;
+        int index = 0;
+    };
+    MpscRing<Item> ring(64); // Small ring so producers regularly find it full
+
+    std::atomic<bool> go{false};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&ring, &go, p] {
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                Item item{p, i};
+                while (!ring.try_push(std::move(item))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> next(PRODUCERS, 0);
+    int received = 0;
+    bool in_order = true;
+    go.store(true);
+    Item item;
+    while (received < PRODUCERS * PER_PRODUCER) {
+        if (!ring.try_pop(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (item.index != next[static_cast<size_t>(item.producer)]) {
+            in_order = false;
+        }
+        next[static_cast<size_t>(item.producer)] = item.index + 1;
+        ++received;
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    REQUIRE(in_order);
+    REQUIRE(received == PRODUCERS * PER_PRODUCER);
+    REQUIRE_FALSE(ring.try_pop(item));
+}
@@ -0,0 +1,128 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "printer_status_router.h"
+
+#include <string>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix;
+using json = nlohmann::json;
+
+TEST_CASE("PrinterStatusRouter: delta visits only owning routes", "[core][state][router]") {
+    PrinterStatusRouter router;
+    std::vector<std::string> calls;
+
+    router.add_route("temperature",
+                     PrinterStatusRouter::match_objects({"heater_bed"}, {"extruder"}),
+                     [&](const json&) { calls.push_back("temperature"); });
+    router.add_route("motion", PrinterStatusRouter::match_objects({"toolhead", "gcode_move"}),
+                     [&](const json&) { calls.push_back("motion"); });
+    router.add_route("fan", PrinterStatusRouter::match_objects({"fan"}, {"heater_fan "}),
+                     [&](const json&) { calls.push_back("fan"); });
+
+    SECTION("single key") {
+        REQUIRE(router.dispatch(json{{"extruder1", {{"temperature", 210.0}}}}) == 1);
+        REQUIRE(calls == std::vector<std::string>{"temperature"});
+    }
+
+    SECTION("multiple keys owned by one route invoke it once") {
+        json delta = {{"extruder", {{"temperature", 210.0}}}, {"heater_bed", {{"target", 60}}}};
+        REQUIRE(router.dispatch(delta) == 1);
+        REQUIRE(calls == std::vector<std::string>{"temperature"});
+    }
+
+    SECTION("routes run in registration order") {
+        json delta = {{"heater_fan hotend", {{"speed", 1.0}}},
+                      {"toolhead", {{"homed_axes", "xyz"}}},
+                      {"extruder", {{"temperature", 200.0}}}};
+        REQUIRE(router.dispatch(delta) == 3);
+        REQUIRE(calls == std::vector<std::string>{"temperature", "motion", "fan"});
+    }
+
+    SECTION("prefix matching does not bleed into exact names") {
+        // "fan" is exact; "fan_generic chamber" is not owned by the fan route
+        REQUIRE(router.dispatch(json{{"fan_generic chamber", {{"speed", 0.5}}}}) == 0);
+        REQUIRE(calls.empty());
+    }
+
+    SECTION("empty and non-object deltas are ignored") {
+        REQUIRE(router.dispatch(json::object()) == 0);
+        REQUIRE(router.dispatch(json::array()) == 0);
+        REQUIRE(calls.empty());
+    }
+}
+
+TEST_CASE("PrinterStatusRouter: unclaimed keys go to fallback routes", "[core][state][router]") {
+    PrinterStatusRouter router;
+    int owned = 0;
+    int fallback = 0;
+
+    router.add_route("motion", PrinterStatusRouter::match_objects({"toolhead"}),
+                     [&](const json&) { ++owned; });
+    router.add_route(
+        "color_sensors", nullptr, [&](const json&) { ++fallback; }, /*fallback=*/true);
+
+    router.dispatch(json{{"toolhead", {{"position", {0, 0, 0, 0}}}}});
+    REQUIRE(owned == 1);
+    REQUIRE(fallback == 0);
+
+    router.dispatch(json{{"td1 A1B2C3", {{"color", "#ff0000"}}}});
+    REQUIRE(owned == 1);
+    REQUIRE(fallback == 1);
+
+    // Mixed delta: both the owner and the fallback run
+    router.dispatch(json{{"toolhead", json::object()}, {"td1 A1B2C3", json::object()}});
+    REQUIRE(owned == 2);
+    REQUIRE(fallback == 2);
+}
+
+TEST_CASE("PrinterStatusRouter: key resolution is cached", "[core][state][router]") {
+    PrinterStatusRouter router;
+    int matcher_calls = 0;
+
+    router.add_route(
+        "motion",
+        [&](const std::string& key) {
+            ++matcher_calls;
+            return key == "toolhead";
+        },
+        [](const json&) {});
+
+    router.prime({"toolhead", "extruder", "heater_bed"});
+    REQUIRE(router.cached_key_count() == 3);
+    REQUIRE(matcher_calls == 3);
+
+    REQUIRE(router.routes_for_key("toolhead") == 0b1);
+    REQUIRE(router.routes_for_key("extruder") == 0);
+
+    for (int i = 0; i < 10; ++i) {
+        router.dispatch(json{{"toolhead", json::object()}, {"extruder", json::object()}});
+    }
+    REQUIRE(matcher_calls == 3);
+
+    SECTION("adding a route re-resolves keys") {
+        router.add_route("temperature", PrinterStatusRouter::match_objects({}, {"extruder"}),
+                         [](const json&) {});
+        REQUIRE(router.cached_key_count() == 0);
+        REQUIRE(router.routes_for_key("extruder") == 0b10);
+    }
+
+    SECTION("invalidate drops cache") {
+        router.invalidate();
+        REQUIRE(router.cached_key_count() == 0);
+        router.dispatch(json{{"toolhead", json::object()}});
+        REQUIRE(matcher_calls == 4);
+    }
+}
+
+TEST_CASE("PrinterStatusRouter: route limit is enforced", "[core][state][router]") {
+    PrinterStatusRouter router;
+    for (size_t i = 0; i < PrinterStatusRouter::MAX_ROUTES; ++i) {
+        REQUIRE(router.add_route("r" + std::to_string(i), nullptr, [](const json&) {}));
+    }
+    REQUIRE_FALSE(router.add_route("overflow", nullptr, [](const json&) {}));
+    REQUIRE(router.route_count() == PrinterStatusRouter::MAX_ROUTES);
+}
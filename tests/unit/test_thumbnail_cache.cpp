@@ -14,6 +14,7 @@
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <vector>
 
 #include "../catch_amalgamated.hpp"
 
@@ -210,14 +211,11 @@ TEST_CASE("ThumbnailCache age validation", "[assets][cache][invalidation]") {
     std::string test_path = "test_age_validation_" + std::to_string(rand()) + ".png";
     std::string cache_path = cache.get_cache_path(test_path);
 
-    // Create a cached file
+    // Create a cached file through the cache so its index records it
     {
-        std::ofstream ofs(cache_path, std::ios::binary);
-        REQUIRE(ofs.good());
-        // Write minimal valid PNG header
-        const unsigned char png_header[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A};
-        ofs.write(reinterpret_cast<const char*>(png_header), sizeof(png_header));
-        ofs.close();
+        // Minimal valid PNG header
+        const std::vector<uint8_t> png_header = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A};
+        REQUIRE(!cache.save_raw_png(test_path, png_header).empty());
     }
 
     SECTION("get_if_cached without source_modified returns cached file") {
@@ -0,0 +1,234 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "thumbnail_index.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../catch_amalgamated.hpp"
+#include "../test_helpers/temp_cache_dir.h"
+
+using helix::ThumbnailIndex;
+using helix::test::TempCacheDir;
+
+TEST_CASE("ThumbnailIndex: builds from a directory without a journal", "[assets][cache][index]") {
+    TempCacheDir dir("test_thumbnail_index");
+    dir.write("a.png", 100);
+    dir.write("b_120x120_ARGB8888.bin", 300);
+    dir.write(".helix_write_test", 5); // hidden files are never indexed
+
+    ThumbnailIndex index(dir.path());
+    auto stats = index.load();
+
+    REQUIRE(stats.rebuilt);
+    REQUIRE(stats.adopted == 2);
+    REQUIRE(index.size() == 2);
+    REQUIRE(index.total_bytes() == 400);
+    REQUIRE(std::filesystem::exists(index.journal_path()));
+}
+
+TEST_CASE("ThumbnailIndex: journal survives a restart", "[assets][cache][index]") {
+    TempCacheDir dir("test_thumbnail_index");
+    {
+        ThumbnailIndex index(dir.path());
+        index.load();
+        dir.write("a.png", 100);
+        index.record("a.png", 100, 1000);
+        dir.write("b.png", 200);
+        index.record("b.png", 200, 2000);
+        dir.write("c.png", 300);
+        index.record("c.png", 300);
+        index.erase("c.png");
+    }
+
+    ThumbnailIndex index(dir.path());
+    auto stats = index.load();
+
+    REQUIRE_FALSE(stats.rebuilt);
+    REQUIRE(stats.adopted == 1); // c.png was erased from the index but left on disk
+    REQUIRE(stats.dropped == 0);
+    REQUIRE(index.size() == 3);
+    REQUIRE(index.peek("a.png")->cached_time == 1000);
+    REQUIRE(index.peek("b.png")->size == 200);
+}
+
+TEST_CASE("ThumbnailIndex: reconciles with files changed behind its back",
+          "[assets][cache][index]") {
+    TempCacheDir dir("test_thumbnail_index");
+    {
+        ThumbnailIndex index(dir.path());
+        index.load();
+        dir.write("kept.png", 10);
+        index.record("kept.png", 10);
+        dir.write("deleted.png", 20);
+        index.record("deleted.png", 20);
+    }
+    std::filesystem::remove(dir.path() + "/deleted.png");
+    dir.write("new.png", 30);
+
+    ThumbnailIndex index(dir.path());
+    auto stats = index.load();
+
+    REQUIRE(stats.dropped == 1);
+    REQUIRE(stats.adopted == 1);
+    REQUIRE(index.peek("kept.png"));
+    REQUIRE_FALSE(index.peek("deleted.png"));
+    REQUIRE(index.peek("new.png")->size == 30);
+    REQUIRE(index.total_bytes() == 40);
+}
+
+TEST_CASE("ThumbnailIndex: tolerates a truncated journal line", "[assets][cache][index]") {
+    TempCacheDir dir("test_thumbnail_index");
+    dir.write("a.png", 10);
+    dir.write("b.png", 20);
+    {
+        std::ofstream journal(dir.path() + "/" + ThumbnailIndex::JOURNAL_NAME);
+        journal << "HXTHUMBIDX 1\n"
+                << "+ 10 100 100 a.png\n"
+                << "+ 20 2"; // power lost mid-write
+    }
+
+    ThumbnailIndex index(dir.path());
+    auto stats = index.load();
+
+    REQUIRE_FALSE(stats.rebuilt);
+    REQUIRE(stats.adopted == 1);
+    REQUIRE(index.peek("a.png")->cached_time == 100);
+    REQUIRE(index.total_bytes() == 30);
+}
+
+TEST_CASE("ThumbnailIndex: evicts least recently used first", "[assets][cache][index]") {
+    TempCacheDir dir("test_thumbnail_index");
+    ThumbnailIndex index(dir.path());
+    index.load();
+
+    for (const char* name : {"old.png", "mid.png", "new.png"}) {
+        dir.write(name, 100);
+        index.record(name, 100);
+    }
+    // A hit moves old.png to the back of the queue
+    REQUIRE(index.lookup("old.png"));
+
+    auto [files, bytes] = index.evict_to(150);
+
+    REQUIRE(files == 2);
+    REQUIRE(bytes == 200);
+    REQUIRE(index.total_bytes() == 100);
+    REQUIRE(dir.exists("old.png"));
+    REQUIRE_FALSE(dir.exists("mid.png"));
+    REQUIRE_FALSE(dir.exists("new.png"));
+
+    SECTION("Evicted entries stay gone after a restart") {
+        ThumbnailIndex reloaded(dir.path());
+        reloaded.load();
+        REQUIRE(reloaded.size() == 1);
+        REQUIRE(reloaded.peek("old.png"));
+    }
+}
+
+TEST_CASE("ThumbnailIndex: adopt stats a file once", "[assets][cache][index]") {
+    TempCacheDir dir("test_thumbnail_index");
+    ThumbnailIndex index(dir.path());
+    index.load();
+
+    REQUIRE_FALSE(index.adopt("missing.png"));
+
+    dir.write("late.png", 42);
+    auto entry = index.adopt("late.png");
+    REQUIRE(entry);
+    REQUIRE(entry->size == 42);
+    REQUIRE(index.total_bytes() == 42);
+
+    // Replacing an entry doesn't double-count it
+    index.record("late.png", 50);
+    REQUIRE(index.total_bytes() == 50);
+    REQUIRE(index.size() == 1);
+}
+
+TEST_CASE("ThumbnailIndex: compacts a growing journal", "[assets][cache][index]") {
+    TempCacheDir dir("test_thumbnail_index");
+    ThumbnailIndex index(dir.path());
+    index.load();
+    dir.write("a.png", 1);
+
+    for (int i = 0; i < 5000; ++i) {
+        index.record("a.png", 1);
+    }
+
+    REQUIRE(index.journal_lines() < 5000);
+    REQUIRE(index.size() == 1);
+}
+
+TEST_CASE("ThumbnailIndex: clear drops everything", "[assets][cache][index]") {
+    TempCacheDir dir("test_thumbnail_index");
+    ThumbnailIndex index(dir.path());
+    index.load();
+    dir.write("a.png", 10);
+    index.record("a.png", 10);
+
+    index.clear();
+
+    REQUIRE(index.size() == 0);
+    REQUIRE(index.total_bytes() == 0);
+    REQUIRE(index.journal_lines() == 0);
+}
+
+// Run with: ./build/bin/helix-tests "[index][.benchmark]" -s
+TEST_CASE("ThumbnailIndex: startup and insert cost at 2000 entries",
+          "[assets][cache][index][.benchmark]") {
+    constexpr int kEntries = 2000;
+    constexpr size_t kFileSize = 8 * 1024;
+    TempCacheDir dir("test_thumbnail_index");
+    for (int i = 0; i < kEntries; ++i) {
+        dir.write(std::to_string(i) + ".png", kFileSize);
+    }
+
+    auto ms = [](auto a, auto b) {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    };
+
+    // The scan the index replaces: walk and stat every file
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t scanned = 0;
+    for (const auto& item : std::filesystem::directory_iterator(dir.path())) {
+        if (std::filesystem::is_regular_file(item.path())) {
+            scanned += std::filesystem::file_size(item.path());
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    {
+        ThumbnailIndex cold(dir.path());
+        auto t2 = std::chrono::steady_clock::now();
+        cold.load();
+        auto t3 = std::chrono::steady_clock::now();
+        printf("directory scan %.2fms, index rebuild (no journal) %.2fms\n", ms(t0, t1),
+               ms(t2, t3));
+    }
+
+    ThumbnailIndex index(dir.path());
+    auto t4 = std::chrono::steady_clock::now();
+    auto stats = index.load();
+    auto t5 = std::chrono::steady_clock::now();
+    REQUIRE(stats.entries == kEntries);
+    REQUIRE(index.total_bytes() == scanned);
+
+    // Steady state: each insert records and evicts one entry
+    constexpr int kInserts = 500;
+    auto t6 = std::chrono::steady_clock::now();
+    for (int i = 0; i < kInserts; ++i) {
+        std::string name = "new_" + std::to_string(i) + ".png";
+        dir.write(name, kFileSize);
+        index.record(name, kFileSize);
+        index.evict_to(static_cast<uint64_t>(kEntries) * kFileSize);
+    }
+    auto t7 = std::chrono::steady_clock::now();
+
+    REQUIRE(index.size() == kEntries);
+    printf("index load (journal) %.2fms, insert+evict %.3fms each\n", ms(t4, t5),
+           ms(t6, t7) / kInserts);
+}